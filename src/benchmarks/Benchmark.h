@@ -0,0 +1,40 @@
+#ifndef GEO_NETWORK_CLIENT_BENCHMARK_H
+#define GEO_NETWORK_CLIENT_BENCHMARK_H
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+/*
+ * Runs the benchmark once and prints its total time and time per operation.
+ * operationsCount - count of operations, performed by the benchmark.
+ */
+inline void measure(
+    const string &name,
+    size_t operationsCount,
+    function<void()> benchmark)
+{
+    const auto kStarted = chrono::steady_clock::now();
+    benchmark();
+    const auto kDuration = chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now() - kStarted);
+
+    cout << left << setw(56) << name
+         << right << setw(10) << operationsCount << " ops"
+         << setw(12) << kDuration.count() / 1000.0 << " ms"
+         << setw(12) << kDuration.count() * 1000.0 / operationsCount << " ns/op" << endl;
+}
+
+// Prevents compiler from removing computations, which results are not used.
+template <typename T>
+inline void doNotOptimize(
+    const T &value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+#endif //GEO_NETWORK_CLIENT_BENCHMARK_H
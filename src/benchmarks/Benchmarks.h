@@ -0,0 +1,19 @@
+#ifndef GEO_NETWORK_CLIENT_BENCHMARKS_H
+#define GEO_NETWORK_CLIENT_BENCHMARKS_H
+
+/*
+ * Each benchmark prints one line per measured case (see Benchmark.h).
+ * New benchmark should be declared here and registered in main.cpp.
+ */
+
+void benchmarkCommandsParser();
+
+void benchmarkCyclesJoiner();
+
+void benchmarkMultiprecision();
+
+void benchmarkSecureArena();
+
+void benchmarkTimerService();
+
+#endif //GEO_NETWORK_CLIENT_BENCHMARKS_H
@@ -0,0 +1,73 @@
+#include "Benchmark.h"
+#include "../core/interface/commands_interface/interface/CommandsInterface.h"
+
+namespace {
+
+const string kCommandUUID = "47183823-2574-4bfd-b411-99ed177d3e43";
+
+string textCommands(
+    size_t commandsCount)
+{
+    const string kCommand = kCommandUUID + "\tGET:contractors/trust-lines\t0\t100\t1\n";
+    string result;
+    result.reserve(kCommand.size() * commandsCount);
+    for (size_t idx = 0; idx < commandsCount; idx++) {
+        result += kCommand;
+    }
+    return result;
+}
+
+// Appends data to the parser by portions of the specified size and parses all received commands.
+size_t parseAll(
+    CommandsParser &parser,
+    const string &data,
+    size_t readSize)
+{
+    size_t commandsCount = 0;
+    for (size_t offset = 0; offset < data.size(); offset += readSize) {
+        parser.appendReadData(
+            data.data() + offset,
+            min(readSize, data.size() - offset));
+        while (true) {
+            auto flagAndCommand = parser.processReceivedCommands();
+            if (flagAndCommand.second == nullptr) {
+                break;
+            }
+            doNotOptimize(flagAndCommand);
+            commandsCount++;
+        }
+    }
+    return commandsCount;
+}
+
+}
+
+/*
+ * Commands, received by one big read, are parsed in place,
+ * so the time per command should not depend on the count of commands in the buffer.
+ */
+void benchmarkCommandsParser()
+{
+    Logger logger;
+    for (const size_t kCommandsCount : {1000, 10000, 100000}) {
+        const auto kData = textCommands(kCommandsCount);
+        measure(
+            "text commands, one read of " + to_string(kCommandsCount),
+            kCommandsCount,
+            [&] () {
+                CommandsParser parser(logger);
+                if (parseAll(parser, kData, kData.size()) != kCommandsCount) {
+                    throw runtime_error("benchmarkCommandsParser: not all commands were parsed");
+                }
+            });
+    }
+
+    const auto kData = textCommands(100000);
+    measure(
+        "text commands, reads of 4 KB",
+        100000,
+        [&] () {
+            CommandsParser parser(logger);
+            parseAll(parser, kData, 4096);
+        });
+}
@@ -0,0 +1,104 @@
+#include "Benchmark.h"
+#include "../core/cycles/BoundaryCyclesJoiner.h"
+#include "../core/contractors/addresses/IPv4WithPortAddress.h"
+
+namespace {
+
+const size_t kBranchesCount = 20;
+const size_t kBoundaryNodesCount = 10000;
+// each branch reaches every kBoundaryNodesStep-th boundary node
+const size_t kBoundaryNodesStep = 10;
+
+BaseAddress::Shared nodeAddress(
+    size_t nodeNumber)
+{
+    return make_shared<IPv4WithPortAddress>(
+        "10.0." + to_string(nodeNumber / 250) + "." + to_string(nodeNumber % 250 + 1) + ":2000");
+}
+
+struct Branches {
+    vector<vector<BaseAddress::Shared>> mOutgoing;
+    vector<vector<BaseAddress::Shared>> mIncoming;
+    // boundary nodes of each branch, branches with the same index have the same boundary nodes
+    vector<vector<BaseAddress::Shared>> mBoundaryNodes;
+};
+
+/*
+ * Two-nodes outgoing and incoming branches, as in boundary messages of six nodes cycles discovery.
+ * Branches with indexes i and j have common boundary nodes if i and j are equal modulo kBoundaryNodesStep.
+ */
+Branches generateBranches()
+{
+    Branches result;
+    size_t nodeNumber = 1;
+    vector<BaseAddress::Shared> boundaryNodes;
+    for (size_t idx = 0; idx < kBoundaryNodesCount; idx++) {
+        boundaryNodes.push_back(
+            nodeAddress(nodeNumber++));
+    }
+    for (size_t branchIdx = 0; branchIdx < kBranchesCount; branchIdx++) {
+        result.mOutgoing.push_back({
+            nodeAddress(nodeNumber++),
+            nodeAddress(nodeNumber++)});
+        result.mIncoming.push_back({
+            nodeAddress(nodeNumber++),
+            nodeAddress(nodeNumber++)});
+        vector<BaseAddress::Shared> branchBoundaryNodes;
+        for (size_t idx = branchIdx % kBoundaryNodesStep; idx < kBoundaryNodesCount; idx += kBoundaryNodesStep) {
+            branchBoundaryNodes.push_back(
+                boundaryNodes[idx]);
+        }
+        result.mBoundaryNodes.push_back(
+            branchBoundaryNodes);
+    }
+    return result;
+}
+
+size_t joinCycles(
+    const Branches &branches,
+    size_t receivedTimes)
+{
+    BoundaryCyclesJoiner joiner(
+        nodeAddress(0));
+    for (size_t time = 0; time < receivedTimes; time++) {
+        for (size_t idx = 0; idx < kBranchesCount; idx++) {
+            joiner.addOutgoingBranch(
+                branches.mOutgoing[idx],
+                branches.mBoundaryNodes[idx]);
+            joiner.addIncomingBranch(
+                branches.mIncoming[idx],
+                branches.mBoundaryNodes[idx]);
+        }
+    }
+    const auto kCycles = joiner.joinCycles();
+    doNotOptimize(kCycles);
+    return kCycles.size();
+}
+
+}
+
+/*
+ * Joins branches, received by six nodes cycles discovery, into cycles.
+ * The time includes interning of all addresses of the branches.
+ * The second case receives each branch twice, as it happens when boundary messages are duplicated.
+ */
+void benchmarkCyclesJoiner()
+{
+    const auto kBranches = generateBranches();
+    // branches with equal indexes modulo kBoundaryNodesStep have the same boundary nodes
+    const size_t kExpectedCyclesCount =
+        (kBranchesCount / kBoundaryNodesStep) * (kBranchesCount / kBoundaryNodesStep)
+        * kBoundaryNodesCount;
+
+    for (const size_t kReceivedTimes : {1, 2}) {
+        measure(
+            "join " + to_string(kBranchesCount * 2) + " branches, received "
+                + to_string(kReceivedTimes) + " time(s), per cycle",
+            kExpectedCyclesCount,
+            [&] () {
+                if (joinCycles(kBranches, kReceivedTimes) != kExpectedCyclesCount) {
+                    throw runtime_error("benchmarkCyclesJoiner: unexpected count of cycles");
+                }
+            });
+    }
+}
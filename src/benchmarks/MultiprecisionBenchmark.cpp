@@ -0,0 +1,102 @@
+#include "Benchmark.h"
+#include "../core/common/multiprecision/MultiprecisionUtils.h"
+
+#include <random>
+
+namespace {
+
+const size_t kValuesCount = 400000;
+
+// serialization via export_bits / import_bits, as it was done before limb by limb writing
+vector<byte> exportBitsAmountToBytes(
+    const TrustLineAmount &amount)
+{
+    vector<byte> exportedBytes;
+    export_bits(amount, back_inserter(exportedBytes), 8);
+    vector<byte> result(kTrustLineAmountBytesCount - exportedBytes.size(), 0);
+    result.insert(result.end(), exportedBytes.begin(), exportedBytes.end());
+    return result;
+}
+
+TrustLineAmount importBitsBytesToAmount(
+    const vector<byte> &amountBytes)
+{
+    TrustLineAmount amount;
+    import_bits(amount, amountBytes.begin(), amountBytes.end());
+    return amount;
+}
+
+vector<TrustLineAmount> generateAmounts()
+{
+    mt19937_64 generator(42);
+    vector<TrustLineAmount> result;
+    result.reserve(kValuesCount);
+    for (size_t idx = 0; idx < kValuesCount; idx++) {
+        // amounts of trust lines are mostly small, but some of them use all 256 bits
+        TrustLineAmount amount = generator();
+        if (idx % 10 == 0) {
+            amount = (amount << 192) | (TrustLineAmount(generator()) << 64) | generator();
+        }
+        result.push_back(amount);
+    }
+    return result;
+}
+
+}
+
+/*
+ * Round trip (serialization and deserialization) of trust line amounts.
+ */
+void benchmarkMultiprecision()
+{
+    const auto kAmounts = generateAmounts();
+
+    measure(
+        "amount round trip via export_bits",
+        kValuesCount,
+        [&kAmounts] () {
+            for (const auto &amount : kAmounts) {
+                if (importBitsBytesToAmount(exportBitsAmountToBytes(amount)) != amount) {
+                    throw runtime_error("benchmarkMultiprecision: round trip failed");
+                }
+            }
+        });
+
+    measure(
+        "amount round trip via vector",
+        kValuesCount,
+        [&kAmounts] () {
+            for (const auto &amount : kAmounts) {
+                if (bytesToTrustLineAmount(trustLineAmountToBytes(amount)) != amount) {
+                    throw runtime_error("benchmarkMultiprecision: round trip failed");
+                }
+            }
+        });
+
+    measure(
+        "amount round trip via buffer",
+        kValuesCount,
+        [&kAmounts] () {
+            byte buffer[kTrustLineAmountBytesCount];
+            for (const auto &amount : kAmounts) {
+                trustLineAmountToBytes(amount, buffer);
+                if (bytesToTrustLineAmount(buffer) != amount) {
+                    throw runtime_error("benchmarkMultiprecision: round trip failed");
+                }
+            }
+        });
+
+    measure(
+        "balance round trip via buffer",
+        kValuesCount,
+        [&kAmounts] () {
+            byte buffer[kTrustLineBalanceSerializeBytesCount];
+            for (const auto &amount : kAmounts) {
+                const TrustLineBalance kBalance = -TrustLineBalance(amount);
+                trustLineBalanceToBytes(kBalance, buffer);
+                if (bytesToTrustLineBalance(buffer) != kBalance) {
+                    throw runtime_error("benchmarkMultiprecision: round trip failed");
+                }
+            }
+        });
+}
@@ -0,0 +1,111 @@
+#include "Benchmark.h"
+#include "../core/crypto/lamportscheme.h"
+
+#include <memory>
+
+using namespace crypto;
+
+namespace {
+
+const size_t kKeysCount = 2000;
+// count of accesses to each key during its lifetime (generation, hashing, signing)
+const size_t kAccessesCount = 3;
+
+template <typename SegmentFactory>
+void runSegmentsLifecycle(
+    SegmentFactory createSegment)
+{
+    vector<unique_ptr<memory::SecureSegment>> segments;
+    for (size_t idx = 0; idx < kKeysCount; idx++) {
+        segments.push_back(
+            createSegment());
+    }
+    for (size_t access = 0; access < kAccessesCount; access++) {
+        for (const auto &segment : segments) {
+            auto guard = segment->unlockAndInitGuard();
+            guard.address()[access] = (byte)access;
+            doNotOptimize(guard.address()[0]);
+        }
+    }
+}
+
+}
+
+/*
+ * Lifecycle of secure memory of Lamport private keys:
+ * allocation, several accesses and freeing of kKeysCount segments of private key size.
+ * Separate sodium_malloc() segments are compared with slots of the arena, accessed with and without unlock scope.
+ * The last cases measure full key usage, which is dominated by hashing.
+ */
+void benchmarkSecureArena()
+{
+    if (sodium_init() == -1) {
+        throw runtime_error("benchmarkSecureArena: sodium can't be initialised");
+    }
+
+    measure(
+        "separate secure segments lifecycle",
+        kKeysCount,
+        [] () {
+            runSegmentsLifecycle([] () {
+                return make_unique<memory::SecureSegment>(
+                    lamport::PrivateKey::keySize());
+            });
+        });
+
+    memory::SecureArena arena(
+        lamport::PrivateKey::keySize(),
+        16);
+    measure(
+        "arena slots lifecycle",
+        kKeysCount,
+        [&arena] () {
+            runSegmentsLifecycle([&arena] () {
+                return make_unique<memory::SecureSegment>(
+                    arena);
+            });
+        });
+
+    measure(
+        "arena slots lifecycle inside unlock scope",
+        kKeysCount,
+        [&arena] () {
+            memory::SecureArena::UnlockScope unlockScope(
+                arena);
+            runSegmentsLifecycle([&arena] () {
+                return make_unique<memory::SecureSegment>(
+                    arena);
+            });
+        });
+
+    const string kDataForSign = "benchmark data for sign";
+    auto generateDeriveAndSign = [&kDataForSign] () {
+        lamport::PrivateKey privateKey;
+        auto publicKey = privateKey.derivePublicKey();
+        lamport::Signature signature(
+            (byte*)kDataForSign.c_str(),
+            kDataForSign.size(),
+            &privateKey);
+        doNotOptimize(publicKey);
+    };
+
+    measure(
+        "generate key, derive public key and sign",
+        kKeysCount,
+        [&generateDeriveAndSign] () {
+            for (size_t idx = 0; idx < kKeysCount; idx++) {
+                generateDeriveAndSign();
+            }
+        });
+
+    measure(
+        "generate key, derive public key and sign in scope",
+        kKeysCount,
+        [&generateDeriveAndSign] () {
+            memory::SecureArena::UnlockScope unlockScope(
+                lamport::PrivateKey::keysArena());
+            for (size_t idx = 0; idx < kKeysCount; idx++) {
+                generateDeriveAndSign();
+            }
+        });
+}
@@ -0,0 +1,91 @@
+#include "Benchmark.h"
+#include "../core/common/time/TimerService.h"
+
+#include <memory>
+
+namespace {
+
+const size_t kTimersCount = 100000;
+
+}
+
+/*
+ * Rescheduling and firing of callbacks by TimerService,
+ * compared with the same callbacks, waited by separate steady_timers (as components did before).
+ * Fired callbacks expire in the same moment, so the time is spent only on timers handling.
+ */
+void benchmarkTimerService()
+{
+    measure(
+        "reschedule TimerService::Timer",
+        kTimersCount,
+        [] () {
+            as::io_service ioService;
+            TimerService timerService(ioService);
+            TimerService::Timer timer(&timerService);
+            for (size_t idx = 0; idx < kTimersCount; idx++) {
+                timer.expiresFromNow(
+                    chrono::seconds(1 + idx % 10),
+                    [] () {});
+            }
+        });
+
+    measure(
+        "reschedule steady_timer",
+        kTimersCount,
+        [] () {
+            as::io_service ioService;
+            as::steady_timer timer(ioService);
+            for (size_t idx = 0; idx < kTimersCount; idx++) {
+                timer.expires_from_now(
+                    chrono::seconds(1 + idx % 10));
+                timer.async_wait(
+                    [] (const boost::system::error_code &) {});
+            }
+        });
+
+    measure(
+        "fire callbacks of TimerService",
+        kTimersCount,
+        [] () {
+            as::io_service ioService;
+            TimerService timerService(ioService);
+            size_t calledCount = 0;
+            const auto kExpiry = TimerService::Clock::now();
+            for (size_t idx = 0; idx < kTimersCount; idx++) {
+                timerService.schedule(
+                    kExpiry,
+                    [&calledCount] () {
+                        calledCount++;
+                    });
+            }
+            ioService.run();
+            if (calledCount != kTimersCount) {
+                throw runtime_error("benchmarkTimerService: unexpected count of called callbacks");
+            }
+        });
+
+    measure(
+        "fire separate steady_timers",
+        kTimersCount,
+        [] () {
+            as::io_service ioService;
+            size_t calledCount = 0;
+            const auto kExpiry = chrono::steady_clock::now();
+            vector<unique_ptr<as::steady_timer>> timers;
+            for (size_t idx = 0; idx < kTimersCount; idx++) {
+                timers.push_back(
+                    make_unique<as::steady_timer>(
+                        ioService,
+                        kExpiry));
+                timers.back()->async_wait(
+                    [&calledCount] (const boost::system::error_code &) {
+                        calledCount++;
+                    });
+            }
+            ioService.run();
+            if (calledCount != kTimersCount) {
+                throw runtime_error("benchmarkTimerService: unexpected count of called timers");
+            }
+        });
+}
@@ -0,0 +1,47 @@
+#include "Benchmarks.h"
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+    const vector<pair<string, function<void()>>> kBenchmarks = {
+        {"commands_parser", benchmarkCommandsParser},
+        {"cycles_joiner", benchmarkCyclesJoiner},
+        {"multiprecision", benchmarkMultiprecision},
+        {"secure_arena", benchmarkSecureArena},
+        {"timer_service", benchmarkTimerService},
+    };
+
+    if (argc > 1 and string(argv[1]) == "--list") {
+        for (const auto &kNameAndBenchmark : kBenchmarks) {
+            cout << kNameAndBenchmark.first << endl;
+        }
+        return 0;
+    }
+
+    size_t runCount = 0;
+    for (const auto &kNameAndBenchmark : kBenchmarks) {
+        bool isSelected = argc == 1;
+        for (int idx = 1; idx < argc; idx++) {
+            if (kNameAndBenchmark.first == argv[idx]) {
+                isSelected = true;
+            }
+        }
+        if (isSelected) {
+            cout << "# " << kNameAndBenchmark.first << endl;
+            kNameAndBenchmark.second();
+            runCount++;
+        }
+    }
+
+    if (runCount == 0) {
+        cerr << "Unknown benchmark. Use --list to get available benchmarks." << endl;
+        return 2;
+    }
+    return 0;
+}
@@ -20,10 +20,14 @@ int Core::run()
 
     writePIDFile();
     updateProcessName();
+    reportMemoryUsage();
 
     try {
         mCommunicator->beginAcceptMessages();
         mCommandsInterface->beginAcceptCommands();
+        if (mSocketInterface != nullptr) {
+            mSocketInterface->beginAcceptConnections();
+        }
 
         info() << "Processing started.";
         mIOService.run();
@@ -70,6 +74,16 @@ int Core::initSubsystems()
         return initCode;
     }
 
+    initCode = initTimerService();
+    if (initCode != 0) {
+        return initCode;
+    }
+
+    initCode = initWorkersPool(conf);
+    if (initCode != 0) {
+        return initCode;
+    }
+
     initCode = initStorageHandler();
     if (initCode != 0) {
         return initCode;
@@ -90,6 +104,11 @@ int Core::initSubsystems()
         return initCode;
     }
 
+    initCode = initSocketInterface(conf);
+    if (initCode != 0) {
+        return initCode;
+    }
+
     initCode = initEventsInterfaceManager(conf);
     if (initCode != 0) {
         return initCode;
@@ -187,10 +206,44 @@ int Core::initLogger()
     }
 }
 
+int Core::initTimerService()
+{
+    try {
+        mTimerService = make_unique<TimerService>(
+            mIOService);
+        mMemoryUsageReportingTimer = make_unique<TimerService::Timer>(
+            mTimerService.get());
+
+        info() << "Timer service is successfully initialised";
+        return 0;
+
+    } catch (const std::exception &e) {
+        mLog->logException("Core", e);
+        return -1;
+    }
+}
+
+int Core::initWorkersPool(
+    const json &conf)
+{
+    try {
+        mWorkersPool = make_unique<WorkersPool>(
+            mIOService,
+            mSettings->workersCount(&conf));
+
+        info() << "Workers pool is successfully initialised with " << mWorkersPool->workersCount() << " workers";
+        return 0;
+
+    } catch (const std::exception &e) {
+        mLog->logException("Core", e);
+        return -1;
+    }
+}
+
 int Core::initTailManager() {
     try {
         mTailManager = make_unique<TailManager>(
-            mIOService,
+            mTimerService.get(),
             *mLog);
 
         info() << "Tail manager is successfully initialised";
@@ -209,6 +262,8 @@ int Core::initCommunicator(
         auto interface = mSettings->interface(&conf);
         mCommunicator = make_unique<Communicator>(
             mIOService,
+            mTimerService.get(),
+            mWorkersPool.get(),
             interface.first,
             interface.second,
             mContractorsManager.get(),
@@ -232,6 +287,7 @@ int Core::initObservingHandler(
         mObservingHandler = make_unique<ObservingHandler>(
             mSettings->observers(&conf),
             mIOService,
+            mTimerService.get(),
             mStorageHandler.get(),
             mResourcesManager.get(),
             *mLog);
@@ -249,6 +305,7 @@ int Core::initResultsInterface()
 {
     try {
         mResultsInterface = make_unique<ResultsInterface>(
+            mIOService,
             *mLog);
         info() << "Results interface is successfully initialised";
         return 0;
@@ -259,20 +316,89 @@ int Core::initResultsInterface()
     }
 }
 
+int Core::initSocketInterface(
+    const json &conf)
+{
+    auto controlInterfaceConf = mSettings->controlInterface(&conf);
+    if (controlInterfaceConf == nullptr) {
+        // Socket interface is optional, commands FIFO is used by default.
+        return 0;
+    }
+
+    try {
+        string unixSocketPath;
+        string tcpHost;
+        uint16_t tcpPort = 0;
+        if (controlInterfaceConf.find("unix_socket") != controlInterfaceConf.end()) {
+            unixSocketPath = controlInterfaceConf.at("unix_socket").get<string>();
+        }
+        const bool isTCPPortPresent = controlInterfaceConf.find("tcp_port") != controlInterfaceConf.end();
+        const bool isTCPHostPresent = controlInterfaceConf.find("tcp_host") != controlInterfaceConf.end();
+        if (isTCPPortPresent != isTCPHostPresent) {
+            throw ValueError(
+                "Control interface configuration: "
+                    "tcp_host and tcp_port should be set together");
+        }
+        if (isTCPPortPresent) {
+            tcpHost = controlInterfaceConf.at("tcp_host").get<string>();
+            const auto kTCPPort = controlInterfaceConf.at("tcp_port").get<int>();
+            if (kTCPPort <= 0 or kTCPPort > numeric_limits<uint16_t>::max()) {
+                throw ValueError(
+                    "Control interface configuration: "
+                        "tcp_port should be in range 1..65535");
+            }
+            tcpPort = (uint16_t)kTCPPort;
+        }
+
+        mSocketInterface = make_unique<SocketInterface>(
+            mIOService,
+            unixSocketPath,
+            tcpHost,
+            tcpPort,
+            *mLog);
+
+        mResultsInterface->setResultsRouter(
+            boost::bind(
+                &SocketInterface::writeResult,
+                mSocketInterface.get(),
+                _1));
+        info() << "Socket interface is successfully initialised";
+        return 0;
+
+    } catch (const std::exception &e) {
+        mLog->logException("Core", e);
+        return -1;
+    }
+}
+
 int Core::initEventsInterfaceManager(
     const json &conf)
 {
     auto eventsConf = mSettings->events(&conf);
-    vector<pair<string, bool>> filesToBlock;
+    vector<pair<string, EventsInterface::Parameters>> filesToParameters;
     vector<pair<string, SerializedEventType>> filesToEvents;
     try {
         if (eventsConf == nullptr) {
             info() << "There are no events in config";
         } else {
             for (const auto &eventConf : eventsConf) {
-                filesToBlock.emplace_back(
+                EventsInterface::Parameters parameters = {
+                    eventConf.at("blocked").get<bool>(),
+                    EventsInterface::kDefaultMaxBufferedEventsCount,
+                    EventsInterface::DropOldest};
+                if (eventConf.count("buffer_size") != 0) {
+                    parameters.mMaxBufferedEventsCount = eventConf.at("buffer_size").get<size_t>();
+                    if (parameters.mMaxBufferedEventsCount == 0) {
+                        throw ValueError("Events buffer size can't be zero");
+                    }
+                }
+                if (eventConf.count("overflow_policy") != 0) {
+                    parameters.mOverflowPolicy = EventsInterface::overflowPolicyFromString(
+                        eventConf.at("overflow_policy").get<string>());
+                }
+                filesToParameters.emplace_back(
                     eventConf.at("file").get<string>(),
-                    eventConf.at("blocked").get<bool>());
+                    parameters);
                 for (const auto &eventTypesConf : eventConf.at("events")) {
                     filesToEvents.emplace_back(
                         eventConf.at("file").get<string>(),
@@ -282,8 +408,10 @@ int Core::initEventsInterfaceManager(
         }
 
         mEventsInterfaceManager = make_unique<EventsInterfaceManager>(
+            mIOService,
+            mTimerService.get(),
             filesToEvents,
-            filesToBlock,
+            filesToParameters,
             *mLog);
         info() << "Events interface manager is successfully initialised";
         return 0;
@@ -302,7 +430,7 @@ int Core::initEquivalentsSubsystemsRouter(
             mKeysStore.get(),
             mContractorsManager.get(),
             mEventsInterfaceManager.get(),
-            mIOService,
+            mTimerService.get(),
             equivalentIAmGateway,
             *mLog);
         info() << "EquivalentsSubsystemsRouter is successfully initialised";
@@ -333,6 +461,15 @@ int Core::initTransactionsManager(
     try {
         CyclesRunningParameters cyclesRunningParameters;
         if (cyclesClearingConf != nullptr) {
+            auto cyclesMaxConcurrentClosingsCount = CyclesRunningParameters::kDefaultCyclesMaxConcurrentClosingsCount;
+            if (cyclesClearingConf.count("max_concurrent_closings") != 0) {
+                cyclesMaxConcurrentClosingsCount = cyclesClearingConf.at("max_concurrent_closings").get<uint16_t>();
+            }
+            auto cyclesMinClosableAmount = CyclesRunningParameters::kDefaultCyclesMinClosableAmount();
+            if (cyclesClearingConf.count("min_closable_amount") != 0) {
+                cyclesMinClosableAmount = TrustLineAmount(
+                    cyclesClearingConf.at("min_closable_amount").get<string>());
+            }
             cyclesRunningParameters = CyclesRunningParameters(
                 cyclesClearingConf.at("three_nodes_enabled").get<bool>(),
                 cyclesClearingConf.at("four_nodes_enabled").get<bool>(),
@@ -340,10 +477,14 @@ int Core::initTransactionsManager(
                 cyclesClearingConf.at("five_nodes_interval_sec").get<uint32_t>(),
                 cyclesClearingConf.at("six_nodes_enabled").get<bool>(),
                 cyclesClearingConf.at("six_nodes_interval_sec").get<uint32_t>(),
-                cyclesClearingConf.at("routing_tables_interval_days").get<uint16_t>());
+                cyclesClearingConf.at("routing_tables_interval_days").get<uint16_t>(),
+                cyclesMaxConcurrentClosingsCount,
+                cyclesMinClosableAmount);
         }
         mTransactionsManager = make_unique<TransactionsManager>(
             mIOService,
+            mTimerService.get(),
+            mWorkersPool.get(),
             mContractorsManager.get(),
             mEquivalentsSubsystemsRouter.get(),
             mResourcesManager.get(),
@@ -354,6 +495,7 @@ int Core::initTransactionsManager(
             mEventsInterfaceManager.get(),
             mTailManager.get(),
             cyclesRunningParameters,
+            mSettings->pipelinedPathsCount(&conf),
             *mLog,
             mSubsystemsController.get(),
             mTrustLinesInfluenceController.get());
@@ -445,7 +587,7 @@ int Core::initProvidingHandler(
             providers,
             addressUpdatingPeriod,
             cachedAddressTTLSeconds,
-            mIOService,
+            mTimerService.get(),
             mContractorsManager->selfContractor(),
             *mLog);
         info() << "Providing handler is successfully initialised";
@@ -500,7 +642,7 @@ int Core::initTopologyEventDelayedTask()
 {
     try {
         mTopologyEventDelayedTask = make_unique<TopologyEventDelayedTask>(
-            mIOService,
+            mTimerService.get(),
             mEquivalentsSubsystemsRouter.get(),
             *mLog);
         info() << "Topology Event Delayed Task is successfully initialized";
@@ -516,7 +658,7 @@ int Core::initFeaturesManager(
 {
     try {
         mFeaturesManager = make_unique<FeaturesManager>(
-            mIOService,
+            mTimerService.get(),
             mSettings->equivalentsRegistryAddress(&conf),
             mContractorsManager->selfContractor()->outputString(),
             mStorageHandler.get(),
@@ -539,6 +681,19 @@ void Core::connectCommandsInterfaceSignals ()
             _2));
 }
 
+void Core::connectSocketInterfaceSignals()
+{
+    if (mSocketInterface == nullptr) {
+        return;
+    }
+    mSocketInterface->commandReceivedSignal.connect(
+        boost::bind(
+            &Core::onCommandReceivedSlot,
+            this,
+            _1,
+            _2));
+}
+
 void Core::connectCommunicatorSignals()
 {
     //communicator's signal to transactions manager slot
@@ -679,6 +834,7 @@ void Core::connectResourcesManagerSignals()
 void Core::connectSignalsToSlots()
 {
     connectCommandsInterfaceSignals();
+    connectSocketInterfaceSignals();
     connectCommunicatorSignals();
     connectResourcesManagerSignals();
     connectObservingSignals();
@@ -975,6 +1131,34 @@ void Core::updateProcessName()
     strcpy(mCommandDescriptionPtr, kProcessName.c_str());
 }
 
+/*
+ * Reports memory, occupied by the biggest in-memory state of the node.
+ * First report is done right after loading of the state from the storage,
+ * next ones - periodically, to follow steady state of the node.
+ */
+void Core::reportMemoryUsage()
+{
+    size_t trustLinesCount = 0;
+    size_t trustLinesBytesCount = 0;
+    for (const auto equivalent : mEquivalentsSubsystemsRouter->equivalents()) {
+        auto trustLinesManager = mEquivalentsSubsystemsRouter->trustLinesManager(equivalent);
+        trustLinesCount += trustLinesManager->trustLines().size();
+        trustLinesBytesCount += trustLinesManager->allocatedBytesCount();
+    }
+
+    auto &keysArena = lamport::PrivateKey::keysArena();
+    info() << "Memory usage: "
+           << "trust lines " << trustLinesBytesCount << " bytes (" << trustLinesCount << " trust lines), "
+           << "contractors " << mContractorsManager->allocatedBytesCount() << " bytes, "
+           << "private keys " << keysArena.allocatedBytesCount() << " bytes ("
+           << keysArena.usedSlotsCount() << " keys)";
+
+    const auto kReportingInterval = chrono::minutes(10);
+    mMemoryUsageReportingTimer->expiresFromNow(kReportingInterval, [this] () {
+        this->reportMemoryUsage();
+    });
+}
+
 string Core::logHeader()
     noexcept
 {
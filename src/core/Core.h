@@ -3,11 +3,14 @@
 #define GEO_NETWORK_CLIENT_CORE_H
 
 #include "common/Types.h"
+#include "common/time/TimerService.h"
+#include "common/workers/WorkersPool.h"
 
 #include "settings/Settings.h"
 #include "network/communicator/Communicator.h"
 #include "interface/commands_interface/interface/CommandsInterface.h"
 #include "interface/results_interface/interface/ResultsInterface.h"
+#include "interface/socket_interface/interface/SocketInterface.h"
 #include "interface/events_interface/interface/EventsInterfaceManager.h"
 #include "resources/manager/ResourcesManager.h"
 #include "transactions/manager/TransactionsManager.h"
@@ -57,6 +60,11 @@ private:
 
     int initLogger();
 
+    int initTimerService();
+
+    int initWorkersPool(
+        const json &conf);
+
     int initTailManager();
 
     int initCommunicator(
@@ -69,6 +77,9 @@ private:
 
     int initResultsInterface();
 
+    int initSocketInterface(
+        const json &conf);
+
     int initEventsInterfaceManager(
         const json &conf);
 
@@ -105,6 +116,8 @@ private:
 
     void connectCommandsInterfaceSignals();
 
+    void connectSocketInterfaceSignals();
+
     void connectResourcesManagerSignals();
 
     void connectSignalsToSlots();
@@ -184,6 +197,8 @@ private:
 
     void updateProcessName();
 
+    void reportMemoryUsage();
+
 protected:
     static string logHeader()
     noexcept;
@@ -206,12 +221,18 @@ protected:
     char* mCommandDescriptionPtr;
 
     as::io_service mIOService;
+    // must be destroyed after all components, which have timers scheduled in it
+    unique_ptr<TimerService> mTimerService;
+    unique_ptr<TimerService::Timer> mMemoryUsageReportingTimer;
+    // must be destroyed before io_service, because workers post results into it
+    unique_ptr<WorkersPool> mWorkersPool;
 
     unique_ptr<Logger> mLog;
     unique_ptr<Settings> mSettings;
     unique_ptr<Communicator> mCommunicator;
     unique_ptr<CommandsInterface> mCommandsInterface;
     unique_ptr<ResultsInterface> mResultsInterface;
+    unique_ptr<SocketInterface> mSocketInterface;
     unique_ptr<EventsInterfaceManager> mEventsInterfaceManager;
     unique_ptr<ResourcesManager> mResourcesManager;
     unique_ptr<TransactionsManager> mTransactionsManager;
@@ -1,7 +1,16 @@
 #include "NodeUUID.h"
 
-NodeUUID::NodeUUID()
-    :uuid(boost::uuids::random_generator()()){
+const NodeUUID::NilTag NodeUUID::kNil{};
+
+NodeUUID::NodeUUID() {
+    randomBytesPool().fill(data);
+    // version 4 (random) and RFC 4122 variant, the same as boost::uuids::random_generator sets
+    data[6] = (uint8_t)((data[6] & 0x0F) | 0x40);
+    data[8] = (uint8_t)((data[8] & 0x3F) | 0x80);
+}
+
+NodeUUID::NodeUUID(NilTag) {
+    memset(data, 0, kBytesSize);
 }
 
 NodeUUID::NodeUUID(uuid const &u):
@@ -37,7 +46,36 @@ NodeUUID& NodeUUID::operator=(const boost::uuids::uuid &u){
 
 const NodeUUID& NodeUUID::empty ()
 {
-    static const NodeUUID kEmpty("00000000-0000-0000-0000-000000000000");
+    static const NodeUUID kEmpty(kNil);
     return kEmpty;
 }
 
+NodeUUID::RandomBytesPool& NodeUUID::randomBytesPool()
+{
+    static thread_local RandomBytesPool pool;
+    return pool;
+}
+
+NodeUUID::RandomBytesPool::RandomBytesPool() :
+    mOffset(kPoolSize)
+{
+    // uuids can be generated before crypto subsystem initialising,
+    // sodium_init() is safe to be called several times and from several threads
+    if (sodium_init() == -1) {
+        throw RuntimeError("NodeUUID::RandomBytesPool: can't initialise libsodium");
+    }
+}
+
+void NodeUUID::RandomBytesPool::fill(
+    uint8_t *bytes)
+{
+    if (mOffset + kBytesSize > kPoolSize) {
+        randombytes_buf(
+            mBytes.data(),
+            kPoolSize);
+        mOffset = 0;
+    }
+    memcpy(bytes, mBytes.data() + mOffset, kBytesSize);
+    mOffset += kBytesSize;
+}
+
@@ -1,6 +1,7 @@
 #ifndef GEO_NETWORK_CLIENT_NODEUUID_H
 #define GEO_NETWORK_CLIENT_NODEUUID_H
 
+#include "exceptions/RuntimeError.h"
 
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -8,6 +9,10 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/endian/arithmetic.hpp>
 
+#include <sodium.h>
+
+#include <array>
+#include <functional>
 #include <string>
 
 
@@ -22,10 +27,17 @@ public:
     static const size_t kHexSize = 36;
     static const size_t kBytesSize = 16;
 
+    // Tag of the constructor, which doesn't generate new uuid, but fills it with zeroes.
+    // Must be used when uuid would be overwritten right after construction (e.g. on deserialization).
+    struct NilTag {};
+    static const NilTag kNil;
+
     static const NodeUUID& empty();
 
 public:
+    // generates new random (version 4) uuid
     explicit NodeUUID();
+    explicit NodeUUID(NilTag);
     NodeUUID(uuid const &u);
     NodeUUID(NodeUUID &u);
     NodeUUID(const NodeUUID &u);
@@ -36,6 +48,39 @@ public:
         const boost::uuids::uuid &u);
 
     const string stringUUID() const;
+
+protected:
+    /**
+     * Per thread pool of random bytes, fetched from libsodium CSPRNG by blocks.
+     * Each uuid consumes kBytesSize bytes from the pool,
+     * so generating of uuid doesn't require system call (and random generator construction) each time.
+     */
+    class RandomBytesPool {
+    public:
+        RandomBytesPool();
+
+        void fill(
+            uint8_t *bytes);
+
+    protected:
+        static const size_t kPoolSize = 256 * kBytesSize;
+
+        array<uint8_t, kPoolSize> mBytes;
+        size_t mOffset;
+    };
+
+    static RandomBytesPool& randomBytesPool();
 };
 
+
+namespace std {
+    template<>
+    struct hash<NodeUUID> {
+        size_t operator()(const NodeUUID &u) const noexcept
+        {
+            return boost::uuids::hash_value(u);
+        }
+    };
+}
+
 #endif //GEO_NETWORK_CLIENT_NODEUUID_H
@@ -0,0 +1,268 @@
+#ifndef GEO_NETWORK_CLIENT_CONTRACTORIDMAP_H
+#define GEO_NETWORK_CLIENT_CONTRACTORIDMAP_H
+
+#include "../Types.h"
+#include "../exceptions/NotFoundError.h"
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Index from ContractorID into smart pointer: pointers are stored in one vector, indexed by contractor id.
+ * Contractors ids are assigned sequentially by ContractorsManager, so the vector has no big gaps,
+ * and lookup is just an indexing (without hashing and without separate allocation per each element).
+ * Only the index is compact: objects, pointed by the values, are allocated separately, as before.
+ * Slot with null value is treated as absent one; iteration skips such slots
+ * and visits elements in order of contractors ids.
+ *
+ * Interface follows std::unordered_map as far as it is used by the node,
+ * except insertion: set() replaces already present value.
+ *
+ * Iterators invalidation:
+ * erase() invalidates only iterators to the erased element;
+ * set() of the id, which has no slot yet, may reallocate slots and invalidates all iterators;
+ * shrinkToFit() invalidates all iterators.
+ * Value must not be changed to nullptr via iterator, erase() should be used instead.
+ */
+template <typename Value>
+class ContractorIDMap {
+
+public:
+    typedef pair<const ContractorID, Value> value_type;
+    typedef vector<value_type> Slots;
+
+    template <typename SlotIterator, typename Reference>
+    class BaseIterator {
+
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef ContractorIDMap::value_type value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename remove_reference<Reference>::type* pointer;
+        typedef Reference reference;
+
+    public:
+        BaseIterator(
+            SlotIterator current,
+            SlotIterator end) :
+            mCurrent(current),
+            mEnd(end)
+        {
+            skipAbsent();
+        }
+
+        reference operator*() const
+        {
+            return *mCurrent;
+        }
+
+        pointer operator->() const
+        {
+            return &(*mCurrent);
+        }
+
+        BaseIterator& operator++()
+        {
+            ++mCurrent;
+            skipAbsent();
+            return *this;
+        }
+
+        BaseIterator operator++(int)
+        {
+            auto previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(
+            const BaseIterator &other) const
+        {
+            return mCurrent == other.mCurrent;
+        }
+
+        bool operator!=(
+            const BaseIterator &other) const
+        {
+            return mCurrent != other.mCurrent;
+        }
+
+    protected:
+        void skipAbsent()
+        {
+            while (mCurrent != mEnd and mCurrent->second == nullptr) {
+                ++mCurrent;
+            }
+        }
+
+    protected:
+        SlotIterator mCurrent;
+        SlotIterator mEnd;
+    };
+
+    typedef BaseIterator<typename Slots::iterator, value_type&> iterator;
+    typedef BaseIterator<typename Slots::const_iterator, const value_type&> const_iterator;
+
+public:
+    ContractorIDMap() :
+        mSize(0)
+    {}
+
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    /**
+     * Reserves slots for contractors ids in range [0, maxContractorID].
+     */
+    void reserve(
+        const ContractorID maxContractorID)
+    {
+        mSlots.reserve(
+            (size_t)maxContractorID + 1);
+    }
+
+    size_t count(
+        const ContractorID contractorID) const
+    {
+        return contractorID < mSlots.size() and mSlots[contractorID].second != nullptr ? 1 : 0;
+    }
+
+    /**
+     * @throws NotFoundError in case if there is no value for the contractor.
+     */
+    const Value& at(
+        const ContractorID contractorID) const
+    {
+        if (count(contractorID) == 0) {
+            throw NotFoundError(
+                "ContractorIDMap::at: there is no value for the contractor " + to_string(contractorID));
+        }
+        return mSlots[contractorID].second;
+    }
+
+    void set(
+        const ContractorID contractorID,
+        Value value)
+    {
+        if (value == nullptr) {
+            erase(contractorID);
+            return;
+        }
+        // keys of the slots are constant, so new slots are constructed with their ids
+        while (contractorID >= mSlots.size()) {
+            mSlots.emplace_back(
+                (ContractorID)mSlots.size(),
+                nullptr);
+        }
+        if (mSlots[contractorID].second == nullptr) {
+            mSize++;
+        }
+        mSlots[contractorID].second = move(value);
+    }
+
+    size_t erase(
+        const ContractorID contractorID)
+    {
+        if (count(contractorID) == 0) {
+            return 0;
+        }
+        // slot itself is kept, so iterators to other elements stay valid
+        mSlots[contractorID].second = nullptr;
+        mSize--;
+        return 1;
+    }
+
+    void clear()
+    {
+        mSlots.clear();
+        mSize = 0;
+    }
+
+    /**
+     * Releases trailing empty slots and their memory, so the vector follows the biggest present id.
+     * Invalidates all iterators.
+     */
+    void shrinkToFit()
+    {
+        while (!mSlots.empty() and mSlots.back().second == nullptr) {
+            mSlots.pop_back();
+        }
+        mSlots.shrink_to_fit();
+    }
+
+    iterator find(
+        const ContractorID contractorID)
+    {
+        if (count(contractorID) == 0) {
+            return end();
+        }
+        return iterator(
+            mSlots.begin() + contractorID,
+            mSlots.end());
+    }
+
+    const_iterator find(
+        const ContractorID contractorID) const
+    {
+        if (count(contractorID) == 0) {
+            return end();
+        }
+        return const_iterator(
+            mSlots.cbegin() + contractorID,
+            mSlots.cend());
+    }
+
+    iterator begin()
+    {
+        return iterator(
+            mSlots.begin(),
+            mSlots.end());
+    }
+
+    iterator end()
+    {
+        return iterator(
+            mSlots.end(),
+            mSlots.end());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(
+            mSlots.cbegin(),
+            mSlots.cend());
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(
+            mSlots.cend(),
+            mSlots.cend());
+    }
+
+    /**
+     * @returns count of bytes, allocated by the map itself (without objects, pointed by the values).
+     */
+    size_t allocatedBytesCount() const
+    {
+        return sizeof(ContractorIDMap) + mSlots.capacity() * sizeof(value_type);
+    }
+
+protected:
+    Slots mSlots;
+    size_t mSize;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_CONTRACTORIDMAP_H
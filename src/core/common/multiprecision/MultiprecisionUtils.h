@@ -6,6 +6,7 @@
 #include "../../contractors/addresses/GNSAddress.h"
 
 #include <boost/endian/arithmetic.hpp>
+#include <cstring>
 #include <vector>
 
 using namespace std;
@@ -20,122 +21,154 @@ inline TrustLineAmount absoluteBalanceAmount(
     }
 }
 
-inline vector<byte> trustLineAmountToBytes(
-    const TrustLineAmount &amount) {
-
-    vector<byte> rawExportedBytesBuffer, resultBytesBuffer;
-
-    // Exporting bytes of the "amount".
-    rawExportedBytesBuffer.reserve(kTrustLineAmountBytesCount);
-    export_bits(amount, back_inserter(rawExportedBytesBuffer), 8);
-
-    // Prepending received bytes by zeroes until 32 bytes would be used.
-    resultBytesBuffer.reserve(kTrustLineAmountBytesCount);
-
-    size_t unusedBytesCount = kTrustLineAmountBytesCount - rawExportedBytesBuffer.size();
-    for (size_t i = 0; i < unusedBytesCount; ++i) {
-        resultBytesBuffer.push_back(0);
-    }
-
-    size_t usedBytesCount = rawExportedBytesBuffer.size();
-    for (size_t i = 0; i < usedBytesCount; ++i) {
-        resultBytesBuffer.push_back(
-            // Casting each byte to big endian makes the deserializer independent
-            // from current machine architecture, and, as result - platfrom portable.
-            boost::endian::native_to_big(
-                rawExportedBytesBuffer[i]));
+/*
+ * TrustLineAmount and TrustLineBalance are fixed width (256 bits) numbers,
+ * which limbs are stored inline, so their magnitude is written into (and read from)
+ * byte buffer directly, limb by limb, in big endian order,
+ * without intermediate exporting into vectors.
+ */
+template <typename FixedWidthNumber>
+inline void storeMagnitudeBigEndian(
+    const FixedWidthNumber &number,
+    byte *buffer)
+{
+    typedef multiprecision::limb_type Limb;
+    static_assert(
+        kTrustLineAmountBytesCount % sizeof(Limb) == 0,
+        "Amount bytes count must be aligned to the limb size");
+
+    memset(
+        buffer,
+        0,
+        kTrustLineAmountBytesCount);
+
+    const auto &backend = number.backend();
+    const auto limbs = backend.limbs();
+    for (size_t limbIndex = 0; limbIndex < backend.size(); ++limbIndex) {
+        const Limb limb = limbs[limbIndex];
+        // the least significant limb goes to the end of the buffer
+        byte *limbEnd = buffer + kTrustLineAmountBytesCount - limbIndex * sizeof(Limb);
+        for (size_t byteIndex = 0; byteIndex < sizeof(Limb); ++byteIndex) {
+            *(limbEnd - 1 - byteIndex) = (byte)(limb >> (8 * byteIndex));
+        }
     }
-
-    return resultBytesBuffer;
 }
 
-inline vector<byte> trustLineBalanceToBytes(
-    const TrustLineBalance &balance) {
-
-    vector<byte> rawExportedBytesBuffer, resultBytesBuffer;
-    // Exporting bytes of the "balance".
-    rawExportedBytesBuffer.reserve(kTrustLineAmountBytesCount);
-    export_bits(balance, back_inserter(rawExportedBytesBuffer), 8);
-
-    // Prepending received bytes by zeroes until 32 bytes would be used.
-    resultBytesBuffer.reserve(kTrustLineAmountBytesCount + 1);
-
-    size_t unusedBytesCount = kTrustLineAmountBytesCount - rawExportedBytesBuffer.size();
-    for (size_t i = 0; i < unusedBytesCount; ++i) {
-        resultBytesBuffer.push_back(0);
-    }
-
-    size_t usedBytesCount = rawExportedBytesBuffer.size();
-    for (size_t i = 0; i < usedBytesCount; ++i) {
-        resultBytesBuffer.push_back(
-            // Casting each byte to big endian makes the deserializer independent
-            // from current machine architecture, and, as result - platfrom portable.
-            boost::endian::native_to_big(
-                rawExportedBytesBuffer[i]));
+template <typename FixedWidthNumber>
+inline void loadMagnitudeBigEndian(
+    FixedWidthNumber &number,
+    const byte *buffer)
+{
+    typedef multiprecision::limb_type Limb;
+    const size_t kLimbsCount = kTrustLineAmountBytesCount / sizeof(Limb);
+
+    auto &backend = number.backend();
+    backend.resize(
+        kLimbsCount,
+        kLimbsCount);
+    auto limbs = backend.limbs();
+    for (size_t limbIndex = 0; limbIndex < kLimbsCount; ++limbIndex) {
+        const byte *limbBegin = buffer + kTrustLineAmountBytesCount - (limbIndex + 1) * sizeof(Limb);
+        Limb limb = 0;
+        for (size_t byteIndex = 0; byteIndex < sizeof(Limb); ++byteIndex) {
+            limb = (limb << 8) | limbBegin[byteIndex];
+        }
+        limbs[limbIndex] = limb;
     }
+    // drops leading zero limbs
+    backend.normalize();
+}
 
-    // Process sign
-    resultBytesBuffer.insert(
-        resultBytesBuffer.begin(),
-        boost::endian::native_to_big(
-            byte(balance < 0)));
+/*
+ * Writes kTrustLineAmountBytesCount bytes of the "amount" into the buffer.
+ */
+inline void trustLineAmountToBytes(
+    const TrustLineAmount &amount,
+    byte *buffer)
+{
+    storeMagnitudeBigEndian(
+        amount,
+        buffer);
+}
 
-    return resultBytesBuffer;
+/*
+ * Writes kTrustLineBalanceSerializeBytesCount bytes of the "balance" into the buffer:
+ * sign byte and kTrustLineBalanceBytesCount bytes of the absolute value.
+ */
+inline void trustLineBalanceToBytes(
+    const TrustLineBalance &balance,
+    byte *buffer)
+{
+    buffer[0] = byte(balance < 0);
+    storeMagnitudeBigEndian(
+        balance,
+        buffer + 1);
 }
 
 inline TrustLineAmount bytesToTrustLineAmount(
-    const vector<byte> &amountBytes) {
-
-    vector<byte> internalBytesBuffer;
-    internalBytesBuffer.reserve(kTrustLineAmountBytesCount);
-
-    for (size_t i=0; i<kTrustLineAmountBytesCount; ++i) {
-        internalBytesBuffer.push_back(
-            boost::endian::big_to_native(
-                amountBytes[i]));
-    }
-
+    const byte *buffer)
+{
     TrustLineAmount amount;
-    import_bits(
+    loadMagnitudeBigEndian(
         amount,
-        internalBytesBuffer.begin(),
-        internalBytesBuffer.end());
-
+        buffer);
     return amount;
 }
 
 inline TrustLineBalance bytesToTrustLineBalance(
-    const vector<byte> &balanceBytes) {
-
-    vector<byte> internalBytesBuffer;
-    internalBytesBuffer.reserve(kTrustLineAmountBytesCount);
-
-    // Note: sign byte must be skipped, so the cycle is starting from 1.
-    for (size_t i=1; i<kTrustLineAmountBytesCount+1; ++i) {
-        internalBytesBuffer.push_back(
-            boost::endian::big_to_native(
-                balanceBytes[i]));
-    }
-
+    const byte *buffer)
+{
     TrustLineBalance balance;
-    import_bits(
+    // Note: sign byte must be skipped.
+    loadMagnitudeBigEndian(
         balance,
-        internalBytesBuffer.begin(),
-        internalBytesBuffer.end());
+        buffer + 1);
 
     // Sign must be processed only in case if balance != 0.
     // By default, after deserialization, balance is always positive,
     // so it must be only checked for > 0, and not != 0.
-    if (balance > 0) {
-        byte sign = boost::endian::big_to_native(balanceBytes[0]);
-        if (sign != 0) {
-            balance = balance * -1;
-        }
+    if (buffer[0] != 0 and balance > 0) {
+        balance.backend().negate();
     }
-
     return balance;
 }
 
+inline vector<byte> trustLineAmountToBytes(
+    const TrustLineAmount &amount)
+{
+    vector<byte> resultBytesBuffer(
+        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        amount,
+        resultBytesBuffer.data());
+    return resultBytesBuffer;
+}
+
+inline vector<byte> trustLineBalanceToBytes(
+    const TrustLineBalance &balance)
+{
+    vector<byte> resultBytesBuffer(
+        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToBytes(
+        balance,
+        resultBytesBuffer.data());
+    return resultBytesBuffer;
+}
+
+inline TrustLineAmount bytesToTrustLineAmount(
+    const vector<byte> &amountBytes)
+{
+    return bytesToTrustLineAmount(
+        amountBytes.data());
+}
+
+inline TrustLineBalance bytesToTrustLineBalance(
+    const vector<byte> &balanceBytes)
+{
+    return bytesToTrustLineBalance(
+        balanceBytes.data());
+}
+
 inline BaseAddress::Shared deserializeAddress(
     byte* offset)
 {
@@ -0,0 +1,153 @@
+#include "TimerService.h"
+
+TimerService::TimerService(
+    as::io_service &ioService) :
+
+    mTimer(ioService),
+    mIsArmed(false),
+    mLastTimerID(kInvalidTimerID)
+{}
+
+TimerService::TimerID TimerService::schedule(
+    const Clock::time_point &expiry,
+    Callback callback)
+{
+    const auto kTimerID = ++mLastTimerID;
+    mCallbacks.insert(
+        make_pair(
+            make_pair(
+                expiry,
+                kTimerID),
+            callback));
+    mExpiries.insert(
+        make_pair(
+            kTimerID,
+            expiry));
+    rearm();
+    return kTimerID;
+}
+
+bool TimerService::cancel(
+    TimerID timerID)
+{
+    const auto kExpiry = mExpiries.find(timerID);
+    if (kExpiry == mExpiries.end()) {
+        return false;
+    }
+    mCallbacks.erase(
+        make_pair(
+            kExpiry->second,
+            timerID));
+    mExpiries.erase(kExpiry);
+    // timer is not rearmed on a later time, if it expires earlier it will be rearmed then
+    return true;
+}
+
+bool TimerService::isScheduled(
+    TimerID timerID) const
+{
+    return mExpiries.count(timerID) != 0;
+}
+
+TimerService::Clock::time_point TimerService::expiry(
+    TimerID timerID) const
+{
+    return mExpiries.at(timerID);
+}
+
+void TimerService::rearm()
+{
+    if (mCallbacks.empty()) {
+        return;
+    }
+    const auto kClosestExpiry = mCallbacks.begin()->first.first;
+    if (mIsArmed and mArmedExpiry <= kClosestExpiry) {
+        return;
+    }
+
+    mIsArmed = true;
+    mArmedExpiry = kClosestExpiry;
+    mTimer.expires_at(kClosestExpiry);
+    mTimer.async_wait(
+        boost::bind(
+            &TimerService::handleExpiration,
+            this,
+            as::placeholders::error));
+}
+
+void TimerService::handleExpiration(
+    const boost::system::error_code &error)
+{
+    if (error == as::error::operation_aborted) {
+        // timer was rearmed on an earlier time
+        return;
+    }
+    mIsArmed = false;
+
+    // expired callbacks are extracted before calling,
+    // because they can schedule or cancel other callbacks
+    const auto kNow = Clock::now();
+    vector<Callback> expiredCallbacks;
+    while (!mCallbacks.empty() and mCallbacks.begin()->first.first <= kNow) {
+        mExpiries.erase(
+            mCallbacks.begin()->first.second);
+        expiredCallbacks.push_back(
+            mCallbacks.begin()->second);
+        mCallbacks.erase(
+            mCallbacks.begin());
+    }
+    rearm();
+
+    for (const auto &callback : expiredCallbacks) {
+        callback();
+    }
+}
+
+TimerService::Timer::Timer(
+    TimerService *timerService) :
+
+    mTimerService(timerService),
+    mTimerID(kInvalidTimerID)
+{}
+
+TimerService::Timer::~Timer()
+{
+    cancel();
+}
+
+void TimerService::Timer::expiresAt(
+    const Clock::time_point &expiry,
+    Callback callback)
+{
+    cancel();
+    mTimerID = mTimerService->schedule(
+        expiry,
+        callback);
+}
+
+void TimerService::Timer::expiresFromNow(
+    const Clock::duration &delay,
+    Callback callback)
+{
+    expiresAt(
+        Clock::now() + delay,
+        callback);
+}
+
+void TimerService::Timer::cancel()
+{
+    if (mTimerID != kInvalidTimerID) {
+        mTimerService->cancel(mTimerID);
+        mTimerID = kInvalidTimerID;
+    }
+}
+
+bool TimerService::Timer::isPending() const
+{
+    return mTimerID != kInvalidTimerID and mTimerService->isScheduled(mTimerID);
+}
+
+TimerService::Clock::time_point TimerService::Timer::expiry() const
+{
+    return mTimerService->expiry(mTimerID);
+}
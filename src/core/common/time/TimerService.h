@@ -0,0 +1,114 @@
+#ifndef GEO_NETWORK_CLIENT_TIMERSERVICE_H
+#define GEO_NETWORK_CLIENT_TIMERSERVICE_H
+
+#include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/bind.hpp>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+namespace as = boost::asio;
+
+/**
+ * Shared timer for all components of the node.
+ *
+ * Keeps all scheduled callbacks ordered by expiration time and waits (via one steady_timer)
+ * only for the closest of them, so the node wakes up only when some callback really should be called.
+ * Callbacks are called on io_service thread; they can schedule and cancel other callbacks.
+ */
+class TimerService {
+
+public:
+    typedef chrono::steady_clock Clock;
+    typedef function<void()> Callback;
+    typedef uint64_t TimerID;
+
+    /**
+     * Cancellable handle of one scheduled callback.
+     * Scheduling of new callback cancels previous one, pending callback is cancelled on handle destroying.
+     */
+    class Timer {
+
+    public:
+        explicit Timer(
+            TimerService *timerService);
+
+        ~Timer();
+
+        Timer(const Timer &) = delete;
+
+        Timer& operator=(const Timer &) = delete;
+
+        void expiresAt(
+            const Clock::time_point &expiry,
+            Callback callback);
+
+        void expiresFromNow(
+            const Clock::duration &delay,
+            Callback callback);
+
+        void cancel();
+
+        bool isPending() const;
+
+        /**
+         * @return expiration time of pending callback.
+         * Must be called only if isPending() returns true.
+         */
+        Clock::time_point expiry() const;
+
+    private:
+        TimerService *mTimerService;
+        TimerID mTimerID;
+    };
+
+public:
+    explicit TimerService(
+        as::io_service &ioService);
+
+    /**
+     * @return id of scheduled callback, which can be used for its cancelling.
+     */
+    TimerID schedule(
+        const Clock::time_point &expiry,
+        Callback callback);
+
+    /**
+     * @return false if callback was already called or cancelled.
+     */
+    bool cancel(
+        TimerID timerID);
+
+    bool isScheduled(
+        TimerID timerID) const;
+
+    Clock::time_point expiry(
+        TimerID timerID) const;
+
+protected:
+    void rearm();
+
+    void handleExpiration(
+        const boost::system::error_code &error);
+
+protected:
+    // id 0 is never used, so it can be used as id of absent timer
+    static const TimerID kInvalidTimerID = 0;
+
+    as::steady_timer mTimer;
+    bool mIsArmed;
+    Clock::time_point mArmedExpiry;
+
+    TimerID mLastTimerID;
+    map<pair<Clock::time_point, TimerID>, Callback> mCallbacks;
+    unordered_map<TimerID, Clock::time_point> mExpiries;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_TIMERSERVICE_H
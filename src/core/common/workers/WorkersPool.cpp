@@ -0,0 +1,50 @@
+#include "WorkersPool.h"
+
+WorkersPool::WorkersPool(
+    as::io_service &mainIOService,
+    size_t workersCount) :
+
+    mMainIOService(mainIOService)
+{
+    if (workersCount == 0) {
+        return;
+    }
+
+    mWork = make_unique<as::io_service::work>(
+        mWorkersIOService);
+    mWorkers.reserve(workersCount);
+    for (size_t i = 0; i < workersCount; ++i) {
+        mWorkers.emplace_back(
+            [this]() {
+                mWorkersIOService.run();
+            });
+    }
+}
+
+WorkersPool::~WorkersPool()
+{
+    // tasks, which are not started yet, are dropped;
+    // results of finished ones would never be applied, because main io_service is already stopped
+    mWork = nullptr;
+    mWorkersIOService.stop();
+    for (auto &worker : mWorkers) {
+        worker.join();
+    }
+}
+
+size_t WorkersPool::workersCount() const
+{
+    return mWorkers.size();
+}
+
+as::io_service::strand& WorkersPool::equivalentStrand(
+    const SerializedEquivalent equivalent)
+{
+    lock_guard<mutex> lock(mStrandsMutex);
+    auto &strand = mStrands[equivalent];
+    if (strand == nullptr) {
+        strand = make_unique<as::io_service::strand>(
+            mWorkersIOService);
+    }
+    return *strand;
+}
@@ -0,0 +1,182 @@
+#ifndef GEO_NETWORK_CLIENT_WORKERSPOOL_H
+#define GEO_NETWORK_CLIENT_WORKERSPOOL_H
+
+#include "../Types.h"
+
+#include <boost/asio.hpp>
+
+#include <exception>
+#include <string>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace as = boost::asio;
+
+/**
+ * Pool of worker threads for CPU heavy computations of the node.
+ *
+ * State of the node (trust lines, transactions, storage, communicator) is owned by the main io_service thread
+ * and is not synchronized, so tasks, posted into the pool, must work only with data passed into them
+ * and must not touch any node component (including logger).
+ * Result of the task is passed to the completion handler, which is called on the main io_service thread,
+ * so it can safely apply result to the node state. If the task throws, its error is passed
+ * to the failure handler (on the main thread too) instead of the completion,
+ * so errors of the tasks never reach the main io_service loop.
+ *
+ * Tasks of one equivalent are serialized by the strand of this equivalent of the pool,
+ * tasks of different equivalents (and tasks without equivalent) are executed in parallel.
+ * Only the tasks, posted into the pool, are distributed between threads:
+ * subsystems and transactions of all equivalents are still run by the main io_service thread.
+ * If pool has no workers, task and its handlers are called immediately on the caller thread.
+ */
+class WorkersPool {
+
+public:
+    typedef function<void(const string &error)> FailureHandler;
+
+public:
+    WorkersPool(
+        as::io_service &mainIOService,
+        size_t workersCount);
+
+    ~WorkersPool();
+
+    WorkersPool(const WorkersPool &) = delete;
+
+    WorkersPool& operator=(const WorkersPool &) = delete;
+
+    size_t workersCount() const;
+
+    /**
+     * Tasks of the same equivalent are executed one by one, in order of posting.
+     * Exactly one of the completion and failure handlers is called for each task.
+     */
+    template <typename Result>
+    void post(
+        const SerializedEquivalent equivalent,
+        function<Result()> task,
+        function<void(Result)> completion,
+        FailureHandler failure)
+    {
+        if (mWorkers.empty()) {
+            runInPlace(
+                task,
+                completion,
+                failure);
+            return;
+        }
+        postInto(
+            equivalentStrand(equivalent),
+            task,
+            completion,
+            failure);
+    }
+
+    /**
+     * Tasks are executed in parallel, so their handlers may be called in any order.
+     */
+    template <typename Result>
+    void post(
+        function<Result()> task,
+        function<void(Result)> completion,
+        FailureHandler failure)
+    {
+        if (mWorkers.empty()) {
+            runInPlace(
+                task,
+                completion,
+                failure);
+            return;
+        }
+        postInto(
+            mWorkersIOService,
+            task,
+            completion,
+            failure);
+    }
+
+protected:
+    /**
+     * @returns result of the task or nullptr if the task has thrown (error is written into "error").
+     */
+    template <typename Result>
+    static shared_ptr<Result> runTask(
+        const function<Result()> &task,
+        string &error)
+    {
+        try {
+            return make_shared<Result>(task());
+
+        } catch (std::exception &e) {
+            error = e.what();
+        } catch (...) {
+            error = "unknown error";
+        }
+        return nullptr;
+    }
+
+    template <typename Result>
+    static void runInPlace(
+        const function<Result()> &task,
+        const function<void(Result)> &completion,
+        const FailureHandler &failure)
+    {
+        string error;
+        auto result = runTask(task, error);
+        if (result == nullptr) {
+            failure(error);
+            return;
+        }
+        completion(move(*result));
+    }
+
+    template <typename Executor, typename Result>
+    void postInto(
+        Executor &executor,
+        function<Result()> task,
+        function<void(Result)> completion,
+        FailureHandler failure)
+    {
+        auto &mainIOService = mMainIOService;
+        executor.post(
+            [&mainIOService, task, completion, failure]() {
+                auto error = make_shared<string>();
+                auto result = runTask(task, *error);
+                if (result == nullptr) {
+                    mainIOService.post(
+                        [failure, error]() {
+                            failure(*error);
+                        });
+                    return;
+                }
+                mainIOService.post(
+                    [completion, result]() {
+                        completion(move(*result));
+                    });
+            });
+    }
+
+protected:
+    as::io_service::strand& equivalentStrand(
+        const SerializedEquivalent equivalent);
+
+protected:
+    as::io_service &mMainIOService;
+    as::io_service mWorkersIOService;
+    unique_ptr<as::io_service::work> mWork;
+    vector<thread> mWorkers;
+
+    // strands are created on demand, from main thread only, but they are guarded anyway
+    // to keep the pool usable from any thread
+    mutex mStrandsMutex;
+    map<SerializedEquivalent, unique_ptr<as::io_service::strand>> mStrands;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_WORKERSPOOL_H
@@ -1,9 +1,12 @@
 #include "ContractorsManager.h"
 
+const ContractorID ContractorsManager::kNotFoundContractorID;
+
 ContractorsManager::ContractorsManager(
     vector<pair<string, string>> ownAddressesStr,
     StorageHandler *storageHandler,
     Logger &logger):
+    mContractorsCount(0),
     mStorageHandler(storageHandler),
     mLogger(logger)
 {
@@ -62,15 +65,13 @@ ContractorsManager::ContractorsManager(
             contractor->getID());
         contractor->setAddresses(
             contractorAddresses);
-        mContractors.insert(
-            make_pair(
-                contractor->getID(),
-                contractor));
+        addContractor(
+            contractor);
     }
 #ifdef DEBUG_LOG_TRUST_LINES_PROCESSING
     debug() << "Contractors:";
-    for (const auto &contractor : mContractors) {
-        debug() << contractor.second->toString();
+    for (const auto &contractor : allContractors()) {
+        debug() << contractor->toString();
     }
     debug() << "Own addresses:";
     for (const auto &address : mSelf->addresses()) {
@@ -83,10 +84,12 @@ ContractorsManager::ContractorsManager(
 vector<Contractor::Shared> ContractorsManager::allContractors() const
 {
     vector<Contractor::Shared> result;
-    result.reserve(mContractors.size());
+    result.reserve(mContractorsCount);
     for (const auto &contractor : mContractors) {
-        result.push_back(
-            contractor.second);
+        if (contractor != nullptr) {
+            result.push_back(
+                contractor);
+        }
     }
     return result;
 }
@@ -105,32 +108,35 @@ Contractor::Shared ContractorsManager::createContractor(
 
     auto id = nextFreeID(ioTransaction);
     info() << "New contractor initializing " << id;
+    Contractor::Shared contractor;
     if (cryptoKey.empty()) {
-        auto contractor = make_shared<Contractor>(
+        contractor = make_shared<Contractor>(
             id,
             contractorAddresses,
             MsgEncryptor::generateKeyTrio());
-        mContractors[id] = contractor;
+        addContractor(
+            contractor);
         ioTransaction->contractorsHandler()->saveContractor(
-            mContractors[id]);
+            contractor);
     } else {
-        auto contractor = make_shared<Contractor>(
+        contractor = make_shared<Contractor>(
             id,
             contractorAddresses,
             MsgEncryptor::generateKeyTrio(cryptoKey));
         contractor->setOwnIdOnContractorSide(
             channelIDOnContractorSide);
         contractor->confirm();
-        mContractors[id] = contractor;
+        addContractor(
+            contractor);
         ioTransaction->contractorsHandler()->saveContractorFull(
-            mContractors[id]);
+            contractor);
     }
     for (const auto &address : contractorAddresses) {
         ioTransaction->addressHandler()->saveAddress(
             id,
             address);
     }
-    return mContractors[id];
+    return contractor;
 }
 
 void ContractorsManager::setConfirmationInfo(
@@ -143,7 +149,7 @@ void ContractorsManager::setConfirmationInfo(
         throw NotFoundError(logHeader() + " There is no contractor " + to_string(contractorID));
     }
 
-    auto contractor = mContractors[contractorID];
+    auto contractor = mContractors.at(contractorID);
     if (!contractor->cryptoKey()) {
         throw NotFoundError(logHeader() + " This contractor does not support encryption " + to_string(contractorID));
     }
@@ -164,7 +170,7 @@ void ContractorsManager::updateContractorCryptoKey(
         throw NotFoundError(logHeader() + " There is no contractor " + to_string(contractorID));
     }
 
-    auto contractor = mContractors[contractorID];
+    auto contractor = mContractors.at(contractorID);
     if (!contractor->cryptoKey()) {
         throw NotFoundError(logHeader() + " This contractor does not support encryption " + to_string(contractorID));
     }
@@ -184,7 +190,7 @@ void ContractorsManager::updateChannelIDOnContractorSide(
         throw NotFoundError(logHeader() + " There is no contractor " + to_string(contractorID));
     }
 
-    auto contractor = mContractors[contractorID];
+    auto contractor = mContractors.at(contractorID);
 
     contractor->setOwnIdOnContractorSide(channelIdOnContractorSide);
     ioTransaction->contractorsHandler()->updateChannelIdOnContractorSide(
@@ -199,7 +205,7 @@ void ContractorsManager::regenerateCryptoKey(
         throw NotFoundError(logHeader() + " There is no contractor " + to_string(contractorID));
     }
 
-    auto contractor = mContractors[contractorID];
+    auto contractor = mContractors.at(contractorID);
     if (!contractor->cryptoKey()) {
         throw NotFoundError(logHeader() + " This contractor does not support encryption " + to_string(contractorID));
     }
@@ -215,7 +221,7 @@ void ContractorsManager::regenerateCryptoKey(
 bool ContractorsManager::contractorPresent(
     ContractorID contractorID) const
 {
-    return mContractors.find(contractorID) != mContractors.end();
+    return contractorID < mContractors.size() and mContractors[contractorID] != nullptr;
 }
 
 bool ContractorsManager::channelConfirmed(
@@ -249,26 +255,37 @@ ContractorID ContractorsManager::contractorIDByAddresses(
     vector<BaseAddress::Shared> &checkedAddresses) const
 {
     // todo : throw error if contractor is present but only with partial addresses
-    for (const auto &contractor : mContractors) {
-        bool contractorMatches = true;
-        for (const auto &contractorAddress : contractor.second->addresses()) {
-            bool addressMatches = false;
-            for (const auto &checkedAddress : checkedAddresses) {
-                if (checkedAddress == contractorAddress) {
-                    addressMatches = true;
+    // Contractor matches if all its addresses are present in checkedAddresses,
+    // so only contractors, which own any of checked addresses, are checked.
+    auto result = kNotFoundContractorID;
+    for (const auto &checkedAddress : checkedAddresses) {
+        auto candidatesIDs = mContractorsIDsByAddresses.equal_range(
+            addressKey(checkedAddress));
+        for (auto candidateID = candidatesIDs.first; candidateID != candidatesIDs.second; candidateID++) {
+            if (candidateID->second >= result) {
+                // contractor with the lowest id is returned, as it was found first
+                continue;
+            }
+            bool contractorMatches = true;
+            for (const auto &contractorAddress : mContractors[candidateID->second]->addresses()) {
+                bool addressMatches = false;
+                for (const auto &address : checkedAddresses) {
+                    if (address == contractorAddress) {
+                        addressMatches = true;
+                        break;
+                    }
+                }
+                if (!addressMatches) {
+                    contractorMatches = false;
                     break;
                 }
             }
-            if (!addressMatches) {
-                contractorMatches = false;
-                break;
+            if (contractorMatches) {
+                result = candidateID->second;
             }
         }
-        if (contractorMatches) {
-            return contractor.first;
-        }
     }
-    return kNotFoundContractorID;
+    return result;
 }
 
 const ContractorID ContractorsManager::nextFreeID(
@@ -318,14 +335,13 @@ BaseAddress::Shared ContractorsManager::contractorMainAddress(
 ContractorID ContractorsManager::contractorIDByAddress(
     BaseAddress::Shared address) const
 {
-    for (const auto &contractor : mContractors) {
-        for (const auto &contractorAddress : contractor.second->addresses()) {
-            if (contractorAddress == address) {
-                return contractor.first;
-            }
-        }
+    auto result = kNotFoundContractorID;
+    auto contractorsIDs = mContractorsIDsByAddresses.equal_range(
+        addressKey(address));
+    for (auto contractorID = contractorsIDs.first; contractorID != contractorsIDs.second; contractorID++) {
+        result = min(result, contractorID->second);
     }
-    return kNotFoundContractorID;
+    return result;
 }
 
 Contractor::Shared ContractorsManager::selfContractor() const
@@ -347,7 +363,13 @@ void ContractorsManager::updateContractorAddresses(
             contractorID,
             address);
     }
-    mContractors.at(contractorID)->setAddresses(newAddresses);
+    unindexContractorAddresses(
+        contractorID,
+        mContractors[contractorID]->addresses());
+    mContractors[contractorID]->setAddresses(newAddresses);
+    indexContractorAddresses(
+        contractorID,
+        newAddresses);
 }
 
 void ContractorsManager::removeContractor(
@@ -362,7 +384,90 @@ void ContractorsManager::removeContractor(
 
     ioTransaction->addressHandler()->removeAddresses(contractorID);
     ioTransaction->contractorsHandler()->removeContractor(contractorID);
-    mContractors.erase(contractorID);
+    if (!contractorPresent(contractorID)) {
+        return;
+    }
+    unindexContractorAddresses(
+        contractorID,
+        mContractors[contractorID]->addresses());
+    mContractors[contractorID] = nullptr;
+    mContractorsCount--;
+    while (!mContractors.empty() and mContractors.back() == nullptr) {
+        mContractors.pop_back();
+    }
+}
+
+size_t ContractorsManager::allocatedBytesCount() const
+{
+    size_t bytesCount = mContractors.capacity() * sizeof(Contractor::Shared)
+                        + mContractorsCount * sizeof(Contractor);
+    for (const auto &contractor : mContractors) {
+        if (contractor != nullptr) {
+            bytesCount += contractor->addresses().size() * sizeof(BaseAddress::Shared);
+        }
+    }
+
+    // each node of the index holds pointer to the next node, key and contractor id
+    bytesCount += mContractorsIDsByAddresses.bucket_count() * sizeof(void*);
+    for (const auto &addressKeyAndID : mContractorsIDsByAddresses) {
+        bytesCount += sizeof(void*) + sizeof(addressKeyAndID) + addressKeyAndID.first.capacity();
+    }
+    return bytesCount;
+}
+
+void ContractorsManager::addContractor(
+    Contractor::Shared contractor)
+{
+    const auto kContractorID = contractor->getID();
+    if (kContractorID >= mContractors.size()) {
+        mContractors.resize(
+            kContractorID + 1);
+    }
+    if (mContractors[kContractorID] != nullptr) {
+        unindexContractorAddresses(
+            kContractorID,
+            mContractors[kContractorID]->addresses());
+    } else {
+        mContractorsCount++;
+    }
+    mContractors[kContractorID] = contractor;
+    indexContractorAddresses(
+        kContractorID,
+        contractor->addresses());
+}
+
+void ContractorsManager::indexContractorAddresses(
+    ContractorID contractorID,
+    const vector<BaseAddress::Shared> &addresses)
+{
+    for (const auto &address : addresses) {
+        mContractorsIDsByAddresses.insert(
+            make_pair(
+                addressKey(address),
+                contractorID));
+    }
+}
+
+void ContractorsManager::unindexContractorAddresses(
+    ContractorID contractorID,
+    const vector<BaseAddress::Shared> &addresses)
+{
+    for (const auto &address : addresses) {
+        auto contractorsIDs = mContractorsIDsByAddresses.equal_range(
+            addressKey(address));
+        for (auto it = contractorsIDs.first; it != contractorsIDs.second; it++) {
+            if (it->second == contractorID) {
+                mContractorsIDsByAddresses.erase(it);
+                break;
+            }
+        }
+    }
+}
+
+string ContractorsManager::addressKey(
+    BaseAddress::Shared address)
+{
+    return to_string(address->typeID()) + " " + address->fullAddress();
 }
 
 const string ContractorsManager::logHeader() const
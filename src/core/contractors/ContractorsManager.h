@@ -6,7 +6,8 @@
 #include "../common/exceptions/ValueError.h"
 #include "../common/exceptions/NotFoundError.h"
 
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 class ContractorsManager {
 
@@ -83,10 +84,31 @@ public:
         IOTransaction::Shared ioTransaction,
         ContractorID contractorID);
 
+    /**
+     * @returns approximate count of bytes, occupied by contractors and their addresses index in memory
+     * (addresses and crypto keys objects are not taken into account).
+     */
+    size_t allocatedBytesCount() const;
+
 protected:
     const ContractorID nextFreeID(
         IOTransaction::Shared ioTransaction) const;
 
+    void addContractor(
+        Contractor::Shared contractor);
+
+    void indexContractorAddresses(
+        ContractorID contractorID,
+        const vector<BaseAddress::Shared> &addresses);
+
+    void unindexContractorAddresses(
+        ContractorID contractorID,
+        const vector<BaseAddress::Shared> &addresses);
+
+    // addresses are equal if their types and full addresses are equal
+    static string addressKey(
+        BaseAddress::Shared address);
+
 protected: // log shortcuts
     const string logHeader() const
     noexcept;
@@ -104,7 +126,13 @@ public:
     static const ContractorID kNotFoundContractorID = std::numeric_limits<ContractorID>::max();
 
 private:
-    map<ContractorID, Contractor::Shared> mContractors;
+    // Contractors ids are dense (new contractor gets the first free id), so contractors are stored by their ids,
+    // absent contractors are nullptr.
+    vector<Contractor::Shared> mContractors;
+    size_t mContractorsCount;
+    // ids of contractors by their addresses.
+    // Multimap is used, because addresses of different contractors are not guaranteed to be unique.
+    unordered_multimap<string, ContractorID> mContractorsIDsByAddresses;
     Contractor::Shared mSelf;
     StorageHandler *mStorageHandler;
     Logger &mLogger;
@@ -58,6 +58,9 @@ namespace crypto {
         IOTransaction::Shared ioTransaction,
         const TransactionUUID &transactionUUID)
     {
+        // key is generated, hashed and saved by one unlocking of keys memory
+        memory::SecureArena::UnlockScope keysUnlockScope(
+            lamport::PrivateKey::keysArena());
         lamport::PrivateKey pKey;
         auto pubKey = pKey.derivePublicKey();
         ioTransaction->paymentKeysHandler()->saveOwnKey(
@@ -74,13 +77,16 @@ namespace crypto {
         size_t dataForSignBytesCount)
     {
         try {
-            auto privateKey = ioTransaction->paymentKeysHandler()->getOwnPrivateKey(
-                transactionUUID);
+            memory::SecureArena::UnlockScope keysUnlockScope(
+                lamport::PrivateKey::keysArena());
+            unique_ptr<lamport::PrivateKey> privateKey(
+                ioTransaction->paymentKeysHandler()->getOwnPrivateKey(
+                    transactionUUID));
             debug() << "Key is ready fro signing";
             return make_shared<Signature>(
                 dataForSign.get(),
                 dataForSignBytesCount,
-                privateKey);
+                privateKey.get());
         } catch (NotFoundError &e) {
             warning() << "Can't get key for transaction " << transactionUUID.stringUUID()
                       << ". Details: " << e.what();
@@ -136,6 +142,9 @@ namespace crypto {
         info() << "Keys set sequence number " << currentKeysSetSequenceNumber;
         auto cntFailedAttempts = 0;
         keyNumberGuard(keyPairsCount);
+        // all keys of the set are generated, hashed and saved by one unlocking of keys memory
+        memory::SecureArena::UnlockScope keysUnlockScope(
+            lamport::PrivateKey::keysArena());
         for (KeyNumber idx = 0; idx < keyPairsCount; idx++) {
             lamport::PrivateKey pKey;
             auto pubKey = pKey.derivePublicKey();
@@ -240,6 +249,8 @@ namespace crypto {
     {
         dataGuard(data, size);
 
+        memory::SecureArena::UnlockScope keysUnlockScope(
+            lamport::PrivateKey::keysArena());
         pair<PrivateKey*, KeyNumber> privateKeyAndNumber;
         try {
             privateKeyAndNumber = ioTransaction->ownKeysHandler()->nextAvailableKey(
@@ -250,11 +261,13 @@ namespace crypto {
             warning() << "Can't get available private key for TL " << mTrustLineID;
             throw e;
         }
+        unique_ptr<PrivateKey> privateKey(
+            privateKeyAndNumber.first);
 
         auto signature = make_shared<lamport::Signature>(
             data.get(),
             size,
-            privateKeyAndNumber.first);
+            privateKey.get());
 
         return make_pair(
             signature,
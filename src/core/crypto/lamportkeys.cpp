@@ -12,7 +12,7 @@ const size_t BaseKey::keySize()
 
 
 PrivateKey::PrivateKey():
-    mData(memory::SecureSegment(kRandomNumbersCount * kRandomNumberSize)),
+    mData(keysArena()),
     mIsCropped(false)
 {
     auto guard = mData.unlockAndInitGuard();
@@ -26,7 +26,7 @@ PrivateKey::PrivateKey():
 
 PrivateKey::PrivateKey(
     byte *data) :
-    mData(memory::SecureSegment(keySize())),
+    mData(keysArena()),
     mIsCropped(false)
 {
     auto guard = mData.unlockAndInitGuard();
@@ -67,6 +67,14 @@ const memory::SecureSegment* PrivateKey::data() const
     return &mData;
 }
 
+memory::SecureArena& PrivateKey::keysArena()
+{
+    static memory::SecureArena arena(
+        keySize(),
+        kKeysArenaChunkSlotsCount);
+    return arena;
+}
+
 PublicKey::PublicKey(
     byte *data)
 {
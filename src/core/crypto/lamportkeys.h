@@ -99,6 +99,15 @@ public:
 
     const memory::SecureSegment* data() const;
 
+    /**
+     * @returns arena, which holds all private keys.
+     * Keys slots can be unlocked together via memory::SecureArena::UnlockScope on it.
+     */
+    static memory::SecureArena& keysArena();
+
+private:
+    static const size_t kKeysArenaChunkSlotsCount = 16;
+
 private:
     memory::SecureSegment mData;
     bool mIsCropped;
@@ -7,7 +7,8 @@ namespace memory {
 
 SecureSegment::SecureSegment(
     size_t bytesCount):
-    mSize(bytesCount) {
+    mSize(bytesCount),
+    mArena(nullptr) {
 
     mAddress = static_cast<byte*>(sodium_malloc(bytesCount));
     if (mAddress == nullptr) {
@@ -24,6 +25,12 @@ SecureSegment::SecureSegment(
     }
 }
 
+SecureSegment::SecureSegment(
+    SecureArena &arena):
+    mAddress(arena.allocateSlot()),
+    mSize(arena.slotSize()),
+    mArena(&arena) {}
+
 SecureSegment::~SecureSegment()
     noexcept {
 
@@ -44,16 +51,47 @@ byte *SecureSegment::address()
     return mAddress;
 }
 
+size_t SecureSegment::size()
+    const
+    noexcept {
+
+    return mSize;
+}
+
 void SecureSegment::wipeAndFree()
     noexcept {
 
     if (mAddress != nullptr) {
-        sodium_free(mAddress);
+        if (mArena != nullptr) {
+            mArena->freeSlot(mAddress);
+        } else {
+            sodium_free(mAddress);
+        }
         mAddress = nullptr;
         mSize = 0;
     }
 }
 
+void SecureSegment::unlock()
+    noexcept {
+
+    if (mArena != nullptr) {
+        mArena->unlockSlot(mAddress);
+    } else {
+        sodium_mprotect_readwrite(mAddress);
+    }
+}
+
+void SecureSegment::lock()
+    noexcept {
+
+    if (mArena != nullptr) {
+        mArena->lockSlot(mAddress);
+    } else {
+        sodium_mprotect_noaccess(mAddress);
+    }
+}
+
 
 SecureSegmentGuard::SecureSegmentGuard(
     SecureSegment &segment)
@@ -61,13 +99,13 @@ SecureSegmentGuard::SecureSegmentGuard(
 
     mSegment(segment){
 
-   sodium_mprotect_readwrite(mSegment.address());
+    mSegment.unlock();
 }
 
 SecureSegmentGuard::~SecureSegmentGuard()
     noexcept {
 
-   sodium_mprotect_noaccess(mSegment.address());
+    mSegment.lock();
 }
 
 byte *SecureSegmentGuard::address() const noexcept {
@@ -75,5 +113,169 @@ byte *SecureSegmentGuard::address() const noexcept {
 }
 
 
+SecureArena::SecureArena(
+    size_t slotSize,
+    size_t chunkSlotsCount):
+    mSlotSize(slotSize),
+    mChunkSlotsCount(chunkSlotsCount),
+    mScopesCount(0) {}
+
+SecureArena::~SecureArena()
+    noexcept {
+
+    for (const auto &chunk : mChunks) {
+        // sodium_free() fills the chunk with zeros before deallocation
+        sodium_free(chunk.mAddress);
+    }
+}
+
+size_t SecureArena::slotSize()
+    const
+    noexcept {
+
+    return mSlotSize;
+}
+
+size_t SecureArena::allocatedBytesCount()
+    noexcept {
+
+    lock_guard<mutex> lock(mMutex);
+    return mChunks.size() * mChunkSlotsCount * mSlotSize;
+}
+
+size_t SecureArena::usedSlotsCount()
+    noexcept {
+
+    lock_guard<mutex> lock(mMutex);
+    return mChunks.size() * mChunkSlotsCount - mFreeSlots.size();
+}
+
+byte *SecureArena::allocateSlot() {
+    lock_guard<mutex> lock(mMutex);
+    if (mFreeSlots.empty()) {
+        allocateChunk();
+    }
+    auto slot = mFreeSlots.back();
+    mFreeSlots.pop_back();
+    return slot;
+}
+
+void SecureArena::freeSlot(
+    byte *slot)
+    noexcept {
+
+    lock_guard<mutex> lock(mMutex);
+    auto &chunk = chunkOfSlot(slot);
+    unlockChunk(chunk);
+    sodium_memzero(slot, mSlotSize);
+    lockChunk(chunk);
+    mFreeSlots.push_back(slot);
+}
+
+void SecureArena::unlockSlot(
+    byte *slot)
+    noexcept {
+
+    lock_guard<mutex> lock(mMutex);
+    unlockChunk(
+        chunkOfSlot(slot));
+}
+
+void SecureArena::lockSlot(
+    byte *slot)
+    noexcept {
+
+    lock_guard<mutex> lock(mMutex);
+    lockChunk(
+        chunkOfSlot(slot));
+}
+
+void SecureArena::allocateChunk() {
+    auto address = static_cast<byte*>(sodium_malloc(mSlotSize * mChunkSlotsCount));
+    if (address == nullptr) {
+        throw MemoryError("SecureArena::allocateChunk: "
+                              "Can't allocate secure memory chunk.");
+    }
+
+    // chunk, allocated inside unlock scope, must stay unlocked until the scope end
+    if (mScopesCount == 0 and sodium_mprotect_noaccess(address) != 0) {
+        sodium_free(address);
+        throw MemoryError("SecureArena::allocateChunk: "
+                              "Can't lock secure memory chunk.");
+    }
+
+    mChunksIndexes.insert(
+        make_pair(
+            address,
+            mChunks.size()));
+    mChunks.push_back({
+        address,
+        mScopesCount});
+    mFreeSlots.reserve(
+        mFreeSlots.size() + mChunkSlotsCount);
+    // slots are handed out from the beginning of the chunk
+    for (size_t i = mChunkSlotsCount; i > 0; --i) {
+        mFreeSlots.push_back(
+            address + (i - 1) * mSlotSize);
+    }
+}
+
+SecureArena::Chunk &SecureArena::chunkOfSlot(
+    byte *slot)
+    noexcept {
+
+    // chunk of the slot is the last one, which begins not after the slot
+    auto chunkAddressAndIndex = mChunksIndexes.upper_bound(slot);
+    if (chunkAddressAndIndex == mChunksIndexes.begin()) {
+        // slot always belongs to one of the chunks
+        abort();
+    }
+    chunkAddressAndIndex--;
+    return mChunks[chunkAddressAndIndex->second];
+}
+
+void SecureArena::unlockChunk(
+    Chunk &chunk)
+    noexcept {
+
+    if (chunk.mUnlocksCount++ == 0) {
+        sodium_mprotect_readwrite(chunk.mAddress);
+    }
+}
+
+void SecureArena::lockChunk(
+    Chunk &chunk)
+    noexcept {
+
+    if (--chunk.mUnlocksCount == 0) {
+        sodium_mprotect_noaccess(chunk.mAddress);
+    }
+}
+
+
+SecureArena::UnlockScope::UnlockScope(
+    SecureArena &arena)
+    noexcept:
+
+    mArena(arena) {
+
+    lock_guard<mutex> lock(mArena.mMutex);
+    mArena.mScopesCount++;
+    for (auto &chunk : mArena.mChunks) {
+        mArena.unlockChunk(chunk);
+    }
+}
+
+SecureArena::UnlockScope::~UnlockScope()
+    noexcept {
+
+    lock_guard<mutex> lock(mArena.mMutex);
+    mArena.mScopesCount--;
+    for (auto &chunk : mArena.mChunks) {
+        mArena.lockChunk(chunk);
+    }
+}
+
+
 }
 }
@@ -5,6 +5,13 @@
 #include <sodium/core.h>
 
 #include "../common/Types.h"
+#include "../common/exceptions/MemoryError.h"
+
+#include <boost/noncopyable.hpp>
+
+#include <map>
+#include <mutex>
+#include <vector>
 
 
 namespace crypto {
@@ -12,6 +19,7 @@ namespace memory {
 
 
 class SecureSegment;
+class SecureArena;
 
 /**
  * @brief
@@ -88,6 +96,17 @@ public:
     SecureSegment(
         size_t bytesCount);
 
+    /**
+     * @brief
+     * Takes fixed size slot from the arena instead of separate allocation,
+     * so no guard pages, canary and mmap calls are needed for each segment.
+     * The slot is wiped and returned into the arena on destruction.
+     *
+     * @throws "MemoryError" on allocation error.
+     */
+    SecureSegment(
+        SecureArena &arena);
+
     /**
      * @brief
      * The wipe() function unlocks and deallocates memory allocated using constructor.
@@ -125,9 +144,126 @@ public:
     void wipeAndFree()
         noexcept;
 
+private:
+    void unlock()
+        noexcept;
+
+    void lock()
+        noexcept;
+
 private:
     byte *mAddress;
     size_t mSize;
+    // nullptr in case if segment was allocated separately
+    SecureArena *mArena;
+};
+
+
+/**
+ * @brief
+ * SecureArena hands out fixed size slots of secure memory.
+ *
+ * Slots are grouped into chunks, each chunk is allocated via sodium_malloc(),
+ * so it is locked in memory, surrounded by guard pages and protected by canary as a whole,
+ * and is inaccessible while none of its slots is unlocked.
+ * Chunk is unlocked (via mprotect) on the first unlocking of its slots and is locked back on the last locking.
+ *
+ * UnlockScope keeps all chunks of the arena unlocked during its lifetime,
+ * so any count of slots can be accessed inside it by one pair of mprotect calls per chunk.
+ *
+ * Freed slots are wiped and reused, chunks are released only on arena destruction.
+ * Arena is thread safe.
+ */
+class SecureArena:
+    boost::noncopyable {
+    friend class SecureSegment;
+
+public:
+    class UnlockScope:
+        boost::noncopyable {
+    public:
+        explicit UnlockScope(
+            SecureArena &arena)
+            noexcept;
+
+        ~UnlockScope()
+            noexcept;
+
+    private:
+        SecureArena &mArena;
+    };
+
+public:
+    SecureArena(
+        size_t slotSize,
+        size_t chunkSlotsCount);
+
+    ~SecureArena()
+        noexcept;
+
+    size_t slotSize()
+        const
+        noexcept;
+
+    /**
+     * @returns count of bytes of secure memory, allocated by the arena (including free slots).
+     */
+    size_t allocatedBytesCount()
+        noexcept;
+
+    size_t usedSlotsCount()
+        noexcept;
+
+protected:
+    struct Chunk {
+        byte *mAddress;
+        size_t mUnlocksCount;
+    };
+
+protected:
+    /**
+     * @throws "MemoryError" if new chunk can't be allocated.
+     */
+    byte* allocateSlot();
+
+    void freeSlot(
+        byte *slot)
+        noexcept;
+
+    void unlockSlot(
+        byte *slot)
+        noexcept;
+
+    void lockSlot(
+        byte *slot)
+        noexcept;
+
+    void allocateChunk();
+
+    Chunk& chunkOfSlot(
+        byte *slot)
+        noexcept;
+
+    void unlockChunk(
+        Chunk &chunk)
+        noexcept;
+
+    void lockChunk(
+        Chunk &chunk)
+        noexcept;
+
+protected:
+    const size_t mSlotSize;
+    const size_t mChunkSlotsCount;
+
+    vector<Chunk> mChunks;
+    // index of the chunk in mChunks by the chunk address, is used for fast search of the chunk of the slot
+    map<byte*, size_t> mChunksIndexes;
+    vector<byte*> mFreeSlots;
+    // count of UnlockScopes, which are alive now
+    size_t mScopesCount;
+
+    mutex mMutex;
 };
 
 
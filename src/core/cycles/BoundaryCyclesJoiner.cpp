@@ -0,0 +1,157 @@
+#include "BoundaryCyclesJoiner.h"
+
+BoundaryCyclesJoiner::BoundaryCyclesJoiner(
+    BaseAddress::Shared selfAddress) :
+
+    mDuplicatedCyclesCount(0)
+{
+    internNode(
+        selfAddress);
+}
+
+void BoundaryCyclesJoiner::addOutgoingBranch(
+    const vector<BaseAddress::Shared> &branch,
+    const vector<BaseAddress::Shared> &boundaryNodes)
+{
+    addBranch(
+        branch,
+        boundaryNodes,
+        mOutgoingBranches,
+        mOutgoingBranchesBuckets);
+}
+
+void BoundaryCyclesJoiner::addIncomingBranch(
+    const vector<BaseAddress::Shared> &branch,
+    const vector<BaseAddress::Shared> &boundaryNodes)
+{
+    addBranch(
+        branch,
+        boundaryNodes,
+        mIncomingBranches,
+        mIncomingBranchesBuckets);
+}
+
+void BoundaryCyclesJoiner::addBranch(
+    const vector<BaseAddress::Shared> &branch,
+    const vector<BaseAddress::Shared> &boundaryNodes,
+    vector<Branch> &branches,
+    BranchesBuckets &branchesBuckets)
+{
+    Branch internedBranch;
+    internedBranch.reserve(branch.size());
+    for (const auto &node : branch) {
+        internedBranch.push_back(
+            internNode(node));
+    }
+    const auto kBranchIndex = branches.size();
+    branches.push_back(
+        internedBranch);
+
+    for (const auto &boundaryNode : boundaryNodes) {
+        const auto kBoundaryNodeIndex = internNode(
+            boundaryNode);
+        //  Prevent loop on cycles path
+        if (kBoundaryNodeIndex == kSelfNodeIndex or
+                isBranchContainsNode(internedBranch, kBoundaryNodeIndex)) {
+            continue;
+        }
+        branchesBuckets[kBoundaryNodeIndex].push_back(
+            kBranchIndex);
+    }
+}
+
+vector<Path::Shared> BoundaryCyclesJoiner::joinCycles()
+{
+    vector<Path::Shared> result;
+    unordered_set<vector<NodeIndex>, boost::hash<vector<NodeIndex>>> joinedCycles;
+
+    // iterate over smaller buckets map and look up into bigger one
+    const bool kIsOutgoingSmaller = mOutgoingBranchesBuckets.size() <= mIncomingBranchesBuckets.size();
+    const auto &kProbingBuckets = kIsOutgoingSmaller ? mOutgoingBranchesBuckets : mIncomingBranchesBuckets;
+    const auto &kLookupBuckets = kIsOutgoingSmaller ? mIncomingBranchesBuckets : mOutgoingBranchesBuckets;
+
+    for (const auto &probingBucket : kProbingBuckets) {
+        const auto kBoundaryNodeIndex = probingBucket.first;
+        const auto kLookupBucket = kLookupBuckets.find(kBoundaryNodeIndex);
+        if (kLookupBucket == kLookupBuckets.end()) {
+            continue;
+        }
+        const auto &kOutgoingBranchesIndexes = kIsOutgoingSmaller ? probingBucket.second : kLookupBucket->second;
+        const auto &kIncomingBranchesIndexes = kIsOutgoingSmaller ? kLookupBucket->second : probingBucket.second;
+
+        for (const auto &outgoingBranchIndex : kOutgoingBranchesIndexes) {
+            const auto &kOutgoingBranch = mOutgoingBranches[outgoingBranchIndex];
+            for (const auto &incomingBranchIndex : kIncomingBranchesIndexes) {
+                const auto &kIncomingBranch = mIncomingBranches[incomingBranchIndex];
+
+                bool isBranchesIntersect = false;
+                for (const auto &node : kIncomingBranch) {
+                    if (isBranchContainsNode(kOutgoingBranch, node)) {
+                        isBranchesIntersect = true;
+                        break;
+                    }
+                }
+                if (isBranchesIntersect) {
+                    continue;
+                }
+
+                vector<NodeIndex> cycle(
+                    kOutgoingBranch.begin(),
+                    kOutgoingBranch.end());
+                cycle.push_back(
+                    kBoundaryNodeIndex);
+                cycle.insert(
+                    cycle.end(),
+                    kIncomingBranch.rbegin(),
+                    kIncomingBranch.rend());
+
+                if (!joinedCycles.insert(cycle).second) {
+                    mDuplicatedCyclesCount++;
+                    continue;
+                }
+
+                vector<BaseAddress::Shared> cycleNodes;
+                cycleNodes.reserve(cycle.size());
+                for (const auto &node : cycle) {
+                    cycleNodes.push_back(
+                        mNodes[node]);
+                }
+                result.push_back(
+                    make_shared<Path>(
+                        cycleNodes));
+            }
+        }
+    }
+    return result;
+}
+
+size_t BoundaryCyclesJoiner::duplicatedCyclesCount() const
+{
+    return mDuplicatedCyclesCount;
+}
+
+BoundaryCyclesJoiner::NodeIndex BoundaryCyclesJoiner::internNode(
+    BaseAddress::Shared nodeAddress)
+{
+    const auto kIndexAndInserted = mNodesIndexes.insert(
+        make_pair(
+            nodeAddress->fullAddress(),
+            (NodeIndex)mNodes.size()));
+    if (kIndexAndInserted.second) {
+        mNodes.push_back(
+            nodeAddress);
+    }
+    return kIndexAndInserted.first->second;
+}
+
+bool BoundaryCyclesJoiner::isBranchContainsNode(
+    const Branch &branch,
+    NodeIndex node)
+{
+    for (const auto &branchNode : branch) {
+        if (branchNode == node) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,84 @@
+#ifndef GEO_NETWORK_CLIENT_BOUNDARYCYCLESJOINER_H
+#define GEO_NETWORK_CLIENT_BOUNDARYCYCLESJOINER_H
+
+#include "../contractors/addresses/BaseAddress.h"
+#include "../paths/lib/Path.h"
+
+#include <boost/functional/hash.hpp>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Builds five and six nodes cycles from branches, received in boundary messages.
+ *
+ * Outgoing branch starts from neighbor with positive balance, incoming branch - from neighbor with negative balance.
+ * Each pair of outgoing and incoming branches with common boundary node produces cycle
+ * [outgoing branch nodes, boundary node, reversed incoming branch nodes],
+ * in case if all nodes of this cycle are different.
+ *
+ * All nodes are interned into numeric ids, so branches are joined via hash buckets by boundary node id
+ * and compared without addresses comparing. Each cycle starts from neighbor of current node,
+ * so its nodes ids sequence is canonical form of it, which is used for cycles deduplication.
+ */
+class BoundaryCyclesJoiner {
+
+public:
+    typedef uint32_t NodeIndex;
+
+public:
+    BoundaryCyclesJoiner(
+        BaseAddress::Shared selfAddress);
+
+    void addOutgoingBranch(
+        const vector<BaseAddress::Shared> &branch,
+        const vector<BaseAddress::Shared> &boundaryNodes);
+
+    void addIncomingBranch(
+        const vector<BaseAddress::Shared> &branch,
+        const vector<BaseAddress::Shared> &boundaryNodes);
+
+    /**
+     * @return unique cycles, which can be built from added branches.
+     */
+    vector<Path::Shared> joinCycles();
+
+    size_t duplicatedCyclesCount() const;
+
+protected:
+    typedef vector<NodeIndex> Branch;
+    typedef unordered_map<NodeIndex, vector<size_t>> BranchesBuckets;
+
+protected:
+    NodeIndex internNode(
+        BaseAddress::Shared nodeAddress);
+
+    void addBranch(
+        const vector<BaseAddress::Shared> &branch,
+        const vector<BaseAddress::Shared> &boundaryNodes,
+        vector<Branch> &branches,
+        BranchesBuckets &branchesBuckets);
+
+    static bool isBranchContainsNode(
+        const Branch &branch,
+        NodeIndex node);
+
+protected:
+    // current node always has index 0
+    static const NodeIndex kSelfNodeIndex = 0;
+
+    vector<BaseAddress::Shared> mNodes;
+    unordered_map<string, NodeIndex> mNodesIndexes;
+
+    vector<Branch> mOutgoingBranches;
+    vector<Branch> mIncomingBranches;
+    // indexes of branches grouped by boundary nodes
+    BranchesBuckets mOutgoingBranchesBuckets;
+    BranchesBuckets mIncomingBranchesBuckets;
+
+    size_t mDuplicatedCyclesCount;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_BOUNDARYCYCLESJOINER_H
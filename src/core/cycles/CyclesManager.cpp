@@ -3,37 +3,43 @@
 CyclesManager::CyclesManager(
     const SerializedEquivalent equivalent,
     TransactionsScheduler *transactionsScheduler,
+    TrustLinesManager *trustLinesManager,
+    ContractorsManager *contractorsManager,
     as::io_service &ioService,
+    TimerService *timerService,
+    WorkersPool *workersPool,
     CyclesRunningParameters cyclesRunningParameters,
     Logger &logger,
     SubsystemsController *subsystemsController) :
 
     mEquivalent(equivalent),
     mTransactionScheduler(transactionsScheduler),
+    mTrustLinesManager(trustLinesManager),
+    mContractorsManager(contractorsManager),
     mIOService(ioService),
+    mWorkersPool(workersPool),
     mCyclesRunningParameters(cyclesRunningParameters),
     mLog(logger),
     mSubsystemsController(subsystemsController),
-    mIsCycleInProcess(false)
+    mSixNodesCycleTimer(timerService),
+    mFiveNodesCycleTimer(timerService),
+    mUpdatingTimer(timerService),
+    mFinishedCyclesCount(0),
+    mDroppedCyclesCount(0),
+    mThroughputPeriodStartedDateTime(utc_now())
 {
-    mCurrentCycleClosingState = CycleClosingState::ThreeNodes;
-
     srand(randomInitializer());
     int timeStarted = (10 * 60) + (rand() % (60 * 60 * 6));
 #ifdef TESTS
     timeStarted = kSignalStartTimeSecondsTests;
 #endif
     if (cyclesRunningParameters.mCyclesFiveNodesEnabled) {
-        mFiveNodesCycleTimer = make_unique<as::steady_timer>(
-            mIOService);
-        mFiveNodesCycleTimer->expires_from_now(
+        mFiveNodesCycleTimer.expiresFromNow(
             std::chrono::seconds(
-                timeStarted));
-        mFiveNodesCycleTimer->async_wait(
-            boost::bind(
-                &CyclesManager::runSignalFiveNodes,
-                this,
-                as::placeholders::error));
+                timeStarted),
+            [this]() {
+                runSignalFiveNodes();
+            });
     }
 
     timeStarted = (10 * 60) + (rand() % (60 * 60 * 6));
@@ -41,28 +47,13 @@ CyclesManager::CyclesManager(
     timeStarted = kSignalStartTimeSecondsTests;
 #endif
     if (cyclesRunningParameters.mCyclesSixNodesEnabled) {
-        mSixNodesCycleTimer = make_unique<as::steady_timer>(
-            mIOService);
-        mSixNodesCycleTimer->expires_from_now(
+        mSixNodesCycleTimer.expiresFromNow(
             std::chrono::seconds(
-                timeStarted));
-        mSixNodesCycleTimer->async_wait(
-            boost::bind(
-                &CyclesManager::runSignalSixNodes,
-                this,
-                as::placeholders::error));
+                timeStarted),
+            [this]() {
+                runSignalSixNodes();
+            });
     }
-
-    mUpdatingTimer = make_unique<as::steady_timer>(
-        mIOService);
-    mUpdatingTimer->expires_from_now(
-        std::chrono::seconds(
-            kUpdatingTimerPeriodSeconds));
-    mUpdatingTimer->async_wait(
-        boost::bind(
-            &CyclesManager::updateOfflineNodesAndClosedTLLists,
-            this,
-            as::placeholders::error));
 }
 
 void CyclesManager::addCycle(
@@ -72,148 +63,271 @@ void CyclesManager::addCycle(
         debug() << "Adding cycles is forbidden";
         return;
     }
-    switch (cycle->length()) {
-        case 2:
-            debug() << "add three nodes cycle";
-            mThreeNodesCycles.push_back(cycle);
-            break;
-        case 3:
-            debug() << "add four nodes cycle";
-            mFourNodesCycles.push_back(cycle);
-            break;
-        case 4:
-            debug() << "add five nodes cycle";
-            mFiveNodesCycles.push_back(cycle);
-            break;
-        case 5:
-            debug() << "add six nodes cycle";
-            mSixNodesCycles.push_back(cycle);
-            break;
-        default:
-            throw ValueError("CyclesManager::addCycle: "
-                                 "illegal length of cycle");
+    if (cycle->length() < 2 or cycle->length() > 5) {
+        throw ValueError("CyclesManager::addCycle: "
+                             "illegal length of cycle");
+    }
+    const auto kClosableAmount = closableAmount(
+        cycle);
+    if (!isClosableAmountSufficient(kClosableAmount)) {
+        debug() << "drop " << cycle->length() + 1 << " nodes cycle with closable amount " << kClosableAmount;
+        mDroppedCyclesCount++;
+        return;
     }
+    // each trust line of cycle is expected to be cleared on closable amount
+    const TrustLineAmount kExpectedClearedDebt = kClosableAmount * (cycle->length() + 1);
+    debug() << "add " << cycle->length() + 1 << " nodes cycle with closable amount " << kClosableAmount;
+    mCycles.insert(
+        make_pair(
+            kExpectedClearedDebt,
+            cycle));
+}
+
+void CyclesManager::addBoundaryCycles(
+    shared_ptr<BoundaryCyclesJoiner> cyclesJoiner)
+{
+    const auto kStartDateTime = utc_now();
+    // joining works only with interned copies of received branches,
+    // so it doesn't touch any state of the node and can be done out of the main thread
+    mWorkersPool->post<vector<Path::Shared>>(
+        mEquivalent,
+        [cyclesJoiner]() {
+            return cyclesJoiner->joinCycles();
+        },
+        [this, cyclesJoiner, kStartDateTime](vector<Path::Shared> cycles) {
+            for (const auto &cycle : cycles) {
+                try {
+                    addCycle(
+                        cycle);
+                } catch (ValueError &e) {
+                    warning() << "Can't add cycle " << cycle->toString() << ": " << e.what();
+                }
+            }
+            info() << "Cycles joined: " << cycles.size()
+                   << ", duplicated: " << cyclesJoiner->duplicatedCyclesCount()
+                   << ", joining duration " << (utc_now() - kStartDateTime).total_microseconds() << " mcs";
+            closeCycles();
+        },
+        [this](const string &error) {
+            warning() << "Boundary cycles joining failed: " << error;
+        });
 }
 
-void CyclesManager::closeOneCycle(
-    bool nextCycleShouldBeRunned)
+void CyclesManager::closeCycles()
 {
     if (!mSubsystemsController->isRunCycleClosingTransactions()) {
         debug() << "Closing cycles is forbidden";
         return;
     }
-    // nextCycleShouldBeRunned equals true when method closeOneCycle was called
-    // by TransactionManager after finishing transaction of closing cycle.
-    // When method closeOneCycle was called by transactions of building cycles it equals false
-    if (nextCycleShouldBeRunned) {
-        mIsCycleInProcess = false;
-    }
+    releaseStaleCycles();
     clearClosedCycles();
-    debug() << "closeOneCycle";
-    debug() << "currentCycleClosingState: " << mCurrentCycleClosingState;
-    debug() << "3 NC count: " << mThreeNodesCycles.size()
-            << " 4 NC count: " << mFourNodesCycles.size()
-            << " 5 NC count: " << mFiveNodesCycles.size()
-            << " 6 NC count: " << mSixNodesCycles.size();
-    if (mIsCycleInProcess) {
-        debug() << "Postpone closing this cycle, because another one in process";
-        return;
+    debug() << "closeCycles";
+    debug() << "cycles count: " << mCycles.size()
+            << " in process: " << mCyclesInProcess.size();
+
+    // cycles are marked as being in process before closing signals,
+    // so cycles queue can be safely changed by signals handlers
+    vector<pair<TrustLineAmount, Path::Shared>> launchedCycles;
+    auto itCycle = mCycles.begin();
+    while (itCycle != mCycles.end() and
+           mCyclesInProcess.size() < mCyclesRunningParameters.mCyclesMaxConcurrentClosingsCount) {
+        auto cycleTrustLines = this->cycleTrustLines(
+            itCycle->second);
+        if (isCycleConflictsWithCyclesInProcess(cycleTrustLines)) {
+            itCycle++;
+            continue;
+        }
+        // balances could be changed since cycle was added
+        if (!isClosableAmountSufficient(closableAmount(itCycle->second))) {
+            debug() << "drop cycle " << itCycle->second->toString() << " because of insufficient closable amount";
+            mDroppedCyclesCount++;
+            itCycle = mCycles.erase(itCycle);
+            continue;
+        }
+        for (const auto &trustLine : cycleTrustLines) {
+            mTrustLinesInProcess.insert(
+                trustLine);
+        }
+        mCyclesInProcess.insert(
+            make_pair(
+                itCycle->second,
+                CycleInProcess{
+                    cycleTrustLines,
+                    utc_now()}));
+        launchedCycles.push_back(
+            *itCycle);
+        itCycle = mCycles.erase(itCycle);
+    }
+
+    if (launchedCycles.empty() and !mCycles.empty()) {
+        debug() << "Postpone closing cycles, because they conflict with cycles in process";
     }
-    CycleClosingState currentCycleClosingState = mCurrentCycleClosingState;
-    do {
-        auto cycles = cyclesVector(
-            mCurrentCycleClosingState);
-        if (!cycles->empty()) {
-            auto cycle = *cycles->begin();
-            cycles->erase(cycles->begin());
-            debug() << "closeCycleSignal " << cycle->toString();
+    for (const auto &expectedClearedDebtAndCycle : launchedCycles) {
+        const auto &cycle = expectedClearedDebtAndCycle.second;
+        debug() << "closeCycleSignal " << cycle->toString();
+        try {
             closeCycleSignal(
                 mEquivalent,
                 cycle);
-            mIsCycleInProcess = true;
-            return;
+
+        } catch (PreconditionFailedError &e) {
+            // closing can't be launched at the moment, cycle is returned to the queue
+            debug() << "Closing of cycle " << cycle->toString() << " is postponed: " << e.what();
+            releaseCycle(
+                cycle);
+            mCycles.insert(
+                expectedClearedDebtAndCycle);
+
+        } catch (Exception &e) {
+            warning() << "Can't launch closing of cycle " << cycle->toString() << ": " << e.what();
+            releaseCycle(
+                cycle);
         }
-        incrementCurrentCycleClosingState();
-    } while (currentCycleClosingState != mCurrentCycleClosingState);
-    mIsCycleInProcess = false;
+    }
 }
 
-vector<Path::Shared>* CyclesManager::cyclesVector(
-    CycleClosingState currentCycleClosingState)
+void CyclesManager::cycleClosingFinished(
+    Path::Shared closedCycle)
 {
-    switch (currentCycleClosingState) {
-        case CycleClosingState::ThreeNodes:
-            return &mThreeNodesCycles;
-        case CycleClosingState::FourNodes:
-            return &mFourNodesCycles;
-        case CycleClosingState::FiveNodes:
-            return &mFiveNodesCycles;
-        case CycleClosingState::SixNodes:
-            return &mSixNodesCycles;
-        default:
-            throw ValueError("Unexpected Cycle closing state " + to_string(currentCycleClosingState));
+    if (mCyclesInProcess.count(closedCycle) != 0) {
+        releaseCycle(
+            closedCycle);
+        mFinishedCyclesCount++;
     }
+    reportClosingThroughput();
+    closeCycles();
 }
 
-void CyclesManager::incrementCurrentCycleClosingState()
+TrustLineAmount CyclesManager::closableAmount(
+    Path::Shared cycle) const
 {
-    switch (mCurrentCycleClosingState) {
-        case CycleClosingState::ThreeNodes:
-            mCurrentCycleClosingState = CycleClosingState::FourNodes;
-            break;
-        case CycleClosingState::FourNodes:
-            mCurrentCycleClosingState = CycleClosingState::FiveNodes;
-            break;
-        case CycleClosingState::FiveNodes:
-            mCurrentCycleClosingState = CycleClosingState::SixNodes;
-            break;
-        case CycleClosingState::SixNodes:
-            mCurrentCycleClosingState = CycleClosingState::ThreeNodes;
-            break;
+    const auto kFirstNodeID = mContractorsManager->contractorIDByAddress(
+        cycle->intermediates().front());
+    const auto kLastNodeID = mContractorsManager->contractorIDByAddress(
+        cycle->intermediates().back());
+    if (!mTrustLinesManager->trustLineIsPresent(kFirstNodeID) or
+            !mTrustLinesManager->trustLineIsPresent(kLastNodeID)) {
+        return TrustLine::kZeroAmount();
+    }
+
+    const auto kOutgoingAmount = *mTrustLinesManager->availableOutgoingCycleAmounts(kFirstNodeID).first;
+    const auto kIncomingAmount = *mTrustLinesManager->availableIncomingCycleAmounts(kLastNodeID).first;
+    return min(
+        kOutgoingAmount,
+        kIncomingAmount);
+}
+
+bool CyclesManager::isClosableAmountSufficient(
+    const TrustLineAmount &closableAmount) const
+{
+    return closableAmount >= mCyclesRunningParameters.mCyclesMinClosableAmount;
+}
+
+vector<CyclesManager::TrustLineKey> CyclesManager::cycleTrustLines(
+    Path::Shared cycle) const
+{
+    vector<TrustLineKey> result;
+    string previousNodeAddress;
+    for (const auto &node : cycle->intermediates()) {
+        const auto nodeAddress = node->fullAddress();
+        result.push_back(
+            make_pair(
+                min(previousNodeAddress, nodeAddress),
+                max(previousNodeAddress, nodeAddress)));
+        previousNodeAddress = nodeAddress;
+    }
+    // trust line between last node of cycle and current node
+    result.push_back(
+        make_pair(
+            string(),
+            previousNodeAddress));
+    return result;
+}
+
+bool CyclesManager::isCycleConflictsWithCyclesInProcess(
+    const vector<TrustLineKey> &cycleTrustLines) const
+{
+    for (const auto &trustLine : cycleTrustLines) {
+        if (mTrustLinesInProcess.count(trustLine) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CyclesManager::releaseCycle(
+    Path::Shared cycle)
+{
+    for (const auto &trustLine : mCyclesInProcess[cycle].mTrustLines) {
+        mTrustLinesInProcess.erase(
+            trustLine);
+    }
+    mCyclesInProcess.erase(
+        cycle);
+}
+
+void CyclesManager::releaseStaleCycles()
+{
+    vector<Path::Shared> staleCycles;
+    for (const auto &cycleAndState : mCyclesInProcess) {
+        if (utc_now() - cycleAndState.second.mStartedDateTime > kCycleClosingMaxDuration()) {
+            staleCycles.push_back(
+                cycleAndState.first);
+        }
+    }
+    for (const auto &cycle : staleCycles) {
+        warning() << "Cycle closing was not finished in time " << cycle->toString();
+        releaseCycle(
+            cycle);
     }
 }
 
-void CyclesManager::runSignalFiveNodes(
-    const boost::system::error_code &err)
+void CyclesManager::reportClosingThroughput()
 {
-    if (err) {
-        warning() << err.message();
+    const auto kPeriod = utc_now() - mThroughputPeriodStartedDateTime;
+    if (kPeriod.total_seconds() < kThroughputReportingPeriodMinutes * 60) {
+        return;
+    }
+    const auto kPeriodMinutes = (double)kPeriod.total_seconds() / 60;
+    if (kPeriodMinutes > 0) {
+        info() << "Cycles closing throughput: " << mFinishedCyclesCount / kPeriodMinutes
+               << " cycles per minute (" << mFinishedCyclesCount << " closing transactions finished in "
+               << kPeriod.total_seconds() << " seconds), cycles count: " << mCycles.size()
+               << ", in process: " << mCyclesInProcess.size()
+               << ", dropped as not profitable: " << mDroppedCyclesCount;
     }
-    mFiveNodesCycleTimer->cancel();
+    mFinishedCyclesCount = 0;
+    mDroppedCyclesCount = 0;
+    mThroughputPeriodStartedDateTime = utc_now();
+}
+
+void CyclesManager::runSignalFiveNodes()
+{
     auto timeRepeated = mCyclesRunningParameters.mCyclesFiveNodesIntervalSec;
 #ifdef TESTS
     timeRepeated = kSignalRepeatTimeSecondsTests;
 #endif
-    mFiveNodesCycleTimer->expires_from_now(
+    mFiveNodesCycleTimer.expiresFromNow(
         std::chrono::seconds(
-            timeRepeated));
-    mFiveNodesCycleTimer->async_wait(
-        boost::bind(
-            &CyclesManager::runSignalFiveNodes,
-            this,
-            as::placeholders::error));
+            timeRepeated),
+        [this]() {
+            runSignalFiveNodes();
+        });
     buildFiveNodesCyclesSignal(mEquivalent);
 }
 
-void CyclesManager::runSignalSixNodes(
-    const boost::system::error_code &err)
+void CyclesManager::runSignalSixNodes()
 {
-    if (err) {
-        warning() << err.message();
-    }
-    mSixNodesCycleTimer->cancel();
     auto timeRepeated = mCyclesRunningParameters.mCyclesSixNodesIntervalSec;
 #ifdef TESTS
     timeRepeated = kSignalRepeatTimeSecondsTests;
 #endif
-    mSixNodesCycleTimer->expires_from_now(
+    mSixNodesCycleTimer.expiresFromNow(
         std::chrono::seconds(
-            timeRepeated));
-    mSixNodesCycleTimer->async_wait(
-        boost::bind(
-            &CyclesManager::runSignalSixNodes,
-            this,
-            as::placeholders::error));
+            timeRepeated),
+        [this]() {
+            runSignalSixNodes();
+        });
     buildSixNodesCyclesSignal(mEquivalent);
 }
 
@@ -304,6 +418,9 @@ void CyclesManager::addClosedTrustLine(
             make_pair(
                 source,
                 destination)));
+    if (!mUpdatingTimer.isPending()) {
+        scheduleUpdating();
+    }
 }
 
 void CyclesManager::addOfflineNode(
@@ -313,19 +430,21 @@ void CyclesManager::addOfflineNode(
         make_pair(
             utc_now(),
             nodeAddress));
+    if (!mUpdatingTimer.isPending()) {
+        scheduleUpdating();
+    }
 }
 
 void CyclesManager::removeCyclesWithClosedTrustLine(
     BaseAddress::Shared sourceClosed,
-    BaseAddress::Shared destinationClosed,
-    vector<Path::Shared> &cycles)
+    BaseAddress::Shared destinationClosed)
 {
-    auto itCycle = cycles.begin();
-    while (itCycle != cycles.end()) {
-        if ((*itCycle)->containsTrustLine(
+    auto itCycle = mCycles.begin();
+    while (itCycle != mCycles.end()) {
+        if (itCycle->second->containsTrustLine(
             sourceClosed,
             destinationClosed)) {
-            cycles.erase(
+            itCycle = mCycles.erase(
                 itCycle);
         } else {
             itCycle++;
@@ -334,14 +453,13 @@ void CyclesManager::removeCyclesWithClosedTrustLine(
 }
 
 void CyclesManager::removeCyclesWithOfflineNode(
-    BaseAddress::Shared offlineNode,
-    vector<Path::Shared> &cycles)
+    BaseAddress::Shared offlineNode)
 {
-    auto itCycle = cycles.begin();
-    while (itCycle != cycles.end()) {
-        if ((*itCycle)->positionOfNode(
+    auto itCycle = mCycles.begin();
+    while (itCycle != mCycles.end()) {
+        if (itCycle->second->positionOfNode(
             offlineNode) >= 0) {
-            cycles.erase(
+            itCycle = mCycles.erase(
                 itCycle);
         } else {
             itCycle++;
@@ -359,23 +477,7 @@ void CyclesManager::clearClosedCycles()
 
         removeCyclesWithClosedTrustLine(
             source,
-            destination,
-            mThreeNodesCycles);
-
-        removeCyclesWithClosedTrustLine(
-            source,
-            destination,
-            mFourNodesCycles);
-
-        removeCyclesWithClosedTrustLine(
-            source,
-            destination,
-            mFiveNodesCycles);
-
-        removeCyclesWithClosedTrustLine(
-            source,
-            destination,
-            mSixNodesCycles);
+            destination);
     }
 
     debug() << "clearClosedCycles offline nodes cnt: " << mOfflineNodes.size();
@@ -385,56 +487,55 @@ void CyclesManager::clearClosedCycles()
             mOfflineNodes.begin());
 
         removeCyclesWithOfflineNode(
-            offlineNode,
-            mThreeNodesCycles);
-
-        removeCyclesWithOfflineNode(
-            offlineNode,
-            mFourNodesCycles);
-
-        removeCyclesWithOfflineNode(
-            offlineNode,
-            mFiveNodesCycles);
-
-        removeCyclesWithOfflineNode(
-            offlineNode,
-            mSixNodesCycles);
+            offlineNode);
     }
 }
 
-void CyclesManager::updateOfflineNodesAndClosedTLLists(
-    const boost::system::error_code &err)
+void CyclesManager::updateOfflineNodesAndClosedTLLists()
 {
-    if (err) {
-        warning() << err.message();
-    }
-    mUpdatingTimer->cancel();
-    mUpdatingTimer->expires_from_now(
-        std::chrono::seconds(
-            kUpdatingTimerPeriodSeconds));
-    mUpdatingTimer->async_wait(
-        boost::bind(
-            &CyclesManager::updateOfflineNodesAndClosedTLLists,
-            this,
-            as::placeholders::error));
-
     // delete legacy offline nodes
-    for (auto timeAndNode : mOfflineNodes) {
-        if (utc_now() - timeAndNode.first > kOfflineNodesAndClosedTLLiveDuration()) {
-            mOfflineNodes.erase(timeAndNode.first);
+    while (!mOfflineNodes.empty()) {
+        if (utc_now() - mOfflineNodes.begin()->first >= kOfflineNodesAndClosedTLLiveDuration()) {
+            mOfflineNodes.erase(mOfflineNodes.begin());
         } else {
             break;
         }
     }
 
     // delete legacy closed TL
-    for (auto timeAndTrustLine : mClosedTrustLines) {
-        if (utc_now() - timeAndTrustLine.first > kOfflineNodesAndClosedTLLiveDuration()) {
-            mClosedTrustLines.erase(timeAndTrustLine.first);
+    while (!mClosedTrustLines.empty()) {
+        if (utc_now() - mClosedTrustLines.begin()->first >= kOfflineNodesAndClosedTLLiveDuration()) {
+            mClosedTrustLines.erase(mClosedTrustLines.begin());
         } else {
             break;
         }
     }
+
+    scheduleUpdating();
+}
+
+void CyclesManager::scheduleUpdating()
+{
+    DateTime oldestDateTime;
+    if (!mOfflineNodes.empty()) {
+        oldestDateTime = mOfflineNodes.begin()->first;
+    }
+    if (!mClosedTrustLines.empty() and
+            (oldestDateTime.is_not_a_date_time() or mClosedTrustLines.begin()->first < oldestDateTime)) {
+        oldestDateTime = mClosedTrustLines.begin()->first;
+    }
+    if (oldestDateTime.is_not_a_date_time()) {
+        mUpdatingTimer.cancel();
+        return;
+    }
+
+    const auto kDelay = oldestDateTime + kOfflineNodesAndClosedTLLiveDuration() - utc_now();
+    mUpdatingTimer.expiresFromNow(
+        std::chrono::milliseconds(
+            max(kDelay.total_milliseconds(), (int64_t)0)),
+        [this]() {
+            updateOfflineNodesAndClosedTLLists();
+        });
 }
 
 uint32_t CyclesManager::randomInitializer() const
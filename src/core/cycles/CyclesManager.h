@@ -4,30 +4,37 @@
 #include "../transactions/scheduler/TransactionsScheduler.h"
 #include "../transactions/transactions/regular/payments/base/BasePaymentTransaction.h"
 #include "../paths/lib/Path.h"
+#include "../trust_lines/manager/TrustLinesManager.h"
+#include "../contractors/ContractorsManager.h"
 #include "../logger/Logger.h"
 #include "../common/time/TimeUtils.h"
+#include "../common/time/TimerService.h"
+#include "../common/workers/WorkersPool.h"
+#include "../common/exceptions/PreconditionFailedError.h"
 #include "../subsystems_controller/SubsystemsController.h"
 #include "CyclesRunningParameters.h"
+#include "BoundaryCyclesJoiner.h"
 
 #include <boost/signals2.hpp>
 #include <boost/asio.hpp>
-#include <boost/asio/steady_timer.hpp>
 
 #include <vector>
 #include <map>
+#include <set>
 
 namespace as = boost::asio;
 namespace signals = boost::signals2;
 
+/**
+ * Keeps discovered cycles and launches their closing.
+ *
+ * Cycles are closed in order of debt, which is expected to be cleared by them:
+ * amount, which can be closed on cycle according to current node trust lines, multiplied by count of its trust lines.
+ * Cycles with closable amount less than mCyclesMinClosableAmount are dropped on adding and before launching.
+ * Several cycles can be closed simultaneously (up to mCyclesMaxConcurrentClosingsCount)
+ * in case if they don't contain common trust lines.
+ */
 class CyclesManager {
-public:
-    enum CycleClosingState {
-        ThreeNodes = 1,
-        FourNodes,
-        FiveNodes,
-        SixNodes
-    };
-
 public:
     typedef signals::signal<void(const SerializedEquivalent)> BuildSixNodesCyclesSignal;
     typedef signals::signal<void(const SerializedEquivalent)> BuildFiveNodesCyclesSignal;
@@ -37,17 +44,39 @@ public:
     CyclesManager(
         const SerializedEquivalent equivalent,
         TransactionsScheduler *transactionsScheduler,
+        TrustLinesManager *trustLinesManager,
+        ContractorsManager *contractorsManager,
         as::io_service &ioService,
+        TimerService *timerService,
+        WorkersPool *workersPool,
         CyclesRunningParameters cyclesRunningParameters,
         Logger &logger,
         SubsystemsController *subsystemsController);
 
-    void closeOneCycle(
-        bool nextCycleShouldBeRunned = false);
+    /**
+     * Launches closing of the most valuable cycles, which don't conflict with cycles in closing process,
+     * while count of simultaneously closing cycles is less than allowed.
+     */
+    void closeCycles();
+
+    /**
+     * Releases trust lines of closedCycle and launches closing of next cycles.
+     * Is called after finishing of cycle closing transaction.
+     */
+    void cycleClosingFinished(
+        Path::Shared closedCycle);
 
     void addCycle(
         Path::Shared);
 
+    /**
+     * Joins five and six nodes cycles from branches of cyclesJoiner in workers pool,
+     * then adds them and launches their closing on the main thread.
+     * cyclesJoiner must not be used by the caller after this call.
+     */
+    void addBoundaryCycles(
+        shared_ptr<BoundaryCyclesJoiner> cyclesJoiner);
+
     bool resolveReservationConflict(
         const TransactionUUID &challengerTransactionUUID,
         const TransactionUUID &reservedTransactionUUID);
@@ -63,19 +92,51 @@ public:
         BaseAddress::Shared nodeAddress);
 
 private:
-    void runSignalSixNodes(
-        const boost::system::error_code &err);
+    // Trust line between two nodes, addresses are sorted, so direction of trust line doesn't matter.
+    // Current node is presented by empty address.
+    typedef pair<string, string> TrustLineKey;
+    typedef multimap<TrustLineAmount, Path::Shared, greater<TrustLineAmount>> CyclesQueue;
+
+    struct CycleInProcess {
+        vector<TrustLineKey> mTrustLines;
+        DateTime mStartedDateTime;
+    };
+
+private:
+    void runSignalSixNodes();
+
+    void runSignalFiveNodes();
+
+    void updateOfflineNodesAndClosedTLLists();
 
-    void runSignalFiveNodes(
-        const boost::system::error_code &err);
+    // Schedules updating on the time, when the oldest offline node or closed trust line becomes legacy.
+    // Timer is not armed while both lists are empty.
+    void scheduleUpdating();
 
-    void updateOfflineNodesAndClosedTLLists(
-        const boost::system::error_code &err);
+    /**
+     * @return amount, which can be closed on cycle according to current node trust lines,
+     * or zero if first or last node of cycle is not a neighbor of current node.
+     */
+    TrustLineAmount closableAmount(
+        Path::Shared cycle) const;
 
-    vector<Path::Shared>* cyclesVector(
-        CycleClosingState currentCycleClosingState);
+    bool isClosableAmountSufficient(
+        const TrustLineAmount &closableAmount) const;
 
-    void incrementCurrentCycleClosingState();
+    vector<TrustLineKey> cycleTrustLines(
+        Path::Shared cycle) const;
+
+    bool isCycleConflictsWithCyclesInProcess(
+        const vector<TrustLineKey> &cycleTrustLines) const;
+
+    void releaseCycle(
+        Path::Shared cycle);
+
+    // releases cycles, which transactions were not finished (or even launched) during allowed time
+    void releaseStaleCycles();
+
+    // reports throughput, if kThroughputReportingPeriodMinutes is passed since previous reporting
+    void reportClosingThroughput();
 
     bool isChallengerTransactionWinReservation(
         BasePaymentTransaction::Shared challengerTransaction,
@@ -85,12 +146,10 @@ private:
 
     void removeCyclesWithClosedTrustLine(
         BaseAddress::Shared sourceClosed,
-        BaseAddress::Shared destinationClosed,
-        vector<Path::Shared> &cycles);
+        BaseAddress::Shared destinationClosed);
 
     void removeCyclesWithOfflineNode(
-        BaseAddress::Shared offlineNode,
-        vector<Path::Shared> &cycles);
+        BaseAddress::Shared offlineNode);
 
     uint32_t randomInitializer() const;
 
@@ -114,7 +173,7 @@ private:
     const uint32_t kSignalStartTimeSecondsTests = 15;
     const uint32_t kSignalRepeatTimeSecondsTests = 10;
 #endif
-    const uint32_t kUpdatingTimerPeriodSeconds = 10 * 60;
+    static const byte kThroughputReportingPeriodMinutes = 10;
 
     static const byte kOfflineNodesAndClosedTLLiveHours = 0;
     static const byte kOfflineNodesAndClosedTLLiveMinutes = 30;
@@ -128,29 +187,48 @@ private:
         return duration;
     }
 
+    // cycle closing transaction is expected to be finished during this time,
+    // otherwise its trust lines are released for closing other cycles
+    static const byte kCycleClosingMaxDurationMinutes = 5;
+
+    static Duration& kCycleClosingMaxDuration() {
+        static auto duration = Duration(
+            0,
+            kCycleClosingMaxDurationMinutes,
+            0);
+        return duration;
+    }
+
 private:
     TransactionsScheduler *mTransactionScheduler;
+    TrustLinesManager *mTrustLinesManager;
+    ContractorsManager *mContractorsManager;
     SerializedEquivalent mEquivalent;
     as::io_service &mIOService;
+    WorkersPool *mWorkersPool;
     CyclesRunningParameters mCyclesRunningParameters;
 
-    vector<Path::Shared> mThreeNodesCycles;
-    vector<Path::Shared> mFourNodesCycles;
-    vector<Path::Shared> mFiveNodesCycles;
-    vector<Path::Shared> mSixNodesCycles;
+    // cycles, which are waiting for closing, ordered by expected cleared debt
+    CyclesQueue mCycles;
 
     map<DateTime, pair<BaseAddress::Shared, BaseAddress::Shared>> mClosedTrustLines;
     map<DateTime, BaseAddress::Shared> mOfflineNodes;
 
-    CycleClosingState mCurrentCycleClosingState;
     Logger &mLog;
 
-    unique_ptr<as::steady_timer> mSixNodesCycleTimer;
-    unique_ptr<as::steady_timer> mFiveNodesCycleTimer;
-    unique_ptr<as::steady_timer> mUpdatingTimer;
+    TimerService::Timer mSixNodesCycleTimer;
+    TimerService::Timer mFiveNodesCycleTimer;
+    TimerService::Timer mUpdatingTimer;
+
+    // cycles in closing process, new cycle can't be launched if it contains any of their trust lines
+    map<Path::Shared, CycleInProcess> mCyclesInProcess;
+    set<TrustLineKey> mTrustLinesInProcess;
 
-    // prevent launching closing cycle if another one in closing process
-    bool mIsCycleInProcess;
+    // count of finished cycles closing transactions since mThroughputPeriodStartedDateTime
+    size_t mFinishedCyclesCount;
+    // count of cycles dropped due to insufficient closable amount since mThroughputPeriodStartedDateTime
+    size_t mDroppedCyclesCount;
+    DateTime mThroughputPeriodStartedDateTime;
 
     SubsystemsController *mSubsystemsController;
 };
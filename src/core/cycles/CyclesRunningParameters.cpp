@@ -7,7 +7,9 @@ CyclesRunningParameters::CyclesRunningParameters() :
     mCyclesFiveNodesIntervalSec(0),
     mCyclesSixNodesEnabled(false),
     mCyclesSixNodesIntervalSec(0),
-    mRoutingTableUpdatingIntervalDays(0)
+    mRoutingTableUpdatingIntervalDays(0),
+    mCyclesMaxConcurrentClosingsCount(kDefaultCyclesMaxConcurrentClosingsCount),
+    mCyclesMinClosableAmount(kDefaultCyclesMinClosableAmount())
 {}
 
 CyclesRunningParameters::CyclesRunningParameters(
@@ -17,7 +19,9 @@ CyclesRunningParameters::CyclesRunningParameters(
     uint32_t cyclesFiveNodesIntervalSec,
     bool cyclesSixNodesEnabled,
     uint32_t cyclesSixNodesIntervalSec,
-    uint16_t routingTableUpdatingIntervalDays):
+    uint16_t routingTableUpdatingIntervalDays,
+    uint16_t cyclesMaxConcurrentClosingsCount,
+    const TrustLineAmount &cyclesMinClosableAmount):
 
     mCyclesThreeNodesEnabled(cyclesThreeNodesEnabled),
     mCyclesFourNodesEnabled(cyclesFourNodesEnabled),
@@ -25,7 +29,9 @@ CyclesRunningParameters::CyclesRunningParameters(
     mCyclesFiveNodesIntervalSec(cyclesFiveNodesIntervalSec),
     mCyclesSixNodesEnabled(cyclesSixNodesEnabled),
     mCyclesSixNodesIntervalSec(cyclesSixNodesIntervalSec),
-    mRoutingTableUpdatingIntervalDays(routingTableUpdatingIntervalDays)
+    mRoutingTableUpdatingIntervalDays(routingTableUpdatingIntervalDays),
+    mCyclesMaxConcurrentClosingsCount(cyclesMaxConcurrentClosingsCount),
+    mCyclesMinClosableAmount(cyclesMinClosableAmount)
 {}
 
 bool CyclesRunningParameters::isUpdateRoutingTables() const
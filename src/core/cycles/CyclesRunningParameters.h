@@ -15,10 +15,21 @@ public:
         uint32_t cyclesFiveNodesIntervalSec,
         bool cyclesSixNodesEnabled,
         uint32_t cyclesSixNodesIntervalSec,
-        uint16_t routingTableUpdatingIntervalDays);
+        uint16_t routingTableUpdatingIntervalDays,
+        uint16_t cyclesMaxConcurrentClosingsCount = kDefaultCyclesMaxConcurrentClosingsCount,
+        const TrustLineAmount &cyclesMinClosableAmount = kDefaultCyclesMinClosableAmount());
 
     bool isUpdateRoutingTables() const;
 
+    // count of cycles closing transactions, which can be run simultaneously
+    static const uint16_t kDefaultCyclesMaxConcurrentClosingsCount = 4;
+
+    // cycles, on which less amount can be closed, are not closed at all
+    static const TrustLineAmount& kDefaultCyclesMinClosableAmount() {
+        static const TrustLineAmount amount = 1;
+        return amount;
+    }
+
     bool mCyclesThreeNodesEnabled;
     bool mCyclesFourNodesEnabled;
     bool mCyclesFiveNodesEnabled;
@@ -26,6 +37,8 @@ public:
     bool mCyclesSixNodesEnabled;
     uint32_t mCyclesSixNodesIntervalSec;
     uint16_t mRoutingTableUpdatingIntervalDays;
+    uint16_t mCyclesMaxConcurrentClosingsCount;
+    TrustLineAmount mCyclesMinClosableAmount;
 };
 
 
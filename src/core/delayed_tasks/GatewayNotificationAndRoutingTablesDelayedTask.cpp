@@ -3,15 +3,13 @@
 GatewayNotificationAndRoutingTablesDelayedTask::GatewayNotificationAndRoutingTablesDelayedTask(
     bool enabled,
     uint32_t updatingTimerPeriodDays,
-    as::io_service &ioService,
+    TimerService *timerService,
     Logger &logger):
 
     mUpdatingTimerPeriodDays(updatingTimerPeriodDays),
-    mIOService(ioService),
+    mNotificationTimer(timerService),
     mLog(logger)
 {
-    mNotificationTimer = make_unique<as::steady_timer>(
-        mIOService);
     // todo : rand() used for concurrent start of all nodes or some part of nodes (data center)
     // on decentralize network it is not necessary
     srand(randomInitializer());
@@ -23,38 +21,28 @@ GatewayNotificationAndRoutingTablesDelayedTask::GatewayNotificationAndRoutingTab
     timeStarted = 10;
 #endif
     if (enabled) {
-        mNotificationTimer->expires_from_now(
+        mNotificationTimer.expiresFromNow(
             chrono::seconds(
-                timeStarted));
-        mNotificationTimer->async_wait(
-            boost::bind(
-                &GatewayNotificationAndRoutingTablesDelayedTask::runSignalNotify,
-                this,
-                as::placeholders::error));
+                timeStarted),
+            [this]() {
+                runSignalNotify();
+            });
     }
 }
 
-void GatewayNotificationAndRoutingTablesDelayedTask::runSignalNotify(
-    const boost::system::error_code &errorCode)
+void GatewayNotificationAndRoutingTablesDelayedTask::runSignalNotify()
 {
-    if (errorCode) {
-        warning() << errorCode.message().c_str();
-    }
     info() << "run gateway notification signal";
-    mNotificationTimer->cancel();
-    mNotificationTimer->expires_from_now(
-        std::chrono::seconds(
-            mUpdatingTimerPeriodDays * 24 * 60 * 60 + rand() % (60 * 60 * 24)));
+    auto nextNotificationDelay = std::chrono::seconds(
+        mUpdatingTimerPeriodDays * 24 * 60 * 60 + rand() % (60 * 60 * 24));
 #ifdef TESTS
-    mNotificationTimer->cancel();
-    mNotificationTimer->expires_from_now(
-        std::chrono::seconds(15));
+    nextNotificationDelay = std::chrono::seconds(15);
 #endif
-    mNotificationTimer->async_wait(
-        boost::bind(
-            &GatewayNotificationAndRoutingTablesDelayedTask::runSignalNotify,
-            this,
-            as::placeholders::error));
+    mNotificationTimer.expiresFromNow(
+        nextNotificationDelay,
+        [this]() {
+            runSignalNotify();
+        });
     gatewayNotificationSignal();
 }
 
@@ -2,15 +2,13 @@
 #define GEO_NETWORK_CLIENT_GATEWAYNOTIFICATIONANDROUTINGTABLESDELAYEDTASK_H
 
 #include "../common/time/TimeUtils.h"
+#include "../common/time/TimerService.h"
 #include "../logger/Logger.h"
 #include "../transactions/transactions/base/TransactionUUID.h"
 
-#include <boost/asio/steady_timer.hpp>
 #include <boost/signals2.hpp>
-#include <boost/asio.hpp>
 
 using namespace std;
-namespace as = boost::asio;
 namespace signals = boost::signals2;
 
 class GatewayNotificationAndRoutingTablesDelayedTask {
@@ -22,15 +20,14 @@ public:
     GatewayNotificationAndRoutingTablesDelayedTask(
         bool enabled,
         uint32_t updatingTimerPeriodSeconds,
-        as::io_service &ioService,
+        TimerService *timerService,
         Logger &logger);
 
 public:
     mutable GatewayNotificationSignal gatewayNotificationSignal;
 
 private:
-    void runSignalNotify(
-        const boost::system::error_code &error);
+    void runSignalNotify();
 
     uint32_t randomInitializer() const;
 
@@ -44,8 +41,7 @@ private:
 
 private:
     uint32_t mUpdatingTimerPeriodDays;
-    as::io_service &mIOService;
-    unique_ptr<as::steady_timer> mNotificationTimer;
+    TimerService::Timer mNotificationTimer;
     Logger &mLog;
 };
 
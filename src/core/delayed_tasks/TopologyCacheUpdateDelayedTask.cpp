@@ -2,51 +2,42 @@
 
 TopologyCacheUpdateDelayedTask::TopologyCacheUpdateDelayedTask(
     const SerializedEquivalent equivalent,
-    as::io_service &ioService,
+    TimerService *timerService,
     TopologyCacheManager *topologyCacheManager,
     TopologyTrustLinesManager *topologyTrustLineManager,
     MaxFlowCacheManager *maxFlowCalculationNodeCacheManager,
     Logger &logger):
 
     mEquivalent(equivalent),
-    mIOService(ioService),
+    mTopologyCacheUpdateTimer(timerService),
     mTopologyCacheManager(topologyCacheManager),
     mTopologyTrustLineManager(topologyTrustLineManager),
     mMaxFlowCalculationNodeCacheManager(maxFlowCalculationNodeCacheManager),
     mLog(logger)
 {
-    mTopologyCacheUpdateTimer = make_unique<as::steady_timer>(
-        mIOService);
-
     Duration microsecondsDelay = minimalAwakeningTimestamp() - utc_now();
-    mTopologyCacheUpdateTimer->expires_from_now(
+    mTopologyCacheUpdateTimer.expiresFromNow(
         chrono::milliseconds(
-            microsecondsDelay.total_milliseconds()));
-    mTopologyCacheUpdateTimer->async_wait(boost::bind(
-            &TopologyCacheUpdateDelayedTask::runSignalTopologyCacheUpdate,
-        this,
-        as::placeholders::error));
+            microsecondsDelay.total_milliseconds()),
+        [this]() {
+            runSignalTopologyCacheUpdate();
+        });
 }
 
-void TopologyCacheUpdateDelayedTask::runSignalTopologyCacheUpdate(
-    const boost::system::error_code &errorCode)
+void TopologyCacheUpdateDelayedTask::runSignalTopologyCacheUpdate()
 {
-    if (errorCode) {
-        warning() << errorCode.message().c_str();
-    }
     DateTime closestTimeEvent = updateCache();
     Duration microsecondsDelay = closestTimeEvent - utc_now();
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     auto duration = chrono::milliseconds(microsecondsDelay.total_milliseconds());
     debug() << "next launch: " << duration.count() << " ms" << endl;
 #endif
-    mTopologyCacheUpdateTimer->expires_from_now(
+    mTopologyCacheUpdateTimer.expiresFromNow(
         chrono::milliseconds(
-            microsecondsDelay.total_milliseconds()));
-    mTopologyCacheUpdateTimer->async_wait(boost::bind(
-            &TopologyCacheUpdateDelayedTask::runSignalTopologyCacheUpdate,
-        this,
-        as::placeholders::error));
+            microsecondsDelay.total_milliseconds()),
+        [this]() {
+            runSignalTopologyCacheUpdate();
+        });
     mTopologyTrustLineManager->setPreventDeleting(false);
 }
 
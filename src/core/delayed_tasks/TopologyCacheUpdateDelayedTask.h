@@ -4,28 +4,23 @@
 #include "../topology/cache/TopologyCacheManager.h"
 #include "../topology/manager/TopologyTrustLinesManager.h"
 #include "../topology/cache/MaxFlowCacheManager.h"
-
-#include <boost/asio/steady_timer.hpp>
-#include <boost/asio.hpp>
+#include "../common/time/TimerService.h"
 
 using namespace std;
 
-namespace as = boost::asio;
-
 class TopologyCacheUpdateDelayedTask {
 
 public:
     TopologyCacheUpdateDelayedTask(
         const SerializedEquivalent equivalent,
-        as::io_service &ioService,
+        TimerService *timerService,
         TopologyCacheManager *topologyCacheManager,
         TopologyTrustLinesManager *topologyTrustLineManager,
         MaxFlowCacheManager *maxFlowCalculationNodeCacheManager,
         Logger &logger);
 
 public:
-    void runSignalTopologyCacheUpdate(
-        const boost::system::error_code &error);
+    void runSignalTopologyCacheUpdate();
 
 private:
     DateTime minimalAwakeningTimestamp();
@@ -54,8 +49,7 @@ private:
     }
 
 private:
-    as::io_service &mIOService;
-    unique_ptr<as::steady_timer> mTopologyCacheUpdateTimer;
+    TimerService::Timer mTopologyCacheUpdateTimer;
     TopologyCacheManager *mTopologyCacheManager;
     TopologyTrustLinesManager *mTopologyTrustLineManager;
     MaxFlowCacheManager *mMaxFlowCalculationNodeCacheManager;
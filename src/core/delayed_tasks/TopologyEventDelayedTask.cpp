@@ -1,26 +1,22 @@
 #include "TopologyEventDelayedTask.h"
 
 TopologyEventDelayedTask::TopologyEventDelayedTask(
-    as::io_service &ioService,
+    TimerService *timerService,
     EquivalentsSubsystemsRouter *equivalentsSubsystemsRouter,
     Logger &logger) :
-    mIOService(ioService),
+    mTopologyEventTimer(timerService),
     mEquivalentsSubsystemsRouter(equivalentsSubsystemsRouter),
     mLog(logger)
 {
-    mTopologyEventTimer = make_unique<as::steady_timer>(
-        mIOService);
-
-    mTopologyEventTimer->expires_from_now(
+    mTopologyEventTimer.expiresFromNow(
         chrono::seconds(
-            +kDelayedTaskTimeSec));
-    mTopologyEventTimer->async_wait(boost::bind(
-        &TopologyEventDelayedTask::runTopologyEvent,
-        this));
+            +kDelayedTaskTimeSec),
+        [this]() {
+            runTopologyEvent();
+        });
 }
 
 void TopologyEventDelayedTask::runTopologyEvent()
 {
-    mTopologyEventTimer->cancel();
     mEquivalentsSubsystemsRouter->sendTopologyEvent();
 }
\ No newline at end of file
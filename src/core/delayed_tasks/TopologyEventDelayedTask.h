@@ -2,15 +2,13 @@
 #define GEO_NETWORK_CLIENT_TOPOLOGYEVENTDELAYEDTASK_H
 
 #include "../equivalents/EquivalentsSubsystemsRouter.h"
-
-#include <boost/asio/steady_timer.hpp>
-#include <boost/asio.hpp>
+#include "../common/time/TimerService.h"
 
 class TopologyEventDelayedTask {
 
 public:
     TopologyEventDelayedTask(
-        as::io_service &ioService,
+        TimerService *timerService,
         EquivalentsSubsystemsRouter *equivalentsSubsystemsRouter,
         Logger &logger);
 
@@ -21,8 +19,7 @@ private:
     static const uint16_t kDelayedTaskTimeSec = 5;
 
 private:
-    as::io_service &mIOService;
-    unique_ptr<as::steady_timer> mTopologyEventTimer;
+    TimerService::Timer mTopologyEventTimer;
     EquivalentsSubsystemsRouter *mEquivalentsSubsystemsRouter;
     Logger &mLog;
 };
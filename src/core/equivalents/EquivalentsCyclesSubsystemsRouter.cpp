@@ -2,15 +2,23 @@
 
 EquivalentsCyclesSubsystemsRouter::EquivalentsCyclesSubsystemsRouter(
     TransactionsScheduler *transactionScheduler,
+    EquivalentsSubsystemsRouter *equivalentsSubsystemsRouter,
+    ContractorsManager *contractorsManager,
     SubsystemsController *subsystemsController,
     as::io_service &ioService,
+    TimerService *timerService,
+    WorkersPool *workersPool,
     vector<SerializedEquivalent> equivalents,
     CyclesRunningParameters cyclesRunningParameters,
     Logger &logger):
 
     mTransactionScheduler(transactionScheduler),
+    mEquivalentsSubsystemsRouter(equivalentsSubsystemsRouter),
+    mContractorsManager(contractorsManager),
     mSubsystemsController(subsystemsController),
     mIOService(ioService),
+    mTimerService(timerService),
+    mWorkersPool(workersPool),
     mCyclesRunningParameters(cyclesRunningParameters),
     mLogger(logger)
 {
@@ -20,6 +28,8 @@ EquivalentsCyclesSubsystemsRouter::EquivalentsCyclesSubsystemsRouter(
            << " period " << cyclesRunningParameters.mCyclesFiveNodesIntervalSec;
     info() << "Cycles six nodes " << cyclesRunningParameters.mCyclesSixNodesEnabled
            << " period " << cyclesRunningParameters.mCyclesSixNodesIntervalSec;
+    info() << "Cycles max concurrent closings " << cyclesRunningParameters.mCyclesMaxConcurrentClosingsCount
+           << " min closable amount " << cyclesRunningParameters.mCyclesMinClosableAmount;
     for (const auto &equivalent : equivalents) {
         info() << "Equivalent " << equivalent;
         mCyclesManagers.insert(
@@ -28,7 +38,11 @@ EquivalentsCyclesSubsystemsRouter::EquivalentsCyclesSubsystemsRouter(
                 make_unique<CyclesManager>(
                     equivalent,
                     mTransactionScheduler,
+                    mEquivalentsSubsystemsRouter->trustLinesManager(equivalent),
+                    mContractorsManager,
                     mIOService,
+                    mTimerService,
+                    mWorkersPool,
                     cyclesRunningParameters,
                     mLogger,
                     mSubsystemsController)));
@@ -46,7 +60,7 @@ EquivalentsCyclesSubsystemsRouter::EquivalentsCyclesSubsystemsRouter(
     mGatewayNotificationAndRoutingTablesDelayedTask = make_unique<GatewayNotificationAndRoutingTablesDelayedTask>(
         cyclesRunningParameters.isUpdateRoutingTables(),
         cyclesRunningParameters.mRoutingTableUpdatingIntervalDays,
-        mIOService,
+        mTimerService,
         mLogger);
     info() << "Gateway Notification and Routing Tables Delayed Task is successfully initialized";
 
@@ -90,7 +104,11 @@ void EquivalentsCyclesSubsystemsRouter::initNewEquivalent(
             make_unique<CyclesManager>(
                 equivalent,
                 mTransactionScheduler,
+                mEquivalentsSubsystemsRouter->trustLinesManager(equivalent),
+                mContractorsManager,
                 mIOService,
+                mTimerService,
+                mWorkersPool,
                 mCyclesRunningParameters,
                 mLogger,
                 mSubsystemsController)));
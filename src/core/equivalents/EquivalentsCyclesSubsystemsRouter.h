@@ -2,6 +2,7 @@
 #define GEO_NETWORK_CLIENT_EQUIVALENTSCYCLESSUBSYSTEMSROUTER_H
 
 #include "../cycles/CyclesManager.h"
+#include "EquivalentsSubsystemsRouter.h"
 #include "../cycles/RoutingTableManager.h"
 #include "../transactions/scheduler/TransactionsScheduler.h"
 #include "../subsystems_controller/SubsystemsController.h"
@@ -25,8 +26,12 @@ public:
 public:
     EquivalentsCyclesSubsystemsRouter(
         TransactionsScheduler *transactionScheduler,
+        EquivalentsSubsystemsRouter *equivalentsSubsystemsRouter,
+        ContractorsManager *contractorsManager,
         SubsystemsController *subsystemsController,
         as::io_service &ioService,
+        TimerService *timerService,
+        WorkersPool *workersPool,
         vector<SerializedEquivalent> equivalents,
         CyclesRunningParameters cyclesRunningParameters,
         Logger &logger);
@@ -91,7 +96,11 @@ private:
 
 private:
     as::io_service &mIOService;
+    TimerService *mTimerService;
+    WorkersPool *mWorkersPool;
     TransactionsScheduler *mTransactionScheduler;
+    EquivalentsSubsystemsRouter *mEquivalentsSubsystemsRouter;
+    ContractorsManager *mContractorsManager;
     SubsystemsController *mSubsystemsController;
     CyclesRunningParameters mCyclesRunningParameters;
     Logger &mLogger;
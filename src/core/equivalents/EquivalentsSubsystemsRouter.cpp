@@ -5,7 +5,7 @@ EquivalentsSubsystemsRouter::EquivalentsSubsystemsRouter(
     Keystore *keystore,
     ContractorsManager *contractorsManager,
     EventsInterfaceManager *eventsInterfaceManager,
-    as::io_service &ioService,
+    TimerService *timerService,
     vector<SerializedEquivalent> &equivalentsIAmGateway,
     Logger &logger):
 
@@ -13,7 +13,7 @@ EquivalentsSubsystemsRouter::EquivalentsSubsystemsRouter(
     mKeysStore(keystore),
     mContractorsManager(contractorsManager),
     mEventsInterfaceManager(eventsInterfaceManager),
-    mIOService(ioService),
+    mTimerService(timerService),
     mLogger(logger)
 {
     {
@@ -72,7 +72,7 @@ EquivalentsSubsystemsRouter::EquivalentsSubsystemsRouter(
                 equivalent,
                 make_unique<TopologyCacheUpdateDelayedTask>(
                     equivalent,
-                    mIOService,
+                    mTimerService,
                     mTopologyCacheManagers[equivalent].get(),
                     mTopologyTrustLinesManagers[equivalent].get(),
                     mMaxFlowCacheManagers[equivalent].get(),
@@ -224,7 +224,7 @@ void EquivalentsSubsystemsRouter::initNewEquivalent(
             equivalent,
             make_unique<TopologyCacheUpdateDelayedTask>(
                 equivalent,
-                mIOService,
+                mTimerService,
                 mTopologyCacheManagers[equivalent].get(),
                 mTopologyTrustLinesManagers[equivalent].get(),
                 mMaxFlowCacheManagers[equivalent].get(),
@@ -19,7 +19,7 @@ public:
         Keystore *keystore,
         ContractorsManager *contractorsManager,
         EventsInterfaceManager *eventsInterfaceManager,
-        as::io_service &ioService,
+        TimerService *timerService,
         vector<SerializedEquivalent> &equivalentsIAmGateway,
         Logger &logger);
 
@@ -72,7 +72,7 @@ private:
 
 private:
     map<SerializedEquivalent, bool> mIAmGateways;
-    as::io_service &mIOService;
+    TimerService *mTimerService;
     StorageHandler *mStorageHandler;
     Keystore *mKeysStore;
     ContractorsManager *mContractorsManager;
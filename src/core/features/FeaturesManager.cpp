@@ -1,14 +1,14 @@
 #include "FeaturesManager.h"
 
 FeaturesManager::FeaturesManager(
-    as::io_service &ioService,
+    TimerService *timerService,
     const string& equivalentsRegistryAddress,
     const string& ownAddresses,
     StorageHandler *storageHandler,
     Logger &logger):
     LoggerMixin(logger),
-    mIOService(ioService),
-    mStorageHandler(storageHandler)
+    mStorageHandler(storageHandler),
+    mNotificationTimer(timerService)
 {
     if (equivalentsRegistryAddress.empty()) {
         throw ValueError("Equivalents registry address is empty");
@@ -45,16 +45,12 @@ FeaturesManager::FeaturesManager(
             ioTransaction->featuresHandler()->saveFeature(
                 kOwnAddressesFieldName,
                 ownAddresses);
-            mNotificationTimer = make_unique<as::steady_timer>(
-                mIOService);
-            mNotificationTimer->expires_from_now(
+            mNotificationTimer.expiresFromNow(
                 chrono::seconds(
-                    kSignalTimerPeriodSeconds));
-            mNotificationTimer->async_wait(
-                boost::bind(
-                    &FeaturesManager::runSignalNotify,
-                    this,
-                    as::placeholders::error));
+                    kSignalTimerPeriodSeconds),
+                [this]() {
+                    runSignalNotify();
+                });
         }
     } catch (NotFoundError &e) {
         info() << "There is no feature " << kOwnAddressesFieldName << " yet. Add it";
@@ -72,14 +68,9 @@ string FeaturesManager::getEquivalentsRegistryAddress() const
     return mEquivalentsRegistryAddressValue;
 }
 
-void FeaturesManager::runSignalNotify(
-    const boost::system::error_code &errorCode)
+void FeaturesManager::runSignalNotify()
 {
-    if (errorCode) {
-        warning() << errorCode.message().c_str();
-    }
     info() << "run address update notification signal";
-    mNotificationTimer->cancel();
     sendAddressesSignal();
 }
 
@@ -4,13 +4,11 @@
 #include "../settings/Settings.h"
 #include "../io/storage/StorageHandler.h"
 #include "../logger/LoggerMixin.hpp"
+#include "../common/time/TimerService.h"
 
-#include <boost/asio/steady_timer.hpp>
 #include <boost/signals2.hpp>
-#include <boost/asio.hpp>
 
 using namespace std;
-namespace as = boost::asio;
 namespace signals = boost::signals2;
 
 class FeaturesManager : protected LoggerMixin {
@@ -20,7 +18,7 @@ public:
 
 public:
     FeaturesManager(
-        as::io_service &ioService,
+        TimerService *timerService,
         const string& equivalentsRegistryAddress,
         const string& ownAddresses,
         StorageHandler *storageHandler,
@@ -35,8 +33,7 @@ protected:
     const string logHeader() const override;
 
 private:
-    void runSignalNotify(
-        const boost::system::error_code &error);
+    void runSignalNotify();
 
 private:
     const string kEquivalentsRegistryAddressFieldName = "EQUIVALENTS_REGISTRY_ADDRESS";
@@ -46,8 +43,7 @@ private:
 private:
     StorageHandler *mStorageHandler;
     string mEquivalentsRegistryAddressValue;
-    as::io_service &mIOService;
-    unique_ptr<as::steady_timer> mNotificationTimer;
+    TimerService::Timer mNotificationTimer;
 };
 
 
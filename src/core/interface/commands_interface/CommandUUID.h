@@ -8,4 +8,14 @@ class CommandUUID: public NodeUUID {
     using NodeUUID::NodeUUID;
 };
 
+namespace std {
+    template<>
+    struct hash<CommandUUID> {
+        size_t operator()(const CommandUUID &u) const noexcept
+        {
+            return hash<NodeUUID>()(u);
+        }
+    };
+}
+
 #endif //GEO_NETWORK_CLIENT_COMMANDUUID_H
@@ -8,6 +8,10 @@ HistoryAdditionalPaymentsCommand::HistoryAdditionalPaymentsCommand(
         uuid,
         identifier())
 {
+    GEOEpochTimestamp cursorTimestamp = 0;
+    uint64_t cursorRecordID = 0;
+    bool isCursorPositioned = false;
+    bool isCursorExhausted = false;
     uint32_t flagLow = 0, flagHigh = 0;
     std::string lowBoundaryAmount, highBoundaryAmount;
     auto check = [&](auto &ctx) {
@@ -61,6 +65,21 @@ HistoryAdditionalPaymentsCommand::HistoryAdditionalPaymentsCommand(
     auto equivalentParse = [&](auto &ctx) {
         mEquivalent = _attr(ctx);
     };
+    auto cursorNull = [&](auto &ctx) {
+        mIsCursorPresent = true;
+    };
+    auto cursorEnd = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorExhausted = true;
+    };
+    auto cursorTimestampParse = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorPositioned = true;
+        cursorTimestamp = _attr(ctx);
+    };
+    auto cursorRecordIDParse = [&](auto &ctx) {
+        cursorRecordID = _attr(ctx);
+    };
 
     try {
         parse(
@@ -87,9 +106,26 @@ HistoryAdditionalPaymentsCommand::HistoryAdditionalPaymentsCommand(
                 > -(*(digit [highBoundaryAmountNumber] > !alpha > !punct))
                 > char_(kTokensSeparator)
                 > int_[equivalentParse]
+                > -(char_(kTokensSeparator)
+                    > (
+                        parserString::string("null")[cursorNull] |
+                        parserString::string("end")[cursorEnd] |
+                        (ulong_[cursorTimestampParse] > char_(':') > ulong_[cursorRecordIDParse])))
                 > eol > eoi));
         mLowBoundaryAmount = TrustLineAmount(lowBoundaryAmount);
         mHighBoundaryAmount = TrustLineAmount(highBoundaryAmount);
+        if (isCursorPositioned) {
+            mCursor = HistoryCursor(
+                cursorTimestamp,
+                (int64_t)cursorRecordID);
+        }
+        if (isCursorExhausted) {
+            mCursor.exhaust();
+        }
+        // cursor defines position of the page by itself, offset can't be applied to it
+        if (mIsCursorPresent and mHistoryFrom != 0) {
+            throw ValueError("HistoryAdditionalPaymentsCommand: cursor can't be combined with records offset.");
+        }
     }
     catch(...) {
        throw ValueError("HistoryAdditionalPaymentsCommand : cannot parse command.");
@@ -157,12 +193,22 @@ const SerializedEquivalent HistoryAdditionalPaymentsCommand::equivalent() const
     return mEquivalent;
 }
 
-CommandResult::SharedConst HistoryAdditionalPaymentsCommand::resultOk(string &historyPaymentsStr) const
+const bool HistoryAdditionalPaymentsCommand::isCursorPresent() const
+{
+    return mIsCursorPresent;
+}
+
+const HistoryCursor &HistoryAdditionalPaymentsCommand::cursor() const
+{
+    return mCursor;
+}
+
+CommandResult::SharedConst HistoryAdditionalPaymentsCommand::resultOk(
+    CommandResult::ChunksGeneratorFactory recordsGenerator) const
 {
-    return CommandResult::SharedConst(
-        new CommandResult(
-            identifier(),
-            UUID(),
-            200,
-            historyPaymentsStr));
+    return make_shared<const CommandResult>(
+        identifier(),
+        UUID(),
+        200,
+        recordsGenerator);
 }
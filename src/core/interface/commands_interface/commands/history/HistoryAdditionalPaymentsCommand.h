@@ -2,6 +2,7 @@
 #define GEO_NETWORK_CLIENT_HISTORYADDTIONALPAYMENTSCOMMAND_H
 
 #include "../BaseUserCommand.h"
+#include "../../../../io/storage/record/base/HistoryCursor.h"
 #include "../../../../common/multiprecision/MultiprecisionUtils.h"
 
 class HistoryAdditionalPaymentsCommand : public BaseUserCommand {
@@ -17,7 +18,7 @@ public:
     static const string &identifier();
 
     CommandResult::SharedConst resultOk(
-        string &historyPaymentsStr) const;
+        CommandResult::ChunksGeneratorFactory recordsGenerator) const;
 
     const size_t historyFrom() const;
 
@@ -41,6 +42,11 @@ public:
 
     const SerializedEquivalent equivalent() const;
 
+    const bool isCursorPresent() const;
+
+    // position of the last record of the previous page, if keyset pagination was requested
+    const HistoryCursor &cursor() const;
+
 private:
     string kNullParameter = "null";
 
@@ -56,6 +62,8 @@ private:
     bool mIsLowBoundaryAmountPresent;
     bool mIsHighBoundaryAmountPresent;
     SerializedEquivalent mEquivalent;
+    HistoryCursor mCursor;
+    bool mIsCursorPresent = false;
 };
 
 #endif //GEO_NETWORK_CLIENT_HISTORYADDTIONALPAYMENTSCOMMAND_H
@@ -208,12 +208,12 @@ const bool HistoryPaymentsAllEquivalentsCommand::isPaymentRecordCommandUUIDPrese
     return mIsPaymentRecordCommandUUIDPresent;
 }
 
-CommandResult::SharedConst HistoryPaymentsAllEquivalentsCommand::resultOk(string &historyPaymentsStr) const
+CommandResult::SharedConst HistoryPaymentsAllEquivalentsCommand::resultOk(
+    CommandResult::ChunksGeneratorFactory recordsGenerator) const
 {
-    return CommandResult::SharedConst(
-        new CommandResult(
-            identifier(),
-            UUID(),
-            200,
-            historyPaymentsStr));
-}
\ No newline at end of file
+    return make_shared<const CommandResult>(
+        identifier(),
+        UUID(),
+        200,
+        recordsGenerator);
+}
@@ -17,7 +17,7 @@ public:
     static const string &identifier();
 
     CommandResult::SharedConst resultOk(
-        string &historyPaymentsStr) const;
+        CommandResult::ChunksGeneratorFactory recordsGenerator) const;
 
     const size_t historyFrom() const;
 
@@ -8,6 +8,10 @@ HistoryPaymentsCommand::HistoryPaymentsCommand(
         uuid,
         identifier())
 {
+    GEOEpochTimestamp cursorTimestamp = 0;
+    uint64_t cursorRecordID = 0;
+    bool isCursorPositioned = false;
+    bool isCursorExhausted = false;
     uint32_t flagLow = 0, flagHigh = 0, flag4 = 0, flag8 =0 , flag12 = 0;
     std::string lowBoundaryAmount, highBoundaryAmount, paymentRecordCommandUUID, paymentRecordTransactionUUID;
     auto check = [&](auto &ctx) {
@@ -120,6 +124,21 @@ HistoryPaymentsCommand::HistoryPaymentsCommand(
     auto equivalentParse = [&](auto &ctx) {
         mEquivalent = _attr(ctx);
     };
+    auto cursorNull = [&](auto &ctx) {
+        mIsCursorPresent = true;
+    };
+    auto cursorEnd = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorExhausted = true;
+    };
+    auto cursorTimestampParse = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorPositioned = true;
+        cursorTimestamp = _attr(ctx);
+    };
+    auto cursorRecordIDParse = [&](auto &ctx) {
+        cursorRecordID = _attr(ctx);
+    };
 
     try {
         parse(
@@ -170,6 +189,11 @@ HistoryPaymentsCommand::HistoryPaymentsCommand(
                             addTransactionUUID12Digits))
                 > char_(kTokensSeparator)
                 > *(int_[equivalentParse])
+                > -(char_(kTokensSeparator)
+                    > (
+                        parserString::string("null")[cursorNull] |
+                        parserString::string("end")[cursorEnd] |
+                        (ulong_[cursorTimestampParse] > char_(':') > ulong_[cursorRecordIDParse])))
                 > eol > eoi));
 
         if(mIsLowBoundaryAmountPresent){
@@ -185,6 +209,18 @@ HistoryPaymentsCommand::HistoryPaymentsCommand(
             mPaymentRecordTransactionUUID = boost::lexical_cast<uuids::uuid>(paymentRecordTransactionUUID);
         }
 
+        if (isCursorPositioned) {
+            mCursor = HistoryCursor(
+                cursorTimestamp,
+                (int64_t)cursorRecordID);
+        }
+        if (isCursorExhausted) {
+            mCursor.exhaust();
+        }
+        // cursor defines position of the page by itself, offset can't be applied to it
+        if (mIsCursorPresent and mHistoryFrom != 0) {
+            throw ValueError("HistoryPaymentsCommand: cursor can't be combined with records offset.");
+        }
     } catch(...) {
         throw ValueError("HistoryPaymentsCommand: cannot parse command.");
     }
@@ -271,12 +307,22 @@ const SerializedEquivalent HistoryPaymentsCommand::equivalent() const
     return mEquivalent;
 }
 
-CommandResult::SharedConst HistoryPaymentsCommand::resultOk(string &historyPaymentsStr) const
+const bool HistoryPaymentsCommand::isCursorPresent() const
+{
+    return mIsCursorPresent;
+}
+
+const HistoryCursor &HistoryPaymentsCommand::cursor() const
+{
+    return mCursor;
+}
+
+CommandResult::SharedConst HistoryPaymentsCommand::resultOk(
+    CommandResult::ChunksGeneratorFactory recordsGenerator) const
 {
-    return CommandResult::SharedConst(
-        new CommandResult(
-            identifier(),
-            UUID(),
-            200,
-            historyPaymentsStr));
+    return make_shared<const CommandResult>(
+        identifier(),
+        UUID(),
+        200,
+        recordsGenerator);
 }
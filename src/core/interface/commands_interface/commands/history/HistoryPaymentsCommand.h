@@ -2,6 +2,7 @@
 #define GEO_NETWORK_CLIENT_HISTORYPAYMENTSCOMMAND_H
 
 #include "../BaseUserCommand.h"
+#include "../../../../io/storage/record/base/HistoryCursor.h"
 #include "../../../../common/multiprecision/MultiprecisionUtils.h"
 #include "../../../../transactions/transactions/base/TransactionUUID.h"
 
@@ -18,7 +19,7 @@ public:
     static const string &identifier();
 
     CommandResult::SharedConst resultOk(
-        string &historyPaymentsStr) const;
+        CommandResult::ChunksGeneratorFactory recordsGenerator) const;
 
     const size_t historyFrom() const;
 
@@ -50,6 +51,11 @@ public:
 
     const SerializedEquivalent equivalent() const;
 
+    const bool isCursorPresent() const;
+
+    // position of the last record of the previous page, if keyset pagination was requested
+    const HistoryCursor &cursor() const;
+
 private:
     string kNullParameter = "null";
 
@@ -69,6 +75,8 @@ private:
     TransactionUUID mPaymentRecordTransactionUUID;
     bool mIsPaymentRecordTransactionUUIDPresent;
     SerializedEquivalent mEquivalent;
+    HistoryCursor mCursor;
+    bool mIsCursorPresent = false;
 };
 
 #endif //GEO_NETWORK_CLIENT_HISTORYPAYMENTSCOMMAND_H
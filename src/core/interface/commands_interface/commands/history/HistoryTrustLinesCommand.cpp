@@ -8,6 +8,10 @@ HistoryTrustLinesCommand::HistoryTrustLinesCommand(
         uuid,
         identifier())
 {
+    GEOEpochTimestamp cursorTimestamp = 0;
+    uint64_t cursorRecordID = 0;
+    bool isCursorPositioned = false;
+    bool isCursorExhausted = false;
     auto check = [&](auto &ctx) {
         if(_attr(ctx) == kCommandsSeparator || _attr(ctx) == kTokensSeparator) {
             throw ValueError("HistoryTrustLinesCommand: input is empty.");
@@ -38,6 +42,21 @@ HistoryTrustLinesCommand::HistoryTrustLinesCommand(
     auto equivalentParse = [&](auto &ctx) {
         mEquivalent = _attr(ctx);
     };
+    auto cursorNull = [&](auto &ctx) {
+        mIsCursorPresent = true;
+    };
+    auto cursorEnd = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorExhausted = true;
+    };
+    auto cursorTimestampParse = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorPositioned = true;
+        cursorTimestamp = _attr(ctx);
+    };
+    auto cursorRecordIDParse = [&](auto &ctx) {
+        cursorRecordID = _attr(ctx);
+    };
 
     try {
         parse(
@@ -58,7 +77,24 @@ HistoryTrustLinesCommand::HistoryTrustLinesCommand(
                 > -(ulong_[timeToPresentAddMicroseconds])
                 > char_(kTokensSeparator)
                 > int_[equivalentParse]
+                > -(char_(kTokensSeparator)
+                    > (
+                        parserString::string("null")[cursorNull] |
+                        parserString::string("end")[cursorEnd] |
+                        (ulong_[cursorTimestampParse] > char_(':') > ulong_[cursorRecordIDParse])))
                 > eol > eoi));
+        if (isCursorPositioned) {
+            mCursor = HistoryCursor(
+                cursorTimestamp,
+                (int64_t)cursorRecordID);
+        }
+        if (isCursorExhausted) {
+            mCursor.exhaust();
+        }
+        // cursor defines position of the page by itself, offset can't be applied to it
+        if (mIsCursorPresent and mHistoryFrom != 0) {
+            throw ValueError("HistoryTrustLinesCommand: cursor can't be combined with records offset.");
+        }
     } catch(...) {
         throw ValueError("HistoryTrustLinesCommand: cannot parse command.");
     }
@@ -105,12 +141,22 @@ const SerializedEquivalent HistoryTrustLinesCommand::equivalent() const
     return mEquivalent;
 }
 
-CommandResult::SharedConst HistoryTrustLinesCommand::resultOk(string &historyTrustLinesStr) const
+const bool HistoryTrustLinesCommand::isCursorPresent() const
+{
+    return mIsCursorPresent;
+}
+
+const HistoryCursor &HistoryTrustLinesCommand::cursor() const
+{
+    return mCursor;
+}
+
+CommandResult::SharedConst HistoryTrustLinesCommand::resultOk(
+    CommandResult::ChunksGeneratorFactory recordsGenerator) const
 {
-    return CommandResult::SharedConst(
-        new CommandResult(
-            identifier(),
-            UUID(),
-            200,
-            historyTrustLinesStr));
+    return make_shared<const CommandResult>(
+        identifier(),
+        UUID(),
+        200,
+        recordsGenerator);
 }
@@ -2,6 +2,7 @@
 #define GEO_NETWORK_CLIENT_HISTORYTRUSTLINESCOMMAND_H
 
 #include "../BaseUserCommand.h"
+#include "../../../../io/storage/record/base/HistoryCursor.h"
 
 class HistoryTrustLinesCommand : public BaseUserCommand {
 
@@ -16,7 +17,7 @@ public:
     static const string &identifier();
 
     CommandResult::SharedConst resultOk(
-        string &historyTrustLinesStr) const;
+        CommandResult::ChunksGeneratorFactory recordsGenerator) const;
 
     const size_t historyFrom() const;
 
@@ -32,6 +33,11 @@ public:
 
     const SerializedEquivalent equivalent() const;
 
+    const bool isCursorPresent() const;
+
+    // position of the last record of the previous page, if keyset pagination was requested
+    const HistoryCursor &cursor() const;
+
 private:
     string kNullParameter = "null";
 
@@ -43,6 +49,8 @@ private:
     bool mIsTimeFromPresent;
     bool mIsTimeToPresent;
     SerializedEquivalent mEquivalent;
+    HistoryCursor mCursor;
+    bool mIsCursorPresent = false;
 };
 
 #endif //GEO_NETWORK_CLIENT_HISTORYTRUSTLINESCOMMAND_H
@@ -8,6 +8,10 @@ HistoryWithContractorCommand::HistoryWithContractorCommand(
         uuid,
         identifier())
 {
+    GEOEpochTimestamp cursorTimestamp = 0;
+    uint64_t cursorRecordID = 0;
+    bool isCursorPositioned = false;
+    bool isCursorExhausted = false;
     std::string address, addressType;
     size_t contractorAddressesCount;
     auto check = [&](auto &ctx) {
@@ -30,6 +34,21 @@ HistoryWithContractorCommand::HistoryWithContractorCommand(
     auto equivalentParse = [&](auto &ctx) {
         mEquivalent = _attr(ctx);
     };
+    auto cursorNull = [&](auto &ctx) {
+        mIsCursorPresent = true;
+    };
+    auto cursorEnd = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorExhausted = true;
+    };
+    auto cursorTimestampParse = [&](auto &ctx) {
+        mIsCursorPresent = true;
+        isCursorPositioned = true;
+        cursorTimestamp = _attr(ctx);
+    };
+    auto cursorRecordIDParse = [&](auto &ctx) {
+        cursorRecordID = _attr(ctx);
+    };
     auto addressAddChar = [&](auto &ctx) {
         address += _attr(ctx);
     };
@@ -92,7 +111,25 @@ HistoryWithContractorCommand::HistoryWithContractorCommand(
                         addressAddNumber,
                         addressTypeParse,
                         addressAddToVector)
-                > +(int_[equivalentParse]) > eol > eoi));
+                > +(int_[equivalentParse])
+                > -(char_(kTokensSeparator)
+                    > (
+                        parserString::string("null")[cursorNull] |
+                        parserString::string("end")[cursorEnd] |
+                        (ulong_[cursorTimestampParse] > char_(':') > ulong_[cursorRecordIDParse])))
+                > eol > eoi));
+        if (isCursorPositioned) {
+            mCursor = HistoryCursor(
+                cursorTimestamp,
+                (int64_t)cursorRecordID);
+        }
+        if (isCursorExhausted) {
+            mCursor.exhaust();
+        }
+        // cursor defines position of the page by itself, offset can't be applied to it
+        if (mIsCursorPresent and mHistoryFrom != 0) {
+            throw ValueError("HistoryWithContractorCommand: cursor can't be combined with records offset.");
+        }
     } catch (...) {
         throw ValueError("HistoryWithContractorCommand: cannot parse command.");
     }
@@ -124,13 +161,22 @@ const SerializedEquivalent HistoryWithContractorCommand::equivalent() const
     return mEquivalent;
 }
 
+const bool HistoryWithContractorCommand::isCursorPresent() const
+{
+    return mIsCursorPresent;
+}
+
+const HistoryCursor &HistoryWithContractorCommand::cursor() const
+{
+    return mCursor;
+}
+
 CommandResult::SharedConst HistoryWithContractorCommand::resultOk(
-    string &historyPaymentsStr) const
+    CommandResult::ChunksGeneratorFactory recordsGenerator) const
 {
-    return CommandResult::SharedConst(
-        new CommandResult(
-            identifier(),
-            UUID(),
-            200,
-            historyPaymentsStr));
+    return make_shared<const CommandResult>(
+        identifier(),
+        UUID(),
+        200,
+        recordsGenerator);
 }
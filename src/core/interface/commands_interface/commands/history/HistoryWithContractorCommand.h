@@ -2,6 +2,7 @@
 #define GEO_NETWORK_CLIENT_HISTORYWITHCONTRACTORCOMMAND_H
 
 #include "../BaseUserCommand.h"
+#include "../../../../io/storage/record/base/HistoryCursor.h"
 
 class HistoryWithContractorCommand : public BaseUserCommand {
 
@@ -16,7 +17,7 @@ public:
     static const string &identifier();
 
     CommandResult::SharedConst resultOk(
-        string &historyWithContractorStr) const;
+        CommandResult::ChunksGeneratorFactory recordsGenerator) const;
 
     const size_t historyFrom() const;
 
@@ -26,11 +27,18 @@ public:
 
     const SerializedEquivalent equivalent() const;
 
+    const bool isCursorPresent() const;
+
+    // position of the last record of the previous page, if keyset pagination was requested
+    const HistoryCursor &cursor() const;
+
 private:
     size_t mHistoryFrom;
     size_t mHistoryCount;
     vector<BaseAddress::Shared> mContractorAddresses;
     SerializedEquivalent mEquivalent;
+    HistoryCursor mCursor;
+    bool mIsCursorPresent = false;
 };
 
 #endif //GEO_NETWORK_CLIENT_HISTORYWITHCONTRACTORCOMMAND_H
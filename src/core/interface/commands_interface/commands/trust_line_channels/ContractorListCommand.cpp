@@ -23,4 +23,14 @@ CommandResult::SharedConst ContractorListCommand::resultOk(
         UUID(),
         200,
         contractors);
-}
\ No newline at end of file
+}
+
+CommandResult::SharedConst ContractorListCommand::resultOk(
+    CommandResult::ChunksGeneratorFactory contractorsGenerator) const
+{
+    return make_shared<const CommandResult>(
+        identifier(),
+        UUID(),
+        200,
+        contractorsGenerator);
+}
@@ -17,6 +17,9 @@ public:
 
     CommandResult::SharedConst resultOk(
         string &contractors) const;
+
+    CommandResult::SharedConst resultOk(
+        CommandResult::ChunksGeneratorFactory contractorsGenerator) const;
 };
 
 #endif //GEO_NETWORK_CLIENT_CONTRACTORLISTCOMMAND_H
@@ -72,3 +72,13 @@ CommandResult::SharedConst GetTrustLinesCommand::resultOk(
         200,
         neighbors);
 }
+
+CommandResult::SharedConst GetTrustLinesCommand::resultOk(
+    CommandResult::ChunksGeneratorFactory neighborsGenerator) const
+{
+    return make_shared<const CommandResult>(
+        identifier(),
+        UUID(),
+        200,
+        neighborsGenerator);
+}
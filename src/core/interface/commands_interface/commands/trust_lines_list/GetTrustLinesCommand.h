@@ -24,6 +24,9 @@ public:
     CommandResult::SharedConst resultOk(
         string &neighbors) const;
 
+    CommandResult::SharedConst resultOk(
+        CommandResult::ChunksGeneratorFactory neighborsGenerator) const;
+
 private:
     SerializedEquivalent mEquivalent;
     size_t mFrom;
@@ -4,8 +4,60 @@
 CommandsParser::CommandsParser(
     Logger &log):
 
+    mBufferOffset(0),
     mLog(log)
-{}
+{
+    registerCommand<InitChannelCommand>(InitChannel);
+    registerCommand<SetChannelContractorAddressesCommand>(SetChannelContractorAddresses);
+    registerCommand<SetChannelContractorCryptoKeyCommand>(SetChannelContractorCryptoKey);
+    registerCommand<RegenerateChannelCryptoKeyCommand>(RegenerateChannelCryptoKey);
+    registerCommand<RemoveChannelCommand>(RemoveChannel);
+    registerCommand<InitTrustLineCommand>(InitTrustLine);
+    registerCommand<SetOutgoingTrustLineCommand>(SetOutgoingTrustLine);
+    registerCommand<CloseIncomingTrustLineCommand>(CloseIncomingTrustLine);
+    registerCommand<ShareKeysCommand>(ShareKeys);
+    registerCommand<RemoveTrustLineCommand>(RemoveTrustLine);
+    registerCommand<ResetTrustLineCommand>(ResetTrustLine);
+    registerCommand<CreditUsageCommand>(CreditUsage);
+    registerCommand<InitiateMaxFlowCalculationCommand>(InitiateMaxFlowCalculation);
+    registerCommand<InitiateMaxFlowCalculationFullyCommand>(InitiateMaxFlowCalculationFully);
+    registerCommand<TotalBalancesCommand>(TotalBalances);
+    registerCommand<HistoryPaymentsCommand>(HistoryPayments);
+    registerCommand<HistoryPaymentsAllEquivalentsCommand>(HistoryPaymentsAllEquivalents);
+    registerCommand<HistoryAdditionalPaymentsCommand>(HistoryAdditionalPayments);
+    registerCommand<HistoryTrustLinesCommand>(HistoryTrustLines);
+    registerCommand<HistoryWithContractorCommand>(HistoryWithContractor);
+    registerCommand<GetFirstLevelContractorsCommand>(GetFirstLevelContractors);
+    registerCommand<GetTrustLinesCommand>(GetTrustLines);
+    registerCommand<GetTrustLineByAddressCommand>(GetTrustLineByAddress);
+    registerCommand<GetTrustLineByIDCommand>(GetTrustLineByID);
+    registerCommand<EquivalentListCommand>(EquivalentList);
+    registerCommand<ContractorListCommand>(ContractorList);
+    registerCommand<GetChannelInfoCommand>(GetChannelInfo);
+    registerCommand<GetChannelInfoByAddressesCommand>(GetChannelInfoByAddresses);
+    registerCommand<SubsystemsInfluenceCommand>(SubsystemsInfluence);
+    registerCommand<TrustLinesInfluenceCommand>(TrustLinesInfluence);
+    registerCommand<PaymentTransactionByCommandUUIDCommand>(PaymentTransactionByCommandUUID);
+    registerCommand<RemoveOutdatedCryptoDataCommand>(RemoveOutdatedCryptoData);
+}
+
+/**
+ * Adds command into the dispatch tables of both text and binary protocols.
+ */
+template <typename CommandType>
+void CommandsParser::registerCommand(
+    const BinaryCommandID binaryID)
+{
+    const string identifier = CommandType::identifier();
+    mFactoriesByIdentifier[identifier] = &CommandsParser::newCommand<CommandType>;
+
+    if (mFactoriesByBinaryID.size() <= binaryID) {
+        mFactoriesByBinaryID.resize(binaryID + 1);
+    }
+    mFactoriesByBinaryID[binaryID] = make_pair(
+        identifier,
+        &CommandsParser::newCommand<CommandType>);
+}
 
 /**
  * Copies data, received from the commands FIFO, into the internal buffer.
@@ -27,10 +79,26 @@ void CommandsParser::appendReadData(
     }
 
     // TODO: check if using buffer->data() doesn't leads to the buffer overflow.
-    const char *data = as::buffer_cast<const char*>(buffer->data());
-    for (size_t i = 0; i < receivedBytesCount; ++i) {
-        mBuffer.push_back(*data++);
+    appendReadData(
+        as::buffer_cast<const char*>(buffer->data()),
+        receivedBytesCount);
+}
+
+/**
+ * Copies raw data, received from the socket, into the internal buffer.
+ * See appendReadData(as::streambuf*, size_t) for the details.
+ */
+void CommandsParser::appendReadData(
+    const char *data,
+    const size_t receivedBytesCount)
+{
+    if (receivedBytesCount == 0) {
+        return;
     }
+
+    mBuffer.append(
+        data,
+        receivedBytesCount);
 }
 
 /**
@@ -49,8 +117,8 @@ pair<bool, BaseUserCommand::Shared> CommandsParser::processReceivedCommands()
 
 /*!
  * Tries to deserialize received command.
- * In case when buffer is too short to contains even one command -
- * will return immediately.
+ * In case when the command is not received completely (there is no commands separator yet) -
+ * will return <false, nullptr>, and command would be processed when the rest of it would be received.
  *
  * First value of returned pair indicates if command was parsed succesfully,
  * and, if so, - the second one will contains shared pointer to the command instance itself.
@@ -58,30 +126,41 @@ pair<bool, BaseUserCommand::Shared> CommandsParser::processReceivedCommands()
  */
 pair<bool, BaseUserCommand::Shared> CommandsParser::tryDeserializeCommand()
 {
-    if (mBuffer.empty()) {
+    if (mBufferOffset == mBuffer.size()) {
+        compactBuffer();
         return make_pair(false, nullptr);
     }
-    if (mBuffer.size() < kMinCommandSize) {
-        cutBufferUpToNextCommand();
-        return commandError(
-            CommandUUID::empty(),
-            "",
-            "command length is less than: " + std::to_string(kMinCommandSize) + ".");
+    if (mBuffer[mBufferOffset] == kBinaryFrameMarker) {
+        return tryDeserializeBinaryCommand();
+    }
+
+    const size_t commandEnd = mBuffer.find(kCommandsSeparator, mBufferOffset);
+    if (commandEnd == string::npos) {
+        if (mBuffer.size() - mBufferOffset > kTextCommandMaxLength) {
+            cutBuffer(mBuffer.size() - mBufferOffset);
+            return commandError(
+                CommandUUID::empty(),
+                "",
+                "command without separator is longer than: " + to_string(kTextCommandMaxLength) + ".");
+        }
+        // the rest of the command is not received yet
+        compactBuffer();
+        return make_pair(false, nullptr);
     }
 
-    size_t nextCommandSeparatorIndex = mBuffer.find(kCommandsSeparator);
-    if (nextCommandSeparatorIndex == string::npos) {
+    if (commandEnd - mBufferOffset < kMinCommandSize) {
         cutBufferUpToNextCommand();
         return commandError(
             CommandUUID::empty(),
             "",
-            "command must contain at leas one separator.");
+            "command length is less than: " + std::to_string(kMinCommandSize) + ".");
     }
 
-    CommandUUID commandUUID;
+    CommandUUID commandUUID(CommandUUID::kNil);
     try {
-        string hexUUID = mBuffer.substr(0, kUUIDHexRepresentationSize);
-        commandUUID = boost::lexical_cast<uuid>(hexUUID);
+        commandUUID = boost::lexical_cast<uuid>(
+            mBuffer.data() + mBufferOffset,
+            kUUIDHexRepresentationSize);
 
     } catch (...) {
         cutBufferUpToNextCommand();
@@ -91,22 +170,13 @@ pair<bool, BaseUserCommand::Shared> CommandsParser::tryDeserializeCommand()
             "failed to parse CommandUUID.");
     }
 
-    string commandIdentifier;
-    const size_t identifierOffset = kUUIDHexRepresentationSize + 1;
-
-    commandIdentifier.reserve(kAverageCommandIdentifierLength);
-    size_t nextTokenOffset = identifierOffset;
-    for (size_t i = identifierOffset; i < mBuffer.size(); ++i) {
-        char symbol = mBuffer.at(i);
-        if (symbol == kTokensSeparator || symbol == kCommandsSeparator) {
-            break;
-        }
-        nextTokenOffset += 1;
-        commandIdentifier.push_back(symbol);
+    const size_t identifierOffset = mBufferOffset + kUUIDHexRepresentationSize + 1;
+    size_t identifierEnd = identifierOffset;
+    while (identifierEnd < commandEnd and mBuffer[identifierEnd] != kTokensSeparator) {
+        identifierEnd++;
     }
-    nextTokenOffset += 1;
 
-    if (commandIdentifier.empty()) {
+    if (identifierEnd == identifierOffset) {
         cutBufferUpToNextCommand();
         return commandError(
             commandUUID,
@@ -114,18 +184,23 @@ pair<bool, BaseUserCommand::Shared> CommandsParser::tryDeserializeCommand()
             "command identifier is void.");
     }
 
+    const string commandIdentifier(
+        mBuffer,
+        identifierOffset,
+        identifierEnd - identifierOffset);
+
     try {
-        auto nextCommandBegin = mBuffer.find(kCommandsSeparator);
-        if (nextCommandBegin == string::npos) {
-            nextCommandBegin = mBuffer.size();
-        }
+        // body of the command, including commands separator (empty, if there are no tokens after identifier)
+        const size_t bodyOffset = identifierEnd + 1;
+        mCommandBody.assign(
+            mBuffer,
+            bodyOffset,
+            commandEnd - bodyOffset + 1);
 
         auto command = tryParseCommand(
             commandUUID,
             commandIdentifier,
-            mBuffer.substr(
-                nextTokenOffset,
-                nextCommandBegin - nextTokenOffset + 1));
+            mCommandBody);
 
         cutBufferUpToNextCommand();
         return command;
@@ -139,6 +214,86 @@ pair<bool, BaseUserCommand::Shared> CommandsParser::tryDeserializeCommand()
     }
 }
 
+/*!
+ * Tries to deserialize command, received in binary frame (see CommandsParser description).
+ * In case when frame is not received completely - returns <false, nullptr>,
+ * and frame would be processed when the rest of it would be received.
+ *
+ * Command UUID is copied from the frame as is, and the command is dispatched by its numeric identifier,
+ * so only command body is copied out of the internal buffer.
+ */
+pair<bool, BaseUserCommand::Shared> CommandsParser::tryDeserializeBinaryCommand()
+{
+    if (mBuffer.size() - mBufferOffset < kBinaryFrameHeaderSize) {
+        compactBuffer();
+        return make_pair(false, nullptr);
+    }
+
+    const auto *bytes = reinterpret_cast<const uint8_t*>(mBuffer.data()) + mBufferOffset;
+    uint32_t frameLength;
+    memcpy(
+        &frameLength,
+        bytes + sizeof(kBinaryFrameMarker),
+        sizeof(frameLength));
+    frameLength = boost::endian::big_to_native(frameLength);
+
+    if (frameLength < kBinaryFrameMinLength or frameLength > kBinaryFrameMaxLength) {
+        cutBufferUpToNextCommand();
+        return commandError(
+            CommandUUID::empty(),
+            "",
+            "invalid binary frame length: " + to_string(frameLength) + ".");
+    }
+
+    const size_t frameSize = kBinaryFrameHeaderSize + frameLength;
+    if (mBuffer.size() - mBufferOffset < frameSize) {
+        compactBuffer();
+        return make_pair(false, nullptr);
+    }
+
+    const auto *frame = bytes + kBinaryFrameHeaderSize;
+    uint16_t binaryID;
+    memcpy(
+        &binaryID,
+        frame,
+        sizeof(binaryID));
+    binaryID = boost::endian::big_to_native(binaryID);
+
+    const CommandUUID commandUUID(
+        frame + sizeof(binaryID));
+
+    if (mBuffer[mBufferOffset + frameSize - 1] != kCommandsSeparator) {
+        cutBuffer(frameSize);
+        return commandError(
+            commandUUID,
+            "",
+            "binary frame must be terminated by commands separator.");
+    }
+
+    if (binaryID >= mFactoriesByBinaryID.size() or mFactoriesByBinaryID[binaryID].second == nullptr) {
+        cutBuffer(frameSize);
+        return commandError(
+            commandUUID,
+            "",
+            "unexpected binary command identifier received. " + to_string(binaryID));
+    }
+
+    const size_t bodyOffset = kBinaryFrameHeaderSize + sizeof(binaryID) + NodeUUID::kBytesSize;
+    const auto &identifierAndFactory = mFactoriesByBinaryID[binaryID];
+    mCommandBody.assign(
+        mBuffer,
+        mBufferOffset + bodyOffset,
+        frameSize - bodyOffset);
+    auto command = tryBuildCommand(
+        commandUUID,
+        identifierAndFactory.first,
+        identifierAndFactory.second,
+        mCommandBody);
+
+    cutBuffer(frameSize);
+    return command;
+}
+
 /*!
  * Checks identifier and tries to build relevant command object.
  * @returns <true, command object> in case of success, otherwise returns <false, nullptr>.
@@ -154,174 +309,37 @@ pair<bool, BaseUserCommand::Shared> CommandsParser::tryParseCommand(
     const string &identifier,
     const string &buffer)
 {
-    BaseUserCommand *command = nullptr;
-    try {
-        if (identifier == InitChannelCommand::identifier()) {
-            command = new InitChannelCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == SetChannelContractorAddressesCommand::identifier()) {
-            command = new SetChannelContractorAddressesCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == SetChannelContractorCryptoKeyCommand::identifier()) {
-            command = new SetChannelContractorCryptoKeyCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == RegenerateChannelCryptoKeyCommand::identifier()) {
-            command = new RegenerateChannelCryptoKeyCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == RemoveChannelCommand::identifier()) {
-            command = new RemoveChannelCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == InitTrustLineCommand::identifier()) {
-            command = new InitTrustLineCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == SetOutgoingTrustLineCommand::identifier()) {
-            command = new SetOutgoingTrustLineCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == CloseIncomingTrustLineCommand::identifier()) {
-            command = new CloseIncomingTrustLineCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == ShareKeysCommand::identifier()) {
-            command = new ShareKeysCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == RemoveTrustLineCommand::identifier()) {
-            command = new RemoveTrustLineCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == ResetTrustLineCommand::identifier()) {
-            command = new ResetTrustLineCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == CreditUsageCommand::identifier()) {
-            command = new CreditUsageCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == InitiateMaxFlowCalculationCommand::identifier()) {
-            command = new InitiateMaxFlowCalculationCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == InitiateMaxFlowCalculationFullyCommand::identifier()) {
-            command = new InitiateMaxFlowCalculationFullyCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == TotalBalancesCommand::identifier()) {
-            command = new TotalBalancesCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == HistoryPaymentsCommand::identifier()) {
-            command = new HistoryPaymentsCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == HistoryPaymentsAllEquivalentsCommand::identifier()) {
-            command = new HistoryPaymentsAllEquivalentsCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == HistoryAdditionalPaymentsCommand::identifier()) {
-            command = new HistoryAdditionalPaymentsCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == HistoryTrustLinesCommand::identifier()) {
-            command = new HistoryTrustLinesCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == HistoryWithContractorCommand::identifier()) {
-            command = new HistoryWithContractorCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == GetFirstLevelContractorsCommand::identifier()) {
-            command = new GetFirstLevelContractorsCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == GetTrustLinesCommand::identifier()) {
-            command = new GetTrustLinesCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == GetTrustLineByAddressCommand::identifier()) {
-            command = new GetTrustLineByAddressCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == GetTrustLineByIDCommand::identifier()) {
-            command = new GetTrustLineByIDCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == EquivalentListCommand::identifier()) {
-            command = new EquivalentListCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == ContractorListCommand::identifier()) {
-            command = new ContractorListCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == GetChannelInfoCommand::identifier()) {
-            command = new GetChannelInfoCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == GetChannelInfoByAddressesCommand::identifier()) {
-            command = new GetChannelInfoByAddressesCommand(
-                uuid,
-                buffer);
-
-        } else if (identifier == SubsystemsInfluenceCommand::identifier()) {
-            return newCommand<SubsystemsInfluenceCommand>(
-                uuid,
-                buffer);
-
-        } else if (identifier == TrustLinesInfluenceCommand::identifier()) {
-            return newCommand<TrustLinesInfluenceCommand>(
-                uuid,
-                buffer);
-
-        } else if (identifier == PaymentTransactionByCommandUUIDCommand::identifier()) {
-            return newCommand<PaymentTransactionByCommandUUIDCommand>(
-                uuid,
-                buffer);
+    const auto identifierAndFactory = mFactoriesByIdentifier.find(identifier);
+    if (identifierAndFactory == mFactoriesByIdentifier.end()) {
+        return commandError(
+            uuid,
+            identifier,
+            "unexpected command identifier received. " + identifier);
+    }
 
-        } else if (identifier == RemoveOutdatedCryptoDataCommand::identifier()) {
-            return newCommand<RemoveOutdatedCryptoDataCommand>(
-                uuid,
-                buffer);
+    return tryBuildCommand(
+        uuid,
+        identifier,
+        identifierAndFactory->second,
+        buffer);
+}
 
-        } else {
-            return commandError(
+/*!
+ * Builds command object by the factory, found in dispatch table.
+ * @returns <true, command object> in case of success, otherwise returns <false, error command>.
+ */
+pair<bool, BaseUserCommand::Shared> CommandsParser::tryBuildCommand(
+    const CommandUUID &uuid,
+    const string &identifier,
+    CommandFactory factory,
+    const string &buffer)
+{
+    try {
+        return make_pair(
+            true,
+            factory(
                 uuid,
-                identifier,
-                "unexpected command identifier received. " + identifier);
-        }
+                buffer));
 
     } catch (bad_alloc &) {
         const char *err = "tryParseCommand: Memory allocation error occurred on command instance creation. ";
@@ -339,31 +357,56 @@ pair<bool, BaseUserCommand::Shared> CommandsParser::tryParseCommand(
             identifier,
             e.what());
     }
-
-    return make_pair(
-        true,
-        BaseUserCommand::Shared(command));
 }
 
 /*!
- * Removes last command (valid, or invalid) from the buffer.
+ * Skips current command (valid, or invalid) in the buffer.
  * Stops on commands separator symbol.
- * If no commands separator symbol is present - clears buffer at all.
+ * If no commands separator symbol is present - skips the rest of the buffer.
  */
 void CommandsParser::cutBufferUpToNextCommand()
 {
-    size_t nextCommandSeparatorIndex = mBuffer.find(kCommandsSeparator);
-    if (mBuffer.size() > (nextCommandSeparatorIndex + 1)) {
-        // Buffer contains other commands (or their parts), and them should be keept;
-        mBuffer = mBuffer.substr(nextCommandSeparatorIndex + 1, mBuffer.size() - 1);
+    size_t nextCommandSeparatorIndex = mBuffer.find(kCommandsSeparator, mBufferOffset);
+    if (nextCommandSeparatorIndex != string::npos) {
+        // Buffer may contain other commands (or their parts), and them should be keept;
+        cutBuffer(nextCommandSeparatorIndex + 1 - mBufferOffset);
 
     } else {
         // Buffer doesn't contains any other commands (even parts).
-        mBuffer.clear();
+        cutBuffer(mBuffer.size() - mBufferOffset);
     }
+}
 
-    // Resize the capacity to free unused memory.
-    mBuffer.shrink_to_fit();
+/*!
+ * Skips specified count of bytes of the current command.
+ * Bytes are not erased here, so processing of several commands received by one read
+ * doesn't move the rest of the buffer after each of them (see compactBuffer()).
+ */
+void CommandsParser::cutBuffer(
+    const size_t bytesCount)
+{
+    mBufferOffset += bytesCount;
+}
+
+/*!
+ * Removes already processed commands from the beginning of the buffer.
+ * Called when all complete commands are processed, so the rest of the buffer
+ * (the beginning of the next command, if any) is moved only once per read.
+ * Buffer capacity is decreased only after huge commands,
+ * so it is not reallocated on each received command.
+ */
+void CommandsParser::compactBuffer()
+{
+    if (mBufferOffset == 0) {
+        return;
+    }
+    mBuffer.erase(0, mBufferOffset);
+    mBufferOffset = 0;
+
+    if (mBuffer.capacity() > kMaxIdleBufferCapacity and mBuffer.size() < kMaxIdleBufferCapacity) {
+        // Resize the capacity to free unused memory.
+        mBuffer.shrink_to_fit();
+    }
 }
 
 pair<bool, BaseUserCommand::Shared> CommandsParser::commandError(
@@ -49,9 +49,12 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/endian/conversion.hpp>
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <unordered_map>
 
 #ifndef TESTS__TRUSTLINES
 #include "../../../common/Types.h"
@@ -68,6 +71,24 @@ namespace signals = boost::signals2;
  * CommandsParser is used for parsing received user input
  * and deserializing them into commands instances.
  *
+ * Optionally, commands may be transmitted in binary framed form through the same FIFO.
+ * Binary frame begins with kBinaryFrameMarker (text command always begins with hex UUID,
+ * so both forms may be mixed in one stream):
+ *
+ *   1 byte  - kBinaryFrameMarker;
+ *   4 bytes - length of the rest of the frame (big endian);
+ *   2 bytes - numeric command identifier (BinaryCommandID, big endian);
+ *  16 bytes - command UUID (raw bytes);
+ *   N bytes - command body in the same form as in text protocol (tokens after command identifier),
+ *             terminated by kCommandsSeparator.
+ *
+ * Binary frame is dispatched by numeric identifier without parsing of textual UUID and identifier.
+ *
+ * Commands are parsed right in the internal buffer: parsed commands are skipped by moving read offset,
+ * and the buffer is compacted only when all complete commands were processed.
+ * Incomplete command (text without commands separator, or not fully received frame)
+ * is kept in the buffer until the rest of it would be received.
+ *
  *
  * Note: shares almost the same logic as "MessagesParser"
  * (see IncomingMessagesHandler.h for details).
@@ -77,6 +98,46 @@ namespace signals = boost::signals2;
 class CommandsParser {
     friend class CommandsParserTests;
 
+public:
+    /*
+     * Numeric identifiers of commands in binary protocol.
+     * Values are the part of the protocol and must not be changed.
+     */
+    enum BinaryCommandID {
+        InitChannel = 1,
+        SetChannelContractorAddresses = 2,
+        SetChannelContractorCryptoKey = 3,
+        RegenerateChannelCryptoKey = 4,
+        RemoveChannel = 5,
+        InitTrustLine = 6,
+        SetOutgoingTrustLine = 7,
+        CloseIncomingTrustLine = 8,
+        ShareKeys = 9,
+        RemoveTrustLine = 10,
+        ResetTrustLine = 11,
+        CreditUsage = 12,
+        InitiateMaxFlowCalculation = 13,
+        InitiateMaxFlowCalculationFully = 14,
+        TotalBalances = 15,
+        HistoryPayments = 16,
+        HistoryPaymentsAllEquivalents = 17,
+        HistoryAdditionalPayments = 18,
+        HistoryTrustLines = 19,
+        HistoryWithContractor = 20,
+        GetFirstLevelContractors = 21,
+        GetTrustLines = 22,
+        GetTrustLineByAddress = 23,
+        GetTrustLineByID = 24,
+        EquivalentList = 25,
+        ContractorList = 26,
+        GetChannelInfo = 27,
+        GetChannelInfoByAddresses = 28,
+        SubsystemsInfluence = 29,
+        TrustLinesInfluence = 30,
+        PaymentTransactionByCommandUUID = 31,
+        RemoveOutdatedCryptoData = 32,
+    };
+
 public:
     CommandsParser(
         Logger &log);
@@ -85,16 +146,32 @@ public:
         as::streambuf *buffer,
         const size_t receivedBytesCount);
 
+    void appendReadData(
+        const char *data,
+        const size_t receivedBytesCount);
+
     pair<bool, BaseUserCommand::Shared> processReceivedCommands();
 
 private:
+    typedef BaseUserCommand::Shared (*CommandFactory)(
+        const CommandUUID &uuid,
+        const string &buffer);
+
     inline pair<bool, BaseUserCommand::Shared> tryDeserializeCommand();
 
+    inline pair<bool, BaseUserCommand::Shared> tryDeserializeBinaryCommand();
+
     inline pair<bool, BaseUserCommand::Shared> tryParseCommand(
         const CommandUUID &uuid,
         const string &identifier,
         const string &buffer);
 
+    inline pair<bool, BaseUserCommand::Shared> tryBuildCommand(
+        const CommandUUID &uuid,
+        const string &identifier,
+        CommandFactory factory,
+        const string &buffer);
+
     inline pair<bool, BaseUserCommand::Shared> commandError(
         const CommandUUID &uuid,
         const string &identifier,
@@ -102,24 +179,41 @@ private:
 
     void cutBufferUpToNextCommand();
 
+    void cutBuffer(
+        const size_t bytesCount);
+
+    void compactBuffer();
+
+    template <typename CommandType>
+    void registerCommand(
+        const BinaryCommandID binaryID);
+
 public:
     static const size_t kUUIDHexRepresentationSize = 36;
     static const size_t kMinCommandSize = kUUIDHexRepresentationSize + 2;
     static const size_t kAverageCommandIdentifierLength = 15;
 
+    static const char kBinaryFrameMarker = 0;
+    // marker + length
+    static const size_t kBinaryFrameHeaderSize = 1 + sizeof(uint32_t);
+    // command ID + command UUID + commands separator
+    static const size_t kBinaryFrameMinLength = sizeof(uint16_t) + NodeUUID::kBytesSize + 1;
+    static const size_t kBinaryFrameMaxLength = 1024 * 1024;
+    // text command, which is not terminated by separator up to this size, is dropped
+    static const size_t kTextCommandMaxLength = kBinaryFrameMaxLength;
+
 protected:
+    // Capacity of the internal buffer, that is kept between the reads.
+    static const size_t kMaxIdleBufferCapacity = 64 * 1024;
 
-    template <typename CommandType, typename... Args>
-    inline pair<bool, BaseUserCommand::Shared> newCommand(
+    template <typename CommandType>
+    static BaseUserCommand::Shared newCommand(
         const CommandUUID &uuid,
-        const string &buffer) const
+        const string &buffer)
     {
-        return make_pair(
-            true,
-            static_pointer_cast<BaseUserCommand>(
-                make_shared<CommandType>(
-                    uuid,
-                    buffer)));
+        return make_shared<CommandType>(
+            uuid,
+            buffer);
     }
 
     static string logHeader()
@@ -130,7 +224,15 @@ protected:
 
 private:
     string mBuffer;
+    // beginning of the first not processed command in mBuffer
+    size_t mBufferOffset;
+    // body of the command being built (reused to avoid allocations on each command)
+    string mCommandBody;
     Logger &mLog;
+
+    // dispatch tables of the text and binary protocols
+    unordered_map<string, CommandFactory> mFactoriesByIdentifier;
+    vector<pair<string, CommandFactory>> mFactoriesByBinaryID;
 };
 
 
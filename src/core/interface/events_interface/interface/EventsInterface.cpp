@@ -1,12 +1,25 @@
 #include "EventsInterface.h"
 
 EventsInterface::EventsInterface(
+    as::io_service &ioService,
+    TimerService *timerService,
     string fifoName,
-    bool isBlocked,
+    const Parameters &parameters,
     Logger &logger) :
+    mIOService(ioService),
     mFIFOName(fifoName),
-    mIsBlocked(isBlocked),
-    mLogger(logger)
+    mIsBlocked(parameters.mIsBlocked),
+    mMaxBufferedEventsCount(parameters.mMaxBufferedEventsCount),
+    mOverflowPolicy(parameters.mOverflowPolicy),
+    mLogger(logger),
+    mReopenTimer(timerService),
+    mSpilledEventsCount(0),
+    mSpillFileSize(0),
+    mCurrentBatchEventsCount(0),
+    mIsWriteInProgress(false),
+    mDroppedEventsCount(0),
+    mDelayedEventsCount(0),
+    mOverflowDroppedEventsCount(0)
 {
     if (!isFIFOExists()) {
         createFIFO(kPermissionsMask);
@@ -17,8 +30,11 @@ EventsInterface::EventsInterface(
 
 EventsInterface::~EventsInterface()
 {
-    if (mFIFODescriptor != 0) {
-        close(mFIFODescriptor);
+    closeFIFO();
+    if (mSpillWriter.is_open()) {
+        mSpillWriter.close();
+        mSpillReader.close();
+        remove(spillFilePath().c_str());
     }
     if (remove(FIFOFilePath().c_str()) != 0) {
         mLogger.warning("events.fifo didn't delete");
@@ -28,49 +44,356 @@ EventsInterface::~EventsInterface()
 void EventsInterface::writeEvent(
     Event::Shared event)
 {
-    if (mFIFODescriptor == 0){
-#ifdef LINUX
+    if (!mIsBlocked and !tryOpenFIFO()) {
+        // there is no consumer on the other side, and it should not be waited for
+        mDroppedEventsCount++;
+        return;
+    }
+    if (mIsWriteInProgress or mFIFOStreamDescriptor == nullptr) {
+        mDelayedEventsCount++;
+    }
+
+    BufferedEvent bufferedEvent = {
+        event->type(),
+        string(
+            (const char*)event->data().get(),
+            event->dataSize())};
+
+    if (mSpilledEventsCount > 0) {
+        // events must be written in order of their appearance,
+        // so while there are spilled events, all new events are spilled after them
+        spillEvent(
+            bufferedEvent);
+    } else if (mBufferedEvents.size() >= mMaxBufferedEventsCount) {
+        handleOverflow(
+            bufferedEvent);
+    } else {
+        mBufferedEvents.push_back(
+            move(bufferedEvent));
+    }
+
+    writeNextBatch();
+}
+
+size_t EventsInterface::droppedEventsCount() const
+{
+    return mDroppedEventsCount;
+}
+
+size_t EventsInterface::delayedEventsCount() const
+{
+    return mDelayedEventsCount;
+}
+
+EventsInterface::OverflowPolicy EventsInterface::overflowPolicyFromString(
+    const string &overflowPolicy)
+{
+    if (overflowPolicy == "drop_oldest") {
+        return DropOldest;
+    }
+    if (overflowPolicy == "spill_to_disk") {
+        return SpillToDisk;
+    }
+    if (overflowPolicy == "coalesce_topology") {
+        return CoalesceTopology;
+    }
+    throw ValueError("EventsInterface::overflowPolicyFromString: "
+                         "unknown overflow policy " + overflowPolicy);
+}
+
+void EventsInterface::writeNextBatch()
+{
+    if (mIsWriteInProgress or mReopenTimer.isPending()) {
+        // next batch would be written when current write (or reopening) would be finished
+        return;
+    }
+
+    if (!tryOpenFIFO()) {
         if (mIsBlocked) {
-            mFIFODescriptor = open(
-                FIFOFilePath().c_str(),
-                O_WRONLY | O_RSYNC | O_DSYNC | F_SETFL);
+            scheduleReopen();
         } else {
-            mFIFODescriptor = open(
-                FIFOFilePath().c_str(),
-                O_WRONLY | O_RSYNC | O_DSYNC | F_SETFL | O_NONBLOCK);
+            dropBufferedEvents();
         }
-#endif
+        return;
+    }
 
-        if (mFIFODescriptor == -1) {
-            throw IOError("EventsInterface::writeEvent: Can't open FIFO file.");
+    if (!prepareNextBatch()) {
+        finishOverflowReporting();
+        return;
+    }
+
+    mIsWriteInProgress = true;
+    as::async_write(
+        *mFIFOStreamDescriptor,
+        as::buffer(
+            mCurrentBatch.data(),
+            mCurrentBatch.size()),
+        boost::bind(
+            &EventsInterface::handleBatchWritten,
+            this,
+            as::placeholders::error,
+            as::placeholders::bytes_transferred));
+}
+
+/*
+ * Returns false if there is nothing to write.
+ */
+bool EventsInterface::prepareNextBatch()
+{
+    if (!mCurrentBatch.empty()) {
+        // batch was not written because of consumer absence, and would be written again
+        return true;
+    }
+
+    while (!mBufferedEvents.empty()) {
+        if (!mCurrentBatch.empty() and
+                mCurrentBatch.size() + mBufferedEvents.front().mData.size() > kMaxBatchSize) {
+            return true;
         }
+        mCurrentBatch.append(
+            mBufferedEvents.front().mData);
+        mCurrentBatchEventsCount++;
+        mBufferedEvents.pop_front();
     }
-    if (write(mFIFODescriptor, event->data().get(), event->dataSize()) != event->dataSize()) {
-        close(mFIFODescriptor);
 
-#ifdef LINUX
+    string spilledEvent;
+    while (mSpilledEventsCount > 0 and mCurrentBatch.size() < kMaxBatchSize) {
+        // reader could reach end of file before the last spilling
+        mSpillReader.clear();
+        if (!getline(mSpillReader, spilledEvent, kCommandsSeparator)) {
+            warning() << "Can't read spilled events, " << mSpilledEventsCount << " events are dropped";
+            mDroppedEventsCount += mSpilledEventsCount;
+            mSpilledEventsCount = 0;
+            break;
+        }
+        mCurrentBatch.append(
+            spilledEvent);
+        mCurrentBatch.push_back(
+            kCommandsSeparator);
+        mCurrentBatchEventsCount++;
+        mSpilledEventsCount--;
+    }
+    if (mSpilledEventsCount == 0 and mSpillWriter.is_open()) {
+        mSpillWriter.close();
+        mSpillReader.close();
+        remove(spillFilePath().c_str());
+        mSpillFileSize = 0;
+    }
+
+    return !mCurrentBatch.empty();
+}
+
+void EventsInterface::handleBatchWritten(
+    const boost::system::error_code &error,
+    const size_t bytesTransferred)
+{
+    mIsWriteInProgress = false;
+
+    if (error) {
+        if (error == as::error::operation_aborted) {
+            return;
+        }
+        warning() << "Can't write events to the FIFO: " << error.message();
+        closeFIFO();
+
+        // Consumer has gone. Partially written batch is dropped,
+        // so the next consumer would receive only whole events.
+        if (bytesTransferred > 0 or !mIsBlocked) {
+            mDroppedEventsCount += mCurrentBatchEventsCount;
+            mCurrentBatch.clear();
+            mCurrentBatchEventsCount = 0;
+        }
         if (mIsBlocked) {
-            mFIFODescriptor = open(
-                FIFOFilePath().c_str(),
-                O_WRONLY | O_RSYNC | O_DSYNC | F_SETFL);
+            scheduleReopen();
         } else {
-            mFIFODescriptor = open(
-                FIFOFilePath().c_str(),
-                O_WRONLY | O_RSYNC | O_DSYNC | F_SETFL | O_NONBLOCK);
+            dropBufferedEvents();
         }
-#endif
+        return;
+    }
 
-        if (mFIFODescriptor == -1) {
-            throw IOError("EventsInterface::writeEvent: Can't open FIFO file.");
+    mCurrentBatch.clear();
+    mCurrentBatchEventsCount = 0;
+    writeNextBatch();
+}
+
+void EventsInterface::handleOverflow(
+    BufferedEvent &event)
+{
+    switch (mOverflowPolicy) {
+        case SpillToDisk: {
+            spillEvent(
+                event);
+            return;
         }
+        case CoalesceTopology: {
+            auto topologyEventIt = mBufferedEvents.begin();
+            while (topologyEventIt != mBufferedEvents.end() and topologyEventIt->mType != Event::Topology) {
+                topologyEventIt++;
+            }
+            if (topologyEventIt != mBufferedEvents.end()) {
+                mBufferedEvents.erase(
+                    topologyEventIt);
+            } else {
+                mBufferedEvents.pop_front();
+            }
+            break;
+        }
+        default: {
+            mBufferedEvents.pop_front();
+        }
+    }
+    if (mOverflowDroppedEventsCount == 0) {
+        warning() << "Events buffer is overflowed (" << mBufferedEvents.size() << " events), "
+                  << "events are dropped";
+    }
+    mDroppedEventsCount++;
+    mOverflowDroppedEventsCount++;
+    mBufferedEvents.push_back(
+        move(event));
+}
 
-        if (write(mFIFODescriptor, event->data().get(), event->dataSize()) != event->dataSize()) {
-            throw IOError("EventsInterface::writeEvent: Can't write result to the disk.");
+void EventsInterface::spillEvent(
+    const BufferedEvent &event)
+{
+    if (mSpillFileSize + event.mData.size() > kMaxSpillFileSize) {
+        mDroppedEventsCount++;
+        mOverflowDroppedEventsCount++;
+        return;
+    }
+
+    if (!mSpillWriter.is_open()) {
+        mSpillWriter.open(
+            spillFilePath(),
+            ios::binary | ios::trunc);
+        mSpillReader.open(
+            spillFilePath(),
+            ios::binary);
+        if (!mSpillWriter.is_open() or !mSpillReader.is_open()) {
+            warning() << "Can't open spill file " << spillFilePath();
+            mSpillWriter.close();
+            mSpillReader.close();
+            mDroppedEventsCount++;
+            mOverflowDroppedEventsCount++;
+            return;
         }
+        info() << "Events are spilled into " << spillFilePath();
+    }
+
+    mSpillWriter.write(
+        event.mData.data(),
+        event.mData.size());
+    // spilled event must be visible for the reader immediately
+    mSpillWriter.flush();
+    mSpilledEventsCount++;
+    mSpillFileSize += event.mData.size();
+}
+
+void EventsInterface::dropBufferedEvents()
+{
+    mDroppedEventsCount += mBufferedEvents.size() + mSpilledEventsCount + mCurrentBatchEventsCount;
+    mBufferedEvents.clear();
+    mCurrentBatch.clear();
+    mCurrentBatchEventsCount = 0;
+    mSpilledEventsCount = 0;
+    if (mSpillWriter.is_open()) {
+        mSpillWriter.close();
+        mSpillReader.close();
+        remove(spillFilePath().c_str());
+        mSpillFileSize = 0;
+    }
+}
+
+void EventsInterface::finishOverflowReporting()
+{
+    if (mOverflowDroppedEventsCount == 0) {
+        return;
+    }
+    warning() << "Events buffer is drained, " << mOverflowDroppedEventsCount << " events were dropped on overflow. "
+              << "Total dropped: " << mDroppedEventsCount << ", delayed: " << mDelayedEventsCount;
+    mOverflowDroppedEventsCount = 0;
+}
+
+bool EventsInterface::tryOpenFIFO()
+{
+    if (mFIFOStreamDescriptor != nullptr) {
+        return true;
+    }
+
+    // FIFO can't be opened for writing in non-blocking manner until consumer opens it from the other side.
+    mFIFODescriptor = open(
+        FIFOFilePath().c_str(),
+        O_WRONLY | O_NONBLOCK);
+
+    if (mFIFODescriptor == -1) {
+        mFIFODescriptor = 0;
+        return false;
+    }
+
+    try {
+        mFIFOStreamDescriptor = make_unique<as::posix::stream_descriptor>(
+            mIOService,
+            mFIFODescriptor);
+        mFIFOStreamDescriptor->non_blocking(true);
+
+    } catch (std::bad_alloc &) {
+        throw MemoryError("EventsInterface::tryOpenFIFO: "
+                              "Can not allocate enough memory for fifo stream descriptor.");
+    }
+    return true;
+}
+
+void EventsInterface::closeFIFO()
+{
+    if (mFIFOStreamDescriptor != nullptr) {
+        boost::system::error_code error;
+        mFIFOStreamDescriptor->close(error);
+        mFIFOStreamDescriptor = nullptr;
+
+    } else if (mFIFODescriptor != 0) {
+        close(mFIFODescriptor);
     }
+    mFIFODescriptor = 0;
+}
+
+void EventsInterface::scheduleReopen()
+{
+    if (mReopenTimer.isPending()) {
+        return;
+    }
+    mReopenTimer.expiresFromNow(
+        std::chrono::milliseconds(
+            kReopenTimeoutMilliseconds),
+        [this]() {
+            handleReopenTimeout();
+        });
+}
+
+void EventsInterface::handleReopenTimeout()
+{
+    writeNextBatch();
+}
+
+const string EventsInterface::spillFilePath() const
+{
+    return FIFOFilePath() + ".spill";
 }
 
 const char *EventsInterface::FIFOName() const
 {
     return mFIFOName.c_str();
 }
+
+string EventsInterface::logHeader() const
+{
+    return "[EventsInterface " + mFIFOName + "]";
+}
+
+LoggerStream EventsInterface::info() const
+{
+    return mLogger.info(logHeader());
+}
+
+LoggerStream EventsInterface::warning() const
+{
+    return mLogger.warning(logHeader());
+}
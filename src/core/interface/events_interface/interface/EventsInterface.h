@@ -4,13 +4,51 @@
 #include "../../BaseFIFOInterface.h"
 #include "../events/Event.h"
 #include "../../../logger/Logger.h"
+#include "../../../common/exceptions/MemoryError.h"
+#include "../../../common/exceptions/ValueError.h"
+#include "../../../common/time/TimerService.h"
 
+#include <boost/bind.hpp>
+
+#include <deque>
+#include <fstream>
+#include <string>
+
+/**
+ * Events are buffered in memory and written into the events FIFO asynchronously.
+ * FIFO is opened and written in non-blocking manner, and each next write is driven by io_service,
+ * so slow (or absent) consumer on the other side never blocks the node.
+ * All events, buffered at the moment of writing, are sent by one write (up to kMaxBatchSize bytes).
+ *
+ * Buffer is bounded by mMaxBufferedEventsCount, overflow is handled according to mOverflowPolicy.
+ * In blocked mode events are buffered while there is no consumer on the other side,
+ * otherwise they are dropped until consumer opens FIFO.
+ */
 class EventsInterface : public BaseFIFOInterface {
 
+public:
+    enum OverflowPolicy {
+        // oldest buffered event is dropped
+        DropOldest = 0,
+        // events are spilled into the file near the FIFO and are written into the FIFO after buffered ones
+        SpillToDisk = 1,
+        // oldest buffered topology event is dropped (topology is sent periodically,
+        // so it is superseded by the next snapshot), if there are no such events - oldest event is dropped
+        CoalesceTopology = 2,
+    };
+
+    struct Parameters {
+        bool mIsBlocked;
+        size_t mMaxBufferedEventsCount;
+        OverflowPolicy mOverflowPolicy;
+    };
+
 public:
     explicit EventsInterface(
+        as::io_service &ioService,
+        TimerService *timerService,
         string fifoName,
-        bool isBlocked,
+        const Parameters &parameters,
         Logger &logger);
 
     ~EventsInterface();
@@ -18,16 +56,99 @@ public:
     void writeEvent(
         Event::Shared event);
 
-private:
+    // count of events, which were lost due to buffer overflow or absence of consumer
+    size_t droppedEventsCount() const;
+
+    // count of events, which were not written immediately, because consumer was not ready for them
+    size_t delayedEventsCount() const;
+
+    static OverflowPolicy overflowPolicyFromString(
+        const string &overflowPolicy);
+
+protected:
+    struct BufferedEvent {
+        SerializedEventType mType;
+        string mData;
+    };
+
+protected:
+    void writeNextBatch();
+
+    bool prepareNextBatch();
+
+    void handleBatchWritten(
+        const boost::system::error_code &error,
+        const size_t bytesTransferred);
+
+    void handleOverflow(
+        BufferedEvent &event);
+
+    void spillEvent(
+        const BufferedEvent &event);
+
+    void dropBufferedEvents();
+
+    void finishOverflowReporting();
+
+    bool tryOpenFIFO();
+
+    void closeFIFO();
+
+    void scheduleReopen();
+
+    void handleReopenTimeout();
+
+    const string spillFilePath() const;
+
     virtual const char* FIFOName() const;
 
+    string logHeader() const;
+
+    LoggerStream info() const;
+
+    LoggerStream warning() const;
+
 public:
     static const constexpr unsigned int kPermissionsMask = 0755;
 
+    static const constexpr size_t kDefaultMaxBufferedEventsCount = 4096;
+
+protected:
+    // timeout between attempts to open FIFO, when there is no consumer on the other side
+    static const constexpr uint32_t kReopenTimeoutMilliseconds = 1000;
+
+    static const constexpr size_t kMaxBatchSize = 64 * 1024;
+
+    static const constexpr size_t kMaxSpillFileSize = 64 * 1024 * 1024;
+
 private:
+    as::io_service &mIOService;
     string mFIFOName;
     bool mIsBlocked;
+    size_t mMaxBufferedEventsCount;
+    OverflowPolicy mOverflowPolicy;
     Logger &mLogger;
+
+    unique_ptr<as::posix::stream_descriptor> mFIFOStreamDescriptor;
+    TimerService::Timer mReopenTimer;
+
+    deque<BufferedEvent> mBufferedEvents;
+
+    // events, spilled on disk, are read by mSpillReader in the same order, in which they were written
+    ofstream mSpillWriter;
+    ifstream mSpillReader;
+    size_t mSpilledEventsCount;
+    size_t mSpillFileSize;
+
+    // batch, which is being written now, and its events count
+    string mCurrentBatch;
+    size_t mCurrentBatchEventsCount;
+    bool mIsWriteInProgress;
+
+    size_t mDroppedEventsCount;
+    size_t mDelayedEventsCount;
+    // count of events, dropped since buffer overflow was reported
+    size_t mOverflowDroppedEventsCount;
 };
 
 
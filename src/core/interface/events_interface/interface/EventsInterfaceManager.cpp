@@ -1,17 +1,23 @@
 #include "EventsInterfaceManager.h"
 
 EventsInterfaceManager::EventsInterfaceManager(
+    as::io_service &ioService,
+    TimerService *timerService,
     vector<pair<string, SerializedEventType>> filesToEvents,
-    vector<pair<string, bool>> filesToBlock,
+    vector<pair<string, EventsInterface::Parameters>> filesToParameters,
     Logger &logger):
     mLogger(logger)
 {
-    for (const auto &fifoFile : filesToBlock) {
+    for (const auto &fifoFile : filesToParameters) {
         auto fifoFineName = fifoFile.first.c_str();
         auto eventsInterface = make_shared<EventsInterface>(
+            ioService,
+            timerService,
             fifoFineName,
             fifoFile.second,
             logger);
+        mFIFOInterfaces.push_back(
+            eventsInterface);
         for (const auto &fifoAndEvent : filesToEvents) {
             if (fifoAndEvent.first == fifoFile.first) {
                 mEventsInterfaces.insert(
@@ -30,4 +36,22 @@ void EventsInterfaceManager::writeEvent(
     for (auto it = eventTypeAndInterface.first; it != eventTypeAndInterface.second; it++) {
         it->second->writeEvent(event);
     }
+}
+
+size_t EventsInterfaceManager::droppedEventsCount() const
+{
+    size_t result = 0;
+    for (const auto &eventsInterface : mFIFOInterfaces) {
+        result += eventsInterface->droppedEventsCount();
+    }
+    return result;
+}
+
+size_t EventsInterfaceManager::delayedEventsCount() const
+{
+    size_t result = 0;
+    for (const auto &eventsInterface : mFIFOInterfaces) {
+        result += eventsInterface->delayedEventsCount();
+    }
+    return result;
 }
\ No newline at end of file
@@ -7,15 +7,23 @@ class EventsInterfaceManager {
 
 public:
     EventsInterfaceManager(
+        as::io_service &ioService,
+        TimerService *timerService,
         vector<pair<string, SerializedEventType>> filesToEvents,
-        vector<pair<string, bool>> filesToBlock,
+        vector<pair<string, EventsInterface::Parameters>> filesToParameters,
         Logger &logger);
 
     void writeEvent(
         Event::Shared event);
 
+    // total counts of dropped and delayed events of all events FIFOs
+    size_t droppedEventsCount() const;
+
+    size_t delayedEventsCount() const;
+
 private:
     multimap<SerializedEventType, shared_ptr<EventsInterface>> mEventsInterfaces;
+    vector<shared_ptr<EventsInterface>> mFIFOInterfaces;
     Logger &mLogger;
 };
 
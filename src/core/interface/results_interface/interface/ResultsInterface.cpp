@@ -1,9 +1,20 @@
 #include "ResultsInterface.h"
 
 ResultsInterface::ResultsInterface(
+    as::io_service &ioService,
     Logger &logger) :
 
-    mLog(logger) {
+    mIOService(ioService),
+    mLog(logger),
+    mResultsRouter(nullptr),
+    mReopenTimer(ioService),
+    mIsReopenScheduled(false),
+    mDroppedResultsCount(0),
+    mCurrentResult(nullptr),
+    mIsCurrentResultSerialized(false),
+    mCurrentResultWrittenBytes(0),
+    mCurrentChunkOffset(0),
+    mIsWriteInProgress(false) {
 
     if (!isFIFOExists()) {
         createFIFO(kPermissionsMask);
@@ -13,64 +24,198 @@ ResultsInterface::ResultsInterface(
 }
 
 ResultsInterface::~ResultsInterface() {
+    mReopenTimer.cancel();
+    closeFIFO();
+}
 
-    if (mFIFODescriptor != 0) {
-        close(mFIFODescriptor);
+void ResultsInterface::writeResult(
+    CommandResult::SharedConst result) {
+
+    if (mResultsRouter != nullptr and mResultsRouter(result)) {
+        return;
     }
+    // while nobody reads the FIFO results are accumulated only up to the limit
+    if (mResultsQueue.size() >= kMaxQueuedResultsCount) {
+        mDroppedResultsCount++;
+        warning() << "Results queue is full, result of command " << result->identifier()
+                  << " " << result->commandUUID() << " was dropped. "
+                  << "Dropped results count: " << mDroppedResultsCount;
+        return;
+    }
+    mResultsQueue.push_back(result);
+    writeNextChunk();
 }
 
-void ResultsInterface::writeResult(
-    const char *bytes,
-    const size_t bytesCount) {
-
-    if (mFIFODescriptor == 0){
-        #ifdef MAC_OS
-        mFIFODescriptor = open(
-            FIFOFilePath().c_str(),
-            O_WRONLY | O_DSYNC);
-        #endif
-        #ifdef LINUX
-        mFIFODescriptor = open(
-            FIFOFilePath().c_str(),
-            O_WRONLY | O_RSYNC | O_DSYNC);
-        #endif
-
-        if (mFIFODescriptor == -1) {
-            throw IOError(
-                "ResultsInterface::ResultsInterface: "
-                    "Can't open FIFO file.");
+void ResultsInterface::setResultsRouter(
+    ResultsRouter resultsRouter) {
+
+    mResultsRouter = resultsRouter;
+}
+
+void ResultsInterface::writeNextChunk() {
+    if (mIsWriteInProgress or mIsReopenScheduled) {
+        // next chunk would be written when current write (or reopening) would be finished
+        return;
+    }
+
+    if (!prepareNextChunk()) {
+        return;
+    }
+
+    if (!tryOpenFIFO()) {
+        scheduleReopen();
+        return;
+    }
+
+    mIsWriteInProgress = true;
+    mFIFOStreamDescriptor->async_write_some(
+        as::buffer(
+            mCurrentChunk.data() + mCurrentChunkOffset,
+            mCurrentChunk.size() - mCurrentChunkOffset),
+        boost::bind(
+            &ResultsInterface::handleChunkWritten,
+            this,
+            as::placeholders::error,
+            as::placeholders::bytes_transferred));
+}
+
+/*
+ * Returns false if there is nothing to write.
+ */
+bool ResultsInterface::prepareNextChunk() {
+    while (mCurrentChunkOffset == mCurrentChunk.size()) {
+        mCurrentChunk.clear();
+        mCurrentChunkOffset = 0;
+
+        if (mCurrentResult != nullptr and mIsCurrentResultSerialized) {
+            mCurrentStream = nullptr;
+            mCurrentResult = nullptr;
+        }
+
+        if (mCurrentResult == nullptr) {
+            if (mResultsQueue.empty()) {
+                return false;
+            }
+            mCurrentResult = mResultsQueue.front();
+            mResultsQueue.pop_front();
+            mCurrentStream = make_unique<CommandResult::ChunksStream>(
+                *mCurrentResult);
+            mIsCurrentResultSerialized = false;
+            mCurrentResultWrittenBytes = 0;
         }
+
+        mIsCurrentResultSerialized = !mCurrentStream->serializeNextChunk(
+            mCurrentChunk);
+    }
+    return true;
+}
+
+bool ResultsInterface::tryOpenFIFO() {
+    if (mFIFOStreamDescriptor != nullptr) {
+        return true;
     }
-    if (write(mFIFODescriptor, bytes, bytesCount) != bytesCount) {
+
+    // FIFO can't be opened for writing in non-blocking manner until reader opens it from the other side.
+    mFIFODescriptor = open(
+        FIFOFilePath().c_str(),
+        O_WRONLY | O_NONBLOCK);
+
+    if (mFIFODescriptor == -1) {
+        mFIFODescriptor = 0;
+        return false;
+    }
+
+    try {
+        mFIFOStreamDescriptor = make_unique<as::posix::stream_descriptor>(
+            mIOService,
+            mFIFODescriptor);
+        mFIFOStreamDescriptor->non_blocking(true);
+
+    } catch (std::bad_alloc &) {
+        throw MemoryError("ResultsInterface::tryOpenFIFO: "
+                              "Can not allocate enough memory for fifo stream descriptor.");
+    }
+    return true;
+}
+
+void ResultsInterface::closeFIFO() {
+    if (mFIFOStreamDescriptor != nullptr) {
+        boost::system::error_code error;
+        mFIFOStreamDescriptor->close(error);
+        mFIFOStreamDescriptor = nullptr;
+
+    } else if (mFIFODescriptor != 0) {
         close(mFIFODescriptor);
+    }
+    mFIFODescriptor = 0;
+}
+
+void ResultsInterface::handleChunkWritten(
+    const boost::system::error_code &error,
+    const size_t bytesTransferred) {
 
-#ifdef MAC_OS
-        mFIFODescriptor = open(
-            FIFOFilePath().c_str(),
-            O_WRONLY | O_DSYNC);
-#endif
-
-#ifdef LINUX
-        mFIFODescriptor = open(
-            FIFOFilePath().c_str(),
-            O_WRONLY | O_RSYNC | O_DSYNC);
-#endif
-
-        if (mFIFODescriptor == -1) {
-            throw IOError(
-                "ResultsInterface::ResultsInterface: "
-                    "Can't open FIFO file.");
+    mIsWriteInProgress = false;
+
+    if (error) {
+        if (error == as::error::operation_aborted) {
+            return;
         }
+        warning() << "Can't write result to the FIFO: " << error.message();
+        closeFIFO();
 
-        if (write(mFIFODescriptor, bytes, bytesCount) != bytesCount) {
-            throw IOError(
-                "ResultsInterface::writeResult: "
-                    "Can't write result to the disk.");
+        // Reader has gone. Rest of the partially written result is dropped,
+        // so the next reader would receive only whole results.
+        if (mCurrentResultWrittenBytes > 0) {
+            warning() << "Result of command " << mCurrentResult->identifier() << " was dropped";
+            mCurrentStream = nullptr;
+            mCurrentResult = nullptr;
+            mCurrentChunk.clear();
+            mCurrentChunkOffset = 0;
         }
+        scheduleReopen();
+        return;
+    }
+
+    mCurrentChunkOffset += bytesTransferred;
+    mCurrentResultWrittenBytes += bytesTransferred;
+    writeNextChunk();
+}
+
+void ResultsInterface::scheduleReopen() {
+    if (mIsReopenScheduled) {
+        return;
+    }
+    mIsReopenScheduled = true;
+    mReopenTimer.expires_from_now(
+        std::chrono::milliseconds(
+            kReopenTimeoutMilliseconds));
+    mReopenTimer.async_wait(
+        boost::bind(
+            &ResultsInterface::handleReopenTimeout,
+            this,
+            as::placeholders::error));
+}
+
+void ResultsInterface::handleReopenTimeout(
+    const boost::system::error_code &error) {
+
+    if (error) {
+        return;
     }
+    mIsReopenScheduled = false;
+    writeNextChunk();
 }
 
 const char *ResultsInterface::FIFOName() const {
     return kFIFOName;
 }
 
+string ResultsInterface::logHeader()
+    noexcept {
+    return "[ResultsInterface]";
+}
+
+LoggerStream ResultsInterface::warning() const
+    noexcept {
+    return mLog.warning(logHeader());
+}
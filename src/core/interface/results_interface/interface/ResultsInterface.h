@@ -2,35 +2,108 @@
 #define GEO_NETWORK_CLIENT_RESULTSINTERFACE_H
 
 #include "../../BaseFIFOInterface.h"
+#include "../result/CommandResult.h"
 #include "../../../logger/Logger.h"
 #include "../../../common/exceptions/IOError.h"
 #include "../../../common/exceptions/MemoryError.h"
 
+#include <boost/bind.hpp>
+
 #include <string>
+#include <deque>
 
 using namespace std;
 
+/**
+ * Results are written into the results FIFO asynchronously, in order of their readiness.
+ * FIFO is opened and written in non-blocking manner, and each next write is driven by io_service,
+ * so slow (or absent) reader on the other side doesn't block the node.
+ *
+ * Streamed results (see CommandResult::ChunksGenerator) are serialized chunk by chunk,
+ * next chunk is serialized only when the previous one was written,
+ * so huge results are never materialized in memory as a whole.
+ *
+ * While there is no reader, not more than kMaxQueuedResultsCount results are kept,
+ * newer ones are dropped (and counted) until the reader appears.
+ */
 class ResultsInterface: public BaseFIFOInterface {
 
+public:
+    /*
+     * Returns true if result was delivered to the client by other means, than the results FIFO
+     * (for example, results of commands, received through SocketInterface).
+     */
+    typedef function<bool(CommandResult::SharedConst)> ResultsRouter;
+
 public:
     explicit ResultsInterface(
+        as::io_service &ioService,
         Logger &logger);
 
     ~ResultsInterface();
 
     void writeResult(
-        const char *bytes,
-        const size_t bytesCount);
+        CommandResult::SharedConst result);
+
+    void setResultsRouter(
+        ResultsRouter resultsRouter);
+
+protected:
+    void writeNextChunk();
+
+    bool prepareNextChunk();
+
+    bool tryOpenFIFO();
+
+    void closeFIFO();
+
+    void handleChunkWritten(
+        const boost::system::error_code &error,
+        const size_t bytesTransferred);
+
+    void scheduleReopen();
+
+    void handleReopenTimeout(
+        const boost::system::error_code &error);
 
-private:
     virtual const char* FIFOName() const;
 
+    static string logHeader()
+    noexcept;
+
+    LoggerStream warning() const
+    noexcept;
+
 public:
     static const constexpr char *kFIFOName = "results.fifo";
     static const constexpr unsigned int kPermissionsMask = 0755;
 
+protected:
+    // timeout between attempts to open FIFO, when there is no reader on the other side
+    static const constexpr uint32_t kReopenTimeoutMilliseconds = 1000;
+
+    static const constexpr size_t kMaxQueuedResultsCount = 1024;
+
 private:
+    as::io_service &mIOService;
     Logger &mLog;
+    ResultsRouter mResultsRouter;
+
+    unique_ptr<as::posix::stream_descriptor> mFIFOStreamDescriptor;
+    as::steady_timer mReopenTimer;
+    bool mIsReopenScheduled;
+
+    deque<CommandResult::SharedConst> mResultsQueue;
+    size_t mDroppedResultsCount;
+
+    // result, which is being written now, and its chunk
+    CommandResult::SharedConst mCurrentResult;
+    unique_ptr<CommandResult::ChunksStream> mCurrentStream;
+    bool mIsCurrentResultSerialized;
+    size_t mCurrentResultWrittenBytes;
+    string mCurrentChunk;
+    size_t mCurrentChunkOffset;
+    bool mIsWriteInProgress;
 };
 
 #endif //GEO_NETWORK_CLIENT_RESULTSINTERFACE_H
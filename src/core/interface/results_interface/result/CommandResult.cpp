@@ -7,7 +7,8 @@ CommandResult::CommandResult(
 
     mCommandUUID(commandUUID),
     mTimestampCompleted(utc_now()),
-    mCommandIdentifier(commandIdentifier)
+    mCommandIdentifier(commandIdentifier),
+    mChunksGeneratorFactory(nullptr)
 {
     mResultCode = resultCode;
 }
@@ -21,7 +22,22 @@ CommandResult::CommandResult(
     mCommandUUID(commandUUID),
     mTimestampCompleted(utc_now()),
     mResultInformation(resultInformation),
-    mCommandIdentifier(commandIdentifier)
+    mCommandIdentifier(commandIdentifier),
+    mChunksGeneratorFactory(nullptr)
+{
+    mResultCode = resultCode;
+}
+
+CommandResult::CommandResult(
+    const string &commandIdentifier,
+    const CommandUUID &commandUUID,
+    const uint16_t resultCode,
+    ChunksGeneratorFactory chunksGeneratorFactory) :
+
+    mCommandUUID(commandUUID),
+    mTimestampCompleted(utc_now()),
+    mCommandIdentifier(commandIdentifier),
+    mChunksGeneratorFactory(chunksGeneratorFactory)
 {
     mResultCode = resultCode;
 }
@@ -43,6 +59,13 @@ const DateTime &CommandResult::timestampCompleted() const
 
 const string CommandResult::serialize() const
 {
+    if (isStreamed()) {
+        // whole result is materialized, so it should be used only for small results
+        string result;
+        ChunksStream stream(*this);
+        while (stream.serializeNextChunk(result)) {}
+        return result;
+    }
     if (!mResultInformation.empty()) {
         return mCommandUUID.stringUUID() + kTokensSeparator +
                to_string(mResultCode) + kTokensSeparator +
@@ -61,4 +84,42 @@ const string CommandResult::serializeShort() const
 const string CommandResult::identifier() const
 {
     return mCommandIdentifier;
-}
\ No newline at end of file
+}
+
+const bool CommandResult::isStreamed() const
+{
+    return mChunksGeneratorFactory != nullptr;
+}
+
+CommandResult::ChunksStream::ChunksStream(
+    const CommandResult &result) :
+
+    mResult(result),
+    mChunksGenerator(result.isStreamed() ? result.mChunksGeneratorFactory() : nullptr),
+    mIsHeaderSerialized(false),
+    mIsFinished(false)
+{}
+
+bool CommandResult::ChunksStream::serializeNextChunk(
+    string &chunk)
+{
+    if (mIsFinished) {
+        return false;
+    }
+    if (mChunksGenerator == nullptr) {
+        chunk += mResult.serialize();
+        mIsFinished = true;
+        return false;
+    }
+    if (!mIsHeaderSerialized) {
+        chunk += mResult.mCommandUUID.stringUUID() + kTokensSeparator +
+                 to_string(mResult.mResultCode) + kTokensSeparator;
+        mIsHeaderSerialized = true;
+    }
+    if (mChunksGenerator(chunk)) {
+        return true;
+    }
+    chunk += kCommandsSeparator;
+    mIsFinished = true;
+    return false;
+}
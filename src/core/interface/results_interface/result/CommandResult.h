@@ -8,6 +8,9 @@
 
 #include <string>
 #include <memory>
+#include <functional>
+#include <sstream>
+#include <vector>
 
 using namespace std;
 
@@ -16,6 +19,45 @@ public:
     typedef shared_ptr<CommandResult> Shared;
     typedef shared_ptr<const CommandResult> SharedConst;
 
+    /*
+     * Used by results with a huge count of records (trust lines, contractors, history).
+     * Appends next portion of serialized records to the chunk and returns false,
+     * when there is nothing more to serialize.
+     */
+    typedef function<bool(string &chunk)> ChunksGenerator;
+
+    /*
+     * Creates generator, which serializes records from the beginning.
+     * Records must be snapshotted when the result is created,
+     * so every generator of the result produces the same output.
+     */
+    typedef function<ChunksGenerator()> ChunksGeneratorFactory;
+
+    /*
+     * State of serialization of one result by one writer.
+     * Result itself is not changed by serialization, so it can be written several times
+     * (e.g. retried, or written to the log and to the client).
+     * Serialized result must outlive the stream.
+     */
+    class ChunksStream {
+    public:
+        explicit ChunksStream(
+            const CommandResult &result);
+
+        /*
+         * Appends next part of serialized result to the chunk.
+         * Returns false when the result is fully serialized (command separator is already appended).
+         */
+        bool serializeNextChunk(
+            string &chunk);
+
+    private:
+        const CommandResult &mResult;
+        ChunksGenerator mChunksGenerator;
+        bool mIsHeaderSerialized;
+        bool mIsFinished;
+    };
+
 public:
     enum CommandResultCode {
         OK = 200,
@@ -35,6 +77,13 @@ public:
         const uint16_t resultCode,
         const string &resultInformation);
 
+    // Result information would be serialized lazily by chunks, while it is written to the results FIFO
+    CommandResult(
+        const string &commandIdentifier,
+        const CommandUUID &commandUUID,
+        const uint16_t resultCode,
+        ChunksGeneratorFactory chunksGeneratorFactory);
+
     const CommandUUID &commandUUID() const;
 
     const uint16_t resultCode() const;
@@ -45,15 +94,70 @@ public:
 
     const string serializeShort() const;
 
+    const bool isStreamed() const;
+
     const string identifier() const;
 
+    /*
+     * Streams "<records count>\t<record>\t<record>...[\t<tail>]",
+     * each chunk contains about kStreamChunkSize bytes of records.
+     * Records are owned by the result, so they should be copies of the shared state.
+     */
+    template <typename Record>
+    static ChunksGeneratorFactory recordsChunks(
+        vector<Record> records,
+        function<void(stringstream&, const Record&)> recordSerializer,
+        const string &tail = string());
+
 private:
     CommandUUID mCommandUUID;
     uint16_t mResultCode;
     DateTime mTimestampCompleted;
     string mResultInformation;
     string mCommandIdentifier;
+
+    ChunksGeneratorFactory mChunksGeneratorFactory;
+
+public:
+    // approximate size of one chunk of streamed result
+    static const size_t kStreamChunkSize = 64 * 1024;
 };
 
+template <typename Record>
+CommandResult::ChunksGeneratorFactory CommandResult::recordsChunks(
+    vector<Record> records,
+    function<void(stringstream&, const Record&)> recordSerializer,
+    const string &tail)
+{
+    auto sharedRecords = make_shared<const vector<Record>>(
+        move(records));
+    return [sharedRecords, recordSerializer, tail] () -> ChunksGenerator {
+        size_t nextRecordIdx = 0;
+        bool isCountSerialized = false;
+        return [sharedRecords, recordSerializer, tail, nextRecordIdx, isCountSerialized] (string &chunk) mutable -> bool {
+            stringstream ss;
+            if (!isCountSerialized) {
+                ss << sharedRecords->size();
+                isCountSerialized = true;
+            }
+            while (nextRecordIdx < sharedRecords->size()
+                   and (size_t)ss.tellp() < kStreamChunkSize) {
+                ss << kTokensSeparator;
+                recordSerializer(ss, sharedRecords->at(nextRecordIdx));
+                nextRecordIdx++;
+            }
+            if (nextRecordIdx < sharedRecords->size()) {
+                chunk += ss.str();
+                return true;
+            }
+            if (!tail.empty()) {
+                ss << kTokensSeparator << tail;
+            }
+            chunk += ss.str();
+            return false;
+        };
+    };
+}
+
 
 #endif //GEO_NETWORK_CLIENT_BASECOMMANDRESULT_H
@@ -0,0 +1,239 @@
+#include "SocketInterface.h"
+
+SocketInterface::SocketInterface(
+    as::io_service &ioService,
+    const string &unixSocketPath,
+    const string &tcpHost,
+    const uint16_t tcpPort,
+    Logger &logger) :
+
+    mIOService(ioService),
+    mLog(logger),
+    mUnixSocketPath(unixSocketPath),
+    mUnixSocket(ioService),
+    mTCPSocket(ioService)
+{
+    if (!mUnixSocketPath.empty()) {
+        // Socket file may remain after previous run of the node.
+        ::unlink(mUnixSocketPath.c_str());
+        mUnixAcceptor = make_unique<as::local::stream_protocol::acceptor>(
+            mIOService,
+            as::local::stream_protocol::endpoint(mUnixSocketPath));
+    }
+
+    if (tcpPort != 0) {
+        const auto address = as::ip::address::from_string(tcpHost);
+        if (!address.is_loopback()) {
+            throw ValueError(
+                "SocketInterface::SocketInterface: "
+                    "TCP control interface may be bound only to the loopback address.");
+        }
+        mTCPAcceptor = make_unique<as::ip::tcp::acceptor>(
+            mIOService,
+            as::ip::tcp::endpoint(
+                address,
+                tcpPort));
+    }
+}
+
+SocketInterface::~SocketInterface()
+{
+    boost::system::error_code error;
+    if (mUnixAcceptor != nullptr) {
+        mUnixAcceptor->close(error);
+        ::unlink(mUnixSocketPath.c_str());
+    }
+    if (mTCPAcceptor != nullptr) {
+        mTCPAcceptor->close(error);
+    }
+    for (const auto &sessionAndCommands : mSessions) {
+        sessionAndCommands.first->closedSignal.disconnect_all_slots();
+        sessionAndCommands.first->close();
+    }
+}
+
+void SocketInterface::beginAcceptConnections()
+{
+    if (mUnixAcceptor != nullptr) {
+        asyncAcceptUnixConnection();
+    }
+    if (mTCPAcceptor != nullptr) {
+        asyncAcceptTCPConnection();
+    }
+}
+
+void SocketInterface::asyncAcceptUnixConnection()
+{
+    mUnixAcceptor->async_accept(
+        mUnixSocket,
+        boost::bind(
+            &SocketInterface::handleUnixConnectionAccepted,
+            this,
+            as::placeholders::error));
+}
+
+void SocketInterface::asyncAcceptTCPConnection()
+{
+    mTCPAcceptor->async_accept(
+        mTCPSocket,
+        boost::bind(
+            &SocketInterface::handleTCPConnectionAccepted,
+            this,
+            as::placeholders::error));
+}
+
+void SocketInterface::handleUnixConnectionAccepted(
+    const boost::system::error_code &error)
+{
+    if (error == as::error::operation_aborted) {
+        return;
+    }
+    if (error) {
+        warning() << "Can't accept unix socket connection: " << error.message();
+    } else {
+        beginSession(
+            SocketSession::Socket(
+                std::move(mUnixSocket)));
+    }
+    asyncAcceptUnixConnection();
+}
+
+void SocketInterface::handleTCPConnectionAccepted(
+    const boost::system::error_code &error)
+{
+    if (error == as::error::operation_aborted) {
+        return;
+    }
+    if (error) {
+        warning() << "Can't accept TCP connection: " << error.message();
+    } else {
+        beginSession(
+            SocketSession::Socket(
+                std::move(mTCPSocket)));
+    }
+    asyncAcceptTCPConnection();
+}
+
+void SocketInterface::beginSession(
+    SocketSession::Socket &&socket)
+{
+    if (mSessions.size() >= kMaxSessionsCount) {
+        warning() << "Connection was rejected: sessions count limit is reached";
+        boost::system::error_code error;
+        socket.close(error);
+        return;
+    }
+
+    auto session = make_shared<SocketSession>(
+        std::move(socket),
+        mLog);
+    session->commandReceivedSignal.connect(
+        boost::bind(
+            &SocketInterface::onSessionCommandReceived,
+            this,
+            _1,
+            _2,
+            _3));
+    session->closedSignal.connect(
+        boost::bind(
+            &SocketInterface::onSessionClosed,
+            this,
+            _1));
+    mSessions[session];
+    info() << "Connection accepted. Sessions count: " << mSessions.size();
+
+    session->beginReceiveCommands();
+}
+
+void SocketInterface::onSessionCommandReceived(
+    SocketSession::Shared session,
+    bool success,
+    BaseUserCommand::Shared command)
+{
+    auto sessionIt = mSessions.find(session);
+    if (sessionIt == mSessions.end()) {
+        // session was already closed, there is nobody to receive the result
+        return;
+    }
+
+    // Results of the commands without UUID can't be routed, so they are written into results FIFO.
+    if (command->UUID() != CommandUUID::empty()) {
+        auto &sessionCommands = sessionIt->second;
+        if (mSessionsByCommandUUID.count(command->UUID()) != 0) {
+            warning() << "Command " << command->UUID() << " was rejected: "
+                      << "result of the command with the same UUID was not written yet";
+            session->writeResult(
+                command->responseProtocolError());
+            return;
+        }
+        if (sessionCommands.size() >= kMaxPendingCommandsCount) {
+            warning() << "Command " << command->UUID() << " was rejected: "
+                      << "session has too many commands without results";
+            session->writeResult(
+                command->responseProtocolError());
+            return;
+        }
+        sessionCommands.insert(command->UUID());
+        mSessionsByCommandUUID[command->UUID()] = session;
+    }
+    commandReceivedSignal(
+        success,
+        command);
+}
+
+void SocketInterface::onSessionClosed(
+    SocketSession::Shared session)
+{
+    auto sessionIt = mSessions.find(session);
+    if (sessionIt == mSessions.end()) {
+        return;
+    }
+
+    // Commands, which results were not written yet (or which have no results at all),
+    // should not keep references to the closed session.
+    for (const auto &commandUUID : sessionIt->second) {
+        mSessionsByCommandUUID.erase(commandUUID);
+    }
+    mSessions.erase(sessionIt);
+    info() << "Connection closed. Sessions count: " << mSessions.size();
+}
+
+bool SocketInterface::writeResult(
+    CommandResult::SharedConst result)
+{
+    auto sessionIt = mSessionsByCommandUUID.find(result->commandUUID());
+    if (sessionIt == mSessionsByCommandUUID.end()) {
+        return false;
+    }
+
+    auto session = sessionIt->second.lock();
+    mSessionsByCommandUUID.erase(sessionIt);
+    if (session == nullptr) {
+        // Client has gone, there is nobody to receive the result.
+        return true;
+    }
+    auto sessionCommandsIt = mSessions.find(session);
+    if (sessionCommandsIt != mSessions.end()) {
+        sessionCommandsIt->second.erase(result->commandUUID());
+    }
+    session->writeResult(result);
+    return true;
+}
+
+string SocketInterface::logHeader()
+    noexcept
+{
+    return "[SocketInterface]";
+}
+
+LoggerStream SocketInterface::info() const
+    noexcept
+{
+    return mLog.info(logHeader());
+}
+
+LoggerStream SocketInterface::warning() const
+    noexcept
+{
+    return mLog.warning(logHeader());
+}
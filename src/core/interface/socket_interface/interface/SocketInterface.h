@@ -0,0 +1,105 @@
+#ifndef GEO_NETWORK_CLIENT_SOCKETINTERFACE_H
+#define GEO_NETWORK_CLIENT_SOCKETINTERFACE_H
+
+#include "SocketSession.h"
+
+#include "../../../common/exceptions/ValueError.h"
+
+#include <map>
+#include <set>
+
+/**
+ * Control interface for clients, that need several concurrent connections to the node
+ * (for example, gateway side services). Accepts connections on unix domain socket
+ * and, optionally, on TCP socket bound to the loopback address.
+ *
+ * Each connection is processed by separate SocketSession: commands are parsed by the same
+ * CommandsParser as commands from the FIFO, and are processed in the same way.
+ * Results are routed back to the connection, from which the command was received,
+ * by the command UUID. Results of commands, received from the FIFO, are not affected.
+ * Command with UUID of another command, which result was not written yet, is rejected,
+ * as well as commands of the connection, which has too many commands without results.
+ */
+class SocketInterface {
+
+public:
+    signals::signal<void(bool, BaseUserCommand::Shared)> commandReceivedSignal;
+
+public:
+    /*
+     * Unix socket is not created if unixSocketPath is empty,
+     * TCP socket is not created if tcpPort is 0.
+     *
+     * @throws ValueError in case if TCP host is not the loopback address.
+     */
+    SocketInterface(
+        as::io_service &ioService,
+        const string &unixSocketPath,
+        const string &tcpHost,
+        const uint16_t tcpPort,
+        Logger &logger);
+
+    ~SocketInterface();
+
+    void beginAcceptConnections();
+
+    /*
+     * Writes result into the connection, from which the command was received.
+     * Returns false if the command was not received through this interface
+     * (or its connection was already closed).
+     */
+    bool writeResult(
+        CommandResult::SharedConst result);
+
+protected:
+    void asyncAcceptUnixConnection();
+
+    void asyncAcceptTCPConnection();
+
+    void handleUnixConnectionAccepted(
+        const boost::system::error_code &error);
+
+    void handleTCPConnectionAccepted(
+        const boost::system::error_code &error);
+
+    void beginSession(
+        SocketSession::Socket &&socket);
+
+    void onSessionCommandReceived(
+        SocketSession::Shared session,
+        bool success,
+        BaseUserCommand::Shared command);
+
+    void onSessionClosed(
+        SocketSession::Shared session);
+
+    static string logHeader()
+    noexcept;
+
+    LoggerStream info() const
+    noexcept;
+
+    LoggerStream warning() const
+    noexcept;
+
+protected:
+    static const constexpr size_t kMaxSessionsCount = 64;
+    // count of commands of one session, which results were not written yet
+    static const constexpr size_t kMaxPendingCommandsCount = 1024;
+
+    as::io_service &mIOService;
+    Logger &mLog;
+
+    string mUnixSocketPath;
+    unique_ptr<as::local::stream_protocol::acceptor> mUnixAcceptor;
+    as::local::stream_protocol::socket mUnixSocket;
+
+    unique_ptr<as::ip::tcp::acceptor> mTCPAcceptor;
+    as::ip::tcp::socket mTCPSocket;
+
+    // sessions and UUIDs of their commands, which results were not written yet
+    map<SocketSession::Shared, set<CommandUUID>> mSessions;
+    map<CommandUUID, weak_ptr<SocketSession>> mSessionsByCommandUUID;
+};
+
+#endif //GEO_NETWORK_CLIENT_SOCKETINTERFACE_H
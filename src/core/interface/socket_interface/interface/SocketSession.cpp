@@ -0,0 +1,193 @@
+#include "SocketSession.h"
+
+SocketSession::SocketSession(
+    Socket &&socket,
+    Logger &logger) :
+
+    mSocket(std::move(socket)),
+    mLog(logger),
+    mIsReadInProgress(false),
+    mCurrentResult(nullptr),
+    mIsCurrentResultSerialized(false),
+    mIsWriteInProgress(false),
+    mIsClosed(false)
+{
+    try {
+        mCommandsParser = make_unique<CommandsParser>(mLog);
+
+    } catch (std::bad_alloc &) {
+        throw MemoryError(
+            "SocketSession::SocketSession: "
+                "Can not allocate enough memory for commands parser.");
+    }
+}
+
+SocketSession::~SocketSession()
+{
+    boost::system::error_code error;
+    mSocket.close(error);
+}
+
+void SocketSession::beginReceiveCommands()
+{
+    asyncReceiveNextCommands();
+}
+
+void SocketSession::asyncReceiveNextCommands()
+{
+    if (mIsClosed or mIsReadInProgress or isOverloaded()) {
+        return;
+    }
+
+    mIsReadInProgress = true;
+    mSocket.async_read_some(
+        as::buffer(mReadBuffer),
+        boost::bind(
+            &SocketSession::handleReceivedInfo,
+            shared_from_this(),
+            as::placeholders::error,
+            as::placeholders::bytes_transferred));
+}
+
+void SocketSession::handleReceivedInfo(
+    const boost::system::error_code &error,
+    const size_t bytesTransferred)
+{
+    mIsReadInProgress = false;
+    if (error) {
+        if (error != as::error::eof and error != as::error::operation_aborted) {
+            warning() << "Can't read from the connection: " << error.message();
+        }
+        close();
+        return;
+    }
+
+    mCommandsParser->appendReadData(
+        mReadBuffer.data(),
+        bytesTransferred);
+
+    while (!mIsClosed) {
+        auto flagAndCommand = mCommandsParser->processReceivedCommands();
+        if (!flagAndCommand.second) {
+            break;
+        }
+        commandReceivedSignal(
+            shared_from_this(),
+            flagAndCommand.first,
+            flagAndCommand.second);
+    }
+
+    // In case if client doesn't read results - next commands would be read
+    // only when queued results would be written.
+    asyncReceiveNextCommands();
+}
+
+void SocketSession::writeResult(
+    CommandResult::SharedConst result)
+{
+    if (mIsClosed) {
+        return;
+    }
+    mResultsQueue.push_back(result);
+    writeNextChunk();
+}
+
+void SocketSession::writeNextChunk()
+{
+    if (mIsClosed or mIsWriteInProgress) {
+        return;
+    }
+
+    if (!prepareNextChunk()) {
+        return;
+    }
+
+    mIsWriteInProgress = true;
+    as::async_write(
+        mSocket,
+        as::buffer(mCurrentChunk),
+        boost::bind(
+            &SocketSession::handleChunkWritten,
+            shared_from_this(),
+            as::placeholders::error,
+            as::placeholders::bytes_transferred));
+}
+
+/*
+ * Returns false if there is nothing to write.
+ */
+bool SocketSession::prepareNextChunk()
+{
+    mCurrentChunk.clear();
+    while (mCurrentChunk.empty()) {
+        if (mCurrentResult == nullptr or mIsCurrentResultSerialized) {
+            if (mResultsQueue.empty()) {
+                mCurrentStream = nullptr;
+                mCurrentResult = nullptr;
+                return false;
+            }
+            mCurrentResult = mResultsQueue.front();
+            mResultsQueue.pop_front();
+            mCurrentStream = make_unique<CommandResult::ChunksStream>(
+                *mCurrentResult);
+        }
+
+        mIsCurrentResultSerialized = !mCurrentStream->serializeNextChunk(
+            mCurrentChunk);
+    }
+    return true;
+}
+
+void SocketSession::handleChunkWritten(
+    const boost::system::error_code &error,
+    const size_t bytesTransferred)
+{
+    mIsWriteInProgress = false;
+    if (error) {
+        if (error != as::error::operation_aborted) {
+            warning() << "Can't write result into the connection: " << error.message();
+        }
+        close();
+        return;
+    }
+
+    writeNextChunk();
+
+    // Reading may be paused because of queued results.
+    asyncReceiveNextCommands();
+}
+
+void SocketSession::close()
+{
+    if (mIsClosed) {
+        return;
+    }
+    mIsClosed = true;
+
+    boost::system::error_code error;
+    mSocket.shutdown(
+        Socket::shutdown_both,
+        error);
+    mSocket.close(error);
+
+    mResultsQueue.clear();
+    mCurrentResult = nullptr;
+    closedSignal(shared_from_this());
+}
+
+const bool SocketSession::isOverloaded() const
+{
+    return mResultsQueue.size() >= kMaxQueuedResultsCount;
+}
+
+string SocketSession::logHeader()
+    noexcept
+{
+    return "[SocketSession]";
+}
+
+LoggerStream SocketSession::warning() const
+    noexcept
+{
+    return mLog.warning(logHeader());
+}
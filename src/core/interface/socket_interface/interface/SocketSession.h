@@ -0,0 +1,100 @@
+#ifndef GEO_NETWORK_CLIENT_SOCKETSESSION_H
+#define GEO_NETWORK_CLIENT_SOCKETSESSION_H
+
+#include "../../commands_interface/interface/CommandsInterface.h"
+#include "../../results_interface/result/CommandResult.h"
+#include "../../../logger/Logger.h"
+
+#include <boost/asio.hpp>
+#include <boost/signals2.hpp>
+#include <boost/bind.hpp>
+
+#include <array>
+#include <deque>
+#include <memory>
+
+using namespace std;
+namespace as = boost::asio;
+namespace signals = boost::signals2;
+
+/**
+ * One client connection of the SocketInterface (unix domain socket or TCP).
+ *
+ * Commands are read from the connection in the same format as from the commands FIFO
+ * (both text and binary framed commands are accepted), results of these commands
+ * are written back into the same connection, in order of their readiness.
+ *
+ * Backpressure: when client doesn't read its results and count of queued results reaches
+ * kMaxQueuedResultsCount, commands are not read from the connection any more,
+ * until queued results would be written.
+ */
+class SocketSession:
+    public enable_shared_from_this<SocketSession> {
+
+public:
+    typedef shared_ptr<SocketSession> Shared;
+    typedef as::generic::stream_protocol::socket Socket;
+
+public:
+    signals::signal<void(SocketSession::Shared, bool, BaseUserCommand::Shared)> commandReceivedSignal;
+    signals::signal<void(SocketSession::Shared)> closedSignal;
+
+public:
+    SocketSession(
+        Socket &&socket,
+        Logger &logger);
+
+    ~SocketSession();
+
+    void beginReceiveCommands();
+
+    void writeResult(
+        CommandResult::SharedConst result);
+
+    void close();
+
+protected:
+    void asyncReceiveNextCommands();
+
+    void handleReceivedInfo(
+        const boost::system::error_code &error,
+        const size_t bytesTransferred);
+
+    void writeNextChunk();
+
+    bool prepareNextChunk();
+
+    void handleChunkWritten(
+        const boost::system::error_code &error,
+        const size_t bytesTransferred);
+
+    const bool isOverloaded() const;
+
+    static string logHeader()
+    noexcept;
+
+    LoggerStream warning() const
+    noexcept;
+
+protected:
+    static const constexpr size_t kReadBufferSize = 4 * 1024;
+    static const constexpr size_t kMaxQueuedResultsCount = 256;
+
+    Socket mSocket;
+    Logger &mLog;
+
+    array<char, kReadBufferSize> mReadBuffer;
+    unique_ptr<CommandsParser> mCommandsParser;
+    bool mIsReadInProgress;
+
+    deque<CommandResult::SharedConst> mResultsQueue;
+    CommandResult::SharedConst mCurrentResult;
+    unique_ptr<CommandResult::ChunksStream> mCurrentStream;
+    bool mIsCurrentResultSerialized;
+    string mCurrentChunk;
+    bool mIsWriteInProgress;
+
+    bool mIsClosed;
+};
+
+#endif //GEO_NETWORK_CLIENT_SOCKETSESSION_H
@@ -311,22 +311,16 @@ const AuditRecord::Shared AuditHandler::getActualAudit(
     if (rc == SQLITE_ROW) {
         auto number = (AuditNumber)sqlite3_column_int(stmt, 0);
         auto incomingAmountBytes = (byte*)sqlite3_column_blob(stmt, 1);
-        vector<byte> incomingAmountBufferBytes(
-            incomingAmountBytes,
-            incomingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount incomingAmount = bytesToTrustLineAmount(incomingAmountBufferBytes);
+        TrustLineAmount incomingAmount = bytesToTrustLineAmount(
+            incomingAmountBytes);
 
         auto outgoingAmountBytes = (byte*)sqlite3_column_blob(stmt, 2);
-        vector<byte> outgoingAmountBufferBytes(
-            outgoingAmountBytes,
-            outgoingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount outgoingAmount = bytesToTrustLineAmount(outgoingAmountBufferBytes);
+        TrustLineAmount outgoingAmount = bytesToTrustLineAmount(
+            outgoingAmountBytes);
 
         auto balanceBytes = (byte*)sqlite3_column_blob(stmt, 3);
-        vector<byte> balanceBufferBytes(
-            balanceBytes,
-            balanceBytes + kTrustLineBalanceSerializeBytesCount);
-        TrustLineBalance balance = bytesToTrustLineBalance(balanceBufferBytes);
+        TrustLineBalance balance = bytesToTrustLineBalance(
+            balanceBytes);
 
         auto contractorSignatureBytes = (byte*)sqlite3_column_blob(stmt, 4);
         lamport::Signature::Shared contractorSignature = nullptr;
@@ -386,22 +380,16 @@ const AuditRecord::Shared AuditHandler::getActualAuditFull(
     if (rc == SQLITE_ROW) {
         auto number = (AuditNumber)sqlite3_column_int(stmt, 0);
         auto incomingAmountBytes = (byte*)sqlite3_column_blob(stmt, 1);
-        vector<byte> incomingAmountBufferBytes(
-            incomingAmountBytes,
-            incomingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount incomingAmount = bytesToTrustLineAmount(incomingAmountBufferBytes);
+        TrustLineAmount incomingAmount = bytesToTrustLineAmount(
+            incomingAmountBytes);
 
         auto outgoingAmountBytes = (byte*)sqlite3_column_blob(stmt, 2);
-        vector<byte> outgoingAmountBufferBytes(
-            outgoingAmountBytes,
-            outgoingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount outgoingAmount = bytesToTrustLineAmount(outgoingAmountBufferBytes);
+        TrustLineAmount outgoingAmount = bytesToTrustLineAmount(
+            outgoingAmountBytes);
 
         auto balanceBytes = (byte*)sqlite3_column_blob(stmt, 3);
-        vector<byte> balanceBufferBytes(
-            balanceBytes,
-            balanceBytes + kTrustLineBalanceSerializeBytesCount);
-        TrustLineBalance balance = bytesToTrustLineBalance(balanceBufferBytes);
+        TrustLineBalance balance = bytesToTrustLineBalance(
+            balanceBytes);
 
         auto ownKeyHash = make_shared<lamport::KeyHash>(
             (byte*)sqlite3_column_blob(stmt, 4));
@@ -577,22 +565,16 @@ vector<AuditRecord::Shared> AuditHandler::auditsLessEqualThanAuditNumber(
     while (sqlite3_step(stmt) == SQLITE_ROW ) {
         auto number = (AuditNumber)sqlite3_column_int(stmt, 0);
         auto incomingAmountBytes = (byte*)sqlite3_column_blob(stmt, 1);
-        vector<byte> incomingAmountBufferBytes(
-            incomingAmountBytes,
-                incomingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount incomingAmount = bytesToTrustLineAmount(incomingAmountBufferBytes);
+        TrustLineAmount incomingAmount = bytesToTrustLineAmount(
+            incomingAmountBytes);
 
         auto outgoingAmountBytes = (byte*)sqlite3_column_blob(stmt, 2);
-        vector<byte> outgoingAmountBufferBytes(
-            outgoingAmountBytes,
-            outgoingAmountBytes + kTrustLineAmountBytesCount);
-        TrustLineAmount outgoingAmount = bytesToTrustLineAmount(outgoingAmountBufferBytes);
+        TrustLineAmount outgoingAmount = bytesToTrustLineAmount(
+            outgoingAmountBytes);
 
         auto balanceBytes = (byte*)sqlite3_column_blob(stmt, 3);
-        vector<byte> balanceBufferBytes(
-            balanceBytes,
-            balanceBytes + kTrustLineBalanceSerializeBytesCount);
-        TrustLineBalance balance = bytesToTrustLineBalance(balanceBufferBytes);
+        TrustLineBalance balance = bytesToTrustLineBalance(
+            balanceBytes);
 
         auto ownKeyHash = make_shared<lamport::KeyHash>(
             (byte*)sqlite3_column_blob(stmt, 4));
@@ -77,7 +77,9 @@ void ContractorKeysHandler::saveKey(
         throw IOError("ContractorKeysHandler::saveKey: "
                           "Bad query; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_blob(stmt, 1, publicKey->hash()->data(), (int)KeyHash::kBytesSize, SQLITE_STATIC);
+    // hash is bound statically, so it must outlive the query
+    const auto kKeyHash = publicKey->hash();
+    rc = sqlite3_bind_blob(stmt, 1, kKeyHash->data(), (int)KeyHash::kBytesSize, SQLITE_STATIC);
     if (rc != SQLITE_OK) {
         throw IOError("ContractorKeysHandler::saveKey: "
                           "Bad binding of Hash; sqlite error: " + to_string(rc));
@@ -9,6 +9,7 @@ HistoryStorage::HistoryStorage(
     mDataBase(dbConnection),
     mMainTableName(mainTableName),
     mAdditionalTableName(additionalTableName),
+    mContractorsTableName(mainTableName + "_contractors"),
     mLog(logger)
 {
     sqlite3_stmt *stmt;
@@ -20,7 +21,8 @@ HistoryStorage::HistoryStorage(
                        "record_body BLOB NOT NULL, "
                        "record_body_bytes_count INT NOT NULL, "
                        "equivalent INTEGER NOT NULL, "
-                       "command_uuid BLOB);";
+                       "command_uuid BLOB, "
+                       "amount BLOB);";
     int rc = sqlite3_prepare_v2( mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
         throw IOError("HistoryStorage::creating main table: "
@@ -107,7 +109,8 @@ HistoryStorage::HistoryStorage(
                        "record_type INTEGER NOT NULL, "
                        "record_body BLOB NOT NULL, "
                        "record_body_bytes_count INT NOT NULL, "
-                       "equivalent INTEGER NOT NULL);";
+                       "equivalent INTEGER NOT NULL, "
+                       "amount BLOB);";
     rc = sqlite3_prepare_v2( mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
         throw IOError("HistoryStorage::creating additional table: "
@@ -173,6 +176,295 @@ HistoryStorage::HistoryStorage(
     }
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
+
+    // creating contractors addresses table, used for filtering main records by contractor
+    executeQuery(
+        "CREATE TABLE IF NOT EXISTS " + mContractorsTableName +
+            "(operation_uuid BLOB NOT NULL, "
+                "address_type INTEGER NOT NULL, "
+                "address TEXT NOT NULL);",
+        "HistoryStorage::creating contractors table");
+    executeQuery(
+        "CREATE INDEX IF NOT EXISTS " + mContractorsTableName
+            + "_address_idx on " + mContractorsTableName + "(address, address_type);",
+        "HistoryStorage::contractors creating index for address");
+
+    // history created by previous versions has no amount column and no contractors addresses,
+    // so they should be restored from records bodies
+    migrateToColumnarFields(
+        !isColumnPresent(mMainTableName, "amount"),
+        !isColumnPresent(mAdditionalTableName, "amount"));
+
+    executeQuery(
+        "CREATE INDEX IF NOT EXISTS " + mMainTableName
+            + "_amount_idx on " + mMainTableName + "(amount);",
+        "HistoryStorage::main creating index for amount");
+    executeQuery(
+        "CREATE INDEX IF NOT EXISTS " + mAdditionalTableName
+            + "_amount_idx on " + mAdditionalTableName + "(amount);",
+        "HistoryStorage::additional creating index for amount");
+
+    // indexes for reading history pages by cursor (rowid is implicitly the last column of each index)
+    executeQuery(
+        "CREATE INDEX IF NOT EXISTS " + mMainTableName
+            + "_equivalent_type_timestamp_idx on " + mMainTableName
+            + "(equivalent, record_type, operation_timestamp);",
+        "HistoryStorage::main creating index for cursor by record type");
+    executeQuery(
+        "CREATE INDEX IF NOT EXISTS " + mMainTableName
+            + "_equivalent_timestamp_idx on " + mMainTableName
+            + "(equivalent, operation_timestamp);",
+        "HistoryStorage::main creating index for cursor");
+    executeQuery(
+        "CREATE INDEX IF NOT EXISTS " + mAdditionalTableName
+            + "_equivalent_type_timestamp_idx on " + mAdditionalTableName
+            + "(equivalent, record_type, operation_timestamp);",
+        "HistoryStorage::additional creating index for cursor by record type");
+}
+
+void HistoryStorage::migrateToColumnarFields(
+    bool isMainTableMigrationRequired,
+    bool isAdditionalTableMigrationRequired)
+{
+    if (!isMainTableMigrationRequired and !isAdditionalTableMigrationRequired) {
+        return;
+    }
+    // schema changes and data copying are done in one transaction,
+    // otherwise interrupted migration would leave amount column present but not filled
+    // and wouldn't be restarted on next launch
+    executeQuery(
+        "BEGIN TRANSACTION;",
+        "HistoryStorage::migrateToColumnarFields: begin");
+    try {
+        if (isMainTableMigrationRequired) {
+            migrateMainTableToColumnarFields();
+        }
+        if (isAdditionalTableMigrationRequired) {
+            migrateAdditionalTableToColumnarFields();
+        }
+    } catch (...) {
+        sqlite3_exec(mDataBase, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr);
+        throw;
+    }
+    executeQuery(
+        "COMMIT TRANSACTION;",
+        "HistoryStorage::migrateToColumnarFields: commit");
+}
+
+void HistoryStorage::migrateMainTableToColumnarFields()
+{
+    info() << "Migrating " << mMainTableName << " to columnar amount and contractor fields";
+    executeQuery(
+        "ALTER TABLE " + mMainTableName + " ADD COLUMN amount BLOB;",
+        "HistoryStorage::migrateMainTableToColumnarFields: adding amount column");
+
+    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, "
+                   "record_type, equivalent, rowid FROM " + mMainTableName + ";";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::migrateMainTableToColumnarFields: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    // records are collected before updating, because table can't be safely updated during reading
+    vector<pair<sqlite3_int64, Record::Shared>> records;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        auto rowID = sqlite3_column_int64(stmt, 6);
+        int recordType = sqlite3_column_int(stmt, 4);
+        switch (recordType) {
+            case Record::TrustLineRecordType:
+                records.emplace_back(
+                    rowID,
+                    deserializeTrustLineRecord(
+                        stmt));
+                break;
+            case Record::PaymentRecordType:
+                records.emplace_back(
+                    rowID,
+                    deserializePaymentRecord(
+                        (SerializedEquivalent)sqlite3_column_int(stmt, 5),
+                        stmt));
+                break;
+            default:
+                throw ValueError("HistoryStorage::migrateMainTableToColumnarFields: "
+                                     "invalid record type");
+        }
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+
+    for (const auto &rowIDAndRecord : records) {
+        auto record = rowIDAndRecord.second;
+        if (record->isTrustLineRecord()) {
+            updateRecordAmount(
+                mMainTableName,
+                rowIDAndRecord.first,
+                static_pointer_cast<TrustLineRecord>(record)->amount());
+        } else {
+            updateRecordAmount(
+                mMainTableName,
+                rowIDAndRecord.first,
+                static_pointer_cast<PaymentRecord>(record)->amount());
+        }
+        saveRecordContractor(
+            record->operationUUID(),
+            record->contractor());
+    }
+    info() << records.size() << " records were migrated";
+}
+
+void HistoryStorage::migrateAdditionalTableToColumnarFields()
+{
+    info() << "Migrating " << mAdditionalTableName << " to columnar amount field";
+    executeQuery(
+        "ALTER TABLE " + mAdditionalTableName + " ADD COLUMN amount BLOB;",
+        "HistoryStorage::migrateAdditionalTableToColumnarFields: adding amount column");
+
+    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, "
+                   "rowid FROM " + mAdditionalTableName + ";";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::migrateAdditionalTableToColumnarFields: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    vector<pair<sqlite3_int64, PaymentAdditionalRecord::Shared>> records;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        records.emplace_back(
+            sqlite3_column_int64(stmt, 4),
+            deserializePaymentAdditionalRecord(
+                stmt));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+
+    for (const auto &rowIDAndRecord : records) {
+        updateRecordAmount(
+            mAdditionalTableName,
+            rowIDAndRecord.first,
+            rowIDAndRecord.second->amount());
+    }
+    info() << records.size() << " records were migrated";
+}
+
+void HistoryStorage::updateRecordAmount(
+    const string &tableName,
+    sqlite3_int64 rowID,
+    const TrustLineAmount &amount)
+{
+    string query = "UPDATE " + tableName + " SET amount = ? WHERE rowid = ?;";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::updateRecordAmount: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    auto serializedAmount = trustLineAmountToBytes(amount);
+    rc = sqlite3_bind_blob(stmt, 1, serializedAmount.data(), kTrustLineAmountBytesCount, SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::updateRecordAmount: "
+                          "Bad binding of Amount; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_int64(stmt, 2, rowID);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::updateRecordAmount: "
+                          "Bad binding of RowID; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_DONE) {
+        throw IOError("HistoryStorage::updateRecordAmount: "
+                          "Run query; sqlite error: " + to_string(rc));
+    }
+}
+
+void HistoryStorage::saveRecordContractor(
+    const TransactionUUID &operationUUID,
+    Contractor::Shared contractor)
+{
+    if (contractor == nullptr) {
+        return;
+    }
+    string query = "INSERT INTO " + mContractorsTableName
+                   + "(operation_uuid, address_type, address) VALUES(?, ?, ?);";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::saveRecordContractor: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    for (const auto &address : contractor->addresses()) {
+        rc = sqlite3_bind_blob(stmt, 1, operationUUID.data, TransactionUUID::kBytesSize, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::saveRecordContractor: "
+                              "Bad binding of OperationUUID; sqlite error: " + to_string(rc));
+        }
+        rc = sqlite3_bind_int(stmt, 2, address->typeID());
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::saveRecordContractor: "
+                              "Bad binding of AddressType; sqlite error: " + to_string(rc));
+        }
+        auto fullAddress = address->fullAddress();
+        rc = sqlite3_bind_text(stmt, 3, fullAddress.c_str(), (int)fullAddress.size(), SQLITE_TRANSIENT);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::saveRecordContractor: "
+                              "Bad binding of Address; sqlite error: " + to_string(rc));
+        }
+        rc = sqlite3_step(stmt);
+        if (rc != SQLITE_DONE) {
+            sqlite3_finalize(stmt);
+            throw IOError("HistoryStorage::saveRecordContractor: "
+                              "Run query; sqlite error: " + to_string(rc));
+        }
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+    }
+    sqlite3_finalize(stmt);
+}
+
+bool HistoryStorage::isColumnPresent(
+    const string &tableName,
+    const string &columnName)
+{
+    string query = "PRAGMA table_info(" + tableName + ");";
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::isColumnPresent: "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    bool result = false;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        // second column of table_info contains column name
+        auto name = (const char *)sqlite3_column_text(stmt, 1);
+        if (name != nullptr && columnName == name) {
+            result = true;
+            break;
+        }
+    }
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+void HistoryStorage::executeQuery(
+    const string &query,
+    const string &errorContext)
+{
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        throw IOError(errorContext + ": "
+                          "Bad query; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_DONE) {
+        throw IOError(errorContext + ": "
+                          "Run query; sqlite error: " + to_string(rc));
+    }
 }
 
 void HistoryStorage::saveTrustLineRecord(
@@ -181,8 +473,8 @@ void HistoryStorage::saveTrustLineRecord(
 {
     string query = "INSERT INTO " + mMainTableName
                    + "(operation_uuid, operation_timestamp, equivalent, "
-                           "record_type, record_body, record_body_bytes_count) "
-                           "VALUES(?, ?, ?, ?, ?, ?);";
+                           "record_type, record_body, record_body_bytes_count, amount) "
+                           "VALUES(?, ?, ?, ?, ?, ?, ?);";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
@@ -223,6 +515,12 @@ void HistoryStorage::saveTrustLineRecord(
         throw IOError("HistoryStorage::insert trustline: "
                           "Bad binding of RecordBody bytes count; sqlite error: " + to_string(rc));
     }
+    auto serializedAmount = trustLineAmountToBytes(record->amount());
+    rc = sqlite3_bind_blob(stmt, 7, serializedAmount.data(), kTrustLineAmountBytesCount, SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::insert trustline: "
+                          "Bad binding of Amount; sqlite error: " + to_string(rc));
+    }
 
     rc = sqlite3_step(stmt);
     sqlite3_reset(stmt);
@@ -235,6 +533,9 @@ void HistoryStorage::saveTrustLineRecord(
         throw IOError("HistoryStorage::insert trustline: "
                           "Run query; sqlite error: " + to_string(rc));
     }
+    saveRecordContractor(
+        record->operationUUID(),
+        record->contractor());
 }
 
 void HistoryStorage::savePaymentRecord(
@@ -260,8 +561,8 @@ void HistoryStorage::savePaymentMainOutgoingRecord(
 {
     string query = "INSERT INTO " + mMainTableName
                    + "(operation_uuid, operation_timestamp, equivalent, record_type, "
-                     "record_body, record_body_bytes_count, command_uuid) "
-                     "VALUES(?, ?, ?, ?, ?, ?, ?);";
+                     "record_body, record_body_bytes_count, command_uuid, amount) "
+                     "VALUES(?, ?, ?, ?, ?, ?, ?, ?);";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
@@ -314,6 +615,13 @@ void HistoryStorage::savePaymentMainOutgoingRecord(
                           "Bad binding of commandUUID; sqlite error: " + to_string(rc));
     }
 
+    auto serializedAmount = trustLineAmountToBytes(record->amount());
+    rc = sqlite3_bind_blob(stmt, 8, serializedAmount.data(), kTrustLineAmountBytesCount, SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::insert main payment: "
+                          "Bad binding of Amount; sqlite error: " + to_string(rc));
+    }
+
     rc = sqlite3_step(stmt);
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
@@ -325,6 +633,9 @@ void HistoryStorage::savePaymentMainOutgoingRecord(
         throw IOError("HistoryStorage::insert main payment: "
                           "Run query; sqlite error: " + to_string(rc));
     }
+    saveRecordContractor(
+        record->operationUUID(),
+        record->contractor());
 }
 
 void HistoryStorage::savePaymentMainIncomingRecord(
@@ -332,8 +643,8 @@ void HistoryStorage::savePaymentMainIncomingRecord(
 {
     string query = "INSERT INTO " + mMainTableName
                    + "(operation_uuid, operation_timestamp, equivalent, "
-                     "record_type, record_body, record_body_bytes_count) "
-                       "VALUES(?, ?, ?, ?, ?, ?);";
+                     "record_type, record_body, record_body_bytes_count, amount) "
+                       "VALUES(?, ?, ?, ?, ?, ?, ?);";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
@@ -380,6 +691,13 @@ void HistoryStorage::savePaymentMainIncomingRecord(
                           "Bad binding of RecordBody bytes count; sqlite error: " + to_string(rc));
     }
 
+    auto serializedAmount = trustLineAmountToBytes(record->amount());
+    rc = sqlite3_bind_blob(stmt, 7, serializedAmount.data(), kTrustLineAmountBytesCount, SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::insert main payment: "
+                          "Bad binding of Amount; sqlite error: " + to_string(rc));
+    }
+
     rc = sqlite3_step(stmt);
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
@@ -391,6 +709,9 @@ void HistoryStorage::savePaymentMainIncomingRecord(
         throw IOError("HistoryStorage::insert main payment: "
                           "Run query; sqlite error: " + to_string(rc));
     }
+    saveRecordContractor(
+        record->operationUUID(),
+        record->contractor());
 }
 
 void HistoryStorage::savePaymentAdditionalRecord(
@@ -398,8 +719,9 @@ void HistoryStorage::savePaymentAdditionalRecord(
     const SerializedEquivalent equivalent)
 {
     string query = "INSERT INTO " + mAdditionalTableName
-                   + "(operation_uuid, operation_timestamp, equivalent, record_type, record_body, record_body_bytes_count) "
-                           "VALUES(?, ?, ?, ?, ?, ?);";
+                   + "(operation_uuid, operation_timestamp, equivalent, record_type, record_body, "
+                           "record_body_bytes_count, amount) "
+                           "VALUES(?, ?, ?, ?, ?, ?, ?);";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
@@ -439,6 +761,12 @@ void HistoryStorage::savePaymentAdditionalRecord(
         throw IOError("HistoryStorage::insert additional payment: "
                           "Bad binding of RecordBody bytes count; sqlite error: " + to_string(rc));
     }
+    auto serializedAmount = trustLineAmountToBytes(record->amount());
+    rc = sqlite3_bind_blob(stmt, 7, serializedAmount.data(), kTrustLineAmountBytesCount, SQLITE_STATIC);
+    if (rc != SQLITE_OK) {
+        throw IOError("HistoryStorage::insert additional payment: "
+                          "Bad binding of Amount; sqlite error: " + to_string(rc));
+    }
     rc = sqlite3_step(stmt);
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
@@ -459,10 +787,15 @@ vector<TrustLineRecord::Shared> HistoryStorage::allTrustLineRecords(
     DateTime timeFrom,
     bool isTimeFromPresent,
     DateTime timeTo,
-    bool isTimeToPresent)
+    bool isTimeToPresent,
+    HistoryCursor::Shared cursor)
 {
     vector<TrustLineRecord::Shared> result;
-    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count FROM "
+    // exhausted cursor was returned with the last page, so there is nothing to read
+    if (cursor != nullptr and cursor->isExhausted()) {
+        return result;
+    }
+    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, rowid FROM "
                    + mMainTableName + " WHERE equivalent = ? AND record_type = ? ";
     if (isTimeFromPresent) {
         query += " AND operation_timestamp >= ? ";
@@ -470,7 +803,15 @@ vector<TrustLineRecord::Shared> HistoryStorage::allTrustLineRecords(
     if (isTimeToPresent) {
         query += " AND operation_timestamp <= ? ";
     }
-    query += " ORDER BY operation_timestamp DESC LIMIT ? OFFSET ?;";
+    appendCursorCondition(
+        query,
+        cursor);
+    query += " ORDER BY operation_timestamp DESC, rowid DESC LIMIT ?";
+    // page position is defined either by cursor or by offset, never by both
+    if (cursor == nullptr) {
+        query += " OFFSET ?";
+    }
+    query += ";";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
@@ -504,22 +845,38 @@ vector<TrustLineRecord::Shared> HistoryStorage::allTrustLineRecords(
                               "Bad binding of TimeTo; sqlite error: " + to_string(rc));
         }
     }
+    bindCursor(
+        stmt,
+        idxParam,
+        cursor,
+        "HistoryStorage::allTrustLineRecords");
     rc = sqlite3_bind_int(stmt, idxParam++, (int)recordsCount);
     if (rc != SQLITE_OK) {
         throw IOError("HistoryStorage::allTrustLineRecords: "
                           "Bad binding of recordsCount; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_int(stmt, idxParam, (int)fromRecord);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::allTrustLineRecords: "
-                          "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+    if (cursor == nullptr) {
+        rc = sqlite3_bind_int(stmt, idxParam, (int)fromRecord);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::allTrustLineRecords: "
+                              "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+        }
     }
 
+    GEOEpochTimestamp lastTimestamp = 0;
+    int64_t lastRecordID = 0;
     while (sqlite3_step(stmt) == SQLITE_ROW ) {
         result.push_back(
             deserializeTrustLineRecord(
                 stmt));
+        lastTimestamp = (GEOEpochTimestamp)sqlite3_column_int64(stmt, 1);
+        lastRecordID = sqlite3_column_int64(stmt, 4);
     }
+    updateCursor(
+        cursor,
+        lastTimestamp,
+        lastRecordID,
+        result.size() == recordsCount);
 
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
@@ -533,10 +890,19 @@ vector<PaymentRecord::Shared> HistoryStorage::allPaymentRecords(
     DateTime timeFrom,
     bool isTimeFromPresent,
     DateTime timeTo,
-    bool isTimeToPresent)
+    bool isTimeToPresent,
+    const TrustLineAmount& lowBoundaryAmount,
+    bool isLowBoundaryAmountPresent,
+    const TrustLineAmount& highBoundaryAmount,
+    bool isHighBoundaryAmountPresent,
+    HistoryCursor::Shared cursor)
 {
     vector<PaymentRecord::Shared> result;
-    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count FROM "
+    // exhausted cursor was returned with the last page, so there is nothing to read
+    if (cursor != nullptr and cursor->isExhausted()) {
+        return result;
+    }
+    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, rowid FROM "
                    + mMainTableName + " WHERE equivalent = ? AND record_type = ? ";
     if (isTimeFromPresent) {
         query += " AND operation_timestamp >= ? ";
@@ -544,7 +910,21 @@ vector<PaymentRecord::Shared> HistoryStorage::allPaymentRecords(
     if (isTimeToPresent) {
         query += " AND operation_timestamp <= ? ";
     }
-    query += " ORDER BY operation_timestamp DESC LIMIT ? OFFSET ?;";
+    if (isLowBoundaryAmountPresent) {
+        query += " AND amount >= ? ";
+    }
+    if (isHighBoundaryAmountPresent) {
+        query += " AND amount <= ? ";
+    }
+    appendCursorCondition(
+        query,
+        cursor);
+    query += " ORDER BY operation_timestamp DESC, rowid DESC LIMIT ?";
+    // page position is defined either by cursor or by offset, never by both
+    if (cursor == nullptr) {
+        query += " OFFSET ?";
+    }
+    query += ";";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
@@ -578,23 +958,57 @@ vector<PaymentRecord::Shared> HistoryStorage::allPaymentRecords(
                               "Bad binding of TimeTo; sqlite error: " + to_string(rc));
         }
     }
+    auto lowBoundaryAmountBytes = trustLineAmountToBytes(lowBoundaryAmount);
+    if (isLowBoundaryAmountPresent) {
+        rc = sqlite3_bind_blob(stmt, idxParam++, lowBoundaryAmountBytes.data(),
+                               kTrustLineAmountBytesCount, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::allPaymentRecords: "
+                              "Bad binding of LowBoundaryAmount; sqlite error: " + to_string(rc));
+        }
+    }
+    auto highBoundaryAmountBytes = trustLineAmountToBytes(highBoundaryAmount);
+    if (isHighBoundaryAmountPresent) {
+        rc = sqlite3_bind_blob(stmt, idxParam++, highBoundaryAmountBytes.data(),
+                               kTrustLineAmountBytesCount, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::allPaymentRecords: "
+                              "Bad binding of HighBoundaryAmount; sqlite error: " + to_string(rc));
+        }
+    }
+    bindCursor(
+        stmt,
+        idxParam,
+        cursor,
+        "HistoryStorage::allPaymentRecords");
     rc = sqlite3_bind_int(stmt, idxParam++, (int)recordsCount);
     if (rc != SQLITE_OK) {
         throw IOError("HistoryStorage::allPaymentRecords: "
                           "Bad binding of recordsCount; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_int(stmt, idxParam, (int)fromRecord);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::allPaymentRecords: "
-                          "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+    if (cursor == nullptr) {
+        rc = sqlite3_bind_int(stmt, idxParam, (int)fromRecord);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::allPaymentRecords: "
+                              "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+        }
     }
 
+    GEOEpochTimestamp lastTimestamp = 0;
+    int64_t lastRecordID = 0;
     while (sqlite3_step(stmt) == SQLITE_ROW ) {
         result.push_back(
             deserializePaymentRecord(
                 equivalent,
                 stmt));
+        lastTimestamp = (GEOEpochTimestamp)sqlite3_column_int64(stmt, 1);
+        lastRecordID = sqlite3_column_int64(stmt, 4);
     }
+    updateCursor(
+        cursor,
+        lastTimestamp,
+        lastRecordID,
+        result.size() == recordsCount);
 
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
@@ -607,7 +1021,11 @@ vector<PaymentRecord::Shared> HistoryStorage::paymentRecordsAllEquivalents(
     DateTime timeFrom,
     bool isTimeFromPresent,
     DateTime timeTo,
-    bool isTimeToPresent)
+    bool isTimeToPresent,
+    const TrustLineAmount& lowBoundaryAmount,
+    bool isLowBoundaryAmountPresent,
+    const TrustLineAmount& highBoundaryAmount,
+    bool isHighBoundaryAmountPresent)
 {
     vector<PaymentRecord::Shared> result;
     string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, equivalent FROM "
@@ -618,6 +1036,12 @@ vector<PaymentRecord::Shared> HistoryStorage::paymentRecordsAllEquivalents(
     if (isTimeToPresent) {
         query += " AND operation_timestamp <= ? ";
     }
+    if (isLowBoundaryAmountPresent) {
+        query += " AND amount >= ? ";
+    }
+    if (isHighBoundaryAmountPresent) {
+        query += " AND amount <= ? ";
+    }
     query += " ORDER BY operation_timestamp DESC LIMIT ? OFFSET ?;";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
@@ -647,6 +1071,24 @@ vector<PaymentRecord::Shared> HistoryStorage::paymentRecordsAllEquivalents(
                           "Bad binding of TimeTo; sqlite error: " + to_string(rc));
         }
     }
+    auto lowBoundaryAmountBytes = trustLineAmountToBytes(lowBoundaryAmount);
+    if (isLowBoundaryAmountPresent) {
+        rc = sqlite3_bind_blob(stmt, idxParam++, lowBoundaryAmountBytes.data(),
+                               kTrustLineAmountBytesCount, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::paymentRecordsAllEquivalents: "
+                          "Bad binding of LowBoundaryAmount; sqlite error: " + to_string(rc));
+        }
+    }
+    auto highBoundaryAmountBytes = trustLineAmountToBytes(highBoundaryAmount);
+    if (isHighBoundaryAmountPresent) {
+        rc = sqlite3_bind_blob(stmt, idxParam++, highBoundaryAmountBytes.data(),
+                               kTrustLineAmountBytesCount, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::paymentRecordsAllEquivalents: "
+                          "Bad binding of HighBoundaryAmount; sqlite error: " + to_string(rc));
+        }
+    }
     rc = sqlite3_bind_int(stmt, idxParam++, (int)recordsCount);
     if (rc != SQLITE_OK) {
         throw IOError("HistoryStorage::paymentRecordsAllEquivalents: "
@@ -671,180 +1113,6 @@ vector<PaymentRecord::Shared> HistoryStorage::paymentRecordsAllEquivalents(
     return result;
 }
 
-size_t HistoryStorage::countRecordsByType(
-    Record::RecordType recordType,
-    const SerializedEquivalent equivalent)
-{
-    string query = "SELECT count(*) FROM "
-                   + mMainTableName + " WHERE equivalent = ? AND record_type = ? ";
-    sqlite3_stmt *stmt;
-    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::countRecordsByType: "
-                          "Bad query; sqlite error: " + to_string(rc));
-    }
-    rc = sqlite3_bind_int(stmt, 1, equivalent);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::countRecordsByType: "
-                          "Bad binding of Equivalent; sqlite error: " + to_string(rc));
-    }
-    rc = sqlite3_bind_int(stmt, 2, recordType);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::countRecordsByType: "
-                          "Bad binding of RecordType; sqlite error: " + to_string(rc));
-    }
-    sqlite3_step(stmt);
-    auto result = (size_t)sqlite3_column_int(stmt, 0);
-    sqlite3_reset(stmt);
-    sqlite3_finalize(stmt);
-    return result;
-}
-
-size_t HistoryStorage::countRecordsByTypeAllEquivalents(
-    Record::RecordType recordType)
-{
-    string query = "SELECT count(*) FROM "
-                   + mMainTableName + " WHERE record_type = ? ";
-    sqlite3_stmt *stmt;
-    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::countRecordsByTypeAllEquivalents: "
-                      "Bad query; sqlite error: " + to_string(rc));
-    }
-    rc = sqlite3_bind_int(stmt, 1, recordType);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::countRecordsByTypeAllEquivalents: "
-                      "Bad binding of RecordType; sqlite error: " + to_string(rc));
-    }
-    sqlite3_step(stmt);
-    auto result = (size_t)sqlite3_column_int(stmt, 0);
-    sqlite3_reset(stmt);
-    sqlite3_finalize(stmt);
-    return result;
-}
-
-vector<PaymentRecord::Shared> HistoryStorage::allPaymentRecords(
-    const SerializedEquivalent equivalent,
-    size_t recordsCount,
-    size_t fromRecord,
-    DateTime timeFrom,
-    bool isTimeFromPresent,
-    DateTime timeTo,
-    bool isTimeToPresent,
-    const TrustLineAmount& lowBoundaryAmount,
-    bool isLowBoundaryAmountPresent,
-    const TrustLineAmount& highBoundaryAmount,
-    bool isHighBoundaryAmountPresent)
-{
-    if (!isLowBoundaryAmountPresent && !isHighBoundaryAmountPresent) {
-        return allPaymentRecords(
-            equivalent,
-            recordsCount,
-            fromRecord,
-            timeFrom,
-            isTimeFromPresent,
-            timeTo,
-            isTimeToPresent);
-    }
-    vector<PaymentRecord::Shared> result;
-    size_t paymentRecordsCount = countRecordsByType(
-        Record::PaymentRecordType,
-        equivalent);
-    size_t currentOffset = 0;
-    size_t countRecordsUnderConditions = 0;
-    while (result.size() < recordsCount && currentOffset < paymentRecordsCount) {
-        auto paymentRecords = allPaymentRecords(
-            equivalent,
-            kPortionRequestSize,
-            currentOffset,
-            timeFrom,
-            isTimeFromPresent,
-            timeTo,
-            isTimeToPresent);
-        for (auto &paymentRecord : paymentRecords) {
-            bool recordUnderConditions = true;
-            if (isLowBoundaryAmountPresent) {
-                recordUnderConditions = recordUnderConditions &&
-                    (paymentRecord->amount() >= lowBoundaryAmount);
-            }
-            if (isHighBoundaryAmountPresent) {
-                recordUnderConditions = recordUnderConditions &&
-                    (paymentRecord->amount() <= highBoundaryAmount);
-            }
-            if (recordUnderConditions) {
-                countRecordsUnderConditions++;
-                if (countRecordsUnderConditions > fromRecord) {
-                    result.push_back(paymentRecord);
-                }
-            }
-            if (result.size() >= recordsCount) {
-                break;
-            }
-        }
-        currentOffset += kPortionRequestSize;
-    }
-    return result;
-}
-
-vector<PaymentRecord::Shared> HistoryStorage::paymentRecordsAllEquivalents(
-    size_t recordsCount,
-    size_t fromRecord,
-    DateTime timeFrom,
-    bool isTimeFromPresent,
-    DateTime timeTo,
-    bool isTimeToPresent,
-    const TrustLineAmount& lowBoundaryAmount,
-    bool isLowBoundaryAmountPresent,
-    const TrustLineAmount& highBoundaryAmount,
-    bool isHighBoundaryAmountPresent)
-{
-    if (!isLowBoundaryAmountPresent && !isHighBoundaryAmountPresent) {
-        return paymentRecordsAllEquivalents(
-            recordsCount,
-            fromRecord,
-            timeFrom,
-            isTimeFromPresent,
-            timeTo,
-            isTimeToPresent);
-    }
-    vector<PaymentRecord::Shared> result;
-    size_t paymentRecordsCount = countRecordsByTypeAllEquivalents(
-        Record::PaymentRecordType);
-    size_t currentOffset = 0;
-    size_t countRecordsUnderConditions = 0;
-    while (result.size() < recordsCount && currentOffset < paymentRecordsCount) {
-        auto paymentRecords = paymentRecordsAllEquivalents(
-            kPortionRequestSize,
-            currentOffset,
-            timeFrom,
-            isTimeFromPresent,
-            timeTo,
-            isTimeToPresent);
-        for (auto &paymentRecord : paymentRecords) {
-            bool recordUnderConditions = true;
-            if (isLowBoundaryAmountPresent) {
-                recordUnderConditions = recordUnderConditions &&
-                    (paymentRecord->amount() >= lowBoundaryAmount);
-            }
-            if (isHighBoundaryAmountPresent) {
-                recordUnderConditions = recordUnderConditions &&
-                    (paymentRecord->amount() <= highBoundaryAmount);
-            }
-            if (recordUnderConditions) {
-                countRecordsUnderConditions++;
-                if (countRecordsUnderConditions > fromRecord) {
-                    result.push_back(paymentRecord);
-                }
-            }
-            if (result.size() >= recordsCount) {
-                break;
-            }
-        }
-        currentOffset += kPortionRequestSize;
-    }
-    return result;
-}
-
 vector<PaymentAdditionalRecord::Shared> HistoryStorage::allPaymentAdditionalRecords(
     const SerializedEquivalent equivalent,
     size_t recordsCount,
@@ -856,69 +1124,15 @@ vector<PaymentAdditionalRecord::Shared> HistoryStorage::allPaymentAdditionalReco
     const TrustLineAmount& lowBoundaryAmount,
     bool isLowBoundaryAmountPresent,
     const TrustLineAmount& highBoundaryAmount,
-    bool isHighBoundaryAmountPresent)
+    bool isHighBoundaryAmountPresent,
+    HistoryCursor::Shared cursor)
 {
-    if (!isLowBoundaryAmountPresent && !isHighBoundaryAmountPresent) {
-        return allPaymentAdditionalRecords(
-            equivalent,
-            recordsCount,
-            fromRecord,
-            timeFrom,
-            isTimeFromPresent,
-            timeTo,
-            isTimeToPresent);
-    }
     vector<PaymentAdditionalRecord::Shared> result;
-    size_t paymentRecordsCount = countRecordsByType(
-        Record::PaymentAdditionalRecordType,
-        equivalent);
-    size_t currentOffset = 0;
-    size_t countRecordsUnderConditions = 0;
-    while (result.size() < recordsCount && currentOffset < paymentRecordsCount) {
-        auto paymentAdditionalRecords = allPaymentAdditionalRecords(
-            equivalent,
-            kPortionRequestSize,
-            currentOffset,
-            timeFrom,
-            isTimeFromPresent,
-            timeTo,
-            isTimeToPresent);
-        for (auto &paymentAdditionalRecord : paymentAdditionalRecords) {
-            bool recordUnderConditions = true;
-            if (isLowBoundaryAmountPresent) {
-                recordUnderConditions = recordUnderConditions &&
-                        (paymentAdditionalRecord->amount() >= lowBoundaryAmount);
-            }
-            if (isHighBoundaryAmountPresent) {
-                recordUnderConditions = recordUnderConditions &&
-                        (paymentAdditionalRecord->amount() <= highBoundaryAmount);
-            }
-            if (recordUnderConditions) {
-                countRecordsUnderConditions++;
-                if (countRecordsUnderConditions > fromRecord) {
-                    result.push_back(paymentAdditionalRecord);
-                }
-            }
-            if (result.size() >= recordsCount) {
-                break;
-            }
-        }
-        currentOffset += kPortionRequestSize;
+    // exhausted cursor was returned with the last page, so there is nothing to read
+    if (cursor != nullptr and cursor->isExhausted()) {
+        return result;
     }
-    return result;
-}
-
-vector<PaymentAdditionalRecord::Shared> HistoryStorage::allPaymentAdditionalRecords(
-    const SerializedEquivalent equivalent,
-    size_t recordsCount,
-    size_t fromRecord,
-    DateTime timeFrom,
-    bool isTimeFromPresent,
-    DateTime timeTo,
-    bool isTimeToPresent)
-{
-    vector<PaymentAdditionalRecord::Shared> result;
-    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count FROM "
+    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, rowid FROM "
                    + mAdditionalTableName + " WHERE equivalent = ? AND record_type = ? ";
     if (isTimeFromPresent) {
         query += " AND operation_timestamp >= ? ";
@@ -926,7 +1140,21 @@ vector<PaymentAdditionalRecord::Shared> HistoryStorage::allPaymentAdditionalReco
     if (isTimeToPresent) {
         query += " AND operation_timestamp <= ? ";
     }
-    query += " ORDER BY operation_timestamp DESC LIMIT ? OFFSET ?;";
+    if (isLowBoundaryAmountPresent) {
+        query += " AND amount >= ? ";
+    }
+    if (isHighBoundaryAmountPresent) {
+        query += " AND amount <= ? ";
+    }
+    appendCursorCondition(
+        query,
+        cursor);
+    query += " ORDER BY operation_timestamp DESC, rowid DESC LIMIT ?";
+    // page position is defined either by cursor or by offset, never by both
+    if (cursor == nullptr) {
+        query += " OFFSET ?";
+    }
+    query += ";";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
@@ -960,61 +1188,139 @@ vector<PaymentAdditionalRecord::Shared> HistoryStorage::allPaymentAdditionalReco
                               "Bad binding of TimeTo; sqlite error: " + to_string(rc));
         }
     }
+    auto lowBoundaryAmountBytes = trustLineAmountToBytes(lowBoundaryAmount);
+    if (isLowBoundaryAmountPresent) {
+        rc = sqlite3_bind_blob(stmt, idxParam++, lowBoundaryAmountBytes.data(),
+                               kTrustLineAmountBytesCount, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::allAdditionalPaymentRecords: "
+                              "Bad binding of LowBoundaryAmount; sqlite error: " + to_string(rc));
+        }
+    }
+    auto highBoundaryAmountBytes = trustLineAmountToBytes(highBoundaryAmount);
+    if (isHighBoundaryAmountPresent) {
+        rc = sqlite3_bind_blob(stmt, idxParam++, highBoundaryAmountBytes.data(),
+                               kTrustLineAmountBytesCount, SQLITE_STATIC);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::allAdditionalPaymentRecords: "
+                              "Bad binding of HighBoundaryAmount; sqlite error: " + to_string(rc));
+        }
+    }
+    bindCursor(
+        stmt,
+        idxParam,
+        cursor,
+        "HistoryStorage::allAdditionalPaymentRecords");
     rc = sqlite3_bind_int(stmt, idxParam++, (int)recordsCount);
     if (rc != SQLITE_OK) {
         throw IOError("HistoryStorage::allAdditionalPaymentRecords: "
                           "Bad binding of recordsCount; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_int(stmt, idxParam, (int)fromRecord);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::allAdditionalPaymentRecords: "
-                          "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+    if (cursor == nullptr) {
+        rc = sqlite3_bind_int(stmt, idxParam, (int)fromRecord);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::allAdditionalPaymentRecords: "
+                              "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+        }
     }
 
+    GEOEpochTimestamp lastTimestamp = 0;
+    int64_t lastRecordID = 0;
     while (sqlite3_step(stmt) == SQLITE_ROW ) {
         result.push_back(
             deserializePaymentAdditionalRecord(
                 stmt));
+        lastTimestamp = (GEOEpochTimestamp)sqlite3_column_int64(stmt, 1);
+        lastRecordID = sqlite3_column_int64(stmt, 4);
     }
+    updateCursor(
+        cursor,
+        lastTimestamp,
+        lastRecordID,
+        result.size() == recordsCount);
 
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
     return result;
 }
 
-vector<Record::Shared> HistoryStorage::recordsPortionWithContractor(
+vector<Record::Shared> HistoryStorage::recordsWithContractor(
+    vector<BaseAddress::Shared> contractorAddresses,
     const SerializedEquivalent equivalent,
     size_t recordsCount,
-    size_t fromRecord)
+    size_t fromRecord,
+    HistoryCursor::Shared cursor)
 {
     vector<Record::Shared> result;
-    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, record_type"
-                   " FROM " + mMainTableName + " WHERE equivalent = ? "
-                   "ORDER BY operation_timestamp DESC LIMIT ? OFFSET ?;";
+    // exhausted cursor was returned with the last page, so there is nothing to read
+    if (cursor != nullptr and cursor->isExhausted()) {
+        return result;
+    }
+    string query = "SELECT operation_uuid, operation_timestamp, record_body, record_body_bytes_count, record_type, rowid"
+                   " FROM " + mMainTableName + " WHERE equivalent = ? ";
+    // record is under conditions only if its contractor contains all requested addresses
+    for (size_t idx = 0; idx < contractorAddresses.size(); idx++) {
+        query += " AND operation_uuid IN (SELECT operation_uuid FROM " + mContractorsTableName
+                 + " WHERE address = ? AND address_type = ?) ";
+    }
+    appendCursorCondition(
+        query,
+        cursor);
+    query += " ORDER BY operation_timestamp DESC, rowid DESC LIMIT ?";
+    // page position is defined either by cursor or by offset, never by both
+    if (cursor == nullptr) {
+        query += " OFFSET ?";
+    }
+    query += ";";
 
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::recordsPortionWithContractor: "
+        throw IOError("HistoryStorage::recordsWithContractor: "
                           "Bad query; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_int(stmt, 1, equivalent);
+    int idxParam = 1;
+    rc = sqlite3_bind_int(stmt, idxParam++, equivalent);
     if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::recordsPortionWithContractor: "
+        throw IOError("HistoryStorage::recordsWithContractor: "
                           "Bad binding of Equivalent; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_int(stmt, 2, (int)recordsCount);
+    for (const auto &address : contractorAddresses) {
+        auto fullAddress = address->fullAddress();
+        rc = sqlite3_bind_text(stmt, idxParam++, fullAddress.c_str(), (int)fullAddress.size(), SQLITE_TRANSIENT);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::recordsWithContractor: "
+                              "Bad binding of Address; sqlite error: " + to_string(rc));
+        }
+        rc = sqlite3_bind_int(stmt, idxParam++, address->typeID());
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::recordsWithContractor: "
+                              "Bad binding of AddressType; sqlite error: " + to_string(rc));
+        }
+    }
+    bindCursor(
+        stmt,
+        idxParam,
+        cursor,
+        "HistoryStorage::recordsWithContractor");
+    rc = sqlite3_bind_int(stmt, idxParam++, (int)recordsCount);
     if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::recordsPortionWithContractor: "
+        throw IOError("HistoryStorage::recordsWithContractor: "
                           "Bad binding of recordsCount; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_int(stmt, 3, (int)fromRecord);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::recordsPortionWithContractor: "
-                          "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+    if (cursor == nullptr) {
+        rc = sqlite3_bind_int(stmt, idxParam, (int)fromRecord);
+        if (rc != SQLITE_OK) {
+            throw IOError("HistoryStorage::recordsWithContractor: "
+                              "Bad binding of fromRecord; sqlite error: " + to_string(rc));
+        }
     }
 
+    GEOEpochTimestamp lastTimestamp = 0;
+    int64_t lastRecordID = 0;
     while (sqlite3_step(stmt) == SQLITE_ROW ) {
+        lastTimestamp = (GEOEpochTimestamp)sqlite3_column_int64(stmt, 1);
+        lastRecordID = sqlite3_column_int64(stmt, 5);
         int recordType = sqlite3_column_int(stmt, 4);
         switch (recordType) {
             case Record::TrustLineRecordType:
@@ -1029,66 +1335,21 @@ vector<Record::Shared> HistoryStorage::recordsPortionWithContractor(
                         stmt));
                 break;
             default:
-                throw ValueError("HistoryStorage::recordsPortionWithContractor: "
+                throw ValueError("HistoryStorage::recordsWithContractor: "
                                      "invalid record type");
         }
     }
+    updateCursor(
+        cursor,
+        lastTimestamp,
+        lastRecordID,
+        result.size() == recordsCount);
 
     sqlite3_reset(stmt);
     sqlite3_finalize(stmt);
     return result;
 }
 
-vector<Record::Shared> HistoryStorage::recordsWithContractor(
-    vector<BaseAddress::Shared> contractorAddresses,
-    const SerializedEquivalent equivalent,
-    size_t recordsCount,
-    size_t fromRecord)
-{
-    vector<Record::Shared> result;
-
-    string query = "SELECT count(*) FROM " + mMainTableName + " WHERE equivalent = ?";
-    sqlite3_stmt *stmt;
-    int rc = sqlite3_prepare_v2(mDataBase, query.c_str(), -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::recordsWithContractor: "
-                          "Bad query; sqlite error: " + to_string(rc));
-    }
-    rc = sqlite3_bind_int(stmt, 1, equivalent);
-    if (rc != SQLITE_OK) {
-        throw IOError("HistoryStorage::recordsWithContractor: "
-                          "Bad binding of Equivalent; sqlite error: " + to_string(rc));
-    }
-    sqlite3_step(stmt);
-    auto allRecordsCount = (size_t)sqlite3_column_int(stmt, 0);
-    sqlite3_reset(stmt);
-    sqlite3_finalize(stmt);
-#ifdef STORAGE_HANDLER_DEBUG_LOG
-    debug() << "all records count: " << allRecordsCount;
-#endif
-    size_t currentOffset = 0;
-    size_t countRecordsUnderConditions = 0;
-    while (result.size() < recordsCount && currentOffset < allRecordsCount) {
-        auto records = recordsPortionWithContractor(
-            equivalent,
-            kPortionRequestSize,
-            currentOffset);
-        for (auto &record : records) {
-            if (record->contractor()->containsAddresses(contractorAddresses)) {
-                countRecordsUnderConditions++;
-                if (countRecordsUnderConditions > fromRecord) {
-                    result.push_back(record);
-                }
-            }
-            if (result.size() >= recordsCount) {
-                break;
-            }
-        }
-        currentOffset += kPortionRequestSize;
-    }
-    return result;
-}
-
 vector<PaymentRecord::Shared> HistoryStorage::paymentRecordsByCommandUUID(
     const CommandUUID &commandUUID)
 {
@@ -1190,6 +1451,63 @@ bool HistoryStorage::whetherOperationWasConducted(
     return result;
 }
 
+void HistoryStorage::appendCursorCondition(
+    string &query,
+    HistoryCursor::Shared cursor) const
+{
+    if (cursor == nullptr or !cursor->isPositioned()) {
+        return;
+    }
+    // first condition allows range scan over operation_timestamp index,
+    // second one skips records of the same timestamp, that were already returned
+    query += " AND operation_timestamp <= ? AND (operation_timestamp < ? OR rowid < ?) ";
+}
+
+void HistoryStorage::bindCursor(
+    sqlite3_stmt *stmt,
+    int &idxParam,
+    HistoryCursor::Shared cursor,
+    const string &errorContext)
+{
+    if (cursor == nullptr or !cursor->isPositioned()) {
+        return;
+    }
+    int rc = sqlite3_bind_int64(stmt, idxParam++, cursor->timestamp());
+    if (rc != SQLITE_OK) {
+        throw IOError(errorContext + ": "
+                          "Bad binding of cursor Timestamp; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_int64(stmt, idxParam++, cursor->timestamp());
+    if (rc != SQLITE_OK) {
+        throw IOError(errorContext + ": "
+                          "Bad binding of cursor Timestamp; sqlite error: " + to_string(rc));
+    }
+    rc = sqlite3_bind_int64(stmt, idxParam++, cursor->recordID());
+    if (rc != SQLITE_OK) {
+        throw IOError(errorContext + ": "
+                          "Bad binding of cursor RecordID; sqlite error: " + to_string(rc));
+    }
+}
+
+void HistoryStorage::updateCursor(
+    HistoryCursor::Shared cursor,
+    GEOEpochTimestamp lastTimestamp,
+    int64_t lastRecordID,
+    bool isPageFull)
+{
+    if (cursor == nullptr) {
+        return;
+    }
+    // empty page (e.g. of zero length) can't move the cursor anywhere
+    if (isPageFull and lastRecordID > 0) {
+        cursor->moveTo(
+            lastTimestamp,
+            lastRecordID);
+    } else {
+        cursor->exhaust();
+    }
+}
+
 TrustLineRecord::Shared HistoryStorage::deserializeTrustLineRecord(
     sqlite3_stmt *stmt)
 {
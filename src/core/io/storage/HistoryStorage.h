@@ -11,6 +11,7 @@
 #include "record/payment/PaymentRecord.h"
 #include "record/trust_line/TrustLineRecord.h"
 #include "record/payment/PaymentAdditionalRecord.h"
+#include "record/base/HistoryCursor.h"
 
 #include "../../../libs/sqlite3/sqlite3.h"
 
@@ -44,7 +45,8 @@ public:
         DateTime timeFrom,
         bool isTimeFromPresent,
         DateTime timeTo,
-        bool isTimeToPresent);
+        bool isTimeToPresent,
+        HistoryCursor::Shared cursor = nullptr);
 
     vector<PaymentRecord::Shared> allPaymentRecords(
         const SerializedEquivalent equivalent,
@@ -57,7 +59,8 @@ public:
         const TrustLineAmount& lowBoundaryAmount,
         bool isLowBoundaryAmountPresent,
         const TrustLineAmount& highBoundaryAmount,
-        bool isHighBoundaryAmountPresent);
+        bool isHighBoundaryAmountPresent,
+        HistoryCursor::Shared cursor = nullptr);
 
     vector<PaymentRecord::Shared> paymentRecordsAllEquivalents(
         size_t recordsCount,
@@ -88,13 +91,15 @@ public:
         const TrustLineAmount& lowBoundaryAmount,
         bool isLowBoundaryAmountPresent,
         const TrustLineAmount& highBoundaryAmount,
-        bool isHighBoundaryAmountPresent);
+        bool isHighBoundaryAmountPresent,
+        HistoryCursor::Shared cursor = nullptr);
 
     vector<Record::Shared> recordsWithContractor(
         vector<BaseAddress::Shared> contractorAddresses,
         const SerializedEquivalent equivalent,
         size_t recordsCount,
-        size_t fromRecord);
+        size_t fromRecord,
+        HistoryCursor::Shared cursor = nullptr);
 
     bool whetherOperationWasConducted(
         const TransactionUUID &transactionUUID);
@@ -106,43 +111,46 @@ private:
     void savePaymentMainIncomingRecord(
         PaymentRecord::Shared record);
 
-    vector<PaymentRecord::Shared> allPaymentRecords(
-        const SerializedEquivalent equivalent,
-        size_t recordsCount,
-        size_t fromRecord,
-        DateTime timeFrom,
-        bool isTimeFromPresent,
-        DateTime timeTo,
-        bool isTimeToPresent);
+    void migrateToColumnarFields(
+        bool isMainTableMigrationRequired,
+        bool isAdditionalTableMigrationRequired);
 
-    vector<PaymentRecord::Shared> paymentRecordsAllEquivalents(
-        size_t recordsCount,
-        size_t fromRecord,
-        DateTime timeFrom,
-        bool isTimeFromPresent,
-        DateTime timeTo,
-        bool isTimeToPresent);
+    void migrateMainTableToColumnarFields();
 
-    vector<PaymentAdditionalRecord::Shared> allPaymentAdditionalRecords(
-        const SerializedEquivalent equivalent,
-        size_t recordsCount,
-        size_t fromRecord,
-        DateTime timeFrom,
-        bool isTimeFromPresent,
-        DateTime timeTo,
-        bool isTimeToPresent);
+    void migrateAdditionalTableToColumnarFields();
 
-    size_t countRecordsByType(
-        Record::RecordType recordType,
-        const SerializedEquivalent equivalent);
+    void updateRecordAmount(
+        const string &tableName,
+        sqlite3_int64 rowID,
+        const TrustLineAmount &amount);
 
-    size_t countRecordsByTypeAllEquivalents(
-        Record::RecordType recordType);
+    void saveRecordContractor(
+        const TransactionUUID &operationUUID,
+        Contractor::Shared contractor);
 
-    vector<Record::Shared> recordsPortionWithContractor(
-        const SerializedEquivalent equivalent,
-        size_t recordsCount,
-        size_t fromRecord);
+    void appendCursorCondition(
+        string &query,
+        HistoryCursor::Shared cursor) const;
+
+    void bindCursor(
+        sqlite3_stmt *stmt,
+        int &idxParam,
+        HistoryCursor::Shared cursor,
+        const string &errorContext);
+
+    void updateCursor(
+        HistoryCursor::Shared cursor,
+        GEOEpochTimestamp lastTimestamp,
+        int64_t lastRecordID,
+        bool isPageFull);
+
+    bool isColumnPresent(
+        const string &tableName,
+        const string &columnName);
+
+    void executeQuery(
+        const string &query,
+        const string &errorContext);
 
     TrustLineRecord::Shared deserializeTrustLineRecord(
         sqlite3_stmt *stmt);
@@ -162,9 +170,6 @@ private:
 
     const string logHeader() const;
 
-private:
-    const size_t kPortionRequestSize = 1000;
-
 private:
     sqlite3 *mDataBase = nullptr;
     // main table used for storing history, needed for frontend
@@ -173,6 +178,8 @@ private:
     // additional table used for storing history, needed for statistics
     // (cycles and payment intermediate nodes)
     string mAdditionalTableName;
+    // addresses of contractors of main table records, used for filtering records by contractor
+    string mContractorsTableName;
     Logger &mLog;
 };
 
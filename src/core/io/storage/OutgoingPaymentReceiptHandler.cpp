@@ -148,11 +148,8 @@ vector<pair<TransactionUUID, TrustLineAmount>> OutgoingPaymentReceiptHandler::au
             (byte*)sqlite3_column_blob(stmt, 0));
 
         auto amountBytes = (byte*)sqlite3_column_blob(stmt, 1);
-        vector<byte> amountBufferBytes(
-            amountBytes,
-            amountBytes + kTrustLineAmountBytesCount);
         auto amount = bytesToTrustLineAmount(
-            amountBufferBytes);
+            amountBytes);
 
         result.emplace_back(
             transactionUUID,
@@ -78,7 +78,9 @@ void OwnKeysHandler::saveKey(
         throw IOError("OwnKeysHandler::saveKey: "
                           "Bad query; sqlite error: " + to_string(rc));
     }
-    rc = sqlite3_bind_blob(stmt, 1, publicKey->hash()->data(),
+    // hash is bound statically, so it must outlive the query
+    const auto kKeyHash = publicKey->hash();
+    rc = sqlite3_bind_blob(stmt, 1, kKeyHash->data(),
                            (int) KeyHash::kBytesSize, SQLITE_STATIC);
     if (rc != SQLITE_OK) {
         throw IOError("OwnKeysHandler::saveKey: "
@@ -46,6 +46,7 @@ StorageHandler::~StorageHandler()
 {
     if (mDBConnection != nullptr) {
         sqlite3_close_v2(mDBConnection);
+        mDBConnection = nullptr;
     }
 }
 
@@ -52,22 +52,16 @@ AuditRecord::AuditRecord(
         sizeof(AuditNumber));
     bytesBufferOffset += sizeof(AuditNumber);
 
-    vector<byte> incomingAmountBytes(
-        buffer + bytesBufferOffset,
-        buffer + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mIncomingAmount = bytesToTrustLineAmount(incomingAmountBytes);
+    mIncomingAmount = bytesToTrustLineAmount(
+        buffer + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> outgoingAmountBytes(
-        buffer + bytesBufferOffset,
-        buffer + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mOutgoingAmount = bytesToTrustLineAmount(outgoingAmountBytes);
+    mOutgoingAmount = bytesToTrustLineAmount(
+        buffer + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> balanceBytes(
-        buffer + bytesBufferOffset,
-        buffer + bytesBufferOffset + kTrustLineBalanceSerializeBytesCount);
-    mBalance = bytesToTrustLineBalance(balanceBytes);
+    mBalance = bytesToTrustLineBalance(
+        buffer + bytesBufferOffset);
     bytesBufferOffset += kTrustLineBalanceSerializeBytesCount;
 
     mOwnKeyHash = make_shared<lamport::KeyHash>(
@@ -170,28 +164,19 @@ BytesShared AuditRecord::serializeToBytes()
         sizeof(AuditNumber));
     dataBytesOffset += sizeof(AuditNumber);
 
-    vector<byte> incomingAmountBufferBytes = trustLineAmountToBytes(
-        mIncomingAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        incomingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mIncomingAmount,
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> outgoingAmountBufferBytes = trustLineAmountToBytes(
-        mOutgoingAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        outgoingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mOutgoingAmount,
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> balanceBufferBytes = trustLineBalanceToBytes(
-        const_cast<TrustLineBalance&>(mBalance));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        balanceBufferBytes.data(),
-        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToBytes(
+        const_cast<TrustLineBalance&>(mBalance),
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineBalanceSerializeBytesCount;
 
     memcpy(
@@ -231,28 +216,19 @@ BytesShared AuditRecord::serializeToCheckSignatureByInitiator()
         sizeof(AuditNumber));
     dataBytesOffset += sizeof(AuditNumber);
 
-    vector<byte> incomingAmountBufferBytes = trustLineAmountToBytes(
-        mIncomingAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        incomingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mIncomingAmount,
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> outgoingAmountBufferBytes = trustLineAmountToBytes(
-        mOutgoingAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        outgoingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mOutgoingAmount,
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> balanceBufferBytes = trustLineBalanceToBytes(
-        const_cast<TrustLineBalance&>(mBalance));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        balanceBufferBytes.data(),
-        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToBytes(
+        const_cast<TrustLineBalance&>(mBalance),
+        dataBytesShared.get() + dataBytesOffset);
 
     return dataBytesShared;
 }
@@ -268,29 +244,20 @@ BytesShared AuditRecord::serializeToCheckSignatureByContractor()
         sizeof(AuditNumber));
     dataBytesOffset += sizeof(AuditNumber);
 
-    vector<byte> outgoingAmountBufferBytes = trustLineAmountToBytes(
-        mOutgoingAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        outgoingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mOutgoingAmount,
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> incomingAmountBufferBytes = trustLineAmountToBytes(
-        mIncomingAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        incomingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mIncomingAmount,
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
     auto contractorBalance = -1 * mBalance;
-    vector<byte> balanceBufferBytes = trustLineBalanceToBytes(
-        const_cast<TrustLineBalance&>(contractorBalance));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        balanceBufferBytes.data(),
-        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToBytes(
+        const_cast<TrustLineBalance&>(contractorBalance),
+        dataBytesShared.get() + dataBytesOffset);
 
     return dataBytesShared;
 }
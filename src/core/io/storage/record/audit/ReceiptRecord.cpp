@@ -14,7 +14,8 @@ ReceiptRecord::ReceiptRecord(
 {}
 
 ReceiptRecord::ReceiptRecord(
-    byte* buffer)
+    byte* buffer) :
+    mTransactionUUID(TransactionUUID::kNil)
 {
     auto bytesBufferOffset = 0;
     memcpy(
@@ -29,10 +30,8 @@ ReceiptRecord::ReceiptRecord(
         TransactionUUID::kBytesSize);
     bytesBufferOffset += TransactionUUID::kBytesSize;
 
-    vector<byte> amountBytes(
-        buffer + bytesBufferOffset,
-        buffer + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mAmount = bytesToTrustLineAmount(amountBytes);
+    mAmount = bytesToTrustLineAmount(
+        buffer + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
     mKeyHash = make_shared<lamport::KeyHash>(
@@ -85,12 +84,9 @@ BytesShared ReceiptRecord::serializeToBytes()
         TransactionUUID::kBytesSize);
     dataBytesOffset += TransactionUUID::kBytesSize;
 
-    vector<byte> amountBufferBytes = trustLineAmountToBytes(
-        mAmount);
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        amountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mAmount,
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
     memcpy(
@@ -0,0 +1,70 @@
+#include "HistoryCursor.h"
+
+const string HistoryCursor::kFirstPageToken = "null";
+const string HistoryCursor::kExhaustedToken = "end";
+
+HistoryCursor::HistoryCursor() :
+    mTimestamp(0),
+    mRecordID(0),
+    mIsPositioned(false),
+    mIsExhausted(false)
+{}
+
+HistoryCursor::HistoryCursor(
+    GEOEpochTimestamp timestamp,
+    int64_t recordID) :
+
+    mTimestamp(timestamp),
+    mRecordID(recordID),
+    mIsPositioned(true),
+    mIsExhausted(false)
+{}
+
+const bool HistoryCursor::isPositioned() const
+{
+    return mIsPositioned;
+}
+
+const bool HistoryCursor::isExhausted() const
+{
+    return mIsExhausted;
+}
+
+const GEOEpochTimestamp HistoryCursor::timestamp() const
+{
+    return mTimestamp;
+}
+
+const int64_t HistoryCursor::recordID() const
+{
+    return mRecordID;
+}
+
+void HistoryCursor::moveTo(
+    GEOEpochTimestamp timestamp,
+    int64_t recordID)
+{
+    mTimestamp = timestamp;
+    mRecordID = recordID;
+    mIsPositioned = true;
+    mIsExhausted = false;
+}
+
+void HistoryCursor::exhaust()
+{
+    mTimestamp = 0;
+    mRecordID = 0;
+    mIsPositioned = false;
+    mIsExhausted = true;
+}
+
+const string HistoryCursor::toString() const
+{
+    if (mIsExhausted) {
+        return kExhaustedToken;
+    }
+    if (!mIsPositioned) {
+        return kFirstPageToken;
+    }
+    return to_string(mTimestamp) + ":" + to_string(mRecordID);
+}
@@ -0,0 +1,64 @@
+#ifndef GEO_NETWORK_CLIENT_HISTORYCURSOR_H
+#define GEO_NETWORK_CLIENT_HISTORYCURSOR_H
+
+#include "../../../../common/time/TimeUtils.h"
+
+#include <memory>
+#include <string>
+
+using namespace std;
+
+/*
+ * Position of the last record of the history page, used for keyset pagination.
+ * The client receives it together with the page and sends it back in the next request,
+ * so the next page is read through the timestamp index starting from (operation_timestamp, rowid),
+ * and its cost doesn't depend on how deep the page is.
+ *
+ * Text form of the cursor (both in requests and in results):
+ *  "null" - before the newest record (first page);
+ *  "<timestamp>:<recordID>" - after the last record of the previous page;
+ *  "end" - there are no more records, reading by this cursor returns empty page.
+ */
+class HistoryCursor {
+
+public:
+    typedef shared_ptr<HistoryCursor> Shared;
+
+public:
+    // cursor, that points before the newest record
+    HistoryCursor();
+
+    HistoryCursor(
+        GEOEpochTimestamp timestamp,
+        int64_t recordID);
+
+    const bool isPositioned() const;
+
+    const bool isExhausted() const;
+
+    const GEOEpochTimestamp timestamp() const;
+
+    const int64_t recordID() const;
+
+    void moveTo(
+        GEOEpochTimestamp timestamp,
+        int64_t recordID);
+
+    // there are no records after the cursor
+    void exhaust();
+
+    const string toString() const;
+
+public:
+    static const string kFirstPageToken;
+    static const string kExhaustedToken;
+
+private:
+    GEOEpochTimestamp mTimestamp;
+    int64_t mRecordID;
+    bool mIsPositioned;
+    bool mIsExhausted;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_HISTORYCURSOR_H
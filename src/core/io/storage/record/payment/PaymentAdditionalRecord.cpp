@@ -33,11 +33,8 @@ PaymentAdditionalRecord::PaymentAdditionalRecord(
         PaymentAdditionalRecord::SerializedPaymentOperationType);
     mPaymentOperationType = (PaymentAdditionalOperationType)*operationType;
 
-    vector<byte> amountBytes(
-        recordBody.get() + dataBufferOffset,
-        recordBody.get() + dataBufferOffset + kTrustLineAmountBytesCount);
     mAmount = bytesToTrustLineAmount(
-        amountBytes);
+        recordBody.get() + dataBufferOffset);
     dataBufferOffset += kTrustLineAmountBytesCount;
 
     uint16_t outgoingTransfersCount;
@@ -124,11 +121,9 @@ pair<BytesShared, size_t> PaymentAdditionalRecord::serializedHistoryRecordBody()
         sizeof(SerializedPaymentOperationType));
     bytesBufferOffset += sizeof(SerializedPaymentOperationType);
 
-    auto trustAmountBytes = trustLineAmountToBytes(mAmount);
-    memcpy(
-        bytesBuffer.get() + bytesBufferOffset,
-        trustAmountBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mAmount,
+        bytesBuffer.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
     auto outgoingTransfersCount = (uint16_t)mOutgoingTransfers.size();
@@ -146,11 +141,9 @@ pair<BytesShared, size_t> PaymentAdditionalRecord::serializedHistoryRecordBody()
                 sizeof(ContractorID));
         bytesBufferOffset += sizeof(ContractorID);
 
-        auto transferAmountBytes = trustLineAmountToBytes(outgoingTransfer.second);
-        memcpy(
-                bytesBuffer.get() + bytesBufferOffset,
-                transferAmountBytes.data(),
-                kTrustLineAmountBytesCount);
+        trustLineAmountToBytes(
+            outgoingTransfer.second,
+            bytesBuffer.get() + bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
     }
 
@@ -169,11 +162,9 @@ pair<BytesShared, size_t> PaymentAdditionalRecord::serializedHistoryRecordBody()
             sizeof(ContractorID));
         bytesBufferOffset += sizeof(ContractorID);
 
-        auto transferAmountBytes = trustLineAmountToBytes(incomingTransfer.second);
-        memcpy(
-            bytesBuffer.get() + bytesBufferOffset,
-            transferAmountBytes.data(),
-            kTrustLineAmountBytesCount);
+        trustLineAmountToBytes(
+            incomingTransfer.second,
+            bytesBuffer.get() + bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
     }
 
@@ -73,18 +73,12 @@ PaymentRecord::PaymentRecord(
         recordBody.get() + dataBufferOffset);
     dataBufferOffset += mContractor->serializedSize();
 
-    vector<byte> amountBytes(
-        recordBody.get() + dataBufferOffset,
-        recordBody.get() + dataBufferOffset + kTrustLineAmountBytesCount);
     mAmount = bytesToTrustLineAmount(
-        amountBytes);
+        recordBody.get() + dataBufferOffset);
     dataBufferOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> balanceBytes(
-        recordBody.get() + dataBufferOffset,
-        recordBody.get() + dataBufferOffset + kTrustLineBalanceSerializeBytesCount);
     mBalanceAfterOperation = bytesToTrustLineBalance(
-        balanceBytes);
+        recordBody.get() + dataBufferOffset);
     dataBufferOffset += kTrustLineBalanceSerializeBytesCount;
 
     uint16_t outgoingTransfersCount;
@@ -221,18 +215,14 @@ pair<BytesShared, size_t> PaymentRecord::serializedHistoryRecordBody() const
         mContractor->serializedSize());
     bytesBufferOffset += mContractor->serializedSize();
 
-    auto trustAmountBytes = trustLineAmountToBytes(mAmount);
-    memcpy(
-        bytesBuffer.get() + bytesBufferOffset,
-        trustAmountBytes.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        mAmount,
+        bytesBuffer.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
-    auto trustBalanceBytes = trustLineBalanceToBytes(mBalanceAfterOperation);
-    memcpy(
-        bytesBuffer.get() + bytesBufferOffset,
-        trustBalanceBytes.data(),
-        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToBytes(
+        mBalanceAfterOperation,
+        bytesBuffer.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineBalanceSerializeBytesCount;
 
     auto outgoingTransfersCount = (uint16_t)mOutgoingTransfers.size();
@@ -250,11 +240,9 @@ pair<BytesShared, size_t> PaymentRecord::serializedHistoryRecordBody() const
             sizeof(ContractorID));
         bytesBufferOffset += sizeof(ContractorID);
 
-        auto transferAmountBytes = trustLineAmountToBytes(outgoingTransfer.second);
-        memcpy(
-            bytesBuffer.get() + bytesBufferOffset,
-            transferAmountBytes.data(),
-            kTrustLineAmountBytesCount);
+        trustLineAmountToBytes(
+            outgoingTransfer.second,
+            bytesBuffer.get() + bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
     }
 
@@ -273,11 +261,9 @@ pair<BytesShared, size_t> PaymentRecord::serializedHistoryRecordBody() const
             sizeof(ContractorID));
         bytesBufferOffset += sizeof(ContractorID);
 
-        auto transferAmountBytes = trustLineAmountToBytes(incomingTransfer.second);
-        memcpy(
-            bytesBuffer.get() + bytesBufferOffset,
-            transferAmountBytes.data(),
-            kTrustLineAmountBytesCount);
+        trustLineAmountToBytes(
+            incomingTransfer.second,
+            bytesBuffer.get() + bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
     }
 
@@ -3,6 +3,8 @@
 
 Communicator::Communicator(
     IOService &IOService,
+    TimerService *timerService,
+    WorkersPool *workersPool,
     Host host,
     Port port,
     ContractorsManager *contractorsManager,
@@ -67,6 +69,8 @@ Communicator::Communicator(
     mIncomingMessagesHandler =
         make_unique<IncomingMessagesHandler>(
             IOService,
+            timerService,
+            workersPool,
             *mSocket,
             contractorsManager,
             tailManager,
@@ -75,6 +79,7 @@ Communicator::Communicator(
     mOutgoingMessagesHandler =
         make_unique<OutgoingMessagesHandler>(
             IOService,
+            timerService,
             *mSocket,
             contractorsManager,
             providingHandler,
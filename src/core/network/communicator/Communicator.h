@@ -29,6 +29,8 @@ public:
 public:
     explicit Communicator(
         IOService &ioService,
+        TimerService *timerService,
+        WorkersPool *workersPool,
         Host host,
         Port port,
         ContractorsManager *contractorsManager,
@@ -2,15 +2,14 @@
 
 
 IncomingChannel::IncomingChannel(
-    MessagesParser &messagesParser,
     TimePoint &nodeHandlerLastUpdate,
     Logger &logger)
     noexcept :
 
     mLastRemoteNodeHandlerUpdated(nodeHandlerLastUpdate),
-    mMessagesParser(messagesParser),
     mLog(logger),
-    mExpectedPacketsCount(0)
+    mExpectedPacketsCount(0),
+    mBufferedBytesCount(0)
 {}
 
 IncomingChannel::~IncomingChannel()
@@ -67,6 +66,7 @@ void IncomingChannel::addPacket(
     // To prevent memory leak - previous packet must be dropped.
     if (mPackets.count(index) > 0){
         free(mPackets[index].first);
+        mBufferedBytesCount -= mPackets[index].second;
     }
 
     memcpy(
@@ -77,15 +77,16 @@ void IncomingChannel::addPacket(
     mPackets[index] = make_pair(
         buffer,
         bytesCount);
+    mBufferedBytesCount += bytesCount;
 
     mLastPacketReceived = chrono::steady_clock::now();
     mLastRemoteNodeHandlerUpdated = mLastPacketReceived;
 }
 
-pair<bool, Message::Shared> IncomingChannel::tryCollectMessage()
+pair<BytesShared, size_t> IncomingChannel::tryCollectMessage()
 {
     if (receivedPacketsCount() != expectedPacketsCount()) {
-        return make_pair(false, Message::Shared(nullptr));
+        return make_pair(nullptr, 0);
     }
 
     size_t totalBytesReceived = 0;
@@ -132,10 +133,10 @@ pair<bool, Message::Shared> IncomingChannel::tryCollectMessage()
             << "CRC of the received packet doesn't equal to the expected one";
 #endif
 
-        return make_pair(false, Message::Shared(nullptr));
+        return make_pair(nullptr, 0);
     }
 
-    return mMessagesParser.processBytesSequence(
+    return make_pair(
         buffer,
         totalBytesReceived - Packet::kCRCChecksumBytesCount);
 }
@@ -150,6 +151,7 @@ void IncomingChannel::clear()
         free(kIndexAndPacketData.second.first);
     }
     mPackets.clear();
+    mBufferedBytesCount = 0;
 }
 
 Packet::Size IncomingChannel::receivedPacketsCount() const
@@ -164,6 +166,12 @@ Packet::Size IncomingChannel::expectedPacketsCount() const
     return mExpectedPacketsCount;
 }
 
+size_t IncomingChannel::bufferedBytesCount() const
+    noexcept
+{
+    return mBufferedBytesCount;
+}
+
 const TimePoint &IncomingChannel::lastUpdated() const
     noexcept
 {
@@ -1,12 +1,12 @@
 #ifndef GEO_NETWORK_CLIENT_INCOMINGCHANNEL_H
 #define GEO_NETWORK_CLIENT_INCOMINGCHANNEL_H
 
-#include "MessageParser.h"
 #include "../common/Types.h"
 #include "../common/Packet.hpp"
 
 #include "../../../messages/Message.hpp"
 #include "../../../../common/memory/MemoryUtils.h"
+#include "../../../../logger/Logger.h"
 #include "../../../../common/exceptions/ConflictError.h"
 
 #include <boost/unordered_map.hpp>
@@ -28,7 +28,6 @@ public:
 
 public:
     IncomingChannel(
-        MessagesParser &messageParser,
         TimePoint &nodeHandlerLastUpdate,
         Logger &logger)
         noexcept;
@@ -49,7 +48,12 @@ public:
         const PacketHeader::PacketSize count)
         noexcept(false);
 
-    pair<bool, Message::Shared> tryCollectMessage();
+    /**
+     * @returns bytes of the message (without CRC) if all its packets are received and CRC is correct,
+     * otherwise - nullptr.
+     * Bytes are not parsed here: parsing is done by IncomingMessagesHandler.
+     */
+    pair<BytesShared, size_t> tryCollectMessage();
 
     Packet::Size receivedPacketsCount() const
         noexcept;
@@ -57,6 +61,10 @@ public:
     Packet::Size expectedPacketsCount() const
         noexcept;
 
+    // total size of packets, buffered by the channel
+    size_t bufferedBytesCount() const
+        noexcept;
+
     const TimePoint& lastUpdated() const
         noexcept;
 
@@ -64,9 +72,9 @@ protected:
     TimePoint mLastPacketReceived;
     TimePoint &mLastRemoteNodeHandlerUpdated;
 
-    MessagesParser &mMessagesParser;
     Logger &mLog;
     Packet::Size mExpectedPacketsCount;
+    size_t mBufferedBytesCount;
 
     boost::unordered_map<PacketHeader::PacketIndex, pair<void*, PacketHeader::PacketSize>> mPackets;
 };
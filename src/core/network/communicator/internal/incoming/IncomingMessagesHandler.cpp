@@ -3,6 +3,8 @@
 
 IncomingMessagesHandler::IncomingMessagesHandler(
     IOService &ioService,
+    TimerService *timerService,
+    WorkersPool *workersPool,
     UDPSocket &socket,
     ContractorsManager *contractorsManager,
     TailManager *tailManager,
@@ -15,11 +17,11 @@ IncomingMessagesHandler::IncomingMessagesHandler(
     mMessagesParser(contractorsManager, &logger),
 
     mTailManager(tailManager),
+    mWorkersPool(workersPool),
     mRemoteNodesHandler(
-        mMessagesParser,
-        mTailManager,
         mLog),
-    mCleaningTimer(ioService)
+    mCleaningTimer(timerService),
+    mReportedDroppedPacketsCount(0)
 {
 #ifdef ENGINE_TYPE_DC
     // Builds Data centers may have signifficantly larger read socket buffer.
@@ -35,8 +37,6 @@ IncomingMessagesHandler::IncomingMessagesHandler(
 
     boost::asio::socket_base::receive_buffer_size option(kMaxReadSocketSize);
     mSocket.set_option(option);
-
-    rescheduleCleaning();
 }
 
 void IncomingMessagesHandler::beginReceivingData ()
@@ -80,18 +80,10 @@ void IncomingMessagesHandler::handleReceivedInfo(
 
     try {
         auto remoteNodeHandler = mRemoteNodesHandler.handler(mRemoteEndpointBuffer);
-        if (remoteNodeHandler->isBanned()) {
-            info() << bytesTransferred <<  "B \tRX  [ <= ] from "
-                   << mRemoteEndpointBuffer.address().to_string()
-                   << ". IGNORED!";
-
-            beginReceivingData();
-            return;
-
-        } else {
-
+        // datagram of the new node is dropped (and counted), if there are too many remote nodes now
+        if (remoteNodeHandler != nullptr) {
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
-            if (mIncomingBuffer.size() > PacketHeader::kSize) {
+            if (bytesTransferred > PacketHeader::kSize and not remoteNodeHandler->isBanned()) {
                 const PacketHeader::ChannelIndex kChannelIndex =
                     *(reinterpret_cast<PacketHeader::ChannelIndex*>(
                         mIncomingBuffer.data() + PacketHeader::kChannelIndexOffset));
@@ -113,18 +105,19 @@ void IncomingMessagesHandler::handleReceivedInfo(
             }
 #endif
 
+            // Packets of banned nodes (or nodes, which exceed their budgets) are dropped and counted by their handlers.
             remoteNodeHandler->processIncomingBytesSequence(
                 mIncomingBuffer.data(),
                 bytesTransferred);
 
-            // Sending all collected messages (if exists) for further processing.
+            // Sending all collected messages (if exists) for parsing.
             for (;;) {
-                auto message = remoteNodeHandler->popNextMessage();
-                if (message != nullptr) {
-                    stringstream ss;
-                    ss << mRemoteEndpointBuffer.address().to_string() << ":" << mRemoteEndpointBuffer.port();
-                    message->setSenderIncomingIP(ss.str());
-                    signalMessageParsed(message);
+                auto messageBytes = remoteNodeHandler->popNextMessage();
+                if (messageBytes.first != nullptr) {
+                    parseMessage(
+                        mRemoteEndpointBuffer,
+                        messageBytes.first,
+                        messageBytes.second);
                 }
                 else {
                     break;
@@ -136,18 +129,125 @@ void IncomingMessagesHandler::handleReceivedInfo(
         error() << e.what();
     }
 
+    if (!mCleaningTimer.isPending()) {
+        rescheduleCleaning();
+    }
 
     // In all cases - messages receiving should be continued.
     beginReceivingData();
 }
 
+void IncomingMessagesHandler::parseMessage(
+    const UDPEndpoint &endpoint,
+    BytesShared bytes,
+    size_t count)
+{
+    const auto kFlagAndCryptoKey = mMessagesParser.decryptionKey(
+        bytes,
+        count);
+    if (!kFlagAndCryptoKey.first) {
+        return;
+    }
+
+    const auto kSequenceNumber = mParsingQueues[endpoint].enqueue();
+    const auto kCryptoKey = kFlagAndCryptoKey.second;
+    // endpoint is copied, because receiving buffer would be overwritten by the next datagram
+    const auto kEndpoint = endpoint;
+    mWorkersPool->post<MessagesParser::ParsedMessage>(
+        [bytes, count, kCryptoKey]() {
+            return MessagesParser::parse(
+                bytes,
+                count,
+                kCryptoKey);
+        },
+        [this, kEndpoint, kSequenceNumber](MessagesParser::ParsedMessage parsedMessage) {
+            onMessageParsed(
+                kEndpoint,
+                kSequenceNumber,
+                parsedMessage);
+        },
+        [this, kEndpoint, kSequenceNumber](const string &error) {
+            // sequence number must be delivered anyway, otherwise next messages of the endpoint would wait for it
+            onMessageParsed(
+                kEndpoint,
+                kSequenceNumber,
+                {nullptr, "parsing failed: " + error});
+        });
+}
+
+void IncomingMessagesHandler::onMessageParsed(
+    const UDPEndpoint &endpoint,
+    uint64_t sequenceNumber,
+    const MessagesParser::ParsedMessage &parsedMessage)
+{
+    auto parsingQueueIt = mParsingQueues.find(endpoint);
+    if (parsingQueueIt == mParsingQueues.end()) {
+        error() << "onMessageParsed: there is no parsing queue for " << endpoint;
+        return;
+    }
+    if (parsedMessage.mMessage == nullptr) {
+        warning() << "Message from " << endpoint << " is dropped: " << parsedMessage.mError;
+    }
+
+    auto &parsingQueue = parsingQueueIt->second;
+    for (const auto &message : parsingQueue.onParsed(sequenceNumber, parsedMessage.mMessage)) {
+        deliverMessage(
+            endpoint,
+            message);
+    }
+
+    if (parsingQueue.isEmpty()) {
+        mParsingQueues.erase(parsingQueueIt);
+    }
+}
+
+void IncomingMessagesHandler::deliverMessage(
+    const UDPEndpoint &endpoint,
+    Message::Shared message)
+{
+    stringstream ss;
+    ss << endpoint.address().to_string() << ":" << endpoint.port();
+    message->setSenderIncomingIP(ss.str());
+
+    switch (message->typeID()) {
+        case Message::MaxFlow_ResultMaxFlowCalculation:
+        case Message::MaxFlow_ResultMaxFlowCalculationFromGateway: {
+            mTailManager->getFlowTail(
+                message->equivalent()).push(message);
+            break;
+        }
+        case Message::Cycles_FiveNodesBoundary: {
+            // boundary messages are processed only by cycles building transactions via tail
+            mTailManager->getCyclesFiveTail(
+                message->equivalent()).push(message);
+            return;
+        }
+        case Message::Cycles_SixNodesBoundary: {
+            mTailManager->getCyclesSixTail(
+                message->equivalent()).push(message);
+            return;
+        }
+        case Message::RoutingTableResponse: {
+            mTailManager->getRoutingTableTail().push(message);
+            break;
+        }
+        default:
+            break;
+    }
+    signalMessageParsed(message);
+}
+
 void IncomingMessagesHandler::rescheduleCleaning()
     noexcept
 {
-    const auto kCleaningInterval = boost::posix_time::seconds(30);
+    if (mRemoteNodesHandler.empty()) {
+        mCleaningTimer.cancel();
+        return;
+    }
+
+    const auto kCleaningInterval = chrono::seconds(30);
 
-    mCleaningTimer.expires_from_now(kCleaningInterval);
-    mCleaningTimer.async_wait([this] (const boost::system::error_code &_) {
+    mCleaningTimer.expiresFromNow(kCleaningInterval, [this] () {
 
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR_GARBAGE_COLLECTOR
         this->debug() << "Automatic cleaning started";
@@ -155,6 +255,7 @@ void IncomingMessagesHandler::rescheduleCleaning()
 
         this->mRemoteNodesHandler.removeOutdatedEndpoints();
         this->mRemoteNodesHandler.removeOutdatedChannelsOfPresentEndpoints();
+        this->reportDroppedPackets();
 
         this->rescheduleCleaning();
 
@@ -164,6 +265,17 @@ void IncomingMessagesHandler::rescheduleCleaning()
     });
 }
 
+void IncomingMessagesHandler::reportDroppedPackets()
+{
+    const auto kDroppedPacketsCount = mRemoteNodesHandler.droppedPacketsCount();
+    if (kDroppedPacketsCount == mReportedDroppedPacketsCount) {
+        return;
+    }
+    warning() << kDroppedPacketsCount - mReportedDroppedPacketsCount << " packets were dropped since previous report, "
+              << kDroppedPacketsCount << " packets were dropped in total";
+    mReportedDroppedPacketsCount = kDroppedPacketsCount;
+}
+
 string IncomingMessagesHandler::logHeader()
     noexcept
 {
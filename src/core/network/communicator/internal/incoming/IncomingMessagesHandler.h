@@ -3,15 +3,26 @@
 
 #include "../common/Types.h"
 #include "../../internal/incoming/IncomingNodesHandler.h"
+#include "../../internal/incoming/MessageParser.h"
+#include "../../internal/incoming/ParsingQueue.h"
+#include "../../internal/incoming/TailManager.h"
 #include "../../../../common/exceptions/ValueError.h"
 #include "../../../../common/exceptions/ConflictError.h"
+#include "../../../../common/time/TimerService.h"
+#include "../../../../common/workers/WorkersPool.h"
 
 #include <boost/asio/steady_timer.hpp>
 
+#include <map>
+
 
 using namespace std;
 
 
+/**
+ * Collected messages are decrypted and parsed in workers pool in parallel.
+ * Parsed messages are delivered on the main thread in order of their receiving from each remote node.
+ */
 class IncomingMessagesHandler {
 public:
     signals::signal<void(Message::Shared)> signalMessageParsed;
@@ -19,6 +30,8 @@ public:
 public:
     IncomingMessagesHandler(
         IOService &ioService,
+        TimerService *timerService,
+        WorkersPool *workersPool,
         UDPSocket &socket,
         ContractorsManager *contractorsManager,
         TailManager *tailManager,
@@ -34,9 +47,28 @@ protected:
         size_t bytesTransferred)
         noexcept;
 
+    void parseMessage(
+        const UDPEndpoint &endpoint,
+        BytesShared bytes,
+        size_t count);
+
+    void onMessageParsed(
+        const UDPEndpoint &endpoint,
+        uint64_t sequenceNumber,
+        const MessagesParser::ParsedMessage &parsedMessage);
+
+    void deliverMessage(
+        const UDPEndpoint &endpoint,
+        Message::Shared message);
+
+    // Cleaning is scheduled only while there are handlers of remote nodes,
+    // so idle node is not woken up for it.
     void rescheduleCleaning()
         noexcept;
 
+    // dropped packets are reported by cleaning, instead of reporting of each of them
+    void reportDroppedPackets();
+
     static string logHeader()
         noexcept;
 
@@ -59,6 +91,7 @@ protected:
     UDPSocket &mSocket;
     IOService &mIOService;
     TailManager *mTailManager;
+    WorkersPool *mWorkersPool;
     Logger &mLog;
 
     boost::array<byte, kMaxIncomingBufferSize> mIncomingBuffer;
@@ -67,7 +100,12 @@ protected:
     MessagesParser mMessagesParser;
     IncomingNodesHandler mRemoteNodesHandler;
 
-    boost::asio::deadline_timer mCleaningTimer;
+    // remote nodes, which have messages in parsing process
+    map<UDPEndpoint, ParsingQueue> mParsingQueues;
+
+    TimerService::Timer mCleaningTimer;
+
+    size_t mReportedDroppedPacketsCount;
 };
 
 #endif //GEO_NETWORK_CLIENT_INCOMINGCONNECTIONSHANDLER_H
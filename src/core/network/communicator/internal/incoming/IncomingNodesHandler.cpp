@@ -2,38 +2,33 @@
 
 
 IncomingNodesHandler::IncomingNodesHandler(
-    MessagesParser &messagesParser,
-    TailManager *tailManager,
     Logger &logger)
     noexcept :
 
-    mMessagesParser(messagesParser),
-    mTailManager(tailManager),
-    mLog(logger)
+    mLog(logger),
+    mRemovedNodesDroppedPacketsCount(0)
 {}
 
-/**
- * @returns handler for processing incoming traffic from the remote node.
- *
- * @param endpoint - UDP endpoint of the remote node.
- */
 IncomingRemoteNode* IncomingNodesHandler::handler (
     const UDPEndpoint &endpoint)
     noexcept
 {
     const auto kEndpointKey = key(endpoint);
 
-    if (mNodes.count(kEndpointKey) == 0) {
-        mNodes.emplace(
-            kEndpointKey,
-            make_unique<IncomingRemoteNode>(
-                endpoint,
-                mMessagesParser,
-                mTailManager,
-                mLog));
+    auto nodeIt = mNodes.find(kEndpointKey);
+    if (nodeIt != mNodes.end()) {
+        return nodeIt->second.get();
     }
 
-    return mNodes[kEndpointKey].get();
+    if (mNodes.size() >= kMaxNodesCount) {
+        mRemovedNodesDroppedPacketsCount++;
+        return nullptr;
+    }
+    return mNodes.emplace(
+        kEndpointKey,
+        make_unique<IncomingRemoteNode>(
+            endpoint,
+            mLog)).first->second.get();
 }
 
 /**
@@ -56,9 +51,12 @@ void IncomingNodesHandler::removeOutdatedEndpoints()
     size_t totalOboleteIndexesCount = 0;
 
     for (const auto &keyAndNodeHandler : mNodes) {
-        if (kNow - keyAndNodeHandler.second->lastUpdated() >= kMaxHandlerTTL) {
+        // handler of banned node is kept until ban expiring, otherwise ban would be lost
+        if (kNow - keyAndNodeHandler.second->lastUpdated() >= kMaxHandlerTTL
+                and not keyAndNodeHandler.second->isBanned()) {
             obsoleteIndexes.push_front(keyAndNodeHandler.first);
             ++totalOboleteIndexesCount;
+            mRemovedNodesDroppedPacketsCount += keyAndNodeHandler.second->droppedPacketsCount();
         }
     }
 
@@ -109,6 +107,22 @@ void IncomingNodesHandler::removeOutdatedChannelsOfPresentEndpoints()
 #endif
 }
 
+bool IncomingNodesHandler::empty() const
+    noexcept
+{
+    return mNodes.empty();
+}
+
+size_t IncomingNodesHandler::droppedPacketsCount() const
+    noexcept
+{
+    auto result = mRemovedNodesDroppedPacketsCount;
+    for (const auto &keyAndNodeHandler : mNodes) {
+        result += keyAndNodeHandler.second->droppedPacketsCount();
+    }
+    return result;
+}
+
 /**
  * Returns 8 bytes unsigned interger,
  * where first 4 bytes - are IPv4 address,
@@ -119,8 +133,8 @@ uint64_t IncomingNodesHandler::key(
     noexcept
 {
     return
-        endpoint.address().to_v4().to_ulong()
-        + endpoint.port();
+        (static_cast<uint64_t>(endpoint.address().to_v4().to_ulong()) << 32)
+        | endpoint.port();
 }
 
 LoggerStream IncomingNodesHandler::debug() const
@@ -3,7 +3,6 @@
 
 #include "../common/Types.h"
 #include "IncomingRemoteNode.h"
-#include "MessageParser.h"
 
 #include "../../../../common/time/TimeUtils.h"
 #include "../../../../logger/Logger.h"
@@ -20,11 +19,13 @@ using namespace std;
 class IncomingNodesHandler {
 public:
     IncomingNodesHandler(
-        MessagesParser &messagesParser,
-        TailManager *tailManager,
         Logger &logger)
         noexcept;
 
+    /**
+     * @returns handler for processing incoming traffic from the remote node,
+     * or nullptr if there are kMaxNodesCount handlers already (datagram of the node must be dropped).
+     */
     IncomingRemoteNode* handler(
         const UDPEndpoint &endpoint)
         noexcept;
@@ -33,6 +34,14 @@ public:
 
     void removeOutdatedChannelsOfPresentEndpoints();
 
+    bool empty() const
+        noexcept;
+
+    // count of packets, dropped by all remote nodes handlers (including already removed ones)
+    // and dropped because of handlers count limit
+    size_t droppedPacketsCount() const
+        noexcept;
+
 protected:
     static uint64_t key(
         const UDPEndpoint &endpoint)
@@ -42,10 +51,16 @@ protected:
         noexcept;
 
 protected:
-    MessagesParser &mMessagesParser;
-    TailManager *mTailManager;
+    // handlers of outdated endpoints are removed periodically,
+    // until that time handlers of new endpoints are not created over this limit
+    static const constexpr size_t kMaxNodesCount = 4096;
+
+protected:
     Logger &mLog;
 
+    // dropped packets of removed handlers and packets of nodes, which handlers were not created
+    size_t mRemovedNodesDroppedPacketsCount;
+
     boost::container::flat_map<uint64_t, IncomingRemoteNode::Unique> mNodes;
 };
 
@@ -1,40 +1,51 @@
 #include "IncomingRemoteNode.h"
 
+const constexpr uint32_t IncomingRemoteNode::kMaxPacketsBurst;
+const constexpr uint32_t IncomingRemoteNode::kMaxMalformedPacketsCount;
+const constexpr uint32_t IncomingRemoteNode::kMalformedPacketsPeriodSeconds;
 
 IncomingRemoteNode::IncomingRemoteNode(
     const UDPEndpoint &endpoint,
-    MessagesParser &messagesParser,
-    TailManager *tailManager,
     Logger &logger)
     noexcept:
 
     mEndpoint(endpoint),
-    mMessagesParser(messagesParser),
-    mTailManager(tailManager),
+    mChannelsBufferedBytesCount(0),
+    mPacketsTokens(kMaxPacketsBurst),
+    mPacketsTokensRefilled(chrono::steady_clock::now()),
+    mMalformedPacketsCount(0),
+    mBansCount(0),
+    mDroppedPacketsCount(0),
     mLog(logger)
 {}
 
-// ToDo: implement me correct
 bool IncomingRemoteNode::isBanned () const
     noexcept
 {
-    return false;
+    return chrono::steady_clock::now() < mBannedUntil;
+}
+
+size_t IncomingRemoteNode::droppedPacketsCount() const
+    noexcept
+{
+    return mDroppedPacketsCount;
 }
 
 /**
- * @returns shared pointer to the next available message, that was collected from the network.
+ * @returns bytes of the next available message, that was collected from the network.
  * In case, if no messages are availabel - nullptr would be returned.
  *
  * Please, note, that this method may return several messages by several sequential calls.
+ * Messages are returned in order of their collecting.
  * For more details, see comment for the "mCollecteMessages" structure in the header.
  */
-Message::Shared IncomingRemoteNode::popNextMessage()
+pair<BytesShared, size_t> IncomingRemoteNode::popNextMessage()
 {
     if (mCollectedMessages.empty())
-        return Message::Shared(nullptr);
+        return make_pair(nullptr, 0);
 
-    const auto kMessage = *(prev(mCollectedMessages.cend()));
-    mCollectedMessages.pop_back();
+    const auto kMessage = mCollectedMessages.front();
+    mCollectedMessages.pop_front();
     return kMessage;
 }
 
@@ -61,6 +72,7 @@ void IncomingRemoteNode::dropOutdatedChannels()
     for (const auto &indexAndChannel : mChannels) {
         if (kNow - indexAndChannel.second->lastUpdated() > kMaxTTL) {
             const auto kChannelIndex = indexAndChannel.first;
+            mChannelsBufferedBytesCount -= indexAndChannel.second->bufferedBytesCount();
 
 #ifdef DEBUG_LOG_NETWORK_COMMUNICATOR
             debug() << "Channel " << kChannelIndex
@@ -77,6 +89,7 @@ void IncomingRemoteNode::dropOutdatedChannels()
         // it would much more efficient to clear whole map at once
         // (with only one memory reallocation)
         mChannels.clear();
+        mChannelsBufferedBytesCount = 0;
 
     } else {
         // Prevent elements reallocation on removing.
@@ -108,6 +121,22 @@ void IncomingRemoteNode::processIncomingBytesSequence (
         return;
     }
 
+    // Node handler is kept alive while the node sends anything, even if all its packets are dropped,
+    // so its ban can't be reset by the outdated endpoints removing.
+    const auto kNow = chrono::steady_clock::now();
+    mLastUpdated = kNow;
+
+    // datagrams of banned node are only counted, they are reported by the communicator periodically
+    if (kNow < mBannedUntil) {
+        mDroppedPacketsCount++;
+        return;
+    }
+
+    if (mChannelsBufferedBytesCount + mBuffer.size() + count > kMaxBufferedBytesCount) {
+        ban("buffered bytes count exceeded " + to_string(kMaxBufferedBytesCount) + "B");
+        return;
+    }
+
     while (mBuffer.capacity() < (mBuffer.size() + count)) {
 
 #ifdef LINUX
@@ -210,9 +239,7 @@ bool IncomingRemoteNode::tryCollectNextPacket ()
         // This period of time must be exponentially increased if this error will not be eliminated
         // on the next round.
 
-        dropEntireIncomingFlow();
-
-        // ToDo: ban the node.
+        dropMalformedPacket("invalid packet size " + to_string(kHeaderAndBodyBytesCount));
         return false;
     }
 
@@ -220,9 +247,7 @@ bool IncomingRemoteNode::tryCollectNextPacket ()
         || kPacketIndex > kTotalPacketsCount) {
 
         // Invalid bytes flow occurred.
-        dropEntireIncomingFlow();
-
-        // ToDo: ban the node.
+        dropMalformedPacket("invalid packet index " + to_string(kPacketIndex) + "/" + to_string(kTotalPacketsCount));
         return false;
     }
 
@@ -232,35 +257,36 @@ bool IncomingRemoteNode::tryCollectNextPacket ()
         return false;
     }
 
+    // each packet is charged separately, because one datagram may contain several packets
+    if (not tryConsumePacketToken(chrono::steady_clock::now())) {
+        ban("packets rate exceeded " + to_string(kMaxPacketsPerSecond) + " packets per second");
+        return false;
+    }
+
+    if (mChannels.count(kChannelIndex) == 0 and mChannels.size() >= kMaxChannelsCount) {
+        ban("open channels count exceeded " + to_string(kMaxChannelsCount));
+        return false;
+    }
+
     auto channel = findChannel(kChannelIndex);
     channel->reservePacketsSlots(kTotalPacketsCount);
+    mChannelsBufferedBytesCount -= channel->bufferedBytesCount();
     channel->addPacket(
         kPacketIndex,
         mBuffer.data() + PacketHeader::kSize,
         kHeaderAndBodyBytesCount - PacketHeader::kSize);
+    mChannelsBufferedBytesCount += channel->bufferedBytesCount();
 
     // Cut bytes transferred to the packet from the buffer
     mBuffer.erase(
         mBuffer.cbegin(),
         mBuffer.cbegin() + kHeaderAndBodyBytesCount);
 
-    const auto kFlagAndMessage = channel->tryCollectMessage();
-    if (kFlagAndMessage.first) {
-        debug() << "Collected message of type " << kFlagAndMessage.second->typeID();
-        if (kFlagAndMessage.second->typeID() == Message::MaxFlow_ResultMaxFlowCalculation or
-            kFlagAndMessage.second->typeID() == Message::MaxFlow_ResultMaxFlowCalculationFromGateway) {
-            mTailManager->getFlowTail().push_back(kFlagAndMessage.second);
-            mCollectedMessages.push_back(kFlagAndMessage.second);
-        } else if (kFlagAndMessage.second->typeID() == Message::Cycles_FiveNodesBoundary) {
-            mTailManager->getCyclesFiveTail().push_back(kFlagAndMessage.second);
-        } else if (kFlagAndMessage.second->typeID() == Message::Cycles_SixNodesBoundary) {
-            mTailManager->getCyclesSixTail().push_back(kFlagAndMessage.second);
-        } else if (kFlagAndMessage.second->typeID() == Message::RoutingTableResponse) {
-            mTailManager->getRoutingTableTail().push_back(kFlagAndMessage.second);
-            mCollectedMessages.push_back(kFlagAndMessage.second);
-        } else {
-            mCollectedMessages.push_back(kFlagAndMessage.second);
-        }
+    const auto kMessageBytes = channel->tryCollectMessage();
+    if (kMessageBytes.first != nullptr) {
+        debug() << "Collected message of " << kMessageBytes.second << " bytes";
+        mCollectedMessages.push_back(kMessageBytes);
+        mChannelsBufferedBytesCount -= channel->bufferedBytesCount();
         mChannels.erase(kChannelIndex);
     }
 
@@ -287,13 +313,97 @@ IncomingChannel* IncomingRemoteNode::findChannel(
         mChannels.emplace(
             index,
             make_unique<IncomingChannel>(
-                mMessagesParser,
                 mLastUpdated,
                 mLog));
 
     return mChannels[index].get();
 }
 
+/*
+ * Returns "false" if there is no token for the next packet.
+ */
+bool IncomingRemoteNode::tryConsumePacketToken(
+    const TimePoint &now)
+{
+    const auto kElapsedSeconds = chrono::duration<double>(now - mPacketsTokensRefilled).count();
+    mPacketsTokensRefilled = now;
+    mPacketsTokens += kElapsedSeconds * kMaxPacketsPerSecond;
+    if (mPacketsTokens > kMaxPacketsBurst) {
+        mPacketsTokens = kMaxPacketsBurst;
+    }
+
+    if (mPacketsTokens < 1) {
+        return false;
+    }
+    mPacketsTokens -= 1;
+    return true;
+}
+
+/*
+ * Drops the current packet and all not collected bytes of the node,
+ * because the beginning of the next packet can't be found after malformed one.
+ * Channels are kept: other messages may be collected by next packets.
+ */
+void IncomingRemoteNode::dropMalformedPacket(
+    const string &reason)
+{
+    const auto kNow = chrono::steady_clock::now();
+    if (kNow - mMalformedPacketsPeriodStarted > chrono::seconds(kMalformedPacketsPeriodSeconds)) {
+        mMalformedPacketsPeriodStarted = kNow;
+        mMalformedPacketsCount = 0;
+    }
+
+    mMalformedPacketsCount++;
+    if (mMalformedPacketsCount > kMaxMalformedPacketsCount) {
+        ban(reason + ", malformed packets count exceeded " + to_string(kMaxMalformedPacketsCount)
+            + " per " + to_string(kMalformedPacketsPeriodSeconds) + " seconds");
+        return;
+    }
+
+    mDroppedPacketsCount++;
+    dropEntireIncomingFlow();
+    debug() << "Malformed packet from " << mEndpoint << " is dropped: " << reason;
+}
+
+/*
+ * Drops the current packet and all buffered data of the node (except already collected messages),
+ * and rejects all its packets for the ban duration.
+ */
+void IncomingRemoteNode::ban(
+    const string &reason)
+{
+    const auto kNow = chrono::steady_clock::now();
+    if (chrono::duration_cast<chrono::seconds>(kNow - mBannedUntil).count() > kBansCountResetPeriodSeconds) {
+        mBansCount = 0;
+    }
+
+    uint32_t banDurationSeconds = kInitialBanDurationSeconds;
+    for (uint32_t i = 0; i < mBansCount and banDurationSeconds < kMaxBanDurationSeconds; ++i) {
+        banDurationSeconds *= 2;
+    }
+    if (banDurationSeconds > kMaxBanDurationSeconds) {
+        banDurationSeconds = kMaxBanDurationSeconds;
+    }
+    mBansCount++;
+    mBannedUntil = kNow + chrono::seconds(banDurationSeconds);
+    mDroppedPacketsCount++;
+
+    dropEntireIncomingFlow();
+    mChannels.clear();
+    mChannelsBufferedBytesCount = 0;
+    // budgets are restored, so the node would not be banned again immediately after ban expiring
+    mPacketsTokens = kMaxPacketsBurst;
+    mMalformedPacketsCount = 0;
+
+    warning() << "Endpoint " << mEndpoint << " is banned for " << banDurationSeconds << " seconds: " << reason;
+}
+
+LoggerStream IncomingRemoteNode::warning() const
+    noexcept
+{
+    return mLog.warning("Communicator / IncomingRemoteNode");
+}
+
 LoggerStream IncomingRemoteNode::debug() const
     noexcept
 {
@@ -4,15 +4,26 @@
 #include "../common/Types.h"
 #include "../common/Packet.hpp"
 #include "IncomingChannel.h"
-#include "MessageParser.h"
-#include "TailManager.h"
 
 #include <boost/unordered_map.hpp>
 
 #include <vector>
+#include <deque>
 #include <forward_list>
 
 
+/**
+ * Collects incoming packets of the remote node into messages.
+ *
+ * Each remote node has its own budget of open channels, buffered bytes and packets rate,
+ * so one misbehaving node can't exhaust memory and CPU, shared by all the rest.
+ * Node, which exceeds any of them, is temporarily banned:
+ * all its buffered data is dropped, and all its packets are dropped until ban is expired.
+ * Each next ban is twice longer than previous one.
+ *
+ * Malformed packet (which may be broken by the network) only drops not collected bytes of the node;
+ * node is banned only if it sends too many malformed packets during short period.
+ */
 class IncomingRemoteNode {
 public:
     using Unique = unique_ptr<IncomingRemoteNode>;
@@ -20,8 +31,6 @@ public:
 public:
     IncomingRemoteNode(
         const UDPEndpoint &endpoint,
-        MessagesParser &messagesParser,
-        TailManager *tailManager,
         Logger &logger)
         noexcept;
 
@@ -37,7 +46,11 @@ public:
     bool isBanned() const
         noexcept;
 
-    Message::Shared popNextMessage();
+    // count of packets, dropped because of ban or exceeded budgets
+    size_t droppedPacketsCount() const
+        noexcept;
+
+    pair<BytesShared, size_t> popNextMessage();
 
     void dropOutdatedChannels();
 
@@ -50,14 +63,59 @@ protected:
     IncomingChannel* findChannel (
         const PacketHeader::ChannelIndex index);
 
+    bool tryConsumePacketToken(
+        const TimePoint &now);
+
+    void dropMalformedPacket(
+        const string &reason);
+
+    void ban(
+        const string &reason);
+
+    LoggerStream warning() const
+        noexcept;
+
     LoggerStream debug() const
         noexcept;
 
+protected:
+    static const constexpr size_t kMaxChannelsCount = 1024;
+
+    // channels and not parsed bytes
+    static const constexpr size_t kMaxBufferedBytesCount = 16 * 1024 * 1024;
+
+    // token bucket of packets: it is refilled with kMaxPacketsPerSecond tokens per second,
+    // up to kMaxPacketsBurst tokens
+    static const constexpr uint32_t kMaxPacketsPerSecond = 10000;
+    static const constexpr uint32_t kMaxPacketsBurst = kMaxPacketsPerSecond * 2;
+
+    // node is banned on the malformed packet, if there were more than kMaxMalformedPacketsCount of them
+    // during kMalformedPacketsPeriodSeconds
+    static const constexpr uint32_t kMaxMalformedPacketsCount = 16;
+    static const constexpr uint32_t kMalformedPacketsPeriodSeconds = 60;
+
+    static const constexpr uint32_t kInitialBanDurationSeconds = 10;
+    static const constexpr uint32_t kMaxBanDurationSeconds = 60 * 60;
+    // bans count is reset, if node was not banned during this period after previous ban
+    static const constexpr uint32_t kBansCountResetPeriodSeconds = 60 * 60;
+
 protected:
     const UDPEndpoint mEndpoint;
     TimePoint mLastUpdated;
 
     boost::unordered_map<PacketHeader::ChannelIndex, IncomingChannel::Unique> mChannels;
+    // total bytes count, buffered by mChannels
+    size_t mChannelsBufferedBytesCount;
+
+    double mPacketsTokens;
+    TimePoint mPacketsTokensRefilled;
+
+    uint32_t mMalformedPacketsCount;
+    TimePoint mMalformedPacketsPeriodStarted;
+
+    TimePoint mBannedUntil;
+    uint32_t mBansCount;
+    size_t mDroppedPacketsCount;
 
 
     // todo: ensure reserve usage
@@ -67,11 +125,10 @@ protected:
     // There is non-zero probability, that whole bytes sequence would be processed in one read cycle,
     // so there are several messages, may be collected at once.
     //
-    // This container stores messages, that was collected on previous read cycles.
-    vector<Message::Shared> mCollectedMessages;
+    // This container stores bytes of messages, that was collected on previous read cycles,
+    // in order of their collecting.
+    deque<pair<BytesShared, size_t>> mCollectedMessages;
 
-    MessagesParser &mMessagesParser;
-    TailManager *mTailManager;
     Logger &mLog;
 };
 
@@ -76,31 +76,59 @@
 
 using namespace std;
 
+/**
+ * Parsing of the collected message is split into two steps.
+ * Decryption key is looked up on the main thread, because it belongs to the contractor.
+ * Decryption and deserialization don't use any state of the node, so they can be done in workers pool.
+ */
 class MessagesParser {
+public:
+    struct ParsedMessage {
+        // nullptr if message was dropped
+        Message::Shared mMessage;
+        // reason of message dropping
+        string mError;
+    };
+
 public:
     MessagesParser(
         ContractorsManager *contractorsManager,
         Logger *logger)
         noexcept;
 
-    pair<bool, Message::Shared> processBytesSequence(
+    /**
+     * @returns false if message must be dropped,
+     * otherwise - true and key for message decryption (nullptr if message is not encrypted).
+     */
+    pair<bool, MsgEncryptor::KeyTrio::Shared> decryptionKey(
         BytesShared buffer,
         size_t count);
 
+    // Doesn't log anything: reason of message dropping is returned in result.
+    static ParsedMessage parse(
+        BytesShared buffer,
+        size_t count,
+        MsgEncryptor::KeyTrio::Shared cryptoKey);
+
     MessagesParser& operator= (
         const MessagesParser &other)
         noexcept;
 
 protected:
-    const size_t kMessageIdentifierSize = 2;
-    const size_t kMinimalMessageSize = kMessageIdentifierSize + 1;
+    static const size_t kMessageIdentifierSize = 2;
+    static const size_t kMinimalMessageSize = kMessageIdentifierSize + 1;
 
 protected:
-    pair<bool, Message::Shared> messageInvalidOrIncomplete();
+    pair<bool, MsgEncryptor::KeyTrio::Shared> messageInvalidOrIncomplete();
+
+    // returns nullptr if message identifier is unknown
+    static Message::Shared deserialize(
+        const Message::SerializedType messageIdentifier,
+        BytesShared buffer);
 
     template <class CollectedMessageType>
-    pair<bool, Message::Shared> messageCollected(
-        CollectedMessageType message) const;
+    static Message::Shared messageCollected(
+        BytesShared buffer);
 
 protected:
     static string logHeader()
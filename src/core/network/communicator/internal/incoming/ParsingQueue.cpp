@@ -0,0 +1,41 @@
+#include "ParsingQueue.h"
+
+
+ParsingQueue::ParsingQueue()
+    noexcept:
+
+    mNextSequenceNumber(0),
+    mNextDeliveredSequenceNumber(0)
+{}
+
+uint64_t ParsingQueue::enqueue()
+    noexcept
+{
+    return mNextSequenceNumber++;
+}
+
+vector<Message::Shared> ParsingQueue::onParsed(
+    uint64_t sequenceNumber,
+    Message::Shared message)
+{
+    mParsedMessages[sequenceNumber] = message;
+
+    vector<Message::Shared> result;
+    while (!mParsedMessages.empty() and
+           mParsedMessages.begin()->first == mNextDeliveredSequenceNumber) {
+        if (mParsedMessages.begin()->second != nullptr) {
+            result.push_back(
+                mParsedMessages.begin()->second);
+        }
+        mParsedMessages.erase(
+            mParsedMessages.begin());
+        mNextDeliveredSequenceNumber++;
+    }
+    return result;
+}
+
+bool ParsingQueue::isEmpty() const
+    noexcept
+{
+    return mNextDeliveredSequenceNumber == mNextSequenceNumber;
+}
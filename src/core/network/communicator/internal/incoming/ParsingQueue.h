@@ -0,0 +1,45 @@
+#ifndef GEO_NETWORK_CLIENT_PARSINGQUEUE_H
+#define GEO_NETWORK_CLIENT_PARSINGQUEUE_H
+
+#include "../../../messages/Message.hpp"
+
+#include <map>
+#include <vector>
+
+
+/**
+ * Keeps order of the messages of one remote node, which are parsed in parallel.
+ * Each collected message gets sequence number; parsed message is delivered
+ * only after all messages, collected before it, are delivered (or dropped).
+ */
+class ParsingQueue {
+public:
+    ParsingQueue()
+        noexcept;
+
+    // returns sequence number of the next collected message
+    uint64_t enqueue()
+        noexcept;
+
+    /**
+     * @param message - parsed message, nullptr if the message was dropped.
+     * @returns messages, which can be delivered now, in order of their collecting (without dropped ones).
+     */
+    vector<Message::Shared> onParsed(
+        uint64_t sequenceNumber,
+        Message::Shared message);
+
+    // returns true if all collected messages are delivered (or dropped)
+    bool isEmpty() const
+        noexcept;
+
+protected:
+    // sequence number of the next collected message
+    uint64_t mNextSequenceNumber;
+    // sequence number of the next message, which must be delivered
+    uint64_t mNextDeliveredSequenceNumber;
+    // messages, which are parsed, but wait for delivering of previous ones (nullptr - dropped message)
+    map<uint64_t, Message::Shared> mParsedMessages;
+};
+
+#endif //GEO_NETWORK_CLIENT_PARSINGQUEUE_H
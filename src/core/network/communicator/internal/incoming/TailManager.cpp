@@ -6,52 +6,41 @@ TailManager::Tail::Tail(TailManager &manager) :
     mManager.mTails.push_back(this);
 }
 
+void TailManager::Tail::push(
+    const Message::Shared &message)
+{
+    push_back(message);
+    back().time = utc_now();
+    if (!mManager.mUpdatingTimer.isPending()) {
+        mManager.scheduleUpdating();
+    }
+}
+
+TailManager::FlowCollection::FlowCollection(
+    const SerializedEquivalent equivalent) :
+    mEquivalent(equivalent)
+{}
+
 TailManager::TailManager(
-    as::io_service &ioService,
+    TimerService *timerService,
     Logger &logger):
-    mIOService(ioService),
     mLog(logger),
     mTails(),
-    mFlowTail(*this),
-    mCyclesFiveTail(*this),
-    mCyclesSixTail(*this),
-    mRoutingTableTail(*this)
-{
-    mUpdatingTimer = make_unique<as::steady_timer>(
-        mIOService);
-    mUpdatingTimer->expires_from_now(
-        std::chrono::seconds(
-            kUpdatingTimerPeriodSeconds));
-    mUpdatingTimer->async_wait(
-        boost::bind(
-            &TailManager::update,
-            this,
-            as::placeholders::error));
-}
+    mRoutingTableTail(*this),
+    mUpdatingTimer(timerService)
+{}
 
 TailManager::~TailManager()
 {}
 
-void TailManager::update(const boost::system::error_code &err)
+void TailManager::update()
 {
-    if (err) {
-        warning() << err.message();
-    }
-    mUpdatingTimer->cancel();
-    mUpdatingTimer->expires_from_now(
-        std::chrono::seconds(
-            kUpdatingTimerPeriodSeconds));
-    mUpdatingTimer->async_wait(
-        boost::bind(
-            &TailManager::update,
-            this,
-            as::placeholders::error));
-
     DateTime now = utc_now();
 
     for(auto lit = mTails.begin(); lit != mTails.end(); ++lit) {
         Tail &tail = **lit;
 
+        // messages, pushed without Tail::push(), are marked on first cleaning
         for(auto current = tail.end(); current != tail.begin(); ) {
             --current;
             Msg &msg = *current;
@@ -63,12 +52,123 @@ void TailManager::update(const boost::system::error_code &err)
 
         for(auto current=tail.begin(); current!=tail.end(); ) {
             Msg &msg = *current;
-            if (!msg.time.is_not_a_date_time() and (now - msg.time) <= kCleanDuration()) {
+            if (!msg.time.is_not_a_date_time() and (now - msg.time) < kCleanDuration()) {
                 break;
             }
             current = tail.erase(current);
         }
     }
+
+    scheduleUpdating();
+}
+
+void TailManager::scheduleUpdating()
+{
+    // messages are ordered by receiving time in each tail,
+    // so only the first message of each tail should be checked
+    DateTime oldestMessageTime;
+    for (const auto tail : mTails) {
+        if (tail->empty() or tail->front().time.is_not_a_date_time()) {
+            continue;
+        }
+        if (oldestMessageTime.is_not_a_date_time() or tail->front().time < oldestMessageTime) {
+            oldestMessageTime = tail->front().time;
+        }
+    }
+    if (oldestMessageTime.is_not_a_date_time()) {
+        mUpdatingTimer.cancel();
+        return;
+    }
+
+    const auto kDelay = oldestMessageTime + kCleanDuration() - utc_now();
+    mUpdatingTimer.expiresFromNow(
+        std::chrono::milliseconds(
+            max(kDelay.total_milliseconds(), (int64_t)0)),
+        [this]() {
+            update();
+        });
+}
+
+TailManager::Tail &TailManager::getFlowTail(
+    const SerializedEquivalent equivalent)
+{
+    return equivalentTail(
+        mFlowTails,
+        equivalent);
+}
+
+TailManager::Tail &TailManager::getCyclesFiveTail(
+    const SerializedEquivalent equivalent)
+{
+    return equivalentTail(
+        mCyclesFiveTails,
+        equivalent);
+}
+
+TailManager::Tail &TailManager::getCyclesSixTail(
+    const SerializedEquivalent equivalent)
+{
+    return equivalentTail(
+        mCyclesSixTails,
+        equivalent);
+}
+
+TailManager::Tail &TailManager::equivalentTail(
+    map<SerializedEquivalent, unique_ptr<Tail>> &tails,
+    const SerializedEquivalent equivalent)
+{
+    auto tailIt = tails.find(equivalent);
+    if (tailIt == tails.end()) {
+        // Tail registers itself in mTails, so it would be cleaned by update() as well.
+        tailIt = tails.emplace(
+            equivalent,
+            make_unique<Tail>(*this)).first;
+    }
+    return *tailIt->second;
+}
+
+void TailManager::beginFlowCollection(
+    const TransactionUUID &collectionID,
+    const SerializedEquivalent equivalent)
+{
+    mFlowCollections.erase(collectionID);
+    mFlowCollections.emplace(
+        collectionID,
+        FlowCollection(equivalent));
+}
+
+void TailManager::finishFlowCollection(
+    const TransactionUUID &collectionID)
+{
+    mFlowCollections.erase(collectionID);
+}
+
+const TailManager::FlowCollection *TailManager::flowCollection(
+    const TransactionUUID &collectionID) const
+{
+    auto collectionIt = mFlowCollections.find(collectionID);
+    if (collectionIt == mFlowCollections.end()) {
+        return nullptr;
+    }
+    return &collectionIt->second;
+}
+
+void TailManager::onFlowResponseIngested(
+    const SerializedEquivalent equivalent,
+    const string &responderAddress)
+{
+    const auto kNow = utc_now();
+    for (auto &collectionIDAndCollection : mFlowCollections) {
+        auto &collection = collectionIDAndCollection.second;
+        if (collection.mEquivalent != equivalent) {
+            continue;
+        }
+        collection.mResponders.insert(responderAddress);
+        if (collection.mFirstResponseReceived.is_not_a_date_time()) {
+            collection.mFirstResponseReceived = kNow;
+        }
+        collection.mLastResponseReceived = kNow;
+    }
 }
 
 LoggerStream TailManager::info() const
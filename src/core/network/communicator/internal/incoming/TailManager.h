@@ -4,14 +4,15 @@
 
 #include <list>
 #include <deque>
+#include <map>
+#include <set>
 #include "../../../messages/Message.hpp"
 #include "../../../../logger/Logger.h"
+#include "../../../../transactions/transactions/base/TransactionUUID.h"
+#include "../../../../common/time/TimerService.h"
 
 #include <boost/signals2.hpp>
-#include <boost/asio.hpp>
-#include <boost/asio/steady_timer.hpp>
 
-namespace as = boost::asio;
 namespace signals = boost::signals2;
 
 class TailManager {
@@ -24,13 +25,30 @@ public:
 
     struct Tail : MsgList {
         explicit Tail(TailManager &manager);
+
+        // Marks message with receiving time and schedules its cleaning.
+        void push(const Message::Shared &message);
+
         TailManager &mManager;
     };
     typedef std::list<Tail *> TailList;
 
-private:
-    const uint32_t kUpdatingTimerPeriodSeconds = 60;
+    /*
+     * Topology collecting, performed by one transaction (collection ID is UUID of the transaction).
+     * Topology responses are ingested once into the topology of the equivalent,
+     * and each collection of the equivalent is notified about the responder.
+     */
+    struct FlowCollection {
+        explicit FlowCollection(
+            const SerializedEquivalent equivalent);
+
+        SerializedEquivalent mEquivalent;
+        set<string> mResponders;
+        DateTime mFirstResponseReceived;
+        DateTime mLastResponseReceived;
+    };
 
+private:
     static const byte kCleanHours = 0;
     static const byte kCleanMinutes = 5;
     static const byte kCleanSeconds = 0;
@@ -45,20 +63,46 @@ private:
 
 public:
     TailManager(
-        as::io_service &ioService,
+        TimerService *timerService,
         Logger &logger
     );
     ~TailManager();
 
 private:
-    void update(const boost::system::error_code &err);
+    void update();
+
+    // Schedules update() on the time, when the oldest message of all tails expires.
+    // Timer is not armed while tails are empty.
+    void scheduleUpdating();
 
 public:
-    Tail &getFlowTail() { return mFlowTail; }
-    Tail &getCyclesFiveTail() { return mCyclesFiveTail; }
-    Tail &getCyclesSixTail() { return mCyclesSixTail; }
+    // Topology and cycles responses are routed by equivalent,
+    // so concurrent transactions of different equivalents don't consume responses of each other.
+    Tail &getFlowTail(const SerializedEquivalent equivalent);
+    Tail &getCyclesFiveTail(const SerializedEquivalent equivalent);
+    Tail &getCyclesSixTail(const SerializedEquivalent equivalent);
     Tail &getRoutingTableTail() { return mRoutingTableTail; }
 
+    void beginFlowCollection(
+        const TransactionUUID &collectionID,
+        const SerializedEquivalent equivalent);
+
+    void finishFlowCollection(
+        const TransactionUUID &collectionID);
+
+    // Returns nullptr if there is no collection with such ID
+    const FlowCollection *flowCollection(
+        const TransactionUUID &collectionID) const;
+
+    void onFlowResponseIngested(
+        const SerializedEquivalent equivalent,
+        const string &responderAddress);
+
+private:
+    Tail &equivalentTail(
+        map<SerializedEquivalent, unique_ptr<Tail>> &tails,
+        const SerializedEquivalent equivalent);
+
 private:
     LoggerStream info() const;
     LoggerStream debug() const;
@@ -69,13 +113,14 @@ private:
     Logger &mLog;
     TailList mTails;
 
-    Tail mFlowTail;
-    Tail mCyclesFiveTail;
-    Tail mCyclesSixTail;
+    map<SerializedEquivalent, unique_ptr<Tail>> mFlowTails;
+    map<SerializedEquivalent, unique_ptr<Tail>> mCyclesFiveTails;
+    map<SerializedEquivalent, unique_ptr<Tail>> mCyclesSixTails;
     Tail mRoutingTableTail;
 
-    as::io_service &mIOService;
-    unique_ptr<as::steady_timer> mUpdatingTimer;
+    map<TransactionUUID, FlowCollection> mFlowCollections;
+
+    TimerService::Timer mUpdatingTimer;
 };
 
 
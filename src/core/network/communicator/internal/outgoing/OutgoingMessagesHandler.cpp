@@ -3,6 +3,7 @@
 
 OutgoingMessagesHandler::OutgoingMessagesHandler(
     IOService &ioService,
+    TimerService *timerService,
     UDPSocket &socket,
     ContractorsManager *contractorsManager,
     ProvidingHandler *providingHandler,
@@ -12,26 +13,18 @@ OutgoingMessagesHandler::OutgoingMessagesHandler(
     mLog(log),
     mNodes(
         ioService,
+        timerService,
         socket,
         log),
     mContractorsManager(contractorsManager),
     mProvidingHandler(providingHandler),
-    mPostponedMessagesCleaningTimer(ioService)
+    mPostponedMessagesCleaningTimer(timerService)
 {
     mProvidingHandler->sendPingMessageSignal.connect(
         boost::bind(
             &OutgoingMessagesHandler::onPingMessageToProviderReady,
             this,
             _1));
-
-    mPostponedMessagesCleaningTimer.expires_from_now(
-        std::chrono::seconds(
-            +kPostponedMessagesClearingPeriodSeconds));
-    mPostponedMessagesCleaningTimer.async_wait(
-        boost::bind(
-            &OutgoingMessagesHandler::clearUndeliveredMessages,
-            this,
-            as::placeholders::error));
 }
 
 void OutgoingMessagesHandler::sendMessage(
@@ -84,12 +77,9 @@ void OutgoingMessagesHandler::sendMessage(
             mLog.debug("OutgoingMessagesHandler::sendMessage")
                     << "send request to provider: " << provider->name();
 #endif
-            mPostponedMessages.insert(
-                make_pair(
-                    gnsAddress->fullAddress(),
-                    make_pair(
-                        sendingData,
-                        utc_now() + kPostponedMessageTimeLiveDuration())));
+            postponeMessage(
+                gnsAddress,
+                sendingData);
 
             auto node = mNodes.providerHandler(
                 provider->lookupAddress());
@@ -155,12 +145,9 @@ void OutgoingMessagesHandler::sendMessage(
                 mLog.debug("OutgoingMessagesHandler::sendMessage")
                         << "send request to provider: " << provider->name();
 #endif
-                mPostponedMessages.insert(
-                    make_pair(
-                        gnsAddress->fullAddress(),
-                        make_pair(
-                            sendingData,
-                            utc_now() + kPostponedMessageTimeLiveDuration())));
+                postponeMessage(
+                    gnsAddress,
+                    sendingData);
 
                 auto node = mNodes.providerHandler(
                     provider->lookupAddress());
@@ -388,13 +375,23 @@ pair<GNSAddress::Shared, IPv4WithPortAddress::Shared> OutgoingMessagesHandler::d
         ipv4Address);
 }
 
-void OutgoingMessagesHandler::clearUndeliveredMessages(
-    const boost::system::error_code &errorCode)
+void OutgoingMessagesHandler::postponeMessage(
+    GNSAddress::Shared gnsAddress,
+    MsgEncryptor::Buffer sendingData)
 {
-    if (errorCode) {
-        mLog.warning("OutgoingMessagesHandler::clearUndeliveredMessages") << errorCode.message().c_str();
+    mPostponedMessages.insert(
+        make_pair(
+            gnsAddress->fullAddress(),
+            make_pair(
+                sendingData,
+                utc_now() + kPostponedMessageTimeLiveDuration())));
+    if (!mPostponedMessagesCleaningTimer.isPending()) {
+        rescheduleUndeliveredMessagesClearing();
     }
-    mPostponedMessagesCleaningTimer.cancel();
+}
+
+void OutgoingMessagesHandler::clearUndeliveredMessages()
+{
 #ifdef DEBUG_LOG_PROVIDING_HANDLER
     mLog.debug("OutgoingMessagesHandler::clearUndeliveredMessages") << "mPostponedMessages size " << mPostponedMessages.size();
 #endif
@@ -406,9 +403,8 @@ void OutgoingMessagesHandler::clearUndeliveredMessages(
             mLog.debug("OutgoingMessagesHandler::clearUndeliveredMessages") << "erase "
                 << postponedMessageIt->first << " " << postponedMessageIt->second.second;
 #endif
-            mPostponedMessages.erase(
+            postponedMessageIt = mPostponedMessages.erase(
                 postponedMessageIt);
-            postponedMessageIt = mPostponedMessages.begin();
         } else {
             postponedMessageIt++;
         }
@@ -418,12 +414,27 @@ void OutgoingMessagesHandler::clearUndeliveredMessages(
         << "mPostponedMessages after deleting " << mPostponedMessages.size();
 #endif
 
-    mPostponedMessagesCleaningTimer.expires_from_now(
-        std::chrono::seconds(
-            +kPostponedMessagesClearingPeriodSeconds));
-    mPostponedMessagesCleaningTimer.async_wait(
-        boost::bind(
-            &OutgoingMessagesHandler::clearUndeliveredMessages,
-            this,
-            as::placeholders::error));
+    rescheduleUndeliveredMessagesClearing();
+}
+
+void OutgoingMessagesHandler::rescheduleUndeliveredMessagesClearing()
+{
+    DateTime closestExpiry;
+    for (const auto &addressAndMessage : mPostponedMessages) {
+        if (closestExpiry.is_not_a_date_time() or addressAndMessage.second.second < closestExpiry) {
+            closestExpiry = addressAndMessage.second.second;
+        }
+    }
+    if (closestExpiry.is_not_a_date_time()) {
+        mPostponedMessagesCleaningTimer.cancel();
+        return;
+    }
+
+    const auto kDelay = closestExpiry - utc_now();
+    mPostponedMessagesCleaningTimer.expiresFromNow(
+        std::chrono::milliseconds(
+            max(kDelay.total_milliseconds(), (int64_t)0)),
+        [this]() {
+            clearUndeliveredMessages();
+        });
 }
@@ -13,6 +13,7 @@ class OutgoingMessagesHandler {
 public:
     OutgoingMessagesHandler(
         IOService &ioService,
+        TimerService *timerService,
         UDPSocket &socket,
         ContractorsManager *contractorsManager,
         ProvidingHandler *providingHandler,
@@ -44,12 +45,16 @@ private:
     pair<GNSAddress::Shared, IPv4WithPortAddress::Shared> deserializeProviderResponse(
         BytesShared buffer);
 
-    void clearUndeliveredMessages(
-        const boost::system::error_code &errorCode);
+    void postponeMessage(
+        GNSAddress::Shared gnsAddress,
+        MsgEncryptor::Buffer sendingData);
 
-private:
-    static const uint16_t kPostponedMessagesClearingPeriodSeconds = 30;
+    void clearUndeliveredMessages();
+
+    // Schedules cleaning on the time, when the oldest postponed message expires.
+    void rescheduleUndeliveredMessagesClearing();
 
+private:
     static const byte kPostponedMessageTimeLiveHours = 0;
     static const byte kPostponedMessageTimeLiveMinutes = 0;
     static const byte kPostponedMessageTimeLiveSeconds = 10;
@@ -67,7 +72,7 @@ protected:
     ContractorsManager *mContractorsManager;
     ProvidingHandler *mProvidingHandler;
 
-    as::steady_timer mPostponedMessagesCleaningTimer;
+    TimerService::Timer mPostponedMessagesCleaningTimer;
     multimap<string, pair<MsgEncryptor::Buffer, DateTime>> mPostponedMessages;
 };
 
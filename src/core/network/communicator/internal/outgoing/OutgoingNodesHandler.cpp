@@ -3,17 +3,16 @@
 
 OutgoingNodesHandler::OutgoingNodesHandler(
     IOService &ioService,
+    TimerService *timerService,
     UDPSocket &socket,
     Logger &logger)
     noexcept:
 
+    mCleaningTimer(timerService),
     mIOService(ioService),
     mSocket(socket),
-    mCleaningTimer(ioService),
     mLog(logger)
-{
-    rescheduleCleaning();
-}
+{}
 
 OutgoingRemoteBaseNode *OutgoingNodesHandler::handler(
     const IPv4WithPortAddress::Shared address)
@@ -30,6 +29,9 @@ OutgoingRemoteBaseNode *OutgoingNodesHandler::handler(
     }
 
     mLastAccessDateTimesNode[address->fullAddress()] = utc_now();
+    if (!mCleaningTimer.isPending()) {
+        rescheduleCleaning();
+    }
     return mNodes[address->fullAddress()].get();
 }
 
@@ -48,6 +50,9 @@ OutgoingRemoteBaseNode *OutgoingNodesHandler::providerHandler(
     }
 
     mLastAccessDateTimesProvider[address->fullAddress()] = utc_now();
+    if (!mCleaningTimer.isPending()) {
+        rescheduleCleaning();
+    }
     return mProviders[address->fullAddress()].get();
 }
 
@@ -66,12 +71,28 @@ chrono::seconds OutgoingNodesHandler::kHandlersTTL()
 void OutgoingNodesHandler::rescheduleCleaning()
     noexcept
 {
-    mCleaningTimer.expires_from_now(kHandlersTTL());
-    mCleaningTimer.async_wait([this] (const boost::system::error_code&) {
-        this->removeOutdatedNodeHandlers();
-        this->removeOutdatedProviderHandlers();
-        this->rescheduleCleaning();
-    });
+    DateTime leastRecentAccess;
+    for (const auto &lastAccessDateTimes : {&mLastAccessDateTimesNode, &mLastAccessDateTimesProvider}) {
+        for (const auto &addressAndLastAccess : *lastAccessDateTimes) {
+            if (leastRecentAccess.is_not_a_date_time() or addressAndLastAccess.second < leastRecentAccess) {
+                leastRecentAccess = addressAndLastAccess.second;
+            }
+        }
+    }
+    if (leastRecentAccess.is_not_a_date_time()) {
+        mCleaningTimer.cancel();
+        return;
+    }
+
+    const auto kDelay = leastRecentAccess - utc_now() + boost::posix_time::seconds(kHandlersTTL().count());
+    mCleaningTimer.expiresFromNow(
+        chrono::milliseconds(
+            max(kDelay.total_milliseconds(), (int64_t)0)),
+        [this] () {
+            this->removeOutdatedNodeHandlers();
+            this->removeOutdatedProviderHandlers();
+            this->rescheduleCleaning();
+        });
 }
 
 void OutgoingNodesHandler::removeOutdatedNodeHandlers()
@@ -105,14 +126,16 @@ void OutgoingNodesHandler::removeOutdatedNodeHandlers()
     forward_list<string> outdatedHandlersIDs;
     size_t totalOutdatedElements = 0;
 
-    for (const auto &nodeIDAndLastAccess : mLastAccessDateTimesNode) {
+    for (auto &nodeIDAndLastAccess : mLastAccessDateTimesNode) {
         if (kNow - nodeIDAndLastAccess.second < kMaxIdleTimeout) {
             continue;
         }
 
         // Handler that doesn't sent all it's data must not be removed,
         // even if it is obsolete by the access time.
+        // Its TTL is prolonged, so the next cleaning would not be scheduled on the past.
         if (mNodes[nodeIDAndLastAccess.first]->containsPacketsInQueue()) {
+            nodeIDAndLastAccess.second = kNow;
             continue;
         }
 
@@ -174,14 +197,16 @@ void OutgoingNodesHandler::removeOutdatedProviderHandlers()
     forward_list<string> outdatedHandlersProvider;
     size_t totalOutdatedElements = 0;
 
-    for (const auto &nodeAddressAndLastAccess : mLastAccessDateTimesProvider) {
+    for (auto &nodeAddressAndLastAccess : mLastAccessDateTimesProvider) {
         if (kNow - nodeAddressAndLastAccess.second < kMaxIdleTimeout) {
             continue;
         }
 
         // Handler that doesn't sent all it's data must not be removed,
         // even if it is obsolete by the access time.
+        // Its TTL is prolonged, so the next cleaning would not be scheduled on the past.
         if (mProviders[nodeAddressAndLastAccess.first]->containsPacketsInQueue()) {
+            nodeAddressAndLastAccess.second = kNow;
             continue;
         }
 
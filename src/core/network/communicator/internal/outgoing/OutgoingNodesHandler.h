@@ -3,6 +3,7 @@
 
 #include "OutgoingRemoteBaseNode.h"
 #include "../../../../providing/Provider.h"
+#include "../../../../common/time/TimerService.h"
 
 #include <boost/unordered/unordered_map.hpp>
 #include <forward_list>
@@ -14,6 +15,7 @@ class OutgoingNodesHandler {
 public:
     OutgoingNodesHandler (
         IOService &ioService,
+        TimerService *timerService,
         UDPSocket &socket,
         Logger &logger)
         noexcept;
@@ -31,6 +33,10 @@ protected:
         noexcept;
 
 protected:
+    /**
+     * Schedules cleaning on the time, when the least recently used handler becomes obsolete.
+     * Cleaning is not scheduled while there are no handlers.
+     */
     void rescheduleCleaning()
         noexcept;
 
@@ -52,7 +58,7 @@ protected:
     boost::unordered_map<string, DateTime> mLastAccessDateTimesNode;
     boost::unordered_map<string, DateTime> mLastAccessDateTimesProvider;
 
-    boost::asio::steady_timer mCleaningTimer;
+    TimerService::Timer mCleaningTimer;
 
     IOService &mIOService;
     UDPSocket &mSocket;
@@ -38,7 +38,7 @@ TransactionMessage::TransactionMessage(
 
     SenderMessage(buffer),
     mTransactionUUID([&buffer](const size_t parentOffset) -> const TransactionUUID {
-        TransactionUUID tu;
+        TransactionUUID tu(TransactionUUID::kNil);
 
         memcpy(
             tu.data,
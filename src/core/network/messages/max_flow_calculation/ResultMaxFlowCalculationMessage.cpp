@@ -30,12 +30,10 @@ ResultMaxFlowCalculationMessage::ResultMaxFlowCalculationMessage(
             buffer.get() + bytesBufferOffset);
         bytesBufferOffset += address->serializedSize();
         //---------------------------------------------------
-        vector<byte> bufferTrustLineAmount(
-            buffer.get() + bytesBufferOffset,
-            buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
+        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(
+            buffer.get() + bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
         //---------------------------------------------------
-        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(bufferTrustLineAmount);
         mOutgoingFlows.emplace_back(
             address,
             make_shared<const TrustLineAmount>(
@@ -51,12 +49,10 @@ ResultMaxFlowCalculationMessage::ResultMaxFlowCalculationMessage(
             buffer.get() + bytesBufferOffset);
         bytesBufferOffset += address->serializedSize();
         //---------------------------------------------------
-        vector<byte> bufferTrustLineAmount(
-            buffer.get() + bytesBufferOffset,
-            buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
+        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(
+            buffer.get() + bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
         //---------------------------------------------------
-        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(bufferTrustLineAmount);
         mIncomingFlows.emplace_back(
             address,
             make_shared<const TrustLineAmount>(
@@ -112,11 +108,9 @@ pair<BytesShared, size_t> ResultMaxFlowCalculationMessage::serializeToBytes() co
             outgoingFlow.first->serializedSize());
         dataBytesOffset += outgoingFlow.first->serializedSize();
         //------------------------------------------------
-        vector<byte> buffer = trustLineAmountToBytes(*outgoingFlow.second.get());
-        memcpy(
-            dataBytesShared.get() + dataBytesOffset,
-            buffer.data(),
-            buffer.size());
+        trustLineAmountToBytes(
+            *outgoingFlow.second.get(),
+            dataBytesShared.get() + dataBytesOffset);
         dataBytesOffset += kTrustLineAmountBytesCount;
     }
     //----------------------------------------------------
@@ -135,11 +129,9 @@ pair<BytesShared, size_t> ResultMaxFlowCalculationMessage::serializeToBytes() co
             incomingFlow.first->serializedSize());
         dataBytesOffset += incomingFlow.first->serializedSize();
         //------------------------------------------------
-        vector<byte> buffer = trustLineAmountToBytes(*incomingFlow.second.get());
-        memcpy(
-            dataBytesShared.get() + dataBytesOffset,
-            buffer.data(),
-            buffer.size());
+        trustLineAmountToBytes(
+            *incomingFlow.second.get(),
+            dataBytesShared.get() + dataBytesOffset);
         dataBytesOffset += kTrustLineAmountBytesCount;
     }
     //----------------------------------------------------
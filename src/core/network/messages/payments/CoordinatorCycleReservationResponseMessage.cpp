@@ -23,12 +23,9 @@ CoordinatorCycleReservationResponseMessage::CoordinatorCycleReservationResponseM
 {
     auto parentMessageOffset = ResponseCycleMessage::kOffsetToInheritedBytes();
     auto amountOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = amountOffset + kTrustLineAmountBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        amountOffset,
-        amountEndOffset);
-
-    mAmountReserved = bytesToTrustLineAmount(amountBytes);
+    // TODO: deserialize only non-zero
+    mAmountReserved = bytesToTrustLineAmount(
+        amountOffset);
 }
 
 const TrustLineAmount& CoordinatorCycleReservationResponseMessage::amountReserved() const
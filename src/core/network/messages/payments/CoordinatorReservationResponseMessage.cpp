@@ -26,12 +26,9 @@ CoordinatorReservationResponseMessage::CoordinatorReservationResponseMessage(
 {
     auto parentMessageOffset = ResponseMessage::kOffsetToInheritedBytes();
     auto amountOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = amountOffset + kTrustLineAmountBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        amountOffset,
-        amountEndOffset);
-
-    mAmountReserved = bytesToTrustLineAmount(amountBytes);
+    // TODO: deserialize only non-zero
+    mAmountReserved = bytesToTrustLineAmount(
+        amountOffset);
 }
 
 const TrustLineAmount&CoordinatorReservationResponseMessage::amountReserved() const
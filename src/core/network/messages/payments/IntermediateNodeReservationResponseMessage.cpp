@@ -25,12 +25,9 @@ IntermediateNodeReservationResponseMessage::IntermediateNodeReservationResponseM
 {
     auto parentMessageOffset = ResponseMessage::kOffsetToInheritedBytes();
     auto amountOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = amountOffset + kTrustLineAmountBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        amountOffset,
-        amountEndOffset);
-
-    mAmountReserved = bytesToTrustLineAmount(amountBytes);
+    // TODO: deserialize only non-zero
+    mAmountReserved = bytesToTrustLineAmount(
+        amountOffset);
 }
 
 const TrustLineAmount& IntermediateNodeReservationResponseMessage::amountReserved() const
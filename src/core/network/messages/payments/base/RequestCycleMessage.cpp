@@ -20,12 +20,9 @@ RequestCycleMessage::RequestCycleMessage(
 {
     auto parentMessageOffset = TransactionMessage::kOffsetToInheritedBytes();
     auto bytesBufferOffset = buffer.get() + parentMessageOffset;
-    auto amountEndOffset = bytesBufferOffset + kTrustLineBalanceBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        bytesBufferOffset,
-        amountEndOffset);
-
-    mAmount = bytesToTrustLineAmount(amountBytes);
+    // TODO: deserialize only non-zero
+    mAmount = bytesToTrustLineAmount(
+        bytesBufferOffset);
 }
 
 const TrustLineAmount &RequestCycleMessage::amount() const
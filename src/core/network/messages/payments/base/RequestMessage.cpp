@@ -26,12 +26,9 @@ RequestMessage::RequestMessage(
     PathID *pathID = new (bytesBufferOffset) PathID;
     mPathID = *pathID;
     bytesBufferOffset += sizeof(PathID);
-    auto amountEndOffset = bytesBufferOffset + kTrustLineBalanceBytesCount; // TODO: deserialize only non-zero
-    vector<byte> amountBytes(
-        bytesBufferOffset,
-        amountEndOffset);
-
-    mAmount = bytesToTrustLineAmount(amountBytes);
+    // TODO: deserialize only non-zero
+    mAmount = bytesToTrustLineAmount(
+        bytesBufferOffset);
 }
 
 const TrustLineAmount &RequestMessage::amount() const
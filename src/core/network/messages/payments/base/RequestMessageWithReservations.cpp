@@ -30,12 +30,10 @@ RequestMessageWithReservations::RequestMessageWithReservations(
         auto *pathID = new (bytesBufferOffset) PathID;
         bytesBufferOffset += sizeof(PathID);
         //---------------------------------------------------
-        vector<byte> bufferTrustLineAmount(
-            bytesBufferOffset,
-            bytesBufferOffset + kTrustLineAmountBytesCount);
+        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(
+            bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
         //---------------------------------------------------
-        TrustLineAmount trustLineAmount = bytesToTrustLineAmount(bufferTrustLineAmount);
         mFinalAmountsConfiguration.emplace_back(
             *pathID,
             make_shared<const TrustLineAmount>(
@@ -81,11 +79,9 @@ pair<BytesShared, size_t> RequestMessageWithReservations::serializeToBytes() con
             sizeof(PathID));
         bytesBufferOffset += sizeof(PathID);
 
-        vector<byte> serializedAmount = trustLineAmountToBytes(*it.second.get());
-        memcpy(
-            bytesBufferOffset,
-            serializedAmount.data(),
-            kTrustLineAmountBytesCount);
+        trustLineAmountToBytes(
+            *it.second.get(),
+            bytesBufferOffset);
         bytesBufferOffset += kTrustLineAmountBytesCount;
     }
     //----------------------------------------------------
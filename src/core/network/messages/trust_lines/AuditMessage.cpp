@@ -34,16 +34,12 @@ AuditMessage::AuditMessage(
         sizeof(AuditNumber));
     bytesBufferOffset += sizeof(AuditNumber);
 
-    vector<byte> incomingAmountBytes(
-        buffer.get() + bytesBufferOffset,
-        buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mIncomingAmount = bytesToTrustLineAmount(incomingAmountBytes);
+    mIncomingAmount = bytesToTrustLineAmount(
+        buffer.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> outgoingAmountBytes(
-        buffer.get() + bytesBufferOffset,
-        buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mOutgoingAmount = bytesToTrustLineAmount(outgoingAmountBytes);
+    mOutgoingAmount = bytesToTrustLineAmount(
+        buffer.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
     memcpy(
@@ -116,18 +112,14 @@ pair<BytesShared, size_t> AuditMessage::serializeToBytes() const
         sizeof(AuditNumber));
     dataBytesOffset += sizeof(AuditNumber);
 
-    vector<byte> incomingAmountBuffer = trustLineAmountToBytes(mIncomingAmount);
-    memcpy(
-        buffer.get() + dataBytesOffset,
-        incomingAmountBuffer.data(),
-        incomingAmountBuffer.size());
+    trustLineAmountToBytes(
+        mIncomingAmount,
+        buffer.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> outgoingAmountBuffer = trustLineAmountToBytes(mOutgoingAmount);
-    memcpy(
-        buffer.get() + dataBytesOffset,
-        outgoingAmountBuffer.data(),
-        outgoingAmountBuffer.size());
+    trustLineAmountToBytes(
+        mOutgoingAmount,
+        buffer.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
     memcpy(
@@ -32,22 +32,16 @@ TrustLineResetMessage::TrustLineResetMessage(
         sizeof(AuditNumber));
     bytesBufferOffset += sizeof(AuditNumber);
 
-    vector<byte> incomingAmountBytes(
-        buffer.get() + bytesBufferOffset,
-        buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mIncomingAmount = bytesToTrustLineAmount(incomingAmountBytes);
+    mIncomingAmount = bytesToTrustLineAmount(
+        buffer.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> outgoingAmountBytes(
-        buffer.get() + bytesBufferOffset,
-        buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-    mOutgoingAmount = bytesToTrustLineAmount(outgoingAmountBytes);
+    mOutgoingAmount = bytesToTrustLineAmount(
+        buffer.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> balance(
-        buffer.get() + bytesBufferOffset,
-        buffer.get() + bytesBufferOffset + kTrustLineBalanceSerializeBytesCount);
-    mBalance = bytesToTrustLineBalance(balance);
+    mBalance = bytesToTrustLineBalance(
+        buffer.get() + bytesBufferOffset);
 }
 
 const Message::MessageType TrustLineResetMessage::typeID() const
@@ -104,25 +98,19 @@ pair<BytesShared, size_t> TrustLineResetMessage::serializeToBytes() const
         sizeof(AuditNumber));
     dataBytesOffset += sizeof(AuditNumber);
 
-    vector<byte> incomingAmountBuffer = trustLineAmountToBytes(mIncomingAmount);
-    memcpy(
-        buffer.get() + dataBytesOffset,
-        incomingAmountBuffer.data(),
-        incomingAmountBuffer.size());
+    trustLineAmountToBytes(
+        mIncomingAmount,
+        buffer.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> outgoingAmountBuffer = trustLineAmountToBytes(mOutgoingAmount);
-    memcpy(
-        buffer.get() + dataBytesOffset,
-        outgoingAmountBuffer.data(),
-        outgoingAmountBuffer.size());
+    trustLineAmountToBytes(
+        mOutgoingAmount,
+        buffer.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
 
-    vector<byte> balanceBuffer = trustLineBalanceToBytes(mBalance);
-    memcpy(
-        buffer.get() + dataBytesOffset,
-        balanceBuffer.data(),
-        balanceBuffer.size());
+    trustLineBalanceToBytes(
+        mBalance,
+        buffer.get() + dataBytesOffset);
 
     return make_pair(
         buffer,
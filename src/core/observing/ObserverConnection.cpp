@@ -0,0 +1,359 @@
+#include "ObserverConnection.h"
+
+ObserverConnection::ObserverConnection(
+    as::io_service &ioService,
+    IPv4WithPortAddress::Shared observerAddress,
+    Logger &logger) :
+
+    mObserverAddress(observerAddress),
+    mResolver(ioService),
+    mSocket(ioService),
+    mResponseTimer(ioService),
+    mLog(logger),
+    mConnectionState(Disconnected),
+    mConnectionNumber(0),
+    mIsWriteInProgress(false),
+    mIsReadInProgress(false),
+    mReceivedResponsesCount(0),
+    mResponseSize(0)
+{}
+
+ObserverConnection::~ObserverConnection()
+{
+    boost::system::error_code error;
+    mSocket.close(error);
+}
+
+void ObserverConnection::sendRequest(
+    ObservingMessage::Shared request,
+    ResponseHandler responseHandler)
+{
+    mQueuedRequests.push_back({
+        request->serializeToBytes(),
+        request->serializedSize(),
+        responseHandler,
+        false});
+
+    if (mConnectionState == Disconnected) {
+        connect();
+        return;
+    }
+    writeNextRequest();
+}
+
+void ObserverConnection::connect()
+{
+#ifdef DEBUG_LOG_OBSEVING_HANDLER
+    debug() << "connect to " << mObserverAddress->fullAddress();
+#endif
+    mConnectionState = Connecting;
+    mReceivedResponsesCount = 0;
+    tcp::resolver::query query(
+        tcp::v4(),
+        mObserverAddress->host(),
+        to_string(mObserverAddress->port()));
+    mResolver.async_resolve(
+        query,
+        boost::bind(
+            &ObserverConnection::handleResolved,
+            shared_from_this(),
+            mConnectionNumber,
+            as::placeholders::error,
+            as::placeholders::iterator));
+    rescheduleResponseTimeout();
+}
+
+void ObserverConnection::handleResolved(
+    const size_t connectionNumber,
+    const boost::system::error_code &error,
+    tcp::resolver::iterator endpointIterator)
+{
+    if (connectionNumber != mConnectionNumber) {
+        return;
+    }
+    if (error) {
+        handleConnectionError(
+            error,
+            false);
+        return;
+    }
+
+    as::async_connect(
+        mSocket,
+        endpointIterator,
+        boost::bind(
+            &ObserverConnection::handleConnected,
+            shared_from_this(),
+            mConnectionNumber,
+            as::placeholders::error,
+            as::placeholders::iterator));
+}
+
+void ObserverConnection::handleConnected(
+    const size_t connectionNumber,
+    const boost::system::error_code &error,
+    tcp::resolver::iterator endpointIterator)
+{
+    if (connectionNumber != mConnectionNumber) {
+        return;
+    }
+    if (error) {
+        handleConnectionError(
+            error,
+            false);
+        return;
+    }
+
+    mConnectionState = Connected;
+    writeNextRequest();
+}
+
+void ObserverConnection::writeNextRequest()
+{
+    if (mConnectionState != Connected or mIsWriteInProgress) {
+        return;
+    }
+    if (mQueuedRequests.empty() or mSentRequests.size() >= kMaxPipelinedRequestsCount) {
+        return;
+    }
+
+    mSentRequests.push_back(
+        mQueuedRequests.front());
+    mQueuedRequests.pop_front();
+
+    mIsWriteInProgress = true;
+    as::async_write(
+        mSocket,
+        as::buffer(
+            mSentRequests.back().mSerializedRequest.get(),
+            mSentRequests.back().mSerializedRequestSize),
+        boost::bind(
+            &ObserverConnection::handleRequestWritten,
+            shared_from_this(),
+            mConnectionNumber,
+            as::placeholders::error,
+            as::placeholders::bytes_transferred));
+
+    if (mSentRequests.size() == 1) {
+        rescheduleResponseTimeout();
+    }
+    readNextResponse();
+}
+
+void ObserverConnection::handleRequestWritten(
+    const size_t connectionNumber,
+    const boost::system::error_code &error,
+    const size_t bytesTransferred)
+{
+    if (connectionNumber != mConnectionNumber) {
+        return;
+    }
+    mIsWriteInProgress = false;
+    if (error) {
+        handleConnectionError(
+            error,
+            true);
+        return;
+    }
+
+    writeNextRequest();
+}
+
+void ObserverConnection::readNextResponse()
+{
+    if (mConnectionState != Connected or mIsReadInProgress or mSentRequests.empty()) {
+        return;
+    }
+
+    mIsReadInProgress = true;
+    as::async_read(
+        mSocket,
+        as::buffer(
+            &mResponseSize,
+            sizeof(ObservingMessage::MessageSize)),
+        boost::bind(
+            &ObserverConnection::handleResponseSizeRead,
+            shared_from_this(),
+            mConnectionNumber,
+            as::placeholders::error,
+            as::placeholders::bytes_transferred));
+}
+
+void ObserverConnection::handleResponseSizeRead(
+    const size_t connectionNumber,
+    const boost::system::error_code &error,
+    const size_t bytesTransferred)
+{
+    if (connectionNumber != mConnectionNumber) {
+        return;
+    }
+    if (error) {
+        mIsReadInProgress = false;
+        handleConnectionError(
+            error,
+            true);
+        return;
+    }
+
+    if (mResponseSize > kMaxResponseSize) {
+        warning() << "Reply size is too large";
+        mIsReadInProgress = false;
+        handleConnectionError(
+            as::error::message_size,
+            false);
+        return;
+    }
+#ifdef DEBUG_LOG_OBSEVING_HANDLER
+    debug() << "obtained reply size " << mResponseSize;
+#endif
+
+    mResponse = tryMalloc(mResponseSize);
+    as::async_read(
+        mSocket,
+        as::buffer(
+            mResponse.get(),
+            mResponseSize),
+        boost::bind(
+            &ObserverConnection::handleResponseRead,
+            shared_from_this(),
+            mConnectionNumber,
+            as::placeholders::error,
+            as::placeholders::bytes_transferred));
+}
+
+void ObserverConnection::handleResponseRead(
+    const size_t connectionNumber,
+    const boost::system::error_code &error,
+    const size_t bytesTransferred)
+{
+    if (connectionNumber != mConnectionNumber) {
+        return;
+    }
+    mIsReadInProgress = false;
+    if (error) {
+        handleConnectionError(
+            error,
+            true);
+        return;
+    }
+
+    mReceivedResponsesCount++;
+    auto responseHandler = mSentRequests.front().mResponseHandler;
+    mSentRequests.pop_front();
+    auto response = mResponse;
+    mResponse = nullptr;
+
+    rescheduleResponseTimeout();
+    readNextResponse();
+    writeNextRequest();
+
+    // handler is called last, because it can send next requests
+    responseHandler(response);
+}
+
+void ObserverConnection::rescheduleResponseTimeout()
+{
+    if (mConnectionState == Connected and mSentRequests.empty()) {
+        mResponseTimer.cancel();
+        return;
+    }
+
+    mResponseTimer.expires_from_now(
+        std::chrono::seconds(
+            +kResponseTimeoutSeconds));
+    mResponseTimer.async_wait(
+        boost::bind(
+            &ObserverConnection::handleResponseTimeout,
+            shared_from_this(),
+            mConnectionNumber,
+            as::placeholders::error));
+}
+
+void ObserverConnection::handleResponseTimeout(
+    const size_t connectionNumber,
+    const boost::system::error_code &error)
+{
+    if (connectionNumber != mConnectionNumber or error == as::error::operation_aborted) {
+        return;
+    }
+    if (mResponseTimer.expiry() > as::steady_timer::clock_type::now()) {
+        // timer was rescheduled after this handler was queued
+        return;
+    }
+    if (mConnectionState == Connected and mSentRequests.empty()) {
+        return;
+    }
+
+    warning() << "Observer " << mObserverAddress->fullAddress() << " doesn't respond";
+    handleConnectionError(
+        as::error::timed_out,
+        false);
+}
+
+void ObserverConnection::handleConnectionError(
+    const boost::system::error_code &error,
+    bool isResendingAllowed)
+{
+    if (error != as::error::eof) {
+        warning() << "Connection to observer " << mObserverAddress->fullAddress()
+                  << " failed: " << error.message();
+    }
+
+    boost::system::error_code closingError;
+    mSocket.close(closingError);
+    mResolver.cancel();
+    mResponseTimer.cancel();
+    mConnectionNumber++;
+    mConnectionState = Disconnected;
+    mIsWriteInProgress = false;
+    mIsReadInProgress = false;
+    mResponse = nullptr;
+
+    // observer can close connection after each response,
+    // so requests are sent again in case if observer responded via this connection,
+    // or if they were not sent again before
+    deque<Request> failedRequests;
+    while (!mSentRequests.empty()) {
+        auto request = mSentRequests.back();
+        mSentRequests.pop_back();
+        if (isResendingAllowed and (mReceivedResponsesCount > 0 or !request.mIsResent)) {
+            request.mIsResent = true;
+            mQueuedRequests.push_front(request);
+        } else {
+            failedRequests.push_front(request);
+        }
+    }
+    if (!isResendingAllowed) {
+        failedRequests.insert(
+            failedRequests.end(),
+            mQueuedRequests.begin(),
+            mQueuedRequests.end());
+        mQueuedRequests.clear();
+    }
+
+    if (!mQueuedRequests.empty()) {
+        connect();
+    }
+
+    for (const auto &request : failedRequests) {
+        request.mResponseHandler(nullptr);
+    }
+}
+
+string ObserverConnection::logHeader()
+    noexcept
+{
+    return "[ObserverConnection]";
+}
+
+LoggerStream ObserverConnection::warning() const
+    noexcept
+{
+    return mLog.warning(logHeader());
+}
+
+LoggerStream ObserverConnection::debug() const
+    noexcept
+{
+    return mLog.debug(logHeader());
+}
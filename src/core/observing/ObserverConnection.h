@@ -0,0 +1,148 @@
+#ifndef GEO_NETWORK_CLIENT_OBSERVERCONNECTION_H
+#define GEO_NETWORK_CLIENT_OBSERVERCONNECTION_H
+
+#include "../contractors/addresses/IPv4WithPortAddress.h"
+#include "messages/base/ObservingMessage.hpp"
+#include "../logger/Logger.h"
+
+#include <boost/asio.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/bind.hpp>
+
+#include <deque>
+#include <functional>
+
+using boost::asio::ip::tcp;
+namespace as = boost::asio;
+
+/**
+ * Persistent connection to one observer.
+ *
+ * Requests are written into the connection one after another without waiting for responses
+ * (up to kMaxPipelinedRequestsCount requests), responses are read in order of requests.
+ * Connection is established on first request and is reused for all next ones.
+ *
+ * In case if observer doesn't respond during kResponseTimeoutSeconds, connection is closed
+ * and all its requests are failed. In case if connection was closed by observer,
+ * not answered requests are sent again via new connection.
+ */
+class ObserverConnection:
+    public enable_shared_from_this<ObserverConnection> {
+
+public:
+    typedef shared_ptr<ObserverConnection> Shared;
+
+    // response is nullptr in case if request was failed
+    typedef function<void(BytesShared)> ResponseHandler;
+
+public:
+    ObserverConnection(
+        as::io_service &ioService,
+        IPv4WithPortAddress::Shared observerAddress,
+        Logger &logger);
+
+    ~ObserverConnection();
+
+    void sendRequest(
+        ObservingMessage::Shared request,
+        ResponseHandler responseHandler);
+
+protected:
+    struct Request {
+        BytesShared mSerializedRequest;
+        size_t mSerializedRequestSize;
+        ResponseHandler mResponseHandler;
+        bool mIsResent;
+    };
+
+    enum ConnectionState {
+        Disconnected = 0,
+        Connecting,
+        Connected,
+    };
+
+protected:
+    void connect();
+
+    void handleResolved(
+        const size_t connectionNumber,
+        const boost::system::error_code &error,
+        tcp::resolver::iterator endpointIterator);
+
+    void handleConnected(
+        const size_t connectionNumber,
+        const boost::system::error_code &error,
+        tcp::resolver::iterator endpointIterator);
+
+    void writeNextRequest();
+
+    void handleRequestWritten(
+        const size_t connectionNumber,
+        const boost::system::error_code &error,
+        const size_t bytesTransferred);
+
+    void readNextResponse();
+
+    void handleResponseSizeRead(
+        const size_t connectionNumber,
+        const boost::system::error_code &error,
+        const size_t bytesTransferred);
+
+    void handleResponseRead(
+        const size_t connectionNumber,
+        const boost::system::error_code &error,
+        const size_t bytesTransferred);
+
+    void rescheduleResponseTimeout();
+
+    void handleResponseTimeout(
+        const size_t connectionNumber,
+        const boost::system::error_code &error);
+
+    /**
+     * Closes connection. Requests, which were not answered, are sent again via new connection,
+     * if it is allowed, otherwise they are failed.
+     */
+    void handleConnectionError(
+        const boost::system::error_code &error,
+        bool isResendingAllowed);
+
+    static string logHeader()
+    noexcept;
+
+    LoggerStream warning() const
+    noexcept;
+
+    LoggerStream debug() const
+    noexcept;
+
+protected:
+    static const constexpr size_t kMaxPipelinedRequestsCount = 16;
+    static const constexpr uint32_t kResponseTimeoutSeconds = 5;
+    static const constexpr ObservingMessage::MessageSize kMaxResponseSize = 32 * 1024 * 1024;
+
+    IPv4WithPortAddress::Shared mObserverAddress;
+    tcp::resolver mResolver;
+    tcp::socket mSocket;
+    as::steady_timer mResponseTimer;
+    Logger &mLog;
+
+    ConnectionState mConnectionState;
+    // is incremented on each connection closing,
+    // handlers of asynchronous operations of closed connections are ignored
+    size_t mConnectionNumber;
+    bool mIsWriteInProgress;
+    bool mIsReadInProgress;
+    // count of responses, received on current connection
+    size_t mReceivedResponsesCount;
+
+    // requests, which are not written into connection yet
+    deque<Request> mQueuedRequests;
+    // requests, which are written into connection and are waiting for responses in order of writing
+    deque<Request> mSentRequests;
+
+    ObservingMessage::MessageSize mResponseSize;
+    BytesShared mResponse;
+};
+
+#endif //GEO_NETWORK_CLIENT_OBSERVERCONNECTION_H
@@ -7,65 +7,27 @@ ObservingCommunicator::ObservingCommunicator(
     mLogger(logger)
 {}
 
-BytesShared ObservingCommunicator::sendRequestToObserver(
+void ObservingCommunicator::sendRequestToObserver(
     IPv4WithPortAddress::Shared observerAddress,
-    ObservingMessage::Shared request)
+    ObservingMessage::Shared request,
+    ResponseHandler responseHandler)
 {
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
     debug() << "sendRequestToObserver " << observerAddress->fullAddress();
 #endif
-    tcp::resolver resolver(mIOService);
-    tcp::resolver::query query(
-        tcp::v4(),
-        observerAddress->host(),
-        to_string(observerAddress->port()));
-    tcp::resolver::iterator iterator = resolver.resolve(query);
-    tcp::resolver::iterator end;
-
-    tcp::socket socket(mIOService);
-    boost::system::error_code errorCode = boost::asio::error::host_not_found;
-    while(errorCode && iterator != end) {
-        socket.close();
-        socket.connect(*iterator++, errorCode);
-    }
-    if (errorCode) {
-        throw errorCode;
+    auto connection = mConnections.find(observerAddress->fullAddress());
+    if (connection == mConnections.end()) {
+        connection = mConnections.insert(
+            make_pair(
+                observerAddress->fullAddress(),
+                make_shared<ObserverConnection>(
+                    mIOService,
+                    observerAddress,
+                    mLogger))).first;
     }
-
-    auto serializedRequest = request->serializeToBytes();
-    boost::asio::write(
-        socket,
-        boost::asio::buffer(
-            serializedRequest.get(),
-            request->serializedSize()));
-#ifdef DEBUG_LOG_OBSEVING_HANDLER
-    debug() << "request sent";
-#endif
-
-    ObservingMessage::MessageSize replySize;
-    boost::asio::read(
-        socket,
-        boost::asio::buffer(
-            &replySize,
-            sizeof(ObservingMessage::MessageSize)));
-
-    if (replySize > 32 * 1024 * 1024) {
-        error() << "Reply size is too large";
-        throw boost::asio::error::message_size;
-    }
-#ifdef DEBUG_LOG_OBSEVING_HANDLER
-    debug() << "obtained reply size " << replySize;
-#endif
-
-    BytesShared result = tryMalloc(replySize);
-    boost::asio::read(
-        socket,
-        boost::asio::buffer(
-            result.get(),
-            replySize));
-
-    socket.close();
-    return result;
+    connection->second->sendRequest(
+        request,
+        responseHandler);
 }
 
 string ObservingCommunicator::logHeader()
@@ -86,4 +48,4 @@ LoggerStream ObservingCommunicator::debug() const
 LoggerStream ObservingCommunicator::info() const
 {
     return mLogger.info(logHeader());
-}
\ No newline at end of file
+}
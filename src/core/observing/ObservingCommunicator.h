@@ -1,24 +1,41 @@
 #ifndef GEO_NETWORK_CLIENT_OBSERVINGCOMMUNICATOR_H
 #define GEO_NETWORK_CLIENT_OBSERVINGCOMMUNICATOR_H
 
+#include "ObserverConnection.h"
 #include "../contractors/addresses/IPv4WithPortAddress.h"
 #include "messages/base/ObservingMessage.hpp"
 #include "../logger/Logger.h"
 
 #include <boost/asio.hpp>
 
+#include <map>
+
 using boost::asio::ip::tcp;
 
+/**
+ * Asynchronous client of observers.
+ * Keeps one persistent connection per observer, requests to the same observer are pipelined
+ * into its connection (see ObserverConnection for the details).
+ */
 class ObservingCommunicator {
 
+public:
+    typedef ObserverConnection::ResponseHandler ResponseHandler;
+
 public:
     ObservingCommunicator(
         IOService &ioService,
         Logger &logger);
 
-    BytesShared sendRequestToObserver(
+    /**
+     * Sends request to the observer and calls responseHandler with response from it,
+     * or with nullptr in case if observer is inaccessible or doesn't respond in time.
+     * Method doesn't block, responseHandler is always called asynchronously.
+     */
+    void sendRequestToObserver(
         IPv4WithPortAddress::Shared observerAddress,
-        ObservingMessage::Shared request);
+        ObservingMessage::Shared request,
+        ResponseHandler responseHandler);
 
 protected:
     static string logHeader();
@@ -32,6 +49,9 @@ protected:
 private:
     IOService &mIOService;
     Logger &mLogger;
+
+    // observer address and connection to it
+    map<string, ObserverConnection::Shared> mConnections;
 };
 
 
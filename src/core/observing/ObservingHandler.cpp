@@ -3,6 +3,7 @@
 ObservingHandler::ObservingHandler(
     vector<pair<string, string>> observersAddressesStr,
     IOService &ioService,
+    TimerService *timerService,
     StorageHandler *storageHandler,
     ResourcesManager *resourcesManager,
     Logger &logger) :
@@ -11,10 +12,10 @@ ObservingHandler::ObservingHandler(
         make_unique<ObservingCommunicator>(
             ioService,
             logger)),
-    mBlockNumberRequestTimer(ioService),
-    mClaimsTimer(ioService),
-    mTransactionsTimer(ioService),
-    mRequestsTimer(ioService),
+    mBlockNumberRequestTimer(timerService),
+    mClaimsTimer(timerService),
+    mTransactionsTimer(timerService),
+    mRequestsTimer(timerService),
     mStorageHandler(storageHandler),
     mResourcesManager(resourcesManager)
 {
@@ -48,13 +49,12 @@ ObservingHandler::ObservingHandler(
     }
     debug() << "Checking transactions count " << mCheckedTransactions.size();
 
-    mBlockNumberRequestTimer.expires_from_now(
+    mBlockNumberRequestTimer.expiresFromNow(
         std::chrono::seconds(
-            +kInitialObservingRequestShiftSeconds));
-    mBlockNumberRequestTimer.async_wait(
-        boost::bind(
-            &ObservingHandler::initialObservingRequest,
-            this));
+            +kInitialObservingRequestShiftSeconds),
+        [this]() {
+            initialObservingRequest();
+        });
 }
 
 void ObservingHandler::sendClaimRequestToObservers(
@@ -67,62 +67,48 @@ void ObservingHandler::sendClaimRequestToObservers(
     mClaims.insert(make_pair(
         request->transactionUUID(),
         newClaim));
+    mClaimsInProcessing.insert(
+        request->transactionUUID());
 
     auto ioTransaction = mStorageHandler->beginTransaction();
     ioTransaction->paymentTransactionsHandler()->updateTransactionState(
         request->transactionUUID(),
         ObservingTransaction::ClaimInPool);
 
-    for (const auto &observer : mObservers) {
-        BytesShared observingResponse;
-        try {
-            observingResponse = mObservingCommunicator->sendRequestToObserver(
-                observer,
-                request);
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observer " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-        try {
+    sendRequestToObservers(
+        request,
+        [this, newClaim] (IPv4WithPortAddress::Shared observer, BytesShared observingResponse) {
             auto claimAppendResponse = make_shared<ObservingClaimAppendResponseMessage>(
                 observingResponse);
             info() << "claimAppendResponse " << claimAppendResponse->observingResponse();
 
             if (claimAppendResponse->observingResponse() == ObservingTransaction::NoInfo) {
-                continue;
+                return false;
             }
+            finishClaimProcessing(newClaim->transactionUUID());
             // if claim period has expired, then transaction should stay serialized and hold reservations forever
             if (claimAppendResponse->observingResponse() == ObservingTransaction::ClaimTimeExpired) {
                 info() << "Claim period has expired";
                 mUncertainTransactionSignal(
-                    request->transactionUUID(),
-                    request->maximalClaimingBlockNumber());
-                mClaims.erase(request->transactionUUID());
-                return;
+                    newClaim->transactionUUID(),
+                    newClaim->observingRequestMessage()->maximalClaimingBlockNumber());
+                mClaims.erase(newClaim->transactionUUID());
+                return true;
             }
 
             newClaim->addRequestedObserver(
                 observer);
             newClaim->setObservingResponseType(
                 ObservingTransaction::ClaimInPool);
-            if (mClaims.size() == 1) {
-                rescheduleResending();
-            }
-            return;
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-    }
-
-    warning() << "Can't send claim to all observers";
-    newClaim->rescheduleNextActionSmallTime();
-    if (mClaims.size() == 1) {
-        rescheduleResending();
-    }
+            rescheduleResending();
+            return true;
+        },
+        [this, newClaim] () {
+            warning() << "Can't send claim to all observers";
+            newClaim->rescheduleNextActionSmallTime();
+            finishClaimProcessing(newClaim->transactionUUID());
+            rescheduleResending();
+        });
 }
 
 void ObservingHandler::addTransactionForChecking(
@@ -136,6 +122,15 @@ void ObservingHandler::addTransactionForChecking(
         make_pair(
             transactionUUID,
             maxBlockNumberForClaiming));
+    // checking is not scheduled while there are no checked transactions
+    if (!mTransactionsTimer.isPending() and !mLastUpdatedBlockNumber.second.is_not_a_date_time()) {
+        auto transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalRepeatTimeSeconds;
+#ifdef TESTS
+        transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalRepeatTimeSecondsTests;
+#endif
+        scheduleTransactionsChecking(
+            transactionCheckingSignalRepeatTimeSeconds);
+    }
 }
 
 void ObservingHandler::requestActualBlockNumber(
@@ -144,14 +139,58 @@ void ObservingHandler::requestActualBlockNumber(
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
     debug() << "requestActualBlockNumber for " << transactionUUID;
 #endif
-    mRequestsTimer.expires_from_now(
-        std::chrono::milliseconds(
-            5));
-    mRequestsTimer.async_wait(
-        boost::bind(
-            &ObservingHandler::responseActualBlockNumber,
-            this,
-            transactionUUID));
+    mBlockNumberRequests.push_back(
+        transactionUUID);
+    if (!mRequestsTimer.isPending()) {
+        mRequestsTimer.expiresFromNow(
+            std::chrono::milliseconds(
+                5),
+            [this]() {
+                responseActualBlockNumbers();
+            });
+    }
+}
+
+void ObservingHandler::sendRequestToObservers(
+    ObservingMessage::Shared request,
+    ObserverResponseHandler responseHandler,
+    ObserversFailureHandler failureHandler,
+    IPv4WithPortAddress::Shared skippedObserver,
+    size_t observerIndex)
+{
+    if (mObservers.size() > 1 and observerIndex < mObservers.size() and
+            mObservers.at(observerIndex) == skippedObserver) {
+        observerIndex++;
+    }
+    if (observerIndex >= mObservers.size()) {
+        failureHandler();
+        return;
+    }
+
+    auto observer = mObservers.at(observerIndex);
+    mObservingCommunicator->sendRequestToObserver(
+        observer,
+        request,
+        [this, request, responseHandler, failureHandler, skippedObserver, observerIndex, observer]
+                (BytesShared observerResponse) {
+            if (observerResponse == nullptr) {
+                this->warning() << "Can't send request to observer " << observer->fullAddress();
+            } else {
+                try {
+                    if (responseHandler(observer, observerResponse)) {
+                        return;
+                    }
+                } catch (std::exception &e) {
+                    this->warning() << "Can't parse observer response " << e.what();
+                }
+            }
+            sendRequestToObservers(
+                request,
+                responseHandler,
+                failureHandler,
+                skippedObserver,
+                observerIndex + 1);
+        });
 }
 
 void ObservingHandler::initialObservingRequest()
@@ -161,23 +200,9 @@ void ObservingHandler::initialObservingRequest()
 #endif
     mBlockNumberRequestTimer.cancel();
 
-    auto getActualBlockNumberMessage = make_shared<ObservingBlockNumberRequest>();
-    BytesShared observerResponse;
-
-    for (const auto &observer : mObservers) {
-        try {
-            observerResponse = mObservingCommunicator->sendRequestToObserver(
-                observer,
-                getActualBlockNumberMessage);
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observer " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-
-        try {
+    sendRequestToObservers(
+        make_shared<ObservingBlockNumberRequest>(),
+        [this] (IPv4WithPortAddress::Shared, BytesShared observerResponse) {
             auto actualBlockNumberResponse = make_shared<ObservingBlockNumberResponse>(
                 observerResponse);
 
@@ -187,29 +212,19 @@ void ObservingHandler::initialObservingRequest()
                 utc_now());
 
             mAllowPaymentTransactionsSignal(true);
-            mTransactionsTimer.expires_from_now(
+            scheduleTransactionsChecking(
+                kInitialObservingRequestShiftSeconds);
+            return true;
+        },
+        [this] () {
+            warning() << "Can't get actual block number from all observers";
+            mBlockNumberRequestTimer.expiresFromNow(
                 std::chrono::seconds(
-                    +kInitialObservingRequestShiftSeconds));
-            mTransactionsTimer.async_wait(
-                boost::bind(
-                    &ObservingHandler::runTransactionsChecking,
-                    this,
-                    as::placeholders::error));
-            return;
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-    }
-
-    warning() << "Can't get actual block number from all observers";
-    mBlockNumberRequestTimer.expires_from_now(
-        std::chrono::seconds(
-            +kInitialObservingRequestNextSeconds));
-    mBlockNumberRequestTimer.async_wait(
-        boost::bind(
-            &ObservingHandler::initialObservingRequest,
-            this));
+                    +kInitialObservingRequestNextSeconds),
+                [this]() {
+                    initialObservingRequest();
+                });
+        });
 }
 
 const DateTime ObservingHandler::closestClaimPerformingTimestamp() const
@@ -242,12 +257,7 @@ void ObservingHandler::rescheduleResending()
     }
 
     const auto kCleaningTimeout = closestClaimPerformingTimestamp() - utc_now();
-    mClaimsTimer.expires_from_now(chrono::microseconds(kCleaningTimeout.total_microseconds()));
-    mClaimsTimer.async_wait([this] (const boost::system::error_code &e) {
-
-        if (e == boost::asio::error::operation_aborted) {
-            return;
-        }
+    mClaimsTimer.expiresFromNow(chrono::microseconds(kCleaningTimeout.total_microseconds()), [this] () {
 
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
         this->debug() << "Actions performing started.";
@@ -266,59 +276,61 @@ void ObservingHandler::performActions()
 {
     const auto now = utc_now();
 
+    // claims, which states should be checked, grouped by observer, which accepted claim
+    map<string, vector<ObservingTransaction::Shared>> checkedClaims;
+    vector<ObservingTransaction::Shared> resentClaims;
     for (const auto &claim : mClaims) {
         if (claim.second->nextActionDateTime() > now) {
             // This claim's timeout is not fired up yet.
             continue;
         }
+        if (mClaimsInProcessing.count(claim.first) != 0) {
+            // Responses on previous requests for this claim are not received yet.
+            continue;
+        }
 
         if (claim.second->observingResponseType() == ObservingTransaction::ParticipantsVotesPresent) {
             // todo : need correct reaction
         }
-        if (performOneClaim(claim.second)) {
-            mClaims.erase(claim.first);
+        debug() << "perform claim " << claim.first
+                << " type " << claim.second->observingResponseType()
+                << " maximalBlockN " << claim.second->observingRequestMessage()->maximalClaimingBlockNumber();
+        if (claim.second->observingResponseType() == ObservingTransaction::NoInfo) {
+            resentClaims.push_back(claim.second);
+            continue;
         }
+        checkedClaims[claim.second->requestedObserver()->fullAddress()].push_back(
+            claim.second);
     }
-}
 
-bool ObservingHandler::performOneClaim(
-    ObservingTransaction::Shared observingTransaction)
-{
-    debug() << "performOneClaim " << observingTransaction->transactionUUID()
-            << " type " << observingTransaction->observingResponseType()
-            << " maximalBlockN " << observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber();
-    if (observingTransaction->observingResponseType() == ObservingTransaction::NoInfo) {
-        sendClaimAgain(
-            observingTransaction);
-        return false;
+    // claims are sent again and checked asynchronously, so mClaims can be changed only after this loop
+    for (const auto &claim : resentClaims) {
+        sendClaimAgain(claim);
+    }
+    for (const auto &observerAndClaims : checkedClaims) {
+        checkClaimsStates(observerAndClaims.second);
     }
+}
 
+void ObservingHandler::checkClaimsStates(
+    vector<ObservingTransaction::Shared> observingTransactions)
+{
+    debug() << "checkClaimsStates " << observingTransactions.size();
     vector<pair<TransactionUUID, BlockNumber>> requestedTransactions;
-    requestedTransactions.emplace_back(
-        observingTransaction->transactionUUID(),
-        observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber());
-    auto claimCheck = make_shared<ObservingTransactionsRequestMessage>(
+    for (const auto &observingTransaction : observingTransactions) {
+        requestedTransactions.emplace_back(
+            observingTransaction->transactionUUID(),
+            observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber());
+        mClaimsInProcessing.insert(
+            observingTransaction->transactionUUID());
+    }
+    auto claimsCheck = make_shared<ObservingTransactionsRequestMessage>(
         requestedTransactions);
 
-    BytesShared observerResponse;
-    for (const auto &observer : mObservers) {
-        if (mObservers.size() > 1 and observer == observingTransaction->requestedObserver()) {
-            // we check if claim in block on all observers except those which accepted claim
-            continue;
-        }
-        try {
-            observerResponse = mObservingCommunicator->sendRequestToObserver(
-                observer,
-                claimCheck);
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observer " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-        ObservingTransaction::ObservingResponseType observingResponseType;
-        try {
+    // we check if claim in block on all observers except those which accepted claim
+    sendRequestToObservers(
+        claimsCheck,
+        [this, observingTransactions] (IPv4WithPortAddress::Shared, BytesShared observerResponse) {
             auto actualTransactionStateResponse = make_shared<ObservingTransactionsResponseMessage>(
                 observerResponse);
             mLastUpdatedBlockNumber = make_pair(
@@ -327,56 +339,75 @@ bool ObservingHandler::performOneClaim(
 
             debug() << "Actual block number " << actualTransactionStateResponse->actualBlockNumber();
             debug() << "Observer response " << actualTransactionStateResponse->transactionsResponses().size();
-            if (actualTransactionStateResponse->transactionsResponses().size() > 1) {
+            if (actualTransactionStateResponse->transactionsResponses().size() != observingTransactions.size()) {
                 warning() << "Size of received transactions is invalid";
-                continue;
+                return false;
             }
-            observingResponseType = actualTransactionStateResponse->transactionsResponses().at(0);
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-#ifdef DEBUG_LOG_OBSEVING_HANDLER
-        debug() << "Transaction state " << observingResponseType;
-#endif
-        if (observingResponseType == ObservingTransaction::NoInfo) {
-            debug() << "No Info";
-            // todo : need correct reaction
-        } else if (observingResponseType == ObservingTransaction::ClaimInPool or
-                observingResponseType == ObservingTransaction::ClaimInBlock) {
-            info() << "ClaimInBlock";
-            observingTransaction->setObservingResponseType(observingResponseType);
-            if (mLastUpdatedBlockNumber.first >
-                observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber()) {
-                info() << "Claiming time has expired, transaction rejected";
-                mRejectTransactionSignal(
-                    observingTransaction->transactionUUID(),
-                    observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber());
-                auto ioTransaction = mStorageHandler->beginTransaction();
-                ioTransaction->paymentTransactionsHandler()->updateTransactionState(
-                    observingTransaction->transactionUUID(),
-                    ObservingTransaction::RejectedByObserving);
-                return true;
+
+            size_t idxProcessedTransaction = 0;
+            for (const auto &observingResponseType : actualTransactionStateResponse->transactionsResponses()) {
+                auto observingTransaction = observingTransactions.at(idxProcessedTransaction++);
+                if (processClaimState(observingTransaction, observingResponseType)) {
+                    mClaims.erase(observingTransaction->transactionUUID());
+                }
             }
-            observingTransaction->rescheduleNextActionTime();
-            return false;
-        } else if (observingResponseType == ObservingTransaction::ParticipantsVotesPresent) {
-            info() << "ParticipantsVotesPresent";
-            if (!getParticipantsVotes(
-                    observingTransaction->transactionUUID(),
-                    observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber())) {
+            rescheduleResending();
+            return true;
+        },
+        [this, observingTransactions] () {
+            warning() << "Can't send request to all observers";
+            for (const auto &observingTransaction : observingTransactions) {
                 observingTransaction->rescheduleNextActionSmallTime();
-                return false;
+                finishClaimProcessing(observingTransaction->transactionUUID());
             }
+            rescheduleResending();
+        },
+        observingTransactions.front()->requestedObserver());
+}
+
+bool ObservingHandler::processClaimState(
+    ObservingTransaction::Shared observingTransaction,
+    ObservingTransaction::ObservingResponseType observingResponseType)
+{
+#ifdef DEBUG_LOG_OBSEVING_HANDLER
+    debug() << "Transaction " << observingTransaction->transactionUUID() << " state " << observingResponseType;
+#endif
+    if (observingResponseType == ObservingTransaction::NoInfo) {
+        debug() << "No Info";
+        // todo : need correct reaction
+        observingTransaction->rescheduleNextActionSmallTime();
+        finishClaimProcessing(observingTransaction->transactionUUID());
+        return false;
+    } else if (observingResponseType == ObservingTransaction::ClaimInPool or
+            observingResponseType == ObservingTransaction::ClaimInBlock) {
+        info() << "ClaimInBlock";
+        finishClaimProcessing(observingTransaction->transactionUUID());
+        observingTransaction->setObservingResponseType(observingResponseType);
+        if (mLastUpdatedBlockNumber.first >
+            observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber()) {
+            info() << "Claiming time has expired, transaction rejected";
+            mRejectTransactionSignal(
+                observingTransaction->transactionUUID(),
+                observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber());
+            auto ioTransaction = mStorageHandler->beginTransaction();
+            ioTransaction->paymentTransactionsHandler()->updateTransactionState(
+                observingTransaction->transactionUUID(),
+                ObservingTransaction::RejectedByObserving);
             return true;
-        } else {
-            warning() << "Unexpected transaction state " << observingResponseType;
-            continue;
         }
+        observingTransaction->rescheduleNextActionTime();
+        return false;
+    } else if (observingResponseType == ObservingTransaction::ParticipantsVotesPresent) {
+        info() << "ParticipantsVotesPresent";
+        // claim stays in processing until participants votes would be received
+        getParticipantsVotes(
+            observingTransaction);
+        return false;
     }
 
-    warning() << "Can't send request to all observers";
+    warning() << "Unexpected transaction state " << observingResponseType;
     observingTransaction->rescheduleNextActionSmallTime();
+    finishClaimProcessing(observingTransaction->transactionUUID());
     return false;
 }
 
@@ -384,27 +415,19 @@ void ObservingHandler::sendClaimAgain(
     ObservingTransaction::Shared observingTransaction)
 {
     debug() << "sendClaimAgain " << observingTransaction->transactionUUID();
-    for (const auto &observer : mObservers) {
-        BytesShared observingResponse;
-        try {
-            observingResponse = mObservingCommunicator->sendRequestToObserver(
-                observer,
-                observingTransaction->observingRequestMessage());
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observer " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-        try {
+    mClaimsInProcessing.insert(
+        observingTransaction->transactionUUID());
+    sendRequestToObservers(
+        observingTransaction->observingRequestMessage(),
+        [this, observingTransaction] (IPv4WithPortAddress::Shared observer, BytesShared observingResponse) {
             auto claimAppendResponse = make_shared<ObservingClaimAppendResponseMessage>(
                 observingResponse);
             info() << "claimAppendResponse " << claimAppendResponse->observingResponse();
 
             if (claimAppendResponse->observingResponse() == ObservingTransaction::NoInfo) {
-                continue;
+                return false;
             }
+            finishClaimProcessing(observingTransaction->transactionUUID());
             // if claim period has expired, then transaction should stay serialized and hold reservations forever
             if (claimAppendResponse->observingResponse() == ObservingTransaction::ClaimTimeExpired) {
                 info() << "Claim period has expired";
@@ -412,7 +435,7 @@ void ObservingHandler::sendClaimAgain(
                     observingTransaction->transactionUUID(),
                     observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber());
                 mClaims.erase(observingTransaction->transactionUUID());
-                return;
+                return true;
             }
 
             observingTransaction->addRequestedObserver(
@@ -420,93 +443,74 @@ void ObservingHandler::sendClaimAgain(
             observingTransaction->setObservingResponseType(
                 ObservingTransaction::ClaimInPool);
             observingTransaction->rescheduleNextActionTime();
-            return;
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-    }
-
-    warning() << "Can't send claim to all observers";
-    observingTransaction->rescheduleNextActionSmallTime();
+            rescheduleResending();
+            return true;
+        },
+        [this, observingTransaction] () {
+            warning() << "Can't send claim to all observers";
+            observingTransaction->rescheduleNextActionSmallTime();
+            finishClaimProcessing(observingTransaction->transactionUUID());
+            rescheduleResending();
+        });
 }
 
-bool ObservingHandler::getParticipantsVotes(
-    const TransactionUUID &transactionUUID,
-    BlockNumber maximalClaimingBlockNumber)
+void ObservingHandler::getParticipantsVotes(
+    ObservingTransaction::Shared observingTransaction)
 {
+    const auto transactionUUID = observingTransaction->transactionUUID();
+    const auto maximalClaimingBlockNumber = observingTransaction->observingRequestMessage()->maximalClaimingBlockNumber();
     info() << "getParticipantsVotes " << transactionUUID;
     auto getTSLRequest = make_shared<ObservingParticipantsVotesRequestMessage>(
         transactionUUID,
         maximalClaimingBlockNumber);
-    for (const auto &observer : mObservers) {
-        BytesShared observerResponse;
-        try {
-            observerResponse = mObservingCommunicator->sendRequestToObserver(
-                observer,
-                getTSLRequest);
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observer " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-        try {
+    sendRequestToObservers(
+        getTSLRequest,
+        [this, transactionUUID, maximalClaimingBlockNumber] (IPv4WithPortAddress::Shared, BytesShared observerResponse) {
             auto participantsVotesMessage = make_shared<ObservingParticipantsVotesResponseMessage>(
                 observerResponse);
             if (!participantsVotesMessage->isParticipantsVotesPresent()) {
                 warning() << "ParticipantsVotes are absent";
-                continue;
+                return false;
             }
             info() << "Receive participants votes " << participantsVotesMessage->transactionUUID() << " "
-                    << participantsVotesMessage->maximalClaimingBlockNumber() << " "
-                    << participantsVotesMessage->participantsSignatures().size();
+                   << participantsVotesMessage->maximalClaimingBlockNumber() << " "
+                   << participantsVotesMessage->participantsSignatures().size();
             // todo : check if participantsVotesMessage is correct
             mParticipantsVotesSignal(
                 transactionUUID,
                 maximalClaimingBlockNumber,
                 participantsVotesMessage->participantsSignatures());
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-        auto ioTransaction = mStorageHandler->beginTransaction();
-        ioTransaction->paymentTransactionsHandler()->updateTransactionState(
-            transactionUUID,
-            ObservingTransaction::ParticipantsVotesPresent);
-        return true;
-    }
 
-    warning() << "Can't get ParticipantsVotes from all observers";
-    return false;
+            auto ioTransaction = mStorageHandler->beginTransaction();
+            ioTransaction->paymentTransactionsHandler()->updateTransactionState(
+                transactionUUID,
+                ObservingTransaction::ParticipantsVotesPresent);
+            finishClaimProcessing(transactionUUID);
+            mClaims.erase(transactionUUID);
+            rescheduleResending();
+            return true;
+        },
+        [this, observingTransaction] () {
+            warning() << "Can't get ParticipantsVotes from all observers";
+            observingTransaction->rescheduleNextActionSmallTime();
+            finishClaimProcessing(observingTransaction->transactionUUID());
+            rescheduleResending();
+        });
+}
+
+void ObservingHandler::finishClaimProcessing(
+    const TransactionUUID &transactionUUID)
+{
+    mClaimsInProcessing.erase(transactionUUID);
 }
 
-void ObservingHandler::runTransactionsChecking(
-    const boost::system::error_code &errorCode)
+void ObservingHandler::runTransactionsChecking()
 {
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
     debug() << "runTransactionsChecking";
 #endif
-    if (errorCode) {
-        warning() << errorCode.message().c_str();
-    }
-    mTransactionsTimer.cancel();
-
     if (mCheckedTransactions.empty()) {
-        mTransactionsTimer.expires_from_now(
-            std::chrono::seconds(
-                +kTransactionCheckingSignalRepeatTimeSeconds));
-#ifdef TESTS
-        mTransactionsTimer.expires_from_now(
-            std::chrono::seconds(
-                +kTransactionCheckingSignalRepeatTimeSecondsTests));
-#endif
-        mTransactionsTimer.async_wait(
-            boost::bind(
-                &ObservingHandler::runTransactionsChecking,
-                this,
-                as::placeholders::error));
+        // checking is scheduled again by addTransactionForChecking
         return;
     }
 
@@ -516,185 +520,159 @@ void ObservingHandler::runTransactionsChecking(
     }
     auto transactionsRequestMessage = make_shared<ObservingTransactionsRequestMessage>(
         checkedTransactions);
-    BytesShared observerResponse;
-    for (const auto &observer : mObservers) {
-        try {
-            observerResponse = mObservingCommunicator->sendRequestToObserver(
-                mObservers.front(),
-                transactionsRequestMessage);
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observers " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-        ObservingTransactionsResponseMessage::Shared transactionsResponse;
-        try {
-            transactionsResponse = make_shared<ObservingTransactionsResponseMessage>(
+    sendRequestToObservers(
+        transactionsRequestMessage,
+        [this, checkedTransactions] (IPv4WithPortAddress::Shared, BytesShared observerResponse) {
+            auto transactionsResponse = make_shared<ObservingTransactionsResponseMessage>(
                 observerResponse);
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-        mLastUpdatedBlockNumber = make_pair(
-            transactionsResponse->actualBlockNumber(),
-            utc_now());
+            mLastUpdatedBlockNumber = make_pair(
+                transactionsResponse->actualBlockNumber(),
+                utc_now());
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
-        debug() << "Actual observing block number: " << transactionsResponse->actualBlockNumber();
+            debug() << "Actual observing block number: " << transactionsResponse->actualBlockNumber();
 #endif
-        if (transactionsResponse->transactionsResponses().size() != checkedTransactions.size()) {
-            warning() << "Received data contains wrong number of transaction "
-                      << transactionsResponse->transactionsResponses().size();
-            continue;
-        }
+            if (transactionsResponse->transactionsResponses().size() != checkedTransactions.size()) {
+                warning() << "Received data contains wrong number of transaction "
+                          << transactionsResponse->transactionsResponses().size();
+                return false;
+            }
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
-        debug() << "Observer response cnt " << transactionsResponse->transactionsResponses().size();
+            debug() << "Observer response cnt " << transactionsResponse->transactionsResponses().size();
 #endif
 
-        auto transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalRepeatTimeSeconds;
+            auto transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalRepeatTimeSeconds;
 #ifdef TESTS
-        transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalRepeatTimeSecondsTests;
+            transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalRepeatTimeSecondsTests;
 #endif
-        size_t idxProcessedTransaction = 0;
-        for (const auto &responseTransaction : transactionsResponse->transactionsResponses()) {
-            auto processedTransaction = checkedTransactions.at(idxProcessedTransaction++).first;
+            // participants votes are sent asynchronously after scheduling,
+            // and in case of failure checking is rescheduled on small time
+            scheduleTransactionsChecking(
+                transactionCheckingSignalRepeatTimeSeconds);
+
+            size_t idxProcessedTransaction = 0;
+            for (const auto &responseTransaction : transactionsResponse->transactionsResponses()) {
+                auto processedTransaction = checkedTransactions.at(idxProcessedTransaction++).first;
+                if (mCheckedTransactions.count(processedTransaction) == 0) {
+                    continue;
+                }
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
-            debug() << "Processed transaction " << processedTransaction << " with response " << responseTransaction;
+                debug() << "Processed transaction " << processedTransaction << " with response " << responseTransaction;
 #endif
-            switch (responseTransaction) {
-                case ObservingTransaction::NoInfo: {
+                switch (responseTransaction) {
+                    case ObservingTransaction::NoInfo: {
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
-                    debug() << "NoInfo";
+                        debug() << "NoInfo";
 #endif
-                    // if claiming time has expired remove transaction from claiming map
-                    if (mCheckedTransactions[processedTransaction] < transactionsResponse->actualBlockNumber()) {
-                        info() << "Claim time has expired for " << processedTransaction;
-                        mCheckedTransactions.erase(
-                            processedTransaction);
-                        auto ioTransaction = mStorageHandler->beginTransaction();
-                        ioTransaction->paymentTransactionsHandler()->updateTransactionState(
-                            processedTransaction,
-                            ObservingTransaction::ClaimTimeExpired);
+                        // if claiming time has expired remove transaction from claiming map
+                        if (mCheckedTransactions[processedTransaction] < transactionsResponse->actualBlockNumber()) {
+                            info() << "Claim time has expired for " << processedTransaction;
+                            mCheckedTransactions.erase(
+                                processedTransaction);
+                            auto ioTransaction = mStorageHandler->beginTransaction();
+                            ioTransaction->paymentTransactionsHandler()->updateTransactionState(
+                                processedTransaction,
+                                ObservingTransaction::ClaimTimeExpired);
+                        }
+                        break;
                     }
-                    break;
-                }
-                case ObservingTransaction::ClaimInPool: {
-                    info() << "Claim in pool for " << processedTransaction;
-                    // todo: need correct reaction because observer get info about claim, when it on the blockchain
-                    if (!sendParticipantsVoteMessageToObservers(
-                        processedTransaction,
-                        mCheckedTransactions[processedTransaction])) {
-                        transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSeconds;
-#ifdef TESTS
-                        transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSecondsTests;
-#endif
+                    case ObservingTransaction::ClaimInPool: {
+                        info() << "Claim in pool for " << processedTransaction;
+                        // todo: need correct reaction because observer get info about claim, when it on the blockchain
+                        sendParticipantsVoteMessageToObservers(
+                            processedTransaction,
+                            mCheckedTransactions[processedTransaction]);
+                        break;
                     }
-                    break;
-                }
-                case ObservingTransaction::ClaimInBlock: {
-                    info() << "Claim in block for " << processedTransaction;
-                    if (mCheckedTransactions[processedTransaction] < transactionsResponse->actualBlockNumber()) {
-                        info() << "Transaction was rejected by observing. Cancelling.";
-                        mCancelTransactionSignal(
+                    case ObservingTransaction::ClaimInBlock: {
+                        info() << "Claim in block for " << processedTransaction;
+                        if (mCheckedTransactions[processedTransaction] < transactionsResponse->actualBlockNumber()) {
+                            info() << "Transaction was rejected by observing. Cancelling.";
+                            mCancelTransactionSignal(
+                                processedTransaction,
+                                mCheckedTransactions[processedTransaction]);
+                            mCheckedTransactions.erase(
+                                processedTransaction);
+                            auto ioTransaction = mStorageHandler->beginTransaction();
+                            ioTransaction->paymentTransactionsHandler()->updateTransactionState(
+                                processedTransaction,
+                                ObservingTransaction::RejectedByObserving);
+                            break;
+                        }
+                        sendParticipantsVoteMessageToObservers(
                             processedTransaction,
                             mCheckedTransactions[processedTransaction]);
+                        break;
+                    }
+                    case ObservingTransaction::ParticipantsVotesPresent: {
+                        info() << "ParticipantsVotesPresent for " << processedTransaction;
                         mCheckedTransactions.erase(
                             processedTransaction);
+                        // todo : check if TSL correct
                         auto ioTransaction = mStorageHandler->beginTransaction();
                         ioTransaction->paymentTransactionsHandler()->updateTransactionState(
                             processedTransaction,
-                            ObservingTransaction::RejectedByObserving);
+                            ObservingTransaction::ParticipantsVotesPresent);
                         break;
                     }
-                    if (!sendParticipantsVoteMessageToObservers(
-                        processedTransaction,
-                        mCheckedTransactions[processedTransaction])) {
-                        transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSeconds;
-#ifdef TESTS
-                        transactionCheckingSignalRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSecondsTests;
-#endif
-                    }
-                    break;
-                }
-                case ObservingTransaction::ParticipantsVotesPresent: {
-                    info() << "ParticipantsVotesPresent for " << processedTransaction;
-                    mCheckedTransactions.erase(
-                        processedTransaction);
-                    // todo : check if TSL correct
-                    auto ioTransaction = mStorageHandler->beginTransaction();
-                    ioTransaction->paymentTransactionsHandler()->updateTransactionState(
-                        processedTransaction,
-                        ObservingTransaction::ParticipantsVotesPresent);
-                    break;
-                }
 
-                default: {
-                    this->warning() << "Invalid type of observing response type "
-                                    << processedTransaction;
-                    continue;
+                    default: {
+                        this->warning() << "Invalid type of observing response type "
+                                        << processedTransaction;
+                        continue;
+                    }
                 }
             }
-        }
-
-        mTransactionsTimer.expires_from_now(
-            std::chrono::seconds(
-                transactionCheckingSignalRepeatTimeSeconds));
-        mTransactionsTimer.async_wait(
-            boost::bind(
-                &ObservingHandler::runTransactionsChecking,
-                this,
-                as::placeholders::error));
-        return;
-    }
-
-    warning() << "Can't send request to all observers";
-    mTransactionsTimer.expires_from_now(
-        std::chrono::seconds(
-            +kTransactionCheckingSignalSmallRepeatTimeSeconds));
+            return true;
+        },
+        [this] () {
+            warning() << "Can't send request to all observers";
+            auto transactionCheckingSignalSmallRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSeconds;
 #ifdef TESTS
-    mTransactionsTimer.expires_from_now(
-        std::chrono::seconds(
-            +kTransactionCheckingSignalSmallRepeatTimeSecondsTests));
+            transactionCheckingSignalSmallRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSecondsTests;
 #endif
-    mTransactionsTimer.async_wait(
-        boost::bind(
-            &ObservingHandler::runTransactionsChecking,
-            this,
-            as::placeholders::error));
+            scheduleTransactionsChecking(
+                transactionCheckingSignalSmallRepeatTimeSeconds);
+        });
+}
+
+void ObservingHandler::scheduleTransactionsChecking(
+    uint32_t delaySeconds)
+{
+    // previously scheduled checking (if any) is cancelled
+    mTransactionsTimer.expiresFromNow(
+        std::chrono::seconds(
+            delaySeconds),
+        [this]() {
+            runTransactionsChecking();
+        });
 }
 
-bool ObservingHandler::sendParticipantsVoteMessageToObservers(
+void ObservingHandler::sendParticipantsVoteMessageToObservers(
     const TransactionUUID &transactionUUID,
     BlockNumber maximalClaimingBlockNumber)
 {
     info() << "sendParticipantsVoteMessageToObservers " << transactionUUID << " " << maximalClaimingBlockNumber;
+    auto transactionCheckingSignalSmallRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSeconds;
+#ifdef TESTS
+    transactionCheckingSignalSmallRepeatTimeSeconds = kTransactionCheckingSignalSmallRepeatTimeSecondsTests;
+#endif
     auto ioTransaction = mStorageHandler->beginTransaction();
     auto participantsSignatures = ioTransaction->paymentParticipantsVotesHandler()->participantsSignatures(
         transactionUUID);
     if (participantsSignatures.empty()) {
         warning() << "Empty participants signatures";
         // todo : need correct reaction
-        return false;
+        scheduleTransactionsChecking(
+            transactionCheckingSignalSmallRepeatTimeSeconds);
+        return;
     }
     auto participantsVotesAppendRequest = make_shared<ObservingParticipantsVotesAppendRequestMessage>(
         transactionUUID,
         maximalClaimingBlockNumber,
         participantsSignatures);
-    BytesShared observerResponse;
-    for (const auto &observer : mObservers) {
-        try {
-            observerResponse = mObservingCommunicator->sendRequestToObserver(
-                observer,
-                participantsVotesAppendRequest);
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observers " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-        try {
+    sendRequestToObservers(
+        participantsVotesAppendRequest,
+        [this, transactionUUID, maximalClaimingBlockNumber] (IPv4WithPortAddress::Shared, BytesShared observerResponse) {
             auto participantsVotesAppendResponse = make_shared<ObservingParticipantsVotesAppendResponseMessage>(
                 observerResponse);
             info() << "participantsVotesAppendResponse " << participantsVotesAppendResponse->observingResponse();
@@ -704,7 +682,7 @@ bool ObservingHandler::sendParticipantsVoteMessageToObservers(
                 return true;
             } else if (participantsVotesAppendResponse->observingResponse() == ObservingTransaction::NoInfo) {
                 info() << "No Info";
-                continue;
+                return false;
             } else if (participantsVotesAppendResponse->observingResponse() == ObservingTransaction::RejectedByObserving) {
                 info() << "RejectedByObserving";
                 // if ParticipantsVotes sending period has expired,
@@ -714,18 +692,26 @@ bool ObservingHandler::sendParticipantsVoteMessageToObservers(
                     transactionUUID,
                     maximalClaimingBlockNumber);
                 return true;
-            } else {
-                warning() << "Wrong observer response " << participantsVotesAppendResponse->observingResponse();
-                continue;
             }
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-    }
+            warning() << "Wrong observer response " << participantsVotesAppendResponse->observingResponse();
+            return false;
+        },
+        [this, transactionCheckingSignalSmallRepeatTimeSeconds] () {
+            this->warning() << "Can't send ParticipantsVotesMessage to all observers";
+            scheduleTransactionsChecking(
+                transactionCheckingSignalSmallRepeatTimeSeconds);
+        });
+}
 
-    this->warning() << "Can't send ParticipantsVotesMessage to all observers";
-    return false;
+void ObservingHandler::responseActualBlockNumbers()
+{
+    // responses can lead to new requests, so requests are moved out before processing
+    vector<TransactionUUID> requests;
+    requests.swap(mBlockNumberRequests);
+    for (const auto &transactionUUID : requests) {
+        responseActualBlockNumber(
+            transactionUUID);
+    }
 }
 
 void ObservingHandler::responseActualBlockNumber(
@@ -734,25 +720,11 @@ void ObservingHandler::responseActualBlockNumber(
 #ifdef DEBUG_LOG_OBSEVING_HANDLER
     debug() << "responseActualBlockNumber " << transactionUUID;
 #endif
-    mRequestsTimer.cancel();
     Duration durationWithoutBlockNumberUpdating = utc_now() - mLastUpdatedBlockNumber.second;
     if (durationWithoutBlockNumberUpdating > kBlockNumberUpdateDuration()) {
-        auto getActualBlockNumberMessage = make_shared<ObservingBlockNumberRequest>();
-        BytesShared observerResponse;
-        for (const auto &observer : mObservers) {
-            try {
-                observerResponse = mObservingCommunicator->sendRequestToObserver(
-                    observer,
-                    getActualBlockNumberMessage);
-            } catch (std::exception &e) {
-                this->warning() << "Can't send request to observer " << e.what();
-                continue;
-            } catch (...) {
-                this->warning() << "Can't send request to observer";
-                continue;
-            }
-
-            try {
+        sendRequestToObservers(
+            make_shared<ObservingBlockNumberRequest>(),
+            [this, transactionUUID] (IPv4WithPortAddress::Shared, BytesShared observerResponse) {
                 auto actualBlockNumberResponse = make_shared<ObservingBlockNumberResponse>(
                     observerResponse);
                 mResourcesManager->putResource(
@@ -763,23 +735,20 @@ void ObservingHandler::responseActualBlockNumber(
                 mLastUpdatedBlockNumber = make_pair(
                     actualBlockNumberResponse->actualBlockNumber(),
                     utc_now());
-                return;
-            } catch (std::exception &e) {
-                this->warning() << "Can't parse observer response " << e.what();
-                continue;
-            }
-        }
-        warning() << "Can't send request to all observers";
-        mAllowPaymentTransactionsSignal(false);
-        mBlockNumberRequestTimer.expires_from_now(
-            std::chrono::seconds(
-                +kInitialObservingRequestNextSeconds));
-        mBlockNumberRequestTimer.async_wait(
-            boost::bind(
-                &ObservingHandler::getActualBlockNumber,
-                this));
-        // if node can't get actual block number ObservingHandler doesn't inform requested transaction
-        // so it will be rejected
+                return true;
+            },
+            [this] () {
+                warning() << "Can't send request to all observers";
+                mAllowPaymentTransactionsSignal(false);
+                mBlockNumberRequestTimer.expiresFromNow(
+                    std::chrono::seconds(
+                        +kInitialObservingRequestNextSeconds),
+                    [this]() {
+                        getActualBlockNumber();
+                    });
+                // if node can't get actual block number ObservingHandler doesn't inform requested transaction
+                // so it will be rejected
+            });
         return;
     }
 
@@ -811,23 +780,9 @@ void ObservingHandler::getActualBlockNumber()
 #endif
     mBlockNumberRequestTimer.cancel();
 
-    auto getActualBlockNumberMessage = make_shared<ObservingBlockNumberRequest>();
-    BytesShared observerResponse;
-
-    for (const auto &observer : mObservers) {
-        try {
-            observerResponse = mObservingCommunicator->sendRequestToObserver(
-                observer,
-                getActualBlockNumberMessage);
-        } catch (std::exception &e) {
-            this->warning() << "Can't send request to observer " << e.what();
-            continue;
-        } catch (...) {
-            this->warning() << "Can't send request to observer";
-            continue;
-        }
-
-        try {
+    sendRequestToObservers(
+        make_shared<ObservingBlockNumberRequest>(),
+        [this] (IPv4WithPortAddress::Shared, BytesShared observerResponse) {
             auto actualBlockNumberResponse = make_shared<ObservingBlockNumberResponse>(
                 observerResponse);
 
@@ -837,24 +792,20 @@ void ObservingHandler::getActualBlockNumber()
                 utc_now());
 
             mAllowPaymentTransactionsSignal(true);
-            return;
-        } catch (std::exception &e) {
-            this->warning() << "Can't parse observer response " << e.what();
-            continue;
-        }
-    }
-
-    warning() << "Can't get actual block number from all observers";
-    mBlockNumberRequestTimer.expires_from_now(
-        std::chrono::seconds(
-            +kInitialObservingRequestNextSeconds));
-    mBlockNumberRequestTimer.async_wait(
-        boost::bind(
-            &ObservingHandler::getActualBlockNumber,
-            this));
+            return true;
+        },
+        [this] () {
+            warning() << "Can't get actual block number from all observers";
+            mBlockNumberRequestTimer.expiresFromNow(
+                std::chrono::seconds(
+                    +kInitialObservingRequestNextSeconds),
+                [this]() {
+                    getActualBlockNumber();
+                });
+        });
 }
 
 const string ObservingHandler::logHeader() const
 {
     return "[ObservingHandler]";
-}
\ No newline at end of file
+}
@@ -17,10 +17,12 @@
 #include "../resources/manager/ResourcesManager.h"
 #include "../resources/resources/BlockNumberRecourse.h"
 #include "../logger/LoggerMixin.hpp"
+#include "../common/time/TimerService.h"
 
-#include <boost/asio/steady_timer.hpp>
 #include <vector>
 #include <map>
+#include <set>
+#include <functional>
 
 using namespace std;
 namespace as = boost::asio;
@@ -38,10 +40,15 @@ public:
     typedef signals::signal<void(const TransactionUUID&, BlockNumber)> CancelTransactionSignal;
     typedef signals::signal<void(bool)> AllowPaymentTransactionsSignal;
 
+    // returns true if response was processed and there is no need to send request to the next observer
+    typedef function<bool(IPv4WithPortAddress::Shared, BytesShared)> ObserverResponseHandler;
+    typedef function<void()> ObserversFailureHandler;
+
 public:
     ObservingHandler(
         vector<pair<string, string>> observersAddressesStr,
         IOService &ioService,
+        TimerService *timerService,
         StorageHandler *storageHandler,
         ResourcesManager *resourcesManager,
         Logger &logger);
@@ -74,36 +81,70 @@ protected:
      */
     void rescheduleResending();
 
+    /**
+     * Sends request to observers one by one, until some of them would respond
+     * and its response would be processed by responseHandler.
+     * Requests are sent asynchronously, so this method doesn't block.
+     * @param skippedObserver observer, to which request should not be sent (if there are other observers)
+     * @param failureHandler is called in case if no one observer processed the request
+     */
+    void sendRequestToObservers(
+        ObservingMessage::Shared request,
+        ObserverResponseHandler responseHandler,
+        ObserversFailureHandler failureHandler,
+        IPv4WithPortAddress::Shared skippedObserver = nullptr,
+        size_t observerIndex = 0);
+
     /**
      * Performs action with claims.
      * This method would be called every time when some claim timeout would fire up.
+     * States of all claims, which timeouts fired up, are checked by one request to observer.
      */
     void performActions();
 
     /**
-     * Performs processing of one claim
-     * @param observingTransaction
+     * Checks states of several claims by one request
+     * @param observingTransactions claims, which have the same requested observer
+     */
+    void checkClaimsStates(
+        vector<ObservingTransaction::Shared> observingTransactions);
+
+    /**
+     * Processes state of the claim, received from observer
      * @return true if claim should be removed from queue
      */
-    bool performOneClaim(
-        ObservingTransaction::Shared observingTransaction);
+    bool processClaimState(
+        ObservingTransaction::Shared observingTransaction,
+        ObservingTransaction::ObservingResponseType observingResponseType);
 
     void sendClaimAgain(
         ObservingTransaction::Shared observingTransaction);
 
-    bool getParticipantsVotes(
-        const TransactionUUID& transactionUUID,
-        BlockNumber maximalClaimingBlockNumber);
+    void getParticipantsVotes(
+        ObservingTransaction::Shared observingTransaction);
+
+    /**
+     * Claim processing is finished, claim timeout can fire up again.
+     */
+    void finishClaimProcessing(
+        const TransactionUUID &transactionUUID);
 
-    void runTransactionsChecking(
-        const boost::system::error_code &errorCode);
+    void runTransactionsChecking();
+
+    void scheduleTransactionsChecking(
+        uint32_t delaySeconds);
+
+    void responseActualBlockNumbers();
 
     void responseActualBlockNumber(
         const TransactionUUID& transactionUUID);
 
     void getActualBlockNumber();
 
-    bool sendParticipantsVoteMessageToObservers(
+    /**
+     * In case if participants votes can't be sent, transactions checking is rescheduled on small time.
+     */
+    void sendParticipantsVoteMessageToObservers(
         const TransactionUUID& transactionUUID,
         BlockNumber maximalClaimingBlockNumber);
 
@@ -148,16 +189,20 @@ private:
     vector<IPv4WithPortAddress::Shared> mObservers;
     unique_ptr<ObservingCommunicator> mObservingCommunicator;
     map<TransactionUUID, ObservingTransaction::Shared> mClaims;
+    // claims, for which requests are sent to observers and responses are not processed yet
+    set<TransactionUUID> mClaimsInProcessing;
     // transactionUUID and block number after which claim is impossible
     map<TransactionUUID, BlockNumber> mCheckedTransactions;
 
     // number of block getting with last response and response time
     pair<BlockNumber, DateTime> mLastUpdatedBlockNumber;
 
-    as::steady_timer mBlockNumberRequestTimer;
-    as::steady_timer mClaimsTimer;
-    as::steady_timer mTransactionsTimer;
-    as::steady_timer mRequestsTimer;
+    TimerService::Timer mBlockNumberRequestTimer;
+    TimerService::Timer mClaimsTimer;
+    TimerService::Timer mTransactionsTimer;
+    TimerService::Timer mRequestsTimer;
+    // transactions, which requested actual block number, are answered together by mRequestsTimer
+    vector<TransactionUUID> mBlockNumberRequests;
 
     StorageHandler *mStorageHandler;
     ResourcesManager *mResourcesManager;
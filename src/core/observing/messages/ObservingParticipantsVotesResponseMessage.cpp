@@ -3,7 +3,8 @@
 ObservingParticipantsVotesResponseMessage::ObservingParticipantsVotesResponseMessage(
     BytesShared buffer):
     ObservingResponseMessage(
-        buffer)
+        buffer),
+    mTransactionUUID(TransactionUUID::kNil)
 {
     size_t bytesBufferOffset = ObservingResponseMessage::kOffsetToInheritedBytes();
 
@@ -11,7 +11,23 @@ PathsManager::PathsManager(
     mTopologyTrustLinesManager(topologyTrustLineManager),
     mLog(logger),
     mPathCollection(nullptr)
-{}
+{
+    mTrustLinesManager->trustLineChangedSignal.connect(
+        boost::bind(
+            &PathsManager::onTrustLineChangedSlot,
+            this,
+            _1));
+    mTopologyTrustLinesManager->trustLineChangedSignal.connect(
+        boost::bind(
+            &PathsManager::onTopologyTrustLineChangedSlot,
+            this,
+            _1,
+            _2));
+    mTopologyTrustLinesManager->legacyTrustLinesDeletedSignal.connect(
+        boost::bind(
+            &PathsManager::onLegacyTopologyTrustLinesDeletedSlot,
+            this));
+}
 
 bool PathsManager::isPathValid(const Path &path)
 {
@@ -150,7 +166,9 @@ TrustLineAmount PathsManager::calculateOneNode(
         if (currentFlow > TrustLine::kZeroAmount()) {
             auto pathWithAddresses = addressesPath();
             auto path = make_shared<Path>(pathWithAddresses);
-            mPathCollection->add(path);
+            mPathCollection->add(
+                path,
+                currentFlow);
             info() << "build path: " << path->toString() << " with amount " << currentFlow;
         }
         return currentFlow;
@@ -204,6 +222,9 @@ void PathsManager::reBuildPaths(
     BaseAddress::Shared contractorAddress,
     const vector<BaseAddress::Shared> &inaccessibleNodes)
 {
+    // Used amounts of topology were changed, so shared paths are not actual anymore.
+    mSharedPaths.erase(
+        contractorAddress->fullAddress());
     mContractorAddress = contractorAddress;
     mContractorID = mTopologyTrustLinesManager->getID(contractorAddress);
     info() << "ReBuild paths to " << mContractorAddress->fullAddress() << " id " << mContractorID;
@@ -283,7 +304,9 @@ TrustLineAmount PathsManager::calculateOneNodeForRebuildingPaths(
         if (currentFlow > TrustLine::kZeroAmount()) {
             auto pathWithAddresses = addressesPath();
             auto path = make_shared<Path>(pathWithAddresses);
-            mPathCollection->add(path);
+            mPathCollection->add(
+                path,
+                currentFlow);
             info() << "build path: " << path->toString() << " with amount " << currentFlow;
         }
         return currentFlow;
@@ -392,6 +415,198 @@ void PathsManager::clearPathsCollection()
     mPathCollection = nullptr;
 }
 
+PathsCollection::Shared PathsManager::sharedPathsCollection(
+    BaseAddress::Shared destinationAddress)
+{
+    auto sharedPathsIt = mSharedPaths.find(
+        destinationAddress->fullAddress());
+    if (sharedPathsIt == mSharedPaths.end()) {
+        return nullptr;
+    }
+    const auto &sharedPaths = sharedPathsIt->second;
+    if (sharedPaths.mPathsCollection == nullptr) {
+        // paths are building at the moment
+        return nullptr;
+    }
+
+    auto result = make_shared<PathsCollection>(
+        *sharedPaths.mPathsCollection);
+    result->resetCurrentPath();
+    return result;
+}
+
+bool PathsManager::joinPathsBuilding(
+    BaseAddress::Shared destinationAddress,
+    const TransactionUUID &requesterUUID)
+{
+    auto sharedPathsIt = mSharedPaths.find(
+        destinationAddress->fullAddress());
+    if (sharedPathsIt == mSharedPaths.end()) {
+        return false;
+    }
+    auto &sharedPaths = sharedPathsIt->second;
+    if (sharedPaths.mPathsCollection != nullptr) {
+        return false;
+    }
+    if (utc_now() - sharedPaths.mBuildingStarted > kMaxPathsBuildingDuration()) {
+        // requester would take over the building (see beginPathsBuilding)
+        info() << "Paths building to " << destinationAddress->fullAddress() << " was not finished in time";
+        return false;
+    }
+
+    sharedPaths.mJoinedRequesters.push_back(
+        requesterUUID);
+    return true;
+}
+
+void PathsManager::beginPathsBuilding(
+    BaseAddress::Shared destinationAddress,
+    const TransactionUUID &builderUUID)
+{
+    auto &sharedPaths = mSharedPaths[destinationAddress->fullAddress()];
+    if (sharedPaths.mPathsCollection != nullptr) {
+        // outdated paths are replaced by the new building
+        sharedPaths.mPathsCollection = nullptr;
+        sharedPaths.mJoinedRequesters.clear();
+    }
+    // requesters of the building, which was not finished in time, are kept
+    // and would receive result of the new building
+    sharedPaths.mBuilderUUID = builderUUID;
+    sharedPaths.mBuildingStarted = utc_now();
+}
+
+vector<TransactionUUID> PathsManager::finishPathsBuilding(
+    BaseAddress::Shared destinationAddress,
+    const TransactionUUID &builderUUID)
+{
+    vector<TransactionUUID> result;
+    auto sharedPathsIt = mSharedPaths.find(
+        destinationAddress->fullAddress());
+    if (sharedPathsIt == mSharedPaths.end()
+        or sharedPathsIt->second.mPathsCollection != nullptr
+        or sharedPathsIt->second.mBuilderUUID != builderUUID) {
+        // building was taken over by another requester
+        return result;
+    }
+    result = sharedPathsIt->second.mJoinedRequesters;
+    if (mPathCollection == nullptr or mPathCollection->count() == 0) {
+        // there is no reason to share empty result, next requester will try to build paths again
+        mSharedPaths.erase(sharedPathsIt);
+        return result;
+    }
+
+    auto &sharedPaths = sharedPathsIt->second;
+    sharedPaths.mPathsCollection = make_shared<PathsCollection>(
+        *mPathCollection);
+    sharedPaths.mJoinedRequesters.clear();
+    return result;
+}
+
+vector<TransactionUUID> PathsManager::abortPathsBuilding(
+    BaseAddress::Shared destinationAddress,
+    const TransactionUUID &builderUUID)
+{
+    vector<TransactionUUID> result;
+    auto sharedPathsIt = mSharedPaths.find(
+        destinationAddress->fullAddress());
+    if (sharedPathsIt == mSharedPaths.end()
+        or sharedPathsIt->second.mPathsCollection != nullptr
+        or sharedPathsIt->second.mBuilderUUID != builderUUID) {
+        return result;
+    }
+    result = sharedPathsIt->second.mJoinedRequesters;
+    mSharedPaths.erase(sharedPathsIt);
+    return result;
+}
+
+void PathsManager::onTrustLineChangedSlot(
+    BaseAddress::Shared contractorAddress)
+{
+    // trust line of current node is the first trust line of each path
+    dropSharedPathsWithTrustLine(
+        nullptr,
+        contractorAddress);
+}
+
+void PathsManager::onTopologyTrustLineChangedSlot(
+    ContractorID sourceID,
+    ContractorID targetID)
+{
+    if (mSharedPaths.empty()) {
+        return;
+    }
+    BaseAddress::Shared sourceAddress = nullptr;
+    if (sourceID != TopologyTrustLinesManager::kCurrentNodeID) {
+        sourceAddress = mTopologyTrustLinesManager->getAddressByID(sourceID);
+        if (sourceAddress == nullptr) {
+            return;
+        }
+    }
+    auto targetAddress = mTopologyTrustLinesManager->getAddressByID(targetID);
+    if (targetAddress == nullptr) {
+        return;
+    }
+    dropSharedPathsWithTrustLine(
+        sourceAddress,
+        targetAddress);
+}
+
+void PathsManager::onLegacyTopologyTrustLinesDeletedSlot()
+{
+    // shared paths can go through deleted trust lines
+    auto sharedPathsIt = mSharedPaths.begin();
+    while (sharedPathsIt != mSharedPaths.end()) {
+        if (sharedPathsIt->second.mPathsCollection != nullptr) {
+            sharedPathsIt = mSharedPaths.erase(sharedPathsIt);
+        } else {
+            sharedPathsIt++;
+        }
+    }
+}
+
+void PathsManager::dropSharedPathsWithTrustLine(
+    BaseAddress::Shared sourceAddress,
+    BaseAddress::Shared targetAddress)
+{
+    // nullptr source address means current node
+    const auto kSourceAddress = sourceAddress == nullptr ? string() : sourceAddress->fullAddress();
+    const auto kTargetAddress = targetAddress->fullAddress();
+    auto sharedPathsIt = mSharedPaths.begin();
+    while (sharedPathsIt != mSharedPaths.end()) {
+        auto pathsCollection = sharedPathsIt->second.mPathsCollection;
+        if (pathsCollection == nullptr) {
+            sharedPathsIt++;
+            continue;
+        }
+
+        bool isTrustLineUsed = false;
+        pathsCollection->resetCurrentPath();
+        while (pathsCollection->hasNextPath() and not isTrustLineUsed) {
+            // path nodes: current node (empty address), intermediate nodes, destination
+            vector<string> pathAddresses{string()};
+            for (const auto &node : pathsCollection->nextPath()->intermediates()) {
+                pathAddresses.push_back(
+                    node->fullAddress());
+            }
+            pathAddresses.push_back(
+                pathsCollection->destination()->fullAddress());
+            for (size_t idx = 1; idx < pathAddresses.size(); idx++) {
+                if (pathAddresses[idx - 1] == kSourceAddress and pathAddresses[idx] == kTargetAddress) {
+                    isTrustLineUsed = true;
+                    break;
+                }
+            }
+        }
+
+        if (isTrustLineUsed) {
+            info() << "Shared paths to " << sharedPathsIt->first << " are not actual anymore";
+            sharedPathsIt = mSharedPaths.erase(sharedPathsIt);
+        } else {
+            sharedPathsIt++;
+        }
+    }
+}
+
 LoggerStream PathsManager::info() const
 {
     return mLog.info(logHeader());
@@ -5,8 +5,10 @@
 #include "../trust_lines/manager/TrustLinesManager.h"
 #include "../topology/manager/TopologyTrustLinesManager.h"
 #include "../logger/Logger.h"
+#include "../transactions/transactions/base/TransactionUUID.h"
 
 #include <set>
+#include <map>
 
 class PathsManager {
 
@@ -43,7 +45,70 @@ public:
 
     void clearPathsCollection();
 
+    /*
+     * Paths requests to the same destination are coalesced:
+     * while paths are building, other requesters join the building and receive its result;
+     * built paths are shared until any trust line used by them is changed
+     * (trust line of current node or trust line of topology), or legacy topology is deleted.
+     * Each requester receives its own copy of the paths collection,
+     * so used amounts and current path are accounted per requester.
+     */
+    // Returns copy of recently built paths collection or nullptr if there is no actual one.
+    PathsCollection::Shared sharedPathsCollection(
+        BaseAddress::Shared destinationAddress);
+
+    // Returns true if paths to the destination are building at the moment,
+    // in this case requester would be returned by finishPathsBuilding() or abortPathsBuilding().
+    bool joinPathsBuilding(
+        BaseAddress::Shared destinationAddress,
+        const TransactionUUID &requesterUUID);
+
+    // Building, which was not finished in time, is taken over with all its requesters.
+    void beginPathsBuilding(
+        BaseAddress::Shared destinationAddress,
+        const TransactionUUID &builderUUID);
+
+    // Shares current paths collection and returns requesters, which joined the building.
+    vector<TransactionUUID> finishPathsBuilding(
+        BaseAddress::Shared destinationAddress,
+        const TransactionUUID &builderUUID);
+
+    // Forgets failed building and returns requesters, which joined it,
+    // they should request paths again.
+    vector<TransactionUUID> abortPathsBuilding(
+        BaseAddress::Shared destinationAddress,
+        const TransactionUUID &builderUUID);
+
+private:
+    // Paths to the destination, shared between requesters
+    struct SharedPaths {
+        PathsCollection::Shared mPathsCollection;
+        TransactionUUID mBuilderUUID;
+        DateTime mBuildingStarted;
+        vector<TransactionUUID> mJoinedRequesters;
+    };
+
+    // Building, that was not finished during this time, is treated as failed,
+    // and is taken over by the next requester.
+    static Duration& kMaxPathsBuildingDuration() {
+        static auto duration = Duration(0, 0, 10);
+        return duration;
+    }
+
 private:
+    void onTrustLineChangedSlot(
+        BaseAddress::Shared contractorAddress);
+
+    void onTopologyTrustLineChangedSlot(
+        ContractorID sourceID,
+        ContractorID targetID);
+
+    void onLegacyTopologyTrustLinesDeletedSlot();
+
+    void dropSharedPathsWithTrustLine(
+        BaseAddress::Shared sourceAddress,
+        BaseAddress::Shared targetAddress);
+
     bool isPathValid(const Path &path);
 
     void buildPathsOnOneLevel();
@@ -83,6 +148,8 @@ private:
     vector<ContractorID> mPassedNodeIDs;
     byte mCurrentPathLength;
     set<ContractorID> mInaccessibleNodes;
+
+    map<string, SharedPaths> mSharedPaths;
 };
 
 
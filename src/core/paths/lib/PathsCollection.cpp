@@ -6,14 +6,29 @@ PathsCollection::PathsCollection(
     mCurrentPath(0)
 {}
 
+PathsCollection::PathsCollection(
+    const PathsCollection &other) :
+    mDestinationNode(other.mDestinationNode),
+    mCapacities(other.mCapacities),
+    mCurrentPath(other.mCurrentPath)
+{
+    mPaths.reserve(other.mPaths.size());
+    for (const auto &path : other.mPaths) {
+        mPaths.push_back(
+            make_shared<Path>(*path));
+    }
+}
+
 void PathsCollection::add(
-        Path::Shared &path)
+        Path::Shared &path,
+        const TrustLineAmount &capacity)
 {
     if (path->length() > 5) {
         throw ValueError("PathsCollection::add "
                              "Added path is too long");
     }
     mPaths.push_back(path);
+    mCapacities.push_back(capacity);
 }
 
 void PathsCollection::resetCurrentPath()
@@ -36,7 +51,21 @@ Path::Shared PathsCollection::nextPath()
     return mPaths.at(mCurrentPath - 1);
 }
 
+const TrustLineAmount &PathsCollection::currentPathCapacity() const
+{
+    if (mCurrentPath == 0 || mCurrentPath > mCapacities.size()) {
+        throw IndexError("PathsCollection::currentPathCapacity "
+                             "there is no current path");
+    }
+    return mCapacities.at(mCurrentPath - 1);
+}
+
 size_t PathsCollection::count() const
 {
     return mPaths.size();
+}
+
+BaseAddress::Shared PathsCollection::destination() const
+{
+    return mDestinationNode;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define GEO_NETWORK_CLIENT_PATHSCOLLECTION_H
 
 #include "Path.h"
+#include "../../common/Types.h"
 #include "../../common/exceptions/ValueError.h"
 #include "../../common/exceptions/IndexError.h"
 
@@ -16,8 +17,13 @@ public:
     PathsCollection(
         BaseAddress::Shared destinationAddress);
 
+    // paths are copied too, because payment transaction appends receiver to the path it uses
+    PathsCollection(
+        const PathsCollection &other);
+
     void add(
-        Path::Shared &path);
+        Path::Shared &path,
+        const TrustLineAmount &capacity);
 
     void resetCurrentPath();
 
@@ -25,11 +31,17 @@ public:
 
     bool hasNextPath();
 
+    // Capacity of the path, returned by last call of nextPath(), estimated by topology during paths building
+    const TrustLineAmount &currentPathCapacity() const;
+
     size_t count() const;
 
+    BaseAddress::Shared destination() const;
+
 private:
     BaseAddress::Shared mDestinationNode;
     vector<Path::Shared> mPaths;
+    vector<TrustLineAmount> mCapacities;
     size_t mCurrentPath;
 };
 
@@ -135,17 +135,17 @@ void AmountReservationsHandler::free(
  * Optionally, filters locks by transactionUUID (see reservations(...) for details).
  * In case if no amount was reserved - returns 0;
  */
-ConstSharedTrustLineAmount AmountReservationsHandler::totalReserved(
+TrustLineAmount AmountReservationsHandler::totalReserved(
     ContractorID trustLineContractor,
     const AmountReservation::ReservationDirection direction,
     const TransactionUUID *transactionUUID) const
 {
-    SharedTrustLineAmount amount(new TrustLineAmount(0));
+    TrustLineAmount amount = 0;
 
     auto reservationsVector = reservations(trustLineContractor, transactionUUID);
     for (auto &lock : reservationsVector) {
         if (lock->direction() == direction)
-            (*amount) += (*lock).amount();
+            amount += (*lock).amount();
     }
     return amount;
 }
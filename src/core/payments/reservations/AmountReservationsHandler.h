@@ -26,7 +26,7 @@ public:
         ContractorID trustLineContractor,
         const AmountReservation::ConstShared reservation);
 
-    ConstSharedTrustLineAmount totalReserved(
+    TrustLineAmount totalReserved(
         ContractorID trustLineContractor,
         const AmountReservation::ReservationDirection direction,
         const TransactionUUID *transactionUUID = nullptr) const;
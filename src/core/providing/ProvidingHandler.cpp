@@ -4,15 +4,15 @@ ProvidingHandler::ProvidingHandler(
     vector<Provider::Shared> &providers,
     uint32_t updatingAddressPeriodSeconds,
     uint32_t cachedAddressTTLSeconds,
-    IOService &ioService,
+    TimerService *timerService,
     Contractor::Shared selfContractor,
     Logger &logger) :
     LoggerMixin(logger),
     mProviders(providers),
     mUpdatingAddressPeriodSeconds(updatingAddressPeriodSeconds),
     mCachedAddressTTLSeconds(cachedAddressTTLSeconds),
-    mUpdatingAddressTimer(ioService),
-    mCacheCleaningTimer(ioService),
+    mUpdatingAddressTimer(timerService),
+    mCacheCleaningTimer(timerService),
     mSelfContractor(selfContractor)
 {
 #ifdef DEBUG_LOG_PROVIDING_HANDLER
@@ -35,41 +35,31 @@ ProvidingHandler::ProvidingHandler(
     }
 
     if (!mProvidersForPing.empty()) {
-        mUpdatingAddressTimer.expires_from_now(
+        mUpdatingAddressTimer.expiresFromNow(
             std::chrono::seconds(
-                +kStartingAddressPeriodSeconds));
-        mUpdatingAddressTimer.async_wait(
-            boost::bind(
-                &ProvidingHandler::updateAddressForProviders,
-                this,
-                as::placeholders::error));
+                +kStartingAddressPeriodSeconds),
+            [this]() {
+                updateAddressForProviders();
+            });
     }
 }
 
-void ProvidingHandler::updateAddressForProviders(
-    const boost::system::error_code &errorCode)
+void ProvidingHandler::updateAddressForProviders()
 {
 #ifdef DEBUG_LOG_PROVIDING_HANDLER
     debug() << "updateAddressForProviders";
 #endif
-    if (errorCode) {
-        warning() << errorCode.message().c_str();
-    }
-    mUpdatingAddressTimer.cancel();
-
     for (const auto &provider : mProvidersForPing) {
         sendPingMessageSignal(
             provider);
     }
 
-    mUpdatingAddressTimer.expires_from_now(
+    mUpdatingAddressTimer.expiresFromNow(
         std::chrono::seconds(
-            mUpdatingAddressPeriodSeconds));
-    mUpdatingAddressTimer.async_wait(
-        boost::bind(
-            &ProvidingHandler::updateAddressForProviders,
-            this,
-            as::placeholders::error));
+            mUpdatingAddressPeriodSeconds),
+        [this]() {
+            updateAddressForProviders();
+        });
 }
 
 Provider::Shared ProvidingHandler::getProviderForAddress(
@@ -135,13 +125,12 @@ void ProvidingHandler::rescheduleCleaning()
         return;
     }
     const auto kCleaningTimeout = mTimesCache.at(0).first - utc_now();
-    mCacheCleaningTimer.expires_from_now(
+    mCacheCleaningTimer.expiresFromNow(
         chrono::microseconds(
-            kCleaningTimeout.total_microseconds()));
-    mCacheCleaningTimer.async_wait(
-        boost::bind(
-            &ProvidingHandler::clearCachedAddresses,
-            this));
+            kCleaningTimeout.total_microseconds()),
+        [this]() {
+            clearCachedAddresses();
+        });
 }
 
 void ProvidingHandler::clearCachedAddresses()
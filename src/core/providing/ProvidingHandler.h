@@ -4,10 +4,10 @@
 #include "Provider.h"
 #include "../contractors/Contractor.h"
 #include "../logger/LoggerMixin.hpp"
+#include "../common/time/TimerService.h"
 
 #include <boost/signals2.hpp>
 #include <boost/asio.hpp>
-#include <boost/asio/steady_timer.hpp>
 
 namespace as = boost::asio;
 namespace signals = boost::signals2;
@@ -26,7 +26,7 @@ public:
         vector<Provider::Shared> &providers,
         uint32_t updatingAddressPeriodSeconds,
         uint32_t cachedAddressTTLSeconds,
-        IOService &ioService,
+        TimerService *timerService,
         Contractor::Shared selfContractor,
         Logger &logger);
 
@@ -48,8 +48,7 @@ protected:
     const string logHeader() const override;
 
 private:
-    void updateAddressForProviders(
-        const boost::system::error_code &errorCode);
+    void updateAddressForProviders();
 
     void rescheduleCleaning();
 
@@ -65,8 +64,8 @@ private:
     vector<Provider::Shared> mProviders;
     vector<Provider::Shared> mProvidersForPing;
     Contractor::Shared mSelfContractor;
-    as::steady_timer mUpdatingAddressTimer;
-    as::steady_timer mCacheCleaningTimer;
+    TimerService::Timer mUpdatingAddressTimer;
+    TimerService::Timer mCacheCleaningTimer;
 
     uint32_t mUpdatingAddressPeriodSeconds;
     uint32_t mCachedAddressTTLSeconds;
@@ -160,4 +160,57 @@ json Settings::cyclesClearing(
         // todo : throw RuntimeError
         return nullptr;
     }
-}
\ No newline at end of file
+}
+
+json Settings::controlInterface(
+    const json *conf) const
+{
+    if (conf == nullptr) {
+        auto j = loadParsedJSON();
+        conf = &j;
+    }
+    try {
+        auto result = (*conf).at("control_interface");
+        return result;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+uint16_t Settings::workersCount(
+    const json *conf) const
+{
+    json loadedConf;
+    if (conf == nullptr) {
+        loadedConf = loadParsedJSON();
+        conf = &loadedConf;
+    }
+    try {
+        if ((*conf).count("workers_count") == 0) {
+            return 0;
+        }
+        return (*conf).at("workers_count").get<uint16_t>();
+    } catch (...) {
+        throw RuntimeError(
+            "Settings::workersCount: invalid workers_count");
+    }
+}
+
+uint16_t Settings::pipelinedPathsCount(
+    const json *conf) const
+{
+    json loadedConf;
+    if (conf == nullptr) {
+        loadedConf = loadParsedJSON();
+        conf = &loadedConf;
+    }
+    try {
+        if ((*conf).count("pipelined_paths_count") == 0) {
+            return 0;
+        }
+        return (*conf).at("pipelined_paths_count").get<uint16_t>();
+    } catch (...) {
+        throw RuntimeError(
+            "Settings::pipelinedPathsCount: invalid pipelined_paths_count");
+    }
+}
@@ -41,6 +41,18 @@ public:
     json cyclesClearing(
         const json *conf = nullptr) const;
 
+    json controlInterface(
+        const json *conf = nullptr) const;
+
+    // count of threads for CPU heavy computations, 0 means that they are done on the main thread
+    uint16_t workersCount(
+        const json *conf = nullptr) const;
+
+    // max count of paths, which are reserved simultaneously by payment coordinator,
+    // 0 (default) means that paths are reserved one by one
+    uint16_t pipelinedPathsCount(
+        const json *conf = nullptr) const;
+
     json loadParsedJSON() const;
 };
 
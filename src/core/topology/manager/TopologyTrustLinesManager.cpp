@@ -48,7 +48,14 @@ void TopologyTrustLinesManager::addTrustLine(
         auto trLineWithPtrIt = hashSet->begin();
         while (trLineWithPtrIt != hashSet->end()) {
             if ((*trLineWithPtrIt)->topologyTrustLine()->targetID() == trustLine->targetID()) {
+                const bool isAmountChanged =
+                    *(*trLineWithPtrIt)->topologyTrustLine()->amount() != *trustLine->amount();
                 (*trLineWithPtrIt)->topologyTrustLine()->setAmount(trustLine->amount());
+                if (isAmountChanged) {
+                    trustLineChangedSignal(
+                        trustLine->sourceID(),
+                        trustLine->targetID());
+                }
 
                 // update time creation of trustline
                 auto dateTimeAndTrustLine = mtTrustLines.begin();
@@ -173,6 +180,7 @@ bool TopologyTrustLinesManager::deleteLegacyTrustLines()
                 delete hashSetPtr;
             }
             msTrustLines.clear();
+            legacyTrustLinesDeletedSignal();
         }
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
         info() << "deleteLegacyTrustLines\t" << "map size after deleting: " << msTrustLines.size();
@@ -208,6 +216,9 @@ bool TopologyTrustLinesManager::deleteLegacyTrustLines()
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     info() << "deleteLegacyTrustLinesNew\t" << "map size after deleting: " << msTrustLines.size();
 #endif
+    if (isTrustLineWasDeleted) {
+        legacyTrustLinesDeletedSignal();
+    }
     return isTrustLineWasDeleted;
 }
 
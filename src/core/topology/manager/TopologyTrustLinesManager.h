@@ -6,13 +6,20 @@
 #include "../../common/time/TimeUtils.h"
 #include "../../logger/Logger.h"
 
+#include <boost/signals2.hpp>
+
 #include <set>
 #include <unordered_map>
 
+namespace signals = boost::signals2;
+
 class TopologyTrustLinesManager {
 
 public:
     typedef unordered_set<TopologyTrustLineWithPtr*> TrustLineWithPtrHashSet;
+    // Emitted when amount of already known trust line (source, target) was changed or trust line was removed
+    typedef signals::signal<void(ContractorID, ContractorID)> TrustLineChangedSignal;
+    typedef signals::signal<void()> LegacyTrustLinesDeletedSignal;
 
 public:
     TopologyTrustLinesManager(
@@ -72,6 +79,10 @@ public:
 public:
     static const ContractorID kCurrentNodeID = 0;
 
+public:
+    mutable TrustLineChangedSignal trustLineChangedSignal;
+    mutable LegacyTrustLinesDeletedSignal legacyTrustLinesDeletedSignal;
+
 private:
     static const byte kResetTrustLinesHours = 0;
     static const byte kResetTrustLinesMinutes = 12;
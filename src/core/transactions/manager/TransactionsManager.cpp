@@ -6,6 +6,8 @@
  */
 TransactionsManager::TransactionsManager(
     as::io_service &IOService,
+    TimerService *timerService,
+    WorkersPool *workersPool,
     ContractorsManager *contractorsManager,
     EquivalentsSubsystemsRouter *equivalentsSubsystemsRouter,
     ResourcesManager *resourcesManager,
@@ -16,6 +18,7 @@ TransactionsManager::TransactionsManager(
     EventsInterfaceManager *eventsInterfaceManager,
     TailManager *tailManager,
     CyclesRunningParameters cyclesRunningParameters,
+    uint16_t maxPipelinedPathsCount,
     Logger &logger,
     SubsystemsController *subsystemsController,
     TrustLinesInfluenceController *trustLinesInfluenceController) :
@@ -35,18 +38,23 @@ TransactionsManager::TransactionsManager(
     mTrustLinesInfluenceController(trustLinesInfluenceController),
     isPaymentTransactionsAllowedDueToObserving(false),
     mCyclesRunningParameters(cyclesRunningParameters),
+    mMaxPipelinedPathsCount(maxPipelinedPathsCount),
 
     mScheduler(
         new TransactionsScheduler(
-            mIOService,
+            timerService,
             mTrustLinesInfluenceController,
             mLog)),
 
     mEquivalentsCyclesSubsystemsRouter(
         new EquivalentsCyclesSubsystemsRouter(
             mScheduler.get(),
+            mEquivalentsSubsystemsRouter,
+            mContractorsManager,
             mSubsystemsController,
             mIOService,
+            timerService,
+            workersPool,
             mEquivalentsSubsystemsRouter->equivalents(),
             cyclesRunningParameters,
             mLog))
@@ -1234,6 +1242,7 @@ void TransactionsManager::launchCoordinatorPaymentTransaction(
             mEquivalentsSubsystemsRouter->pathsManager(command->equivalent()),
             mKeysStore,
             isPaymentTransactionsAllowedDueToObserving,
+            mMaxPipelinedPathsCount,
             mEventsInterfaceManager,
             mLog,
             mSubsystemsController);
@@ -1509,8 +1518,9 @@ void TransactionsManager::onCloseCycleTransaction(
     Path::Shared cycle)
 {
     if (!isPaymentTransactionsAllowedDueToObserving) {
-        warning() << "It is forbid to run payment transactions due to observing";
-        return;
+        throw PreconditionFailedError(
+            "TransactionsManager::onCloseCycleTransaction: "
+                "it is forbid to run payment transactions due to observing");
     }
     try {
         auto transaction = make_shared<CycleCloserInitiatorTransaction>(
@@ -1540,6 +1550,7 @@ void TransactionsManager::onCloseCycleTransaction(
     } catch (NotFoundError &e) {
         error() << "There are no subsystems for CycleCloserInitiatorTransaction "
                 "with equivalent " << equivalent << " Details are: " << e.what();
+        throw;
     }
 }
 
@@ -2315,7 +2326,8 @@ void TransactionsManager::subscribeForTryCloseNextCycleSignal(
         boost::bind(
             &TransactionsManager::onTryCloseNextCycleSlot,
             this,
-            _1));
+            _1,
+            _2));
 }
 
 void TransactionsManager::subscribeForProcessingConfirmationMessage(
@@ -2436,8 +2448,6 @@ void TransactionsManager::onCommandResultReady(
     CommandResult::SharedConst result)
 {
     try {
-        auto message = result->serialize();
-
         if (result->identifier() != HistoryPaymentsCommand::identifier() and
                 result->identifier() != HistoryPaymentsAllEquivalentsCommand::identifier() and
                 result->identifier() != HistoryTrustLinesCommand::identifier() and
@@ -2448,12 +2458,15 @@ void TransactionsManager::onCommandResultReady(
                 result->identifier() != GetTrustLineByAddressCommand::identifier() and
                 result->identifier() != GetTrustLineByIDCommand::identifier()) {
             info() << "Result for command " + result->identifier();
-            info() << "CommandResultReady: " << message;
+            if (not result->isStreamed()) {
+                info() << "CommandResultReady: " << result->serialize();
+            }
         }
 
+        // Result is written asynchronously,
+        // streamed results are serialized by chunks during writing.
         mResultsInterface->writeResult(
-            message.c_str(),
-            message.size());
+            result);
 
     } catch (...) {
         throw RuntimeError(
@@ -2527,10 +2540,12 @@ void TransactionsManager::onBuildCycleSixNodesTransaction(
 }
 
 void TransactionsManager::onTryCloseNextCycleSlot(
-    const SerializedEquivalent equivalent)
+    const SerializedEquivalent equivalent,
+    Path::Shared closedCycle)
 {
     try {
-        mEquivalentsCyclesSubsystemsRouter->cyclesManager(equivalent)->closeOneCycle(true);
+        mEquivalentsCyclesSubsystemsRouter->cyclesManager(equivalent)->cycleClosingFinished(
+            closedCycle);
     } catch (NotFoundError &e) {
         error() << "There are no subsystems for Closing next cycle "
                 "with equivalent " << equivalent << " Details are: " << e.what();
@@ -110,6 +110,8 @@ public:
 public:
     TransactionsManager(
         as::io_service &IOService,
+        TimerService *timerService,
+        WorkersPool *workersPool,
         ContractorsManager *contractorsManager,
         EquivalentsSubsystemsRouter *equivalentsSubsystemsRouter,
         ResourcesManager *ResourcesManager,
@@ -120,6 +122,7 @@ public:
         EventsInterfaceManager *eventsInterfaceManager,
         TailManager *tailManager,
         CyclesRunningParameters cyclesRunningParameters,
+        uint16_t maxPipelinedPathsCount,
         Logger &logger,
         SubsystemsController *subsystemsController,
         TrustLinesInfluenceController *trustLinesInfluenceController);
@@ -483,7 +486,8 @@ protected:
         Path::Shared cycle);
 
     void onTryCloseNextCycleSlot(
-        const SerializedEquivalent equivalent);
+        const SerializedEquivalent equivalent,
+        Path::Shared closedCycle);
 
     void onProcessConfirmationMessageSlot(
         ConfirmationMessage::Shared confirmationMessage);
@@ -560,6 +564,7 @@ private:
     bool isPaymentTransactionsAllowedDueToObserving;
 
     CyclesRunningParameters mCyclesRunningParameters;
+    uint16_t mMaxPipelinedPathsCount;
 
     SubsystemsController *mSubsystemsController;
     TrustLinesInfluenceController *mTrustLinesInfluenceController;
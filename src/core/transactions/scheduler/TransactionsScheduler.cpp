@@ -1,16 +1,17 @@
 ﻿#include "TransactionsScheduler.h"
 
+#include "../transactions/regular/payments/CycleCloserInitiatorTransaction.h"
+
 TransactionsScheduler::TransactionsScheduler(
-    as::io_service &IOService,
+    TimerService *timerService,
     TrustLinesInfluenceController *trustLinesInfluenceController,
     Logger &logger) :
 
-    mIOService(IOService),
     mTrustLinesInfluenceController(trustLinesInfluenceController),
     mLog(logger),
 
-    mTransactions(new map<BaseTransaction::Shared, TransactionState::SharedConst>()),
-    mProcessingTimer(new as::steady_timer(mIOService))
+    mProcessingTimer(timerService),
+    mTransactions(new map<BaseTransaction::Shared, TransactionState::SharedConst>())
 {}
 
 /*!
@@ -40,15 +41,16 @@ void TransactionsScheduler::run()
 void TransactionsScheduler::scheduleTransaction(
     BaseTransaction::Shared transaction)
 {
-    for (const auto &transactionAndState : *mTransactions){
-        if (transaction->currentTransactionUUID() == transactionAndState.first->currentTransactionUUID()) {
-            warning() << "scheduleTransaction: Duplicate TransactionUUID. Already exists. "
-                      << "Current TA type: " << transaction->transactionType()
-                      << ". Conflicted TA type:" << transactionAndState.first->transactionType();
-            throw ConflictError("Duplicate TransactionUUID");
-        }
+    const auto kConflictedTransaction = mTransactionsByUUID.find(
+        transaction->currentTransactionUUID());
+    if (kConflictedTransaction != mTransactionsByUUID.end()) {
+        warning() << "scheduleTransaction: Duplicate TransactionUUID. Already exists. "
+                  << "Current TA type: " << transaction->transactionType()
+                  << ". Conflicted TA type:" << kConflictedTransaction->second->transactionType();
+        throw ConflictError("Duplicate TransactionUUID");
     }
     (*mTransactions)[transaction] = TransactionState::awakeAsFastAsPossible();
+    mTransactionsByUUID[transaction->currentTransactionUUID()] = transaction;
 
     adjustAwakeningToNextTransaction();
 }
@@ -57,15 +59,16 @@ void TransactionsScheduler::postponeTransaction(
     BaseTransaction::Shared transaction,
     uint32_t millisecondsDelay)
 {
-    for (const auto &transactionAndState : *mTransactions){
-        if (transaction->currentTransactionUUID() == transactionAndState.first->currentTransactionUUID()) {
-            warning() << "postponeTransaction: Duplicate TransactionUUID. Already exists. "
-                      << "Current TA type: " << transaction->transactionType()
-                      << ". Conflicted TA type:" << transactionAndState.first->transactionType();
-            throw ConflictError("Duplicate TransactionUUID");
-        }
+    const auto kConflictedTransaction = mTransactionsByUUID.find(
+        transaction->currentTransactionUUID());
+    if (kConflictedTransaction != mTransactionsByUUID.end()) {
+        warning() << "postponeTransaction: Duplicate TransactionUUID. Already exists. "
+                  << "Current TA type: " << transaction->transactionType()
+                  << ". Conflicted TA type:" << kConflictedTransaction->second->transactionType();
+        throw ConflictError("Duplicate TransactionUUID");
     }
     (*mTransactions)[transaction] = TransactionState::awakeAfterMilliseconds(millisecondsDelay);
+    mTransactionsByUUID[transaction->currentTransactionUUID()] = transaction;
 
     adjustAwakeningToNextTransaction();
 }
@@ -73,12 +76,11 @@ void TransactionsScheduler::postponeTransaction(
 void TransactionsScheduler::awakeTransaction(
     BaseTransaction::Shared transaction)
 {
-    for (const auto &transactionAndState : *mTransactions){
-        if (transaction->currentTransactionUUID() == transactionAndState.first->currentTransactionUUID()) {
-            (*mTransactions)[transactionAndState.first] = TransactionState::awakeAsFastAsPossible();
-            adjustAwakeningToNextTransaction();
-            break;
-        }
+    const auto kScheduledTransaction = mTransactionsByUUID.find(
+        transaction->currentTransactionUUID());
+    if (kScheduledTransaction != mTransactionsByUUID.end()) {
+        (*mTransactions)[kScheduledTransaction->second] = TransactionState::awakeAsFastAsPossible();
+        adjustAwakeningToNextTransaction();
     }
 }
 
@@ -92,11 +94,10 @@ void TransactionsScheduler::tryAttachMessageToTransaction(
     }
 
     auto transactionMessage = static_pointer_cast<TransactionMessage>(message);
-    for (auto const &transactionAndState : *mTransactions) {
-
-        if (transactionMessage->transactionUUID() != transactionAndState.first->currentTransactionUUID()) {
-            continue;
-        }
+    const auto kTransaction = mTransactionsByUUID.find(
+        transactionMessage->transactionUUID());
+    if (kTransaction != mTransactionsByUUID.end()) {
+        const auto &transactionAndState = *mTransactions->find(kTransaction->second);
 
         for (auto const &messageType : transactionAndState.second->acceptedMessagesTypes()) {
             if (message->typeID() != messageType) {
@@ -133,11 +134,10 @@ void TransactionsScheduler::tryAttachMessageToTransaction(
 void TransactionsScheduler::tryAttachResourceToTransaction(
     BaseResource::Shared resource)
 {
-    for (const auto& transactionAndState : *mTransactions) {
-
-        if (resource->transactionUUID() != transactionAndState.first->currentTransactionUUID()) {
-            continue;
-        }
+    const auto kTransaction = mTransactionsByUUID.find(
+        resource->transactionUUID());
+    if (kTransaction != mTransactionsByUUID.end()) {
+        const auto &transactionAndState = *mTransactions->find(kTransaction->second);
 
         for (const auto &resType : transactionAndState.second->acceptedResourcesTypes()) {
             if (resource->type() != resType) {
@@ -260,6 +260,7 @@ void TransactionsScheduler::processTransactionState(
         //
         // So the [] operator must be used
         (*mTransactions)[transaction] = state;
+        mTransactionsByUUID[transaction->currentTransactionUUID()] = transaction;
 
     } else {
         forgetTransaction(transaction);
@@ -291,11 +292,15 @@ void TransactionsScheduler::forgetTransaction(
     }
 
     if (transaction->transactionType() == BaseTransaction::Payments_CycleCloserInitiatorTransaction) {
+        const auto kCycleCloserTransaction = static_pointer_cast<CycleCloserInitiatorTransaction>(
+            transaction);
         cycleCloserTransactionWasFinishedSignal(
-            static_pointer_cast<BasePaymentTransaction>(
-                transaction)->equivalent());
+            kCycleCloserTransaction->equivalent(),
+            kCycleCloserTransaction->closedCycle());
     }
     mTransactions->erase(transaction);
+    mTransactionsByUUID.erase(
+        transaction->currentTransactionUUID());
 }
 
 void TransactionsScheduler::adjustAwakeningToNextTransaction()
@@ -393,61 +398,25 @@ void TransactionsScheduler::asyncWaitUntil(
         microsecondsDelay = nextAwakeningTimestamp - now;
     }
 
-    mProcessingTimer->expires_from_now(
-        chrono::microseconds(microsecondsDelay));
-
-    mProcessingTimer->async_wait(
-        boost::bind(
-            &TransactionsScheduler::handleAwakening,
-            this,
-            as::placeholders::error));
+    mProcessingTimer.expiresFromNow(
+        chrono::microseconds(microsecondsDelay),
+        [this]() {
+            handleAwakening();
+        });
 }
 
-void TransactionsScheduler::handleAwakening(
-    const boost::system::error_code &errorMessage)
+void TransactionsScheduler::handleAwakening()
 {
-    static auto errorsCount = 0;
-
-    if (errorMessage && errorMessage == as::error::operation_aborted) {
-        return;
-    }
-
-    if (errorMessage && errorMessage != as::error::operation_aborted) {
-
-        if (errorsCount < 10) {
-            error() << "handleAwakening. Error occurred on planned awakening. Details: " << errorMessage.message().c_str()
-                   << ". Next awakening would be scheduled for " << errorsCount << " seconds from now.";
-
-            // Transactions processing must not be cancelled.
-            // Next awakening would be delayed for 10 seconds
-            // (for cases when OS runs out of memory, or similar).
-            asyncWaitUntil(
-                microsecondsSinceGEOEpoch(
-                    utc_now() + pt::seconds(errorsCount)));
-
-        } else {
-            error() << "handleAwakening. Some error repeatedly occurs on awakening. "
-                   << "It seems that it can't be recovered automatically."
-                   << "Next awakening would not be planned.";
-
-            throw RuntimeError(
-                "TransactionsScheduler::handleAwakening: "
-                    "Some error repeated too much times");
-        }
-    }
-
     try {
         auto transactionAndDelay = transactionWithMinimalAwakeningTimestamp();
         if (microsecondsSinceGEOEpoch(utc_now()) >= transactionAndDelay.second) {
             if (transactionAndDelay.first->transactionType() !=
                     BaseTransaction::MaxFlowCalculationStepTwoTransactionType) {
                 launchTransaction(transactionAndDelay.first);
-                errorsCount = 0;
             } else {
                 auto transaction = getEarlierTransaction(
                     transactionAndDelay.first);
                 launchTransaction(transaction);
-                errorsCount = 0;
             }
         }
 
@@ -469,15 +438,15 @@ const map<BaseTransaction::Shared, TransactionState::SharedConst>* transactions(
 const BaseTransaction::Shared TransactionsScheduler::cycleClosingTransactionByUUID(
     const TransactionUUID &transactionUUID) const
 {
-    for (const auto &transactionAndState : *mTransactions) {
-        if (transactionAndState.first->currentTransactionUUID() == transactionUUID) {
-            if (transactionAndState.first->transactionType() != BaseTransaction::Payments_CycleCloserInitiatorTransaction &&
-                transactionAndState.first->transactionType() != BaseTransaction::Payments_CycleCloserIntermediateNodeTransaction) {
-                throw ValueError("TransactionsScheduler::cycleClosingTransactionByUUID: "
-                                     "requested transaction doesn't belong to CycleClosing transactions");
-            }
-            return transactionAndState.first;
+    const auto kTransaction = mTransactionsByUUID.find(
+        transactionUUID);
+    if (kTransaction != mTransactionsByUUID.end()) {
+        if (kTransaction->second->transactionType() != BaseTransaction::Payments_CycleCloserInitiatorTransaction &&
+            kTransaction->second->transactionType() != BaseTransaction::Payments_CycleCloserIntermediateNodeTransaction) {
+            throw ValueError("TransactionsScheduler::cycleClosingTransactionByUUID: "
+                                 "requested transaction doesn't belong to CycleClosing transactions");
         }
+        return kTransaction->second;
     }
     throw NotFoundError("TransactionsScheduler::cycleClosingTransactionByUUID: "
                          "there is no transaction with requested UUID");
@@ -486,12 +455,7 @@ const BaseTransaction::Shared TransactionsScheduler::cycleClosingTransactionByUU
 bool TransactionsScheduler::isTransactionInProcess(
     const TransactionUUID &transactionUUID) const
 {
-    for (const auto &transactionAndState : *mTransactions) {
-        if (transactionAndState.first->currentTransactionUUID() == transactionUUID) {
-            return true;
-        }
-    }
-    return false;
+    return mTransactionsByUUID.count(transactionUUID) != 0;
 }
 
 const BaseTransaction::Shared TransactionsScheduler::paymentTransactionByCommandUUID(
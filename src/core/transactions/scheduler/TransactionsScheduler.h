@@ -2,6 +2,7 @@
 #define GEO_NETWORK_CLIENT_TRANSACTIONSSCHEDULER_H
 
 #include "../../common/time/TimeUtils.h"
+#include "../../common/time/TimerService.h"
 
 #include "../../network/messages/Message.hpp"
 #include "../../network/messages/base/transaction/TransactionMessage.h"
@@ -22,15 +23,13 @@
 
 #include "../../subsystems_controller/TrustLinesInfluenceController.h"
 
-#include <boost/asio.hpp>
-#include <boost/asio/steady_timer.hpp>
-#include <boost/bind.hpp>
 #include <boost/signals2.hpp>
 
 #include <chrono>
 #include <map>
 #include <memory>
 #include <stdint.h>
+#include <unordered_map>
 
 
 using namespace std;
@@ -43,12 +42,14 @@ class TransactionsScheduler {
 public:
     typedef signals::signal<void(CommandResult::SharedConst)> CommandResultSignal;
     typedef signals::signal<void(BaseTransaction::Shared)> SerializeTransactionSignal;
-    typedef signals::signal<void(const SerializedEquivalent equivalent)> CycleCloserTransactionWasFinishedSignal;
+    typedef signals::signal<void(
+            const SerializedEquivalent equivalent,
+            Path::Shared cycle)> CycleCloserTransactionWasFinishedSignal;
 
 
 public:
     TransactionsScheduler(
-        as::io_service &IOService,
+        TimerService *timerService,
         TrustLinesInfluenceController *trustLinesInfluenceController,
         Logger &logger);
 
@@ -140,8 +141,7 @@ private:
     void asyncWaitUntil(
         GEOEpochTimestamp nextAwakeningTimestamp);
 
-    void handleAwakening(
-        const boost::system::error_code &error);
+    void handleAwakening();
 
 public:
     mutable CommandResultSignal commandResultIsReadySignal;
@@ -151,11 +151,12 @@ public:
     mutable CycleCloserTransactionWasFinishedSignal cycleCloserTransactionWasFinishedSignal;
 
 private:
-    as::io_service &mIOService;
     Logger &mLog;
 
-    unique_ptr<as::steady_timer> mProcessingTimer;
+    TimerService::Timer mProcessingTimer;
     unique_ptr<map<BaseTransaction::Shared, TransactionState::SharedConst>> mTransactions;
+    // index of scheduled transactions for attaching of messages and resources without full scan
+    unordered_map<TransactionUUID, BaseTransaction::Shared> mTransactionsByUUID;
 
     TrustLinesInfluenceController *mTrustLinesInfluenceController;
 };
@@ -1,5 +1,8 @@
 #include "BaseCollectTopologyTransaction.h"
 
+uint64_t BaseCollectTopologyTransaction::sTopologyCollectingSavedMilliseconds = 0;
+uint64_t BaseCollectTopologyTransaction::sTopologyCollectingRoundsCount = 0;
+
 BaseCollectTopologyTransaction::BaseCollectTopologyTransaction(
     const TransactionType type,
     const SerializedEquivalent equivalent,
@@ -18,9 +21,17 @@ BaseCollectTopologyTransaction::BaseCollectTopologyTransaction(
     mTopologyTrustLineManager(equivalentsSubsystemsRouter->topologyTrustLineManager(equivalent)),
     mTopologyCacheManager(equivalentsSubsystemsRouter->topologyCacheManager(equivalent)),
     mMaxFlowCacheManager(equivalentsSubsystemsRouter->maxFlowCacheManager(equivalent)),
-    mTailManager(tailManager)
+    mTailManager(tailManager),
+    mRoundFixedWindowMilliseconds(0),
+    mRoundDeadlineMilliseconds(0)
 {}
 
+BaseCollectTopologyTransaction::~BaseCollectTopologyTransaction()
+{
+    mTailManager->finishFlowCollection(
+        currentTransactionUUID());
+}
+
 TransactionResult::SharedConst BaseCollectTopologyTransaction::run()
 {
     switch (mStep) {
@@ -42,72 +53,69 @@ TransactionResult::SharedConst BaseCollectTopologyTransaction::run()
 void BaseCollectTopologyTransaction::fillTopology()
 {
     /// Take messages from TailManager instead of BaseTransaction's 'mContext'
-    auto &mContext = mTailManager->getFlowTail();
+    auto &mContext = mTailManager->getFlowTail(mEquivalent);
 
     while (!mContext.empty()) {
         if (mContext.front()->typeID() == Message::MaxFlow_ResultMaxFlowCalculation) {
             const auto kMessage = popNextMessage<ResultMaxFlowCalculationMessage>(mContext);
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
-            debug() << "Equivalent " << kMessage->equivalent();
             debug() << "Sender " << kMessage->senderAddresses.at(0)->fullAddress() << " common";
             debug() << "Outgoing flows: " << kMessage->outgoingFlows().size();
             debug() << "Incoming flows: " << kMessage->incomingFlows().size();
             debug() << "ConfirmationID " << kMessage->confirmationID();
 #endif
-            auto topologyTrustLineManager = mEquivalentsSubsystemsRouter->topologyTrustLineManager(
-                kMessage->equivalent());
-            auto senderID = topologyTrustLineManager->getID(kMessage->senderAddresses.at(0));
+            auto senderID = mTopologyTrustLineManager->getID(kMessage->senderAddresses.at(0));
             for (auto const &outgoingFlow : kMessage->outgoingFlows()) {
                 auto targetID = mTopologyTrustLineManager->getID(outgoingFlow.first);
-                topologyTrustLineManager->addTrustLine(
+                mTopologyTrustLineManager->addTrustLine(
                     make_shared<TopologyTrustLine>(
                         senderID,
                         targetID,
                         outgoingFlow.second));
             }
             for (auto const &incomingFlow : kMessage->incomingFlows()) {
-                auto sourceID = topologyTrustLineManager->getID(incomingFlow.first);
-                topologyTrustLineManager->addTrustLine(
+                auto sourceID = mTopologyTrustLineManager->getID(incomingFlow.first);
+                mTopologyTrustLineManager->addTrustLine(
                     make_shared<TopologyTrustLine>(
                         sourceID,
                         senderID,
                         incomingFlow.second));
             }
+            mTailManager->onFlowResponseIngested(
+                mEquivalent,
+                kMessage->senderAddresses.at(0)->fullAddress());
         }
         else if (mContext.front()->typeID() == Message::MaxFlow_ResultMaxFlowCalculationFromGateway) {
             const auto kMessage = popNextMessage<ResultMaxFlowCalculationGatewayMessage>(mContext);
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
-            debug() << "Equivalent " << kMessage->equivalent();
             debug() << "Sender " << kMessage->senderAddresses.at(0)->fullAddress() << " gateway";
             debug() << "Outgoing flows: " << kMessage->outgoingFlows().size();
             debug() << "Incoming flows: " << kMessage->incomingFlows().size();
             debug() << "ConfirmationID " << kMessage->confirmationID();
 #endif
-            auto topologyTrustLineManager = mEquivalentsSubsystemsRouter->topologyTrustLineManager(
-                kMessage->equivalent());
-            auto senderID = topologyTrustLineManager->getID(kMessage->senderAddresses.at(0));
-            topologyTrustLineManager->addGateway(senderID);
+            auto senderID = mTopologyTrustLineManager->getID(kMessage->senderAddresses.at(0));
+            mTopologyTrustLineManager->addGateway(senderID);
             for (auto const &outgoingFlow : kMessage->outgoingFlows()) {
-                auto targetID = topologyTrustLineManager->getID(outgoingFlow.first);
-                topologyTrustLineManager->addTrustLine(
+                auto targetID = mTopologyTrustLineManager->getID(outgoingFlow.first);
+                mTopologyTrustLineManager->addTrustLine(
                     make_shared<TopologyTrustLine>(
                         senderID,
                         targetID,
                         outgoingFlow.second));
             }
             for (auto const &incomingFlow : kMessage->incomingFlows()) {
-                auto sourceID = topologyTrustLineManager->getID(incomingFlow.first);
-                topologyTrustLineManager->addTrustLine(
+                auto sourceID = mTopologyTrustLineManager->getID(incomingFlow.first);
+                mTopologyTrustLineManager->addTrustLine(
                     make_shared<TopologyTrustLine>(
                         sourceID,
                         senderID,
                         incomingFlow.second));
             }
-
-            if (kMessage->equivalent() == mEquivalent) {
-                mGateways.insert(
-                    senderID);
-            }
+            mGateways.insert(
+                senderID);
+            mTailManager->onFlowResponseIngested(
+                mEquivalent,
+                kMessage->senderAddresses.at(0)->fullAddress());
         }
         else {
             warning() << "Invalid message type in context during fill topology";
@@ -115,3 +123,88 @@ void BaseCollectTopologyTransaction::fillTopology()
         }
     }
 }
+
+void BaseCollectTopologyTransaction::beginTopologyCollectingRound(
+    const vector<BaseAddress::Shared> &expectedResponders,
+    const uint32_t fixedWindowMilliseconds,
+    const uint32_t deadlineMilliseconds)
+{
+    mExpectedResponders.clear();
+    for (const auto &responder : expectedResponders) {
+        mExpectedResponders.insert(
+            responder->fullAddress());
+    }
+    mTailManager->beginFlowCollection(
+        currentTransactionUUID(),
+        mEquivalent);
+    mRoundStarted = utc_now();
+    mStageStarted = mRoundStarted;
+    mRoundFixedWindowMilliseconds = fixedWindowMilliseconds;
+    mRoundDeadlineMilliseconds = deadlineMilliseconds;
+}
+
+bool BaseCollectTopologyTransaction::isTopologyCollectingRoundCompleted() const
+{
+    const auto kNow = utc_now();
+    const auto kRoundMilliseconds = (kNow - mRoundStarted).total_milliseconds();
+    if (kRoundMilliseconds >= mRoundDeadlineMilliseconds) {
+        return true;
+    }
+
+    const auto kCollection = mTailManager->flowCollection(
+        currentTransactionUUID());
+    if (kCollection == nullptr or kCollection->mResponders.empty()) {
+        // Without any response round is completed only by fixed window.
+        return kRoundMilliseconds >= mRoundFixedWindowMilliseconds;
+    }
+
+    // Next hop responses are expected not later than first response, received in this round.
+    const uint32_t kSettlingMilliseconds = max(
+        uint32_t(kMinTopologySettlingMillisecondsTimeout),
+        uint32_t((kCollection->mFirstResponseReceived - mRoundStarted).total_milliseconds()));
+    const bool isResponsesStopped =
+        (kNow - kCollection->mLastResponseReceived).total_milliseconds() >= kSettlingMilliseconds;
+
+    if (kRoundMilliseconds >= mRoundFixedWindowMilliseconds) {
+        return isResponsesStopped;
+    }
+    for (const auto &expectedResponder : mExpectedResponders) {
+        if (kCollection->mResponders.count(expectedResponder) == 0) {
+            return false;
+        }
+    }
+    return isResponsesStopped;
+}
+
+void BaseCollectTopologyTransaction::finishTopologyCollectingRound()
+{
+    const auto kRoundMilliseconds = (uint32_t)(utc_now() - mRoundStarted).total_milliseconds();
+    const uint32_t kSavedMilliseconds = mRoundFixedWindowMilliseconds > kRoundMilliseconds ?
+        mRoundFixedWindowMilliseconds - kRoundMilliseconds : 0;
+    sTopologyCollectingSavedMilliseconds += kSavedMilliseconds;
+    sTopologyCollectingRoundsCount++;
+
+    const auto kCollection = mTailManager->flowCollection(
+        currentTransactionUUID());
+    info() << "Topology collected in " << kRoundMilliseconds << " ms from "
+           << (kCollection == nullptr ? 0 : kCollection->mResponders.size()) << " responders. Latency saved: " << kSavedMilliseconds
+           << " ms, total saved: " << sTopologyCollectingSavedMilliseconds
+           << " ms by " << sTopologyCollectingRoundsCount << " rounds";
+}
+
+void BaseCollectTopologyTransaction::beginTopologyCollectingStage()
+{
+    mStageStarted = utc_now();
+}
+
+bool BaseCollectTopologyTransaction::isTopologyCollectingStageElapsed(
+    const uint32_t stageMilliseconds) const
+{
+    return (utc_now() - mStageStarted).total_milliseconds() >= stageMilliseconds;
+}
+
+TransactionResult::SharedConst BaseCollectTopologyTransaction::resultAwakeForTopologyCollecting() const
+{
+    return resultAwakeAfterMilliseconds(
+        kTopologyCollectingPollingMillisecondsTimeout);
+}
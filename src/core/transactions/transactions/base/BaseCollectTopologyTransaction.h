@@ -23,6 +23,8 @@ public:
         TailManager *tailManager,
         Logger &logger);
 
+    ~BaseCollectTopologyTransaction();
+
     TransactionResult::SharedConst run() override;
 
 protected:
@@ -39,11 +41,40 @@ protected:
 
     virtual TransactionResult::SharedConst applyCustomLogic(){return resultDone();};
 
+    // Drains topology responses of the transaction's equivalent into the topology trust lines manager.
+    // Responses are ingested once, all collections of the equivalent are notified about responders.
     void fillTopology();
 
+    /*
+     * Topology collecting round is used instead of waiting of fixed time window for topology responses.
+     * Round is completed as soon as all expected responders (nodes, to which topology requests were sent
+     * directly) have answered, and no other responses were received during settling interval.
+     * After fixedWindowMilliseconds (the time, which was waited before) round is completed
+     * as soon as responses are stopped. Round is always completed after deadlineMilliseconds.
+     */
+    void beginTopologyCollectingRound(
+        const vector<BaseAddress::Shared> &expectedResponders,
+        const uint32_t fixedWindowMilliseconds,
+        const uint32_t deadlineMilliseconds);
+
+    bool isTopologyCollectingRoundCompleted() const;
+
+    void finishTopologyCollectingRound();
+
+    // Used by transactions, which send intermediate results on several stages of topology collecting
+    void beginTopologyCollectingStage();
+
+    bool isTopologyCollectingStageElapsed(
+        const uint32_t stageMilliseconds) const;
+
+    TransactionResult::SharedConst resultAwakeForTopologyCollecting() const;
+
 protected:
     const uint16_t kFinalStep = 10;
 
+    static const uint32_t kTopologyCollectingPollingMillisecondsTimeout = 50;
+    static const uint32_t kMinTopologySettlingMillisecondsTimeout = 200;
+
 protected:
     ContractorsManager *mContractorsManager;
     TrustLinesManager *mTrustLinesManager;
@@ -55,6 +86,16 @@ protected:
 
 private:
     EquivalentsSubsystemsRouter *mEquivalentsSubsystemsRouter;
+
+    set<string> mExpectedResponders;
+    DateTime mRoundStarted;
+    DateTime mStageStarted;
+    uint32_t mRoundFixedWindowMilliseconds;
+    uint32_t mRoundDeadlineMilliseconds;
+
+    // latency, saved by all rounds in comparison with fixed time windows
+    static uint64_t sTopologyCollectingSavedMilliseconds;
+    static uint64_t sTopologyCollectingRoundsCount;
 };
 
 
@@ -28,6 +28,7 @@ BaseTransaction::BaseTransaction(
 BaseTransaction::BaseTransaction(
     BytesShared buffer,
     Logger &log) :
+    mTransactionUUID(TransactionUUID::kNil),
     mLog(log)
 {
     size_t bytesBufferOffset = 0;
@@ -23,4 +23,14 @@ public:
     using NodeUUID::NodeUUID;
 };
 
+namespace std {
+    template<>
+    struct hash<TransactionUUID> {
+        size_t operator()(const TransactionUUID &u) const noexcept
+        {
+            return hash<NodeUUID>()(u);
+        }
+    };
+}
+
 #endif //GEO_NETWORK_CLIENT_TRANSACTIONUUID_H
@@ -31,4 +31,110 @@ TransactionResult::SharedConst CyclesBaseFiveSixNodesInitTransaction::run() {
                 "CyclesBaseFiveSixNodesInitTransaction::run():"
                     "Invalid transaction step.");
     }
-}
\ No newline at end of file
+}
+
+void CyclesBaseFiveSixNodesInitTransaction::buildCyclesFromBoundaryMessages(
+    TailManager::Tail &tail,
+    size_t outgoingPathSize,
+    size_t incomingPathSize)
+{
+#ifdef DEBUG_LOG_CYCLES_BUILDING_POCESSING
+    debug() << "Context size: " << tail.size();
+#endif
+    const auto kSelfAddress = mContractorsManager->selfContractor()->mainAddress();
+    const auto kStartDateTime = utc_now();
+    auto cyclesJoiner = make_shared<BoundaryCyclesJoiner>(
+        kSelfAddress);
+    // neighbors suitability is checked once per neighbor
+    map<ContractorID, bool> neighborsSuitability;
+    size_t prunedPathsCount = 0;
+    while (!tail.empty()) {
+        const auto message = popNextMessage<CyclesBaseFiveOrSixNodesBoundaryMessage>(tail);
+#ifdef DEBUG_LOG_CYCLES_BUILDING_POCESSING
+        debug() << "Receive message from " << message->senderIncomingIP();
+        debug() << "Path:";
+        for (const auto &node : message->path()) {
+            debug() << node->fullAddress();
+        }
+        debug() << "Boundary nodes:";
+        for (const auto &node : message->boundaryNodes()) {
+            debug() << node->fullAddress();
+        }
+#endif
+        if (message->equivalent() != mEquivalent) {
+            warning() << "Message belongs to equivalent " << message->equivalent();
+            continue;
+        }
+        auto stepPath = message->path();
+        if (stepPath.size() < 2) {
+            warning() << "Received message contains " << stepPath.size() << " nodes";
+            continue;
+        }
+        if (stepPath.front() != kSelfAddress) {
+            warning() << "Received message was initiate by other node " << stepPath.front()->fullAddress();
+            continue;
+        }
+        auto contractorID = mContractorsManager->contractorIDByAddress(stepPath[1]);
+        if (contractorID == ContractorsManager::kNotFoundContractorID) {
+            warning() << "There is no contractor with address " << stepPath[1]->fullAddress();
+            continue;
+        }
+
+        const auto kBalance = mTrustLinesManager->balance(contractorID);
+        if (kBalance == TrustLine::kZeroBalance()) {
+            // zero balance - skip it
+            continue;
+        }
+        const bool kIsOutgoingBranch = kBalance > TrustLine::kZeroBalance();
+        //  It has to be exactly nodes count in path
+        const auto kExpectedPathSize = kIsOutgoingBranch ? outgoingPathSize : incomingPathSize;
+        if (stepPath.size() != kExpectedPathSize) {
+            warning() << "Received message contains " << stepPath.size() << " nodes";
+            continue;
+        }
+
+        auto neighborSuitability = neighborsSuitability.find(contractorID);
+        if (neighborSuitability == neighborsSuitability.end()) {
+            neighborSuitability = neighborsSuitability.insert(
+                make_pair(
+                    contractorID,
+                    isNeighborSuitableForCycles(
+                        contractorID,
+                        kIsOutgoingBranch))).first;
+        }
+        if (!neighborSuitability->second) {
+            prunedPathsCount++;
+            continue;
+        }
+
+        const vector<BaseAddress::Shared> kBranch(
+            stepPath.begin() + 1,
+            stepPath.end());
+        if (kIsOutgoingBranch) {
+            cyclesJoiner->addOutgoingBranch(
+                kBranch,
+                message->boundaryNodes());
+        } else {
+            cyclesJoiner->addIncomingBranch(
+                kBranch,
+                message->boundaryNodes());
+        }
+    }
+
+    info() << "Pruned paths: " << prunedPathsCount
+           << ", branches collecting duration " << (utc_now() - kStartDateTime).total_microseconds() << " mcs";
+    // cycles are joined in workers pool, and closing of them is launched by cycles manager after joining
+    mCyclesManager->addBoundaryCycles(
+        cyclesJoiner);
+}
+
+bool CyclesBaseFiveSixNodesInitTransaction::isNeighborSuitableForCycles(
+    ContractorID neighborID,
+    bool isOutgoingBranch) const
+{
+    if (isOutgoingBranch) {
+        // outgoing amount reserved by other transactions can be used by cycle closing
+        return *mTrustLinesManager->availableOutgoingCycleAmounts(neighborID).second > TrustLine::kZeroAmount();
+    }
+    return *mTrustLinesManager->availableIncomingCycleAmounts(neighborID).first > TrustLine::kZeroAmount();
+}
@@ -5,13 +5,14 @@
 #include "../../../../../contractors/ContractorsManager.h"
 #include "../../../../../trust_lines/manager/TrustLinesManager.h"
 #include "../../../../../cycles/CyclesManager.h"
+#include "../../../../../cycles/BoundaryCyclesJoiner.h"
+#include "../../../../../network/messages/cycles/SixAndFiveNodes/base/CyclesBaseFiveOrSixNodesBoundaryMessage.h"
 
 class CyclesBaseFiveSixNodesInitTransaction :
     public BaseTransaction {
 
 public:
     typedef shared_ptr<CyclesBaseFiveSixNodesInitTransaction> Shared;
-    typedef multimap<string, vector<BaseAddress::Shared>> CycleMap;
 
 public:
     CyclesBaseFiveSixNodesInitTransaction(
@@ -34,6 +35,25 @@ protected:
     virtual TransactionResult::SharedConst runCollectDataAndSendMessagesStage() = 0;
     virtual TransactionResult::SharedConst runParseMessageAndCreateCyclesStage() = 0;
 
+    /**
+     * Builds cycles from boundary messages, which are present in tail, and adds them into CyclesManager.
+     * Path of each message starts from current node, path of message from neighbor with positive balance
+     * should contain outgoingPathSize nodes, from neighbor with negative balance - incomingPathSize nodes.
+     * Paths through neighbors, on which cycle can't be closed, are ignored.
+     */
+    void buildCyclesFromBoundaryMessages(
+        TailManager::Tail &tail,
+        size_t outgoingPathSize,
+        size_t incomingPathSize);
+
+    /**
+     * @return false if cycle through neighbor can't be closed according to current trust line state
+     * (same conditions as in CycleCloserInitiatorTransaction are used).
+     */
+    bool isNeighborSuitableForCycles(
+        ContractorID neighborID,
+        bool isOutgoingBranch) const;
+
 protected:
     static const uint16_t mkWaitingForResponseTime = 5000;
 
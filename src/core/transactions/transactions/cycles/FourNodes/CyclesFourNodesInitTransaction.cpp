@@ -144,7 +144,7 @@ TransactionResult::SharedConst CyclesFourNodesInitTransaction::runParseMessageAn
         debug() << "CyclePath " << cyclePath->toString();
     }
 #endif
-    mCyclesManager->closeOneCycle();
+    mCyclesManager->closeCycles();
     return resultDone();
 }
 
@@ -100,7 +100,7 @@ TransactionResult::SharedConst CyclesThreeNodesInitTransaction::runParseMessageA
         debug() << "CyclePath " << cyclePath->toString();
     }
 #endif
-    mCyclesManager->closeOneCycle();
+    mCyclesManager->closeCycles();
     return resultDone();
 }
 
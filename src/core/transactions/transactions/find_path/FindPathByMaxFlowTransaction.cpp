@@ -28,9 +28,29 @@ FindPathByMaxFlowTransaction::FindPathByMaxFlowTransaction(
 TransactionResult::SharedConst FindPathByMaxFlowTransaction::sendRequestForCollectingTopology()
 {
     debug() << "Build paths to " << mContractorAddress->fullAddress();
+    const auto kSharedPathsCollection = mPathsManager->sharedPathsCollection(
+        mContractorAddress);
+    if (kSharedPathsCollection != nullptr) {
+        info() << "Recently built paths are used";
+        mResourcesManager->putResource(
+            make_shared<PathsResource>(
+                mRequestedTransactionUUID,
+                kSharedPathsCollection));
+        return resultDone();
+    }
+    if (mPathsManager->joinPathsBuilding(
+            mContractorAddress,
+            mRequestedTransactionUUID)) {
+        info() << "Paths are building by another transaction, result will be shared";
+        return resultDone();
+    }
+    mPathsManager->beginPathsBuilding(
+        mContractorAddress,
+        currentTransactionUUID());
+
+    vector<BaseAddress::Shared> contractors;
+    contractors.push_back(mContractorAddress);
     try {
-        vector<BaseAddress::Shared> contractors;
-        contractors.push_back(mContractorAddress);
         mContractorID = mTopologyTrustLineManager->getID(
             mContractorAddress);
         info() << "ContractorID " << mContractorID;
@@ -51,30 +71,62 @@ TransactionResult::SharedConst FindPathByMaxFlowTransaction::sendRequestForColle
         warning() << "Can not launch Collecting Topology transaction";
     }
 
-    mCountProcessCollectingTopologyRun = 0;
-    return resultAwakeAfterMilliseconds(
-        kTopologyCollectingMillisecondsTimeout);
+    beginTopologyCollectingRound(
+        contractors,
+        kTopologyCollectingMillisecondsTimeout,
+        kMaxTopologyCollectingMillisecondsTimeout);
+    return resultAwakeForTopologyCollecting();
 }
 
 TransactionResult::SharedConst FindPathByMaxFlowTransaction::processCollectingTopology()
 {
-    auto const contextSize = mTailManager->getFlowTail().size();
     fillTopology();
-    mCountProcessCollectingTopologyRun++;
-    if (contextSize > 0 && mCountProcessCollectingTopologyRun <= kCountRunningProcessCollectingTopologyStage) {
-        return resultAwakeAfterMilliseconds(
-            kTopologyCollectingAgainMillisecondsTimeout);
+    if (!isTopologyCollectingRoundCompleted()) {
+        return resultAwakeForTopologyCollecting();
     }
+    finishTopologyCollectingRound();
+
+    try {
+        mPathsManager->buildPaths(
+            mContractorAddress,
+            mContractorID);
 
-    mPathsManager->buildPaths(
+    } catch (...) {
+        // requesters, which joined this building, should not wait for its result
+        for (const auto &joinedRequesterUUID : mPathsManager->abortPathsBuilding(
+                mContractorAddress,
+                currentTransactionUUID())) {
+            info() << "Paths building failed, " << joinedRequesterUUID << " requests paths again";
+            mResourcesManager->requestPaths(
+                joinedRequesterUUID,
+                mContractorAddress,
+                mEquivalent);
+        }
+        mPathsManager->clearPathsCollection();
+        mTopologyTrustLineManager->setPreventDeleting(false);
+        throw;
+    }
+
+    const auto kJoinedRequesters = mPathsManager->finishPathsBuilding(
         mContractorAddress,
-        mContractorID);
+        currentTransactionUUID());
 
     mResourcesManager->putResource(
         make_shared<PathsResource>(
             mRequestedTransactionUUID,
             mPathsManager->pathCollection()));
 
+    for (const auto &joinedRequesterUUID : kJoinedRequesters) {
+        info() << "Share paths with " << joinedRequesterUUID;
+        auto pathsCollection = make_shared<PathsCollection>(
+            *mPathsManager->pathCollection());
+        pathsCollection->resetCurrentPath();
+        mResourcesManager->putResource(
+            make_shared<PathsResource>(
+                joinedRequesterUUID,
+                pathsCollection));
+    }
+
     mPathsManager->clearPathsCollection();
     mTopologyTrustLineManager->setPreventDeleting(false);
     return resultDone();
@@ -37,12 +37,7 @@ private:
 private:
     // ToDo: move to separate config file
     static const uint32_t kTopologyCollectingMillisecondsTimeout = 3000;
-
-    static const uint32_t kTopologyCollectingAgainMillisecondsTimeout = 500;
     static const uint32_t kMaxTopologyCollectingMillisecondsTimeout = 6000;
-    static const uint16_t kCountRunningProcessCollectingTopologyStage =
-            (kMaxTopologyCollectingMillisecondsTimeout - kTopologyCollectingMillisecondsTimeout) /
-            kTopologyCollectingAgainMillisecondsTimeout;
 
 private:
     ContractorID mContractorID;
@@ -50,7 +45,6 @@ private:
     TransactionUUID mRequestedTransactionUUID;
     PathsManager *mPathsManager;
     ResourcesManager *mResourcesManager;
-    size_t mCountProcessCollectingTopologyRun;
     bool mIamGateway;
 };
 
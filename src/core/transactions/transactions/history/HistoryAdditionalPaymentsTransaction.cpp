@@ -10,7 +10,8 @@ HistoryAdditionalPaymentsTransaction::HistoryAdditionalPaymentsTransaction(
         command->equivalent(),
         logger),
     mCommand(command),
-    mStorageHandler(storageHandler)
+    mStorageHandler(storageHandler),
+    mCursor(command->isCursorPresent() ? make_shared<HistoryCursor>(command->cursor()) : nullptr)
 {}
 
 TransactionResult::SharedConst HistoryAdditionalPaymentsTransaction::run()
@@ -28,49 +29,55 @@ TransactionResult::SharedConst HistoryAdditionalPaymentsTransaction::run()
         mCommand->lowBoundaryAmount(),
         mCommand->isLowBoundaryAmountPresent(),
         mCommand->highBoundaryAmount(),
-        mCommand->isHighBoundaryAmountPresent());
+        mCommand->isHighBoundaryAmountPresent(),
+        mCursor);
     return resultOk(paymentRecords);
 }
 
 TransactionResult::SharedConst HistoryAdditionalPaymentsTransaction::resultOk(
     const vector<PaymentAdditionalRecord::Shared> &records)
 {
-    const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
-
-    stringstream stream;
-    stream << records.size();
+    // Records are read from the storage for this result only, so they are its snapshot,
+    // and are serialized lazily by chunks, while result is written to the client.
+    // Operation types are checked beforehand, so serialization can't fail.
     for (auto const &kRecord : records) {
-        // Formatting operation date time to the Unix timestamp
-        const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
+        formattedOperationType(kRecord);
+    }
+    return transactionResultFromCommand(
+        mCommand->resultOk(
+            CommandResult::recordsChunks<PaymentAdditionalRecord::Shared>(
+                records,
+                [] (stringstream &stream, const PaymentAdditionalRecord::Shared &kRecord) {
+                    static const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
+                    // Formatting operation date time to the Unix timestamp
+                    const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
 
-        // Formatting operation type
-        const auto kOperationType = kRecord->operationType();
-        string formattedOperationType;
-        if (kOperationType == PaymentAdditionalRecord::CycleCloserType) {
-            formattedOperationType = "cycle_closer";
+                    stream << kRecord->operationUUID() << kTokensSeparator;
+                    stream << kUnixTimestampMicrosec << kTokensSeparator;
+                    stream << formattedOperationType(kRecord) << kTokensSeparator;
+                    stream << kRecord->amount();
+                },
+                mCursor != nullptr ? mCursor->toString() : string())));
+}
 
-        } else if (kOperationType == PaymentAdditionalRecord::CycleCloserIntermediateType) {
-            formattedOperationType = "cycle_intermediate";
+string HistoryAdditionalPaymentsTransaction::formattedOperationType(
+    const PaymentAdditionalRecord::Shared &record)
+{
+    const auto kOperationType = record->operationType();
+    if (kOperationType == PaymentAdditionalRecord::CycleCloserType) {
+        return "cycle_closer";
 
-        } else if (kOperationType == PaymentAdditionalRecord::IntermediatePaymentType) {
-            formattedOperationType = "intermediate";
+    } else if (kOperationType == PaymentAdditionalRecord::CycleCloserIntermediateType) {
+        return "cycle_intermediate";
 
-        } else {
-            throw RuntimeError(
-                "HistoryAdditionalPaymentsTransaction::resultOk: "
-                    "unexpected operation type occured.");
-        }
+    } else if (kOperationType == PaymentAdditionalRecord::IntermediatePaymentType) {
+        return "intermediate";
 
-        stream << kTokensSeparator << kRecord->operationUUID() << kTokensSeparator;
-        stream << kUnixTimestampMicrosec << kTokensSeparator;
-        stream << formattedOperationType << kTokensSeparator;
-        stream << kRecord->amount();
+    } else {
+        throw RuntimeError(
+            "HistoryAdditionalPaymentsTransaction::formattedOperationType: "
+            "unexpected operation type occured.");
     }
-
-    auto result = stream.str();
-    return transactionResultFromCommand(
-        mCommand->resultOk(
-            result));
 }
 
 const string HistoryAdditionalPaymentsTransaction::logHeader() const
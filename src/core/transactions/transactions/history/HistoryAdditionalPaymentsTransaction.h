@@ -27,9 +27,14 @@ private:
     TransactionResult::SharedConst resultOk(
         const vector<PaymentAdditionalRecord::Shared> &records);
 
+    static string formattedOperationType(
+        const PaymentAdditionalRecord::Shared &record);
+
 private:
     HistoryAdditionalPaymentsCommand::Shared mCommand;
     StorageHandler *mStorageHandler;
+    // null if records are paged by offset
+    HistoryCursor::Shared mCursor;
 };
 
 #endif //GEO_NETWORK_CLIENT_HISTORYADDITIONALPAYMENTSTRANSACTION_H
@@ -41,45 +41,49 @@ TransactionResult::SharedConst HistoryPaymentsAllEquivalentsTransaction::run()
 }
 
 TransactionResult::SharedConst HistoryPaymentsAllEquivalentsTransaction::resultOk(
-        const vector<PaymentRecord::Shared> &records)
+    const vector<PaymentRecord::Shared> &records)
 {
-    const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
-
-    stringstream stream;
-    stream << records.size();
+    // Records are read from the storage for this result only, so they are its snapshot,
+    // and are serialized lazily by chunks, while result is written to the client.
+    // Operation types are checked beforehand, so serialization can't fail.
     for (auto const &kRecord : records) {
-        // Formatting operation date time to the Unix timestamp
-        const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
+        formattedOperationType(kRecord);
+    }
+    return transactionResultFromCommand(
+        mCommand->resultOk(
+            CommandResult::recordsChunks<PaymentRecord::Shared>(
+                records,
+                [] (stringstream &stream, const PaymentRecord::Shared &kRecord) {
+                    static const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
+                    // Formatting operation date time to the Unix timestamp
+                    const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
 
-        // Formatting operation type
-        const auto kOperationType = kRecord->paymentOperationType();
-        string formattedOperationType;
-        if (kOperationType == PaymentRecord::IncomingPaymentType) {
-            formattedOperationType = "incoming";
+                    stream << kRecord->equivalent()
+                           << kTokensSeparator << kRecord->operationUUID()
+                           << kTokensSeparator << kUnixTimestampMicrosec
+                           << kTokensSeparator << kRecord->contractor()->outputString()
+                           << kTokensSeparator << formattedOperationType(kRecord)
+                           << kTokensSeparator << kRecord->amount()
+                           << kTokensSeparator << kRecord->balanceAfterOperation()
+                           << kTokensSeparator << kRecord->payload();
+                })));
+}
 
-        } else if (kOperationType == PaymentRecord::OutgoingPaymentType) {
-            formattedOperationType = "outgoing";
+string HistoryPaymentsAllEquivalentsTransaction::formattedOperationType(
+    const PaymentRecord::Shared &record)
+{
+    const auto kOperationType = record->paymentOperationType();
+    if (kOperationType == PaymentRecord::IncomingPaymentType) {
+        return "incoming";
 
-        } else {
-            throw RuntimeError(
-                    "HistoryPaymentsAllEquivalentsTransaction::resultOk: "
-                    "unexpected operation type occurred.");
-        }
+    } else if (kOperationType == PaymentRecord::OutgoingPaymentType) {
+        return "outgoing";
 
-        stream << kTokensSeparator << kRecord->equivalent()
-               << kTokensSeparator << kRecord->operationUUID()
-               << kTokensSeparator << kUnixTimestampMicrosec
-               << kTokensSeparator << kRecord->contractor()->outputString()
-               << kTokensSeparator << formattedOperationType
-               << kTokensSeparator << kRecord->amount()
-               << kTokensSeparator << kRecord->balanceAfterOperation()
-               << kTokensSeparator << kRecord->payload();
+    } else {
+        throw RuntimeError(
+            "HistoryPaymentsAllEquivalentsTransaction::formattedOperationType: "
+            "unexpected operation type occurred.");
     }
-
-    auto result = stream.str();
-    return transactionResultFromCommand(
-        mCommand->resultOk(
-            result));
 }
 
 const string HistoryPaymentsAllEquivalentsTransaction::logHeader() const
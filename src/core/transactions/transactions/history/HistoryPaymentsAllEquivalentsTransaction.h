@@ -28,6 +28,9 @@ private:
     TransactionResult::SharedConst resultOk(
         const vector<PaymentRecord::Shared> &records);
 
+    static string formattedOperationType(
+        const PaymentRecord::Shared &record);
+
 private:
     HistoryPaymentsAllEquivalentsCommand::Shared mCommand;
     StorageHandler *mStorageHandler;
@@ -10,7 +10,8 @@ HistoryPaymentsTransaction::HistoryPaymentsTransaction(
         command->equivalent(),
         logger),
     mCommand(command),
-    mStorageHandler(storageHandler)
+    mStorageHandler(storageHandler),
+    mCursor(command->isCursorPresent() ? make_shared<HistoryCursor>(command->cursor()) : nullptr)
 {}
 
 TransactionResult::SharedConst HistoryPaymentsTransaction::run()
@@ -23,6 +24,10 @@ TransactionResult::SharedConst HistoryPaymentsTransaction::run()
         if (paymentRecords.size() > 1) {
             warning() << "Count transactions with requested transactionUUID is more than one";
         }
+        // lookup by uuid returns all found records at once, so there are no more pages
+        if (mCursor != nullptr) {
+            mCursor->exhaust();
+        }
         return resultOk(paymentRecords);
     }
     if (mCommand->isPaymentRecordCommandUUIDPresent()) {
@@ -31,6 +36,10 @@ TransactionResult::SharedConst HistoryPaymentsTransaction::run()
         if (paymentRecords.size() > 1) {
             warning() << "Count transactions with requested commandUUID is more than one";
         }
+        // lookup by uuid returns all found records at once, so there are no more pages
+        if (mCursor != nullptr) {
+            mCursor->exhaust();
+        }
         return resultOk(paymentRecords);
     }
 
@@ -45,49 +54,55 @@ TransactionResult::SharedConst HistoryPaymentsTransaction::run()
         mCommand->lowBoundaryAmount(),
         mCommand->isLowBoundaryAmountPresent(),
         mCommand->highBoundaryAmount(),
-        mCommand->isHighBoundaryAmountPresent());
+        mCommand->isHighBoundaryAmountPresent(),
+        mCursor);
     return resultOk(paymentRecords);
 }
 
 TransactionResult::SharedConst HistoryPaymentsTransaction::resultOk(
     const vector<PaymentRecord::Shared> &records)
 {
-    const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
-
-    stringstream stream;
-    stream << records.size();
+    // Records are read from the storage for this result only, so they are its snapshot,
+    // and are serialized lazily by chunks, while result is written to the client.
+    // Operation types are checked beforehand, so serialization can't fail.
     for (auto const &kRecord : records) {
-        // Formatting operation date time to the Unix timestamp
-        const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
+        formattedOperationType(kRecord);
+    }
+    return transactionResultFromCommand(
+        mCommand->resultOk(
+            CommandResult::recordsChunks<PaymentRecord::Shared>(
+                records,
+                [] (stringstream &stream, const PaymentRecord::Shared &kRecord) {
+                    static const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
+                    // Formatting operation date time to the Unix timestamp
+                    const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
 
-        // Formatting operation type
-        const auto kOperationType = kRecord->paymentOperationType();
-        string formattedOperationType;
-        if (kOperationType == PaymentRecord::IncomingPaymentType) {
-            formattedOperationType = "incoming";
+                    stream << kRecord->operationUUID()
+                           << kTokensSeparator << kUnixTimestampMicrosec
+                           << kTokensSeparator << kRecord->contractor()->outputString()
+                           << kTokensSeparator << formattedOperationType(kRecord)
+                           << kTokensSeparator << kRecord->amount()
+                           << kTokensSeparator << kRecord->balanceAfterOperation()
+                           << kTokensSeparator << kRecord->payload();
+                },
+                mCursor != nullptr ? mCursor->toString() : string())));
+}
 
-        } else if (kOperationType == PaymentRecord::OutgoingPaymentType) {
-            formattedOperationType = "outgoing";
+string HistoryPaymentsTransaction::formattedOperationType(
+    const PaymentRecord::Shared &record)
+{
+    const auto kOperationType = record->paymentOperationType();
+    if (kOperationType == PaymentRecord::IncomingPaymentType) {
+        return "incoming";
 
-        } else {
-            throw RuntimeError(
-                "HistoryPaymentsTransaction::resultOk: "
-                "unexpected operation type occurred.");
-        }
+    } else if (kOperationType == PaymentRecord::OutgoingPaymentType) {
+        return "outgoing";
 
-        stream << kTokensSeparator << kRecord->operationUUID()
-               << kTokensSeparator << kUnixTimestampMicrosec
-               << kTokensSeparator << kRecord->contractor()->outputString()
-               << kTokensSeparator << formattedOperationType
-               << kTokensSeparator << kRecord->amount()
-               << kTokensSeparator << kRecord->balanceAfterOperation()
-               << kTokensSeparator << kRecord->payload();
+    } else {
+        throw RuntimeError(
+            "HistoryPaymentsTransaction::formattedOperationType: "
+            "unexpected operation type occurred.");
     }
-
-    auto result = stream.str();
-    return transactionResultFromCommand(
-        mCommand->resultOk(
-            result));
 }
 
 const string HistoryPaymentsTransaction::logHeader() const
@@ -28,9 +28,14 @@ private:
     TransactionResult::SharedConst resultOk(
         const vector<PaymentRecord::Shared> &records);
 
+    static string formattedOperationType(
+        const PaymentRecord::Shared &record);
+
 private:
     HistoryPaymentsCommand::Shared mCommand;
     StorageHandler *mStorageHandler;
+    // null if records are paged by offset
+    HistoryCursor::Shared mCursor;
 };
 
 
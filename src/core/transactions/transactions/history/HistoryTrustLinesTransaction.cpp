@@ -10,7 +10,8 @@ HistoryTrustLinesTransaction::HistoryTrustLinesTransaction(
         command->equivalent(),
         logger),
     mCommand(command),
-    mStorageHandler(storageHandler)
+    mStorageHandler(storageHandler),
+    mCursor(command->isCursorPresent() ? make_shared<HistoryCursor>(command->cursor()) : nullptr)
 {}
 
 TransactionResult::SharedConst HistoryTrustLinesTransaction::run()
@@ -23,65 +24,71 @@ TransactionResult::SharedConst HistoryTrustLinesTransaction::run()
         mCommand->timeFrom(),
         mCommand->isTimeFromPresent(),
         mCommand->timeTo(),
-        mCommand->isTimeToPresent());
+        mCommand->isTimeToPresent(),
+        mCursor);
     return resultOk(trustLineRecords);
 }
 
 TransactionResult::SharedConst HistoryTrustLinesTransaction::resultOk(
     const vector<TrustLineRecord::Shared> &records)
 {
-    const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
-
-    stringstream stream;
-    stream << records.size();
+    // Records are read from the storage for this result only, so they are its snapshot,
+    // and are serialized lazily by chunks, while result is written to the client.
+    // Operation types are checked beforehand, so serialization can't fail.
     for (auto const &kRecord : records) {
-        // Formatting operation date time to the Unix timestamp
-        const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
-
-        // Formatting operation type
-        const auto kOperationType = kRecord->trustLineOperationType();
-        string formattedOperationType;
-        if (kOperationType == TrustLineRecord::Opening) {
-            formattedOperationType = "opening";
+        formattedOperationType(kRecord);
+    }
+    return transactionResultFromCommand(
+        mCommand->resultOk(
+            CommandResult::recordsChunks<TrustLineRecord::Shared>(
+                records,
+                [] (stringstream &stream, const TrustLineRecord::Shared &kRecord) {
+                    static const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
+                    // Formatting operation date time to the Unix timestamp
+                    const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
+
+                    stream << kRecord->operationUUID()
+                           << kTokensSeparator << kUnixTimestampMicrosec
+                           << kTokensSeparator << kRecord->contractor()->outputString()
+                           << kTokensSeparator << formattedOperationType(kRecord)
+                           << kTokensSeparator << kRecord->amount();
+                },
+                mCursor != nullptr ? mCursor->toString() : string())));
+}
 
-        } else if (kOperationType == TrustLineRecord::Accepting) {
-            formattedOperationType = "accepting";
+string HistoryTrustLinesTransaction::formattedOperationType(
+    const TrustLineRecord::Shared &record)
+{
+    const auto kOperationType = record->trustLineOperationType();
+    if (kOperationType == TrustLineRecord::Opening) {
+        return "opening";
 
-        } else if (kOperationType == TrustLineRecord::Setting) {
-            formattedOperationType = "setting";
+    } else if (kOperationType == TrustLineRecord::Accepting) {
+        return "accepting";
 
-        } else if (kOperationType == TrustLineRecord::Updating) {
-            formattedOperationType = "updating";
+    } else if (kOperationType == TrustLineRecord::Setting) {
+        return "setting";
 
-        } else if (kOperationType == TrustLineRecord::Closing) {
-            formattedOperationType = "closing";
+    } else if (kOperationType == TrustLineRecord::Updating) {
+        return "updating";
 
-        } else if (kOperationType == TrustLineRecord::Rejecting) {
-            formattedOperationType = "rejecting";
+    } else if (kOperationType == TrustLineRecord::Closing) {
+        return "closing";
 
-        } else if (kOperationType == TrustLineRecord::ClosingIncoming) {
-            formattedOperationType = "closing_incoming";
+    } else if (kOperationType == TrustLineRecord::Rejecting) {
+        return "rejecting";
 
-        } else if (kOperationType == TrustLineRecord::RejectingOutgoing) {
-            formattedOperationType = "rejecting_outgoing";
+    } else if (kOperationType == TrustLineRecord::ClosingIncoming) {
+        return "closing_incoming";
 
-        } else {
-            throw RuntimeError(
-                "HistoryTrustLinesTransaction::resultOk: "
-                "unexpected operation type occurred.");
-        }
+    } else if (kOperationType == TrustLineRecord::RejectingOutgoing) {
+        return "rejecting_outgoing";
 
-        stream << kTokensSeparator << kRecord->operationUUID()
-               << kTokensSeparator << kUnixTimestampMicrosec
-               << kTokensSeparator << kRecord->contractor()->outputString()
-               << kTokensSeparator << formattedOperationType
-               << kTokensSeparator << kRecord->amount();
+    } else {
+        throw RuntimeError(
+            "HistoryTrustLinesTransaction::formattedOperationType: "
+            "unexpected operation type occurred.");
     }
-
-    auto result = stream.str();
-    return transactionResultFromCommand(
-        mCommand->resultOk(
-            result));
 }
 
 const string HistoryTrustLinesTransaction::logHeader() const
@@ -28,9 +28,14 @@ private:
     TransactionResult::SharedConst resultOk(
         const vector<TrustLineRecord::Shared> &records);
 
+    static string formattedOperationType(
+        const TrustLineRecord::Shared &record);
+
 private:
     HistoryTrustLinesCommand::Shared mCommand;
     StorageHandler *mStorageHandler;
+    // null if records are paged by offset
+    HistoryCursor::Shared mCursor;
 };
 
 
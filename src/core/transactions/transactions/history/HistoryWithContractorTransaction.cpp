@@ -10,7 +10,8 @@ HistoryWithContractorTransaction::HistoryWithContractorTransaction(
         command->equivalent(),
         logger),
     mCommand(command),
-    mStorageHandler(storageHandler)
+    mStorageHandler(storageHandler),
+    mCursor(command->isCursorPresent() ? make_shared<HistoryCursor>(command->cursor()) : nullptr)
 {}
 
 TransactionResult::SharedConst HistoryWithContractorTransaction::run()
@@ -21,100 +22,110 @@ TransactionResult::SharedConst HistoryWithContractorTransaction::run()
         contractorAddresses,
         mCommand->equivalent(),
         mCommand->historyCount(),
-        mCommand->historyFrom());
+        mCommand->historyFrom(),
+        mCursor);
     return resultOk(resultRecords);
 }
 
 TransactionResult::SharedConst HistoryWithContractorTransaction::resultOk(
     const vector<Record::Shared> &records)
 {
-    const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
-
-    stringstream stream;
-    stream << records.size();
+    // Records are read from the storage for this result only, so they are its snapshot,
+    // and are serialized lazily by chunks, while result is written to the client.
+    // Records types are checked beforehand, so serialization can't fail.
     for (auto const &kRecord : records) {
-        // Formatting operation date time to the Unix timestamp
-        const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
-
-        string formattedRecordType;
         if (kRecord->isPaymentRecord()) {
-            formattedRecordType = "payment";
-            auto paymentRecord = static_pointer_cast<PaymentRecord>(kRecord);
-            // Formatting operation type
-            const auto kOperationType = paymentRecord->paymentOperationType();
-            string formattedOperationType;
-            if (kOperationType == PaymentRecord::IncomingPaymentType) {
-                formattedOperationType = "incoming";
-
-            } else if (kOperationType == PaymentRecord::OutgoingPaymentType) {
-                formattedOperationType = "outgoing";
-
-            } else {
-                throw RuntimeError(
-                        "HistoryWithContractorTransaction::resultOk: "
-                                "unexpected payment operation type occurred.");
-            }
-
-            stream << kTokensSeparator << formattedRecordType
-                   << kTokensSeparator << paymentRecord->operationUUID()
-                   << kTokensSeparator << kUnixTimestampMicrosec
-                   << kTokensSeparator << formattedOperationType
-                   << kTokensSeparator << paymentRecord->amount()
-                   << kTokensSeparator << paymentRecord->balanceAfterOperation()
-                   << kTokensSeparator << paymentRecord->payload();
-
+            formattedOperationType(
+                static_pointer_cast<PaymentRecord>(kRecord));
         } else if (kRecord->isTrustLineRecord()) {
-            formattedRecordType = "trustline";
-            auto trustLineRecord = static_pointer_cast<TrustLineRecord>(kRecord);
+            formattedOperationType(
+                static_pointer_cast<TrustLineRecord>(kRecord));
+        } else {
+            throw ValueError("HistoryWithContractorTransaction::resultOk: "
+                                 "unexpected record type occurred.");
+        }
+    }
+    return transactionResultFromCommand(
+        mCommand->resultOk(
+            CommandResult::recordsChunks<Record::Shared>(
+                records,
+                [] (stringstream &stream, const Record::Shared &kRecord) {
+                    static const auto kUnixEpoch = DateTime(boost::gregorian::date(1970,1,1));
+                    // Formatting operation date time to the Unix timestamp
+                    const auto kUnixTimestampMicrosec = (kRecord->timestamp() - kUnixEpoch).total_microseconds();
+
+                    if (kRecord->isPaymentRecord()) {
+                        auto paymentRecord = static_pointer_cast<PaymentRecord>(kRecord);
+                        stream << "payment"
+                               << kTokensSeparator << paymentRecord->operationUUID()
+                               << kTokensSeparator << kUnixTimestampMicrosec
+                               << kTokensSeparator << formattedOperationType(paymentRecord)
+                               << kTokensSeparator << paymentRecord->amount()
+                               << kTokensSeparator << paymentRecord->balanceAfterOperation()
+                               << kTokensSeparator << paymentRecord->payload();
+
+                    } else {
+                        auto trustLineRecord = static_pointer_cast<TrustLineRecord>(kRecord);
+                        stream << "trustline"
+                               << kTokensSeparator << trustLineRecord->operationUUID()
+                               << kTokensSeparator << kUnixTimestampMicrosec
+                               << kTokensSeparator << formattedOperationType(trustLineRecord)
+                               << kTokensSeparator << trustLineRecord->amount();
+                    }
+                },
+                mCursor != nullptr ? mCursor->toString() : string())));
+}
+
+string HistoryWithContractorTransaction::formattedOperationType(
+    const PaymentRecord::Shared &record)
+{
+    const auto kOperationType = record->paymentOperationType();
+    if (kOperationType == PaymentRecord::IncomingPaymentType) {
+        return "incoming";
 
-            // Formatting operation type
-            const auto kOperationType = trustLineRecord->trustLineOperationType();
-            string formattedOperationType;
-            if (kOperationType == TrustLineRecord::Opening) {
-                formattedOperationType = "opening";
+    } else if (kOperationType == PaymentRecord::OutgoingPaymentType) {
+        return "outgoing";
 
-            } else if (kOperationType == TrustLineRecord::Accepting) {
-                formattedOperationType = "accepting";
+    } else {
+        throw RuntimeError(
+            "HistoryWithContractorTransaction::formattedOperationType: "
+            "unexpected operation type occurred.");
+    }
+}
 
-            } else if (kOperationType == TrustLineRecord::Setting) {
-                formattedOperationType = "setting";
+string HistoryWithContractorTransaction::formattedOperationType(
+    const TrustLineRecord::Shared &record)
+{
+    const auto kOperationType = record->trustLineOperationType();
+    if (kOperationType == TrustLineRecord::Opening) {
+        return "opening";
 
-            } else if (kOperationType == TrustLineRecord::Updating) {
-                formattedOperationType = "updating";
+    } else if (kOperationType == TrustLineRecord::Accepting) {
+        return "accepting";
 
-            } else if (kOperationType == TrustLineRecord::Closing) {
-                formattedOperationType = "closing";
+    } else if (kOperationType == TrustLineRecord::Setting) {
+        return "setting";
 
-            } else if (kOperationType == TrustLineRecord::Rejecting) {
-                formattedOperationType = "rejecting";
+    } else if (kOperationType == TrustLineRecord::Updating) {
+        return "updating";
 
-            } else if (kOperationType == TrustLineRecord::ClosingIncoming) {
-                formattedOperationType = "closing_incoming";
+    } else if (kOperationType == TrustLineRecord::Closing) {
+        return "closing";
 
-            } else if (kOperationType == TrustLineRecord::RejectingOutgoing) {
-                formattedOperationType = "rejecting_outgoing";
+    } else if (kOperationType == TrustLineRecord::Rejecting) {
+        return "rejecting";
 
-            } else {
-                throw RuntimeError(
-                        "HistoryWithContractorTransaction::resultOk: "
-                            "unexpected trust line operation type occurred.");
-            }
+    } else if (kOperationType == TrustLineRecord::ClosingIncoming) {
+        return "closing_incoming";
 
-            stream << kTokensSeparator << formattedRecordType
-                   << kTokensSeparator << trustLineRecord->operationUUID()
-                   << kTokensSeparator << kUnixTimestampMicrosec
-                   << kTokensSeparator << formattedOperationType
-                   << kTokensSeparator << trustLineRecord->amount();
-        } else {
-            throw ValueError("HistoryWithContractorTransaction::resultOk: "
-                                 "unexpected record type occurred.");
-        }
-    }
+    } else if (kOperationType == TrustLineRecord::RejectingOutgoing) {
+        return "rejecting_outgoing";
 
-    auto result = stream.str();
-    return transactionResultFromCommand(
-        mCommand->resultOk(
-            result));
+    } else {
+        throw RuntimeError(
+            "HistoryWithContractorTransaction::formattedOperationType: "
+            "unexpected operation type occurred.");
+    }
 }
 
 const string HistoryWithContractorTransaction::logHeader() const
@@ -29,9 +29,17 @@ private:
     TransactionResult::SharedConst resultOk(
         const vector<Record::Shared> &records);
 
+    static string formattedOperationType(
+        const PaymentRecord::Shared &record);
+
+    static string formattedOperationType(
+        const TrustLineRecord::Shared &record);
+
 private:
     HistoryWithContractorCommand::Shared mCommand;
     StorageHandler *mStorageHandler;
+    // null if records are paged by offset
+    HistoryCursor::Shared mCursor;
 };
 
 
@@ -93,6 +93,11 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::sendReques
         mLog);
     mTopologyTrustLineManager->setPreventDeleting(true);
     launchSubsidiaryTransaction(kTransaction);
+    beginTopologyCollectingRound(
+        nonCachedContractors,
+        kWaitMillisecondsForCalculatingMaxFlow * 2,
+        kMaxWaitMillisecondsForCalculatingMaxFlow);
+
     bool isDirectPathOccurred = false;
     for (const auto &contractorIDAndAddress : mContractorIDs) {
         auto neighborID = mContractorsManager->contractorIDByAddress(contractorIDAndAddress.second);
@@ -105,8 +110,7 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::sendReques
     if (isDirectPathOccurred) {
         return resultIntermediateOk();
     } else {
-        return resultAwakeAfterMilliseconds(
-            kWaitMillisecondsForCalculatingMaxFlow);
+        return resultAwakeForTopologyCollecting();
     }
 }
 
@@ -116,9 +120,18 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::processCol
     info() << "CalculateMaxTransactionFlow";
     info() << "context size: " << mContext.size();
 #endif
-    auto const contextSize = mContext.size();
     fillTopology();
+    const auto isCollectingCompleted = isTopologyCollectingRoundCompleted();
+    if (isCollectingCompleted and !mShortMaxFlowsCalculated) {
+        // All topology is already collected, so intermediate stages are useless.
+        mGatewayResponseProcessed = true;
+        mShortMaxFlowsCalculated = true;
+    }
+
     if (!mGatewayResponseProcessed) {
+        if (!isTopologyCollectingStageElapsed(kWaitMillisecondsForCalculatingMaxFlow)) {
+            return resultAwakeForTopologyCollecting();
+        }
         mGatewayResponseProcessed = true;
         bool gatewayPathOccurred = false;
 
@@ -142,15 +155,18 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::processCol
             }
         }
 
+        beginTopologyCollectingStage();
         if (gatewayPathOccurred) {
             return resultIntermediateOk();
         } else {
-            return resultAwakeAfterMilliseconds(
-                kWaitMillisecondsForCalculatingMaxFlow);
+            return resultAwakeForTopologyCollecting();
         }
     }
 
     if (!mShortMaxFlowsCalculated) {
+        if (!isTopologyCollectingStageElapsed(kWaitMillisecondsForCalculatingMaxFlow)) {
+            return resultAwakeForTopologyCollecting();
+        }
         mShortMaxFlowsCalculated = true;
         mFirstLevelTopology = mTopologyTrustLineManager->trustLinePtrsSet(
             TopologyTrustLinesManager::kCurrentNodeID);
@@ -168,20 +184,18 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::processCol
             }
         }
         info() << "all contractors calculating time: " << utc_now() - startTime;
-        mCountProcessCollectingTopologyRun = 0;
         return resultIntermediateOk();
     }
 
-    mCountProcessCollectingTopologyRun++;
-    if (contextSize > 0 && mCountProcessCollectingTopologyRun <= kCountRunningProcessCollectingTopologyStage) {
-        return resultAwakeAfterMilliseconds(
-            kWaitMillisecondsForCalculatingMaxFlowAgain);
+    if (!isCollectingCompleted) {
+        return resultAwakeForTopologyCollecting();
     }
+    finishTopologyCollectingRound();
 
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     mTopologyTrustLineManager->printTrustLines();
 #endif
-    mFinalTopologyCollected = contextSize == 0;
+    mFinalTopologyCollected = true;
     mFirstLevelTopology = mTopologyTrustLineManager->trustLinePtrsSet(
         TopologyTrustLinesManager::kCurrentNodeID);
     mMaxPathLength = kLongMaxPathLength;
@@ -223,7 +237,6 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::applyCusto
     mCurrentGlobalContractorIdx++;
     if (mCurrentGlobalContractorIdx == mCommand->contractorAddresses().size()) {
         if (!mFinalTopologyCollected) {
-            mCountProcessCollectingTopologyRun = 0;
             mStep = ProcessCollectingTopology;
             return resultIntermediateOk();
         }
@@ -387,7 +400,7 @@ TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::resultInte
     return transactionResultFromCommandAndAwakeAfterMilliseconds(
         mCommand->responseOk(
             kMaxFlowAmountsStr),
-        kWaitMillisecondsForCalculatingMaxFlow);
+        kTopologyCollectingPollingMillisecondsTimeout);
 }
 
 TransactionResult::SharedConst InitiateMaxFlowCalculationTransaction::resultProtocolError()
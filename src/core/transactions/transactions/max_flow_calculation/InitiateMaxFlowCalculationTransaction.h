@@ -52,12 +52,9 @@ private:
 private:
     static const byte kShortMaxPathLength = 5;
     static const byte kLongMaxPathLength = 6;
+    // intermediate results are sent on each stage, if topology is not collected yet
     static const uint32_t kWaitMillisecondsForCalculatingMaxFlow = 1000;
-    static const uint32_t kWaitMillisecondsForCalculatingMaxFlowAgain = 500;
     static const uint32_t kMaxWaitMillisecondsForCalculatingMaxFlow = 10000;
-    static const uint16_t kCountRunningProcessCollectingTopologyStage =
-            (kMaxWaitMillisecondsForCalculatingMaxFlow - kWaitMillisecondsForCalculatingMaxFlow * 2) /
-            kWaitMillisecondsForCalculatingMaxFlowAgain;
 
 private:
     InitiateMaxFlowCalculationCommand::Shared mCommand;
@@ -65,7 +62,6 @@ private:
     byte mCurrentPathLength;
     TrustLineAmount mCurrentMaxFlow;
     ContractorID mCurrentContractor;
-    size_t mCountProcessCollectingTopologyRun;
     TopologyTrustLinesManager::TrustLineWithPtrHashSet mFirstLevelTopology;
     vector<pair<ContractorID, BaseAddress::Shared>> mContractorIDs;
     map<ContractorID, TrustLineAmount> mMaxFlows;
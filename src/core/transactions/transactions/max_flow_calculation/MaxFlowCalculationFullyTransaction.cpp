@@ -68,9 +68,11 @@ TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::sendRequestFo
     mTopologyTrustLineManager->setPreventDeleting(true);
     launchSubsidiaryTransaction(kTransaction);
 
-    mCountProcessCollectingTopologyRun = 0;
-    return resultAwakeAfterMilliseconds(
-        kWaitMillisecondsForCalculatingMaxFlow);
+    beginTopologyCollectingRound(
+        mCommand->contractorAddresses(),
+        kWaitMillisecondsForCalculatingMaxFlow,
+        kMaxWaitMillisecondsForCalculatingMaxFlow);
+    return resultAwakeForTopologyCollecting();
 }
 
 TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::processCollectingTopology()
@@ -79,13 +81,11 @@ TransactionResult::SharedConst MaxFlowCalculationFullyTransaction::processCollec
     info() << "CalculateMaxTransactionFlow";
     info() << "context size: " << mContext.size();
 #endif
-    auto const contextSize = mContext.size();
     fillTopology();
-    mCountProcessCollectingTopologyRun++;
-    if (contextSize > 0 && mCountProcessCollectingTopologyRun <= kCountRunningProcessCollectingTopologyStage) {
-        return resultAwakeAfterMilliseconds(
-            kWaitMillisecondsForCalculatingMaxFlowAgain);
+    if (!isTopologyCollectingRoundCompleted()) {
+        return resultAwakeForTopologyCollecting();
     }
+    finishTopologyCollectingRound();
     mMaxFlows.reserve(mCommand->contractorAddresses().size());
 #ifdef DEBUG_LOG_MAX_FLOW_CALCULATION
     mTopologyTrustLineManager->printTrustLines();
@@ -46,11 +46,7 @@ private:
 private:
     static const byte kMaxPathLength = 6;
     static const uint32_t kWaitMillisecondsForCalculatingMaxFlow = 4000;
-    static const uint32_t kWaitMillisecondsForCalculatingMaxFlowAgain = 500;
     static const uint32_t kMaxWaitMillisecondsForCalculatingMaxFlow = 15000;
-    static const uint16_t kCountRunningProcessCollectingTopologyStage =
-            (kMaxWaitMillisecondsForCalculatingMaxFlow - kWaitMillisecondsForCalculatingMaxFlow) /
-            kWaitMillisecondsForCalculatingMaxFlowAgain;
 
 private:
     InitiateMaxFlowCalculationFullyCommand::Shared mCommand;
@@ -58,7 +54,6 @@ private:
     byte mCurrentPathLength;
     TrustLineAmount mCurrentMaxFlow;
     ContractorID mCurrentContractor;
-    size_t mCountProcessCollectingTopologyRun;
     TopologyTrustLinesManager::TrustLineWithPtrHashSet mFirstLevelTopology;
     vector<pair<ContractorID, BaseAddress::Shared>> mContractorIDs;
     vector<pair<ContractorID, TrustLineAmount>> mMaxFlows;
@@ -12,6 +12,7 @@ CoordinatorPaymentTransaction::CoordinatorPaymentTransaction(
     PathsManager *pathsManager,
     Keystore *keystore,
     bool isPaymentTransactionsAllowedDueToObserving,
+    uint16_t maxPipelinedPathsCount,
     EventsInterfaceManager *eventsInterfaceManager,
     Logger &log,
     SubsystemsController *subsystemsController):
@@ -41,7 +42,10 @@ CoordinatorPaymentTransaction::CoordinatorPaymentTransaction(
     mCountParticipantKeysResending(1),
     mNeighborsKeysProblem(false),
     mParticipantsKeysProblem(false),
-    mIsPaymentTransactionsAllowedDueToObserving(isPaymentTransactionsAllowedDueToObserving)
+    mIsPaymentTransactionsAllowedDueToObserving(isPaymentTransactionsAllowedDueToObserving),
+    mMaxPipelinedPathsCount(maxPipelinedPathsCount),
+    mIsCurrentPathPipelined(false),
+    mIsPipelinedReservationRejected(false)
 {
     mStep = Stages::Coordinator_Initialization;
     mContractor = make_shared<Contractor>(command->contractorAddresses());
@@ -65,6 +69,9 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::run()
                 case Stages::Coordinator_AmountReservation:
                     return runAmountReservationStage();
 
+                case Stages::Coordinator_PipelinedAmountReservation:
+                    return runPipelinedAmountReservationStage();
+
                 case Stages::Coordinator_ShortPathAmountReservationResponseProcessing:
                     return runDirectAmountReservationResponseProcessingStage();
 
@@ -153,9 +160,12 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runPathsResourcePr
     response->pathCollection()->resetCurrentPath();
     while (response->pathCollection()->hasNextPath()) {
         auto path = response->pathCollection()->nextPath();
-        info() << "path " << path->toString();
+        info() << "path " << path->toString() << " estimated capacity "
+               << response->pathCollection()->currentPathCapacity();
         if (isPathValid(path)) {
-            addPathForFurtherProcessing(path);
+            addPathForFurtherProcessing(
+                path,
+                response->pathCollection()->currentPathCapacity());
         } else {
             warning() << "Invalid path: " << path->toString();
         }
@@ -226,8 +236,8 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runReceiverRespons
             mContractor->mainAddress()->fullAddress(),
             mCurrentFreePaymentID));
     mCurrentFreePaymentID++;
-    mStep = Stages::Coordinator_AmountReservation;
-    return runAmountReservationStage();
+    mAmountsReservationStarted = utc_now();
+    return tryBeginPipelinedAmountsReservation();
 }
 
 TransactionResult::SharedConst CoordinatorPaymentTransaction::runAmountReservationStage ()
@@ -340,6 +350,7 @@ void CoordinatorPaymentTransaction::initAmountsReservationOnNextPath()
     debug() << "[" << mCurrentAmountReservingPathIdentifier << "] {"
             << currentAmountReservationPathStats()->path()->toString() << "}";
     mCurrentPathParticipants.clear();
+    restorePipelinedPathParticipants();
 }
 
 /*
@@ -487,7 +498,8 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::tryReserveNextInte
 }
 
 void CoordinatorPaymentTransaction::addPathForFurtherProcessing(
-    Path::Shared path)
+    Path::Shared path,
+    const TrustLineAmount &estimatedCapacity)
 {
     // Preventing paths duplication
     for (const auto &identifierAndStats : mPathsStats) {
@@ -503,6 +515,7 @@ void CoordinatorPaymentTransaction::addPathForFurtherProcessing(
         if (mPathsStats.count(identifier) == 0){
             mPathsStats[identifier] = make_unique<PathStats>(path);
             mPathsStats[identifier]->path()->addReceiver(mContractor->mainAddress());
+            mPathsEstimatedCapacities[identifier] = estimatedCapacity;
             mPathIDs.push_back(identifier);
             return;
         }
@@ -949,7 +962,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::processNeighborFur
             mCurrentAmountReservingPathIdentifier,
             path);
 
-        if (kTotalAmount == mCommand->amount()){
+        if (kTotalAmount == mCommand->amount() && !isPipelinedPathsPending()) {
             debug() << "Total requested amount: " << mCommand->amount() << ". Collected.";
 
             mStep = Common_ObservingBlockNumberProcessing;
@@ -1035,9 +1048,20 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::processRemoteNodeR
             TTLProlongationResponseMessage::Continue);
         debug() << "Switching to another path.";
 
-        // remote node is inaccessible, we add it to offline nodes
         const auto kPathStats = currentAmountReservationPathStats();
         const auto addressAndPos = kPathStats->currentIntermediateNodeAndPos();
+        if (mIsCurrentPathPipelined) {
+            // nodes of previous versions don't accept reservation request,
+            // which was postponed by pipelined reservation, so remote node is not marked as offline
+            // and the rest of paths are reserved one by one
+            warning() << "Postponed reservation request was not processed by "
+                      << addressAndPos.first->fullAddress() << ". Pipelined reservation is disabled.";
+            mMaxPipelinedPathsCount = 0;
+            mIsPipelinedReservationRejected = true;
+            return tryProcessNextPath();
+        }
+
+        // remote node is inaccessible, we add it to offline nodes
         mInaccessibleNodes.push_back(addressAndPos.first);
         debug() << addressAndPos.first->fullAddress() << " was added to offline nodes";
 
@@ -1195,7 +1219,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::processRemoteNodeR
             mCurrentAmountReservingPathIdentifier,
             path);
 
-        if (kTotalAmount == mCommand->amount()) {
+        if (kTotalAmount == mCommand->amount() && !isPipelinedPathsPending()) {
             debug() << "Total requested amount: " << mCommand->amount() << ". Collected.";
 
             mStep = Common_ObservingBlockNumberProcessing;
@@ -1211,42 +1235,543 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::processRemoteNodeR
     return tryReserveNextIntermediateNodeAmount(path);
 }
 
+TransactionResult::SharedConst CoordinatorPaymentTransaction::tryBeginPipelinedAmountsReservation()
+{
+    debug() << "tryBeginPipelinedAmountsReservation";
+    // paths, selected for pipelined reservation, and amounts, which would be reserved on them
+    vector<pair<PathID, TrustLineAmount>> selectedPaths;
+    if (mMaxPipelinedPathsCount > 1) {
+        set<string> selectedNodes;
+        auto unallocatedAmount = mCommand->amount() - totalReservedAmount(AmountReservation::Outgoing);
+        for (const auto pathID : mPathIDs) {
+            if (selectedPaths.size() >= mMaxPipelinedPathsCount || unallocatedAmount == 0) {
+                break;
+            }
+            const auto pathStats = mPathsStats[pathID].get();
+            if (!pathStats->containsIntermediateNodes()) {
+                continue;
+            }
+
+            // receiver is the last node of the path and it is common for all paths
+            const auto kIntermediates = pathStats->path()->intermediates();
+            bool isNodeDisjoint = true;
+            for (size_t idx = 0; idx < kIntermediates.size() - 1; idx++) {
+                if (selectedNodes.count(kIntermediates[idx]->fullAddress()) != 0) {
+                    isNodeDisjoint = false;
+                    break;
+                }
+            }
+            if (!isNodeDisjoint) {
+                continue;
+            }
+
+            // paths with problems on first level trust line are left for sequential processing,
+            // which handles all such cases
+            auto neighborID = mContractorsManager->contractorIDByAddress(kIntermediates[0]);
+            if (neighborID == ContractorsManager::kNotFoundContractorID or
+                    !mTrustLinesManager->trustLineIsPresent(neighborID) or
+                    !mTrustLinesManager->trustLineIsActive(neighborID) or
+                    !mTrustLinesManager->trustLineOwnKeysPresent(neighborID)) {
+                continue;
+            }
+
+            auto reservationAmount = min(
+                *mTrustLinesManager->outgoingTrustAmountConsideringReservations(neighborID),
+                unallocatedAmount);
+            const auto kEstimatedCapacity = mPathsEstimatedCapacities.find(pathID);
+            if (kEstimatedCapacity != mPathsEstimatedCapacities.end() and kEstimatedCapacity->second > 0) {
+                reservationAmount = min(reservationAmount, kEstimatedCapacity->second);
+            }
+            if (reservationAmount == 0) {
+                continue;
+            }
+
+            for (size_t idx = 0; idx < kIntermediates.size() - 1; idx++) {
+                selectedNodes.insert(kIntermediates[idx]->fullAddress());
+            }
+            selectedPaths.emplace_back(
+                pathID,
+                reservationAmount);
+            unallocatedAmount -= reservationAmount;
+        }
+    }
+
+    if (selectedPaths.size() < 2) {
+        debug() << "There are no enough node-disjoint paths for pipelined reservation";
+        mStep = Stages::Coordinator_AmountReservation;
+        return runAmountReservationStage();
+    }
+
+    for (const auto &pathIDAndAmount : selectedPaths) {
+        const auto pathID = pathIDAndAmount.first;
+        const auto pathStats = mPathsStats[pathID].get();
+        const auto kNeighbor = pathStats->path()->intermediates()[0];
+        const auto neighborID = mContractorsManager->contractorIDByAddress(kNeighbor);
+        if (not reserveOutgoingAmount(
+                neighborID,
+                pathIDAndAmount.second,
+                pathID)) {
+            warning() << "Can't reserve amount locally on path " << pathID
+                      << ". It will be processed sequentially.";
+            continue;
+        }
+
+        pathStats->shortageMaxFlow(pathIDAndAmount.second);
+        pathStats->setNodeState(
+            0,
+            PathStats::NeighbourReservationRequestSent);
+
+        vector<pair<PathID, ConstSharedTrustLineAmount>> reservations;
+        reservations.emplace_back(
+            pathID,
+            make_shared<const TrustLineAmount>(pathIDAndAmount.second));
+        if (mNodesFinalAmountsConfiguration.find(kNeighbor->fullAddress()) != mNodesFinalAmountsConfiguration.end()) {
+            // add existing neighbor reservations
+            const auto kNeighborReservations = mNodesFinalAmountsConfiguration[kNeighbor->fullAddress()];
+            reservations.insert(
+                reservations.end(),
+                kNeighborReservations.begin(),
+                kNeighborReservations.end());
+        }
+
+        sendMessage<IntermediateNodeReservationRequestMessage>(
+            neighborID,
+            mEquivalent,
+            mContractorsManager->ownAddresses(),
+            mTransactionUUID,
+            reservations);
+
+        debug() << "[" << pathID << "] {" << pathStats->path()->toString() << "} pipelined reservation request for "
+                << pathIDAndAmount.second << " sent to the node (" << kNeighbor->fullAddress() << ")";
+
+        mPipelinedPathIDs.insert(pathID);
+        mPipelinedPathsParticipants[pathID] = {};
+        mPipelinedPathsDeadlines[pathID] = utc_now() + pt::milliseconds(maxNetworkDelay(2));
+    }
+
+    if (mPipelinedPathsDeadlines.empty()) {
+        mStep = Stages::Coordinator_AmountReservation;
+        return runAmountReservationStage();
+    }
+
+    info() << "Pipelined reservation started on " << mPipelinedPathsDeadlines.size() << " paths";
+    mStep = Stages::Coordinator_PipelinedAmountReservation;
+    return resultWaitForMessageTypes(
+        {Message::Payments_IntermediateNodeReservationResponse,
+         Message::Payments_CoordinatorReservationResponse,
+         Message::Payments_TTLProlongationRequest,
+         Message::General_NoEquivalent},
+        pipelinedResponsesWaitingTime());
+}
+
+TransactionResult::SharedConst CoordinatorPaymentTransaction::runPipelinedAmountReservationStage()
+{
+    debug() << "runPipelinedAmountReservationStage";
+    while (!mContext.empty()) {
+        switch (mContext.front()->typeID()) {
+            case Message::Payments_IntermediateNodeReservationResponse: {
+                if (!processPipelinedNeighborReservationResponse(
+                        popNextMessage<IntermediateNodeReservationResponseMessage>())) {
+                    return reject("Desynchronization in pipelined reservation occurred. Transaction closed.");
+                }
+                break;
+            }
+            case Message::Payments_CoordinatorReservationResponse: {
+                if (!processPipelinedFurtherReservationResponse(
+                        popNextMessage<CoordinatorReservationResponseMessage>())) {
+                    return reject("Desynchronization in pipelined reservation occurred. Transaction closed.");
+                }
+                break;
+            }
+            case Message::Payments_TTLProlongationRequest: {
+                runTTLTransactionResponse();
+                break;
+            }
+            case Message::General_NoEquivalent: {
+                const auto kMessage = popNextMessage<TransactionMessage>();
+                const auto kSenderAddress = kMessage->senderAddresses.at(0);
+                for (const auto &pathIDAndDeadline : mPipelinedPathsDeadlines) {
+                    const auto pathStats = mPathsStats[pathIDAndDeadline.first].get();
+                    if (pathStats->isWaitingForNeighborReservationResponse() and
+                            pathStats->path()->intermediates()[0] == kSenderAddress) {
+                        warning() << "Node " << kSenderAddress->fullAddress() << " hasn't TLs on requested equivalent";
+                        dropPipelinedPath(
+                            pathIDAndDeadline.first,
+                            false);
+                        break;
+                    }
+                }
+                break;
+            }
+            default: {
+                warning() << "Unexpected message received " << mContext.front()->typeID();
+                mContext.pop_front();
+            }
+        }
+    }
+
+    // paths, which nodes didn't respond in time
+    const auto kNow = utc_now();
+    vector<PathID> expiredPaths;
+    for (const auto &pathIDAndDeadline : mPipelinedPathsDeadlines) {
+        if (pathIDAndDeadline.second <= kNow) {
+            expiredPaths.push_back(pathIDAndDeadline.first);
+        }
+    }
+    for (const auto pathID : expiredPaths) {
+        const auto pathStats = mPathsStats[pathID].get();
+        const auto kInaccessibleNode = pathStats->currentIntermediateNodeAndPos().first;
+        debug() << "No response received on pipelined path " << pathID;
+        dropPipelinedPath(
+            pathID,
+            !pathStats->isWaitingForNeighborReservationResponse());
+        // remote node is inaccessible, we add it to offline nodes
+        mInaccessibleNodes.push_back(kInaccessibleNode);
+        debug() << kInaccessibleNode->fullAddress() << " was added to offline nodes";
+    }
+
+    if (mPipelinedPathsDeadlines.empty()) {
+        return finishPipelinedAmountsReservation();
+    }
+
+    return resultWaitForMessageTypes(
+        {Message::Payments_IntermediateNodeReservationResponse,
+         Message::Payments_CoordinatorReservationResponse,
+         Message::Payments_TTLProlongationRequest,
+         Message::General_NoEquivalent},
+        pipelinedResponsesWaitingTime());
+}
+
+void CoordinatorPaymentTransaction::sendNextPipelinedReservationRequest(
+    const PathID pathID)
+{
+    const auto pathStats = mPathsStats[pathID].get();
+    const auto kIntermediates = pathStats->path()->intermediates();
+    const auto remoteNodeAndPos = pathStats->nextIntermediateNodeAndPos();
+    const auto remoteNode = remoteNodeAndPos.first;
+    const auto remoteNodePosition = remoteNodeAndPos.second;
+
+    if (remoteNodePosition + 2 == (SerializedPositionInPath)kIntermediates.size()) {
+        // only the hop to Receiver is left, it will be processed sequentially
+        debug() << "[" << pathID << "] pipelined reservation finished, max flow " << pathStats->maxFlow();
+        mPipelinedPathsDeadlines.erase(pathID);
+        return;
+    }
+
+    const auto kNextAfterRemoteNode = kIntermediates[remoteNodePosition + 1];
+    vector<pair<PathID, ConstSharedTrustLineAmount>> reservations;
+    reservations.emplace_back(
+        pathID,
+        make_shared<const TrustLineAmount>(pathStats->maxFlow()));
+    if (mNodesFinalAmountsConfiguration.find(kNextAfterRemoteNode->fullAddress()) !=
+            mNodesFinalAmountsConfiguration.end()) {
+        // add existing next after remote node reservations
+        const auto kNextNodeReservations = mNodesFinalAmountsConfiguration[kNextAfterRemoteNode->fullAddress()];
+        reservations.insert(
+            reservations.end(),
+            kNextNodeReservations.begin(),
+            kNextNodeReservations.end());
+    }
+
+    sendMessage<CoordinatorReservationRequestMessage>(
+        remoteNode,
+        mEquivalent,
+        mContractorsManager->ownAddresses(),
+        mTransactionUUID,
+        reservations,
+        kNextAfterRemoteNode);
+
+    pathStats->setNodeState(
+        remoteNodePosition,
+        PathStats::ReservationRequestSent);
+    // delay is equal 4 because in IntermediateNodePaymentTransaction::runCoordinatorRequestProcessingStage delay is 2
+    mPipelinedPathsDeadlines[pathID] = utc_now() + pt::milliseconds(maxNetworkDelay(4));
+
+    debug() << "[" << pathID << "] further amount reservation request sent to the node ("
+            << remoteNode->fullAddress() << ") [" << pathStats->maxFlow() << "], next node - ("
+            << kNextAfterRemoteNode->fullAddress() << ")";
+}
+
+bool CoordinatorPaymentTransaction::processPipelinedNeighborReservationResponse(
+    IntermediateNodeReservationResponseMessage::Shared message)
+{
+    const auto pathID = message->pathID();
+    const auto neighborAddress = message->senderAddresses.at(0);
+    debug() << "processPipelinedNeighborReservationResponse [" << pathID << "] from " << neighborAddress->fullAddress();
+    if (mPipelinedPathsDeadlines.count(pathID) == 0) {
+        warning() << "Response on path, which is not processed at the moment. Ignored";
+        return true;
+    }
+    const auto pathStats = mPathsStats[pathID].get();
+    if (!pathStats->isWaitingForNeighborReservationResponse() or
+            pathStats->path()->intermediates()[0] != neighborAddress) {
+        warning() << "Unexpected response on path " << pathID << ". Ignored";
+        return true;
+    }
+
+    if (message->state() == IntermediateNodeReservationResponseMessage::Closed) {
+        warning() << "Neighbor node doesn't approved reservation request";
+        return false;
+    }
+
+    if (message->state() == IntermediateNodeReservationResponseMessage::Rejected or
+            message->state() == IntermediateNodeReservationResponseMessage::RejectedDueContractorKeysAbsence) {
+        warning() << "Neighbor node doesn't approved reservation request";
+        dropPipelinedPath(
+            pathID,
+            false);
+        mRejectedTrustLines.emplace_back(
+            mContractorsManager->ownAddresses().at(0),
+            neighborAddress);
+        if (message->state() == IntermediateNodeReservationResponseMessage::RejectedDueContractorKeysAbsence) {
+            mNeighborsKeysProblem = true;
+        }
+        return true;
+    }
+
+    if (message->state() != IntermediateNodeReservationResponseMessage::Accepted) {
+        warning() << "Unexpected message state " << message->state();
+        return false;
+    }
+
+    pathStats->setNodeState(
+        0,
+        PathStats::NeighbourReservationApproved);
+    if (message->amountReserved() != pathStats->maxFlow()) {
+        pathStats->shortageMaxFlow(message->amountReserved());
+        shortageReservationsOnPath(
+            mContractorsManager->contractorIDByAddress(neighborAddress),
+            pathID,
+            pathStats->maxFlow());
+    }
+    sendNextPipelinedReservationRequest(pathID);
+    return true;
+}
+
+bool CoordinatorPaymentTransaction::processPipelinedFurtherReservationResponse(
+    CoordinatorReservationResponseMessage::Shared message)
+{
+    const auto pathID = message->pathID();
+    const auto remoteNodeAddress = message->senderAddresses.at(0);
+    debug() << "processPipelinedFurtherReservationResponse [" << pathID << "] from " << remoteNodeAddress->fullAddress();
+    if (mPipelinedPathsDeadlines.count(pathID) == 0) {
+        warning() << "Response on path, which is not processed at the moment. Ignored";
+        return true;
+    }
+    const auto pathStats = mPathsStats[pathID].get();
+    const auto remoteNodeAndPos = pathStats->currentIntermediateNodeAndPos();
+    if (!pathStats->isWaitingForReservationResponse() or remoteNodeAndPos.first != remoteNodeAddress) {
+        warning() << "Unexpected response on path " << pathID << ". Ignored";
+        return true;
+    }
+    const auto nextAfterRemoteNode = pathStats->path()->intermediates()[remoteNodeAndPos.second + 1];
+
+    if (message->state() == CoordinatorReservationResponseMessage::Closed) {
+        return false;
+    }
+
+    if (message->state() == CoordinatorReservationResponseMessage::NextNodeInaccessible) {
+        warning() << "Next node after remote node is inaccessible. Rejecting request.";
+        dropPipelinedPath(
+            pathID,
+            false);
+        // Receiver is never requested on pipelined stage
+        mInaccessibleNodes.push_back(nextAfterRemoteNode);
+        debug() << nextAfterRemoteNode->fullAddress() << " was added to offline nodes";
+        return true;
+    }
+
+    if (message->amountReserved() == 0 or message->state() == CoordinatorReservationResponseMessage::Rejected) {
+        warning() << "Remote node rejected reservation.";
+        dropPipelinedPath(
+            pathID,
+            false);
+        // processed trustLine was rejected, we add it to Rejected TrustLines
+        mRejectedTrustLines.emplace_back(
+            remoteNodeAddress,
+            nextAfterRemoteNode);
+        return true;
+    }
+
+    if (message->state() == CoordinatorReservationResponseMessage::RejectedDueOwnKeysAbsence or
+            message->state() == CoordinatorReservationResponseMessage::RejectedDueContractorKeysAbsence) {
+        warning() << "Remote node doesn't accepted coordinator request due to keys absence.";
+        dropPipelinedPath(
+            pathID,
+            false);
+        mRejectedTrustLines.emplace_back(
+            remoteNodeAddress,
+            nextAfterRemoteNode);
+        mParticipantsKeysProblem = true;
+        return true;
+    }
+
+    if (message->state() != CoordinatorReservationResponseMessage::Accepted) {
+        warning() << "Unexpected message state " << message->state();
+        return false;
+    }
+
+    debug() << "Remote node reserved " << message->amountReserved();
+    pathStats->setNodeState(
+        remoteNodeAndPos.second,
+        PathStats::ReservationApproved);
+    mPipelinedPathsParticipants[pathID].push_back(
+        make_shared<Contractor>(
+            message->senderAddresses));
+    if (message->amountReserved() != pathStats->maxFlow()) {
+        pathStats->shortageMaxFlow(message->amountReserved());
+        shortageReservationsOnPath(
+            mContractorsManager->contractorIDByAddress(
+                pathStats->path()->intermediates()[0]),
+            pathID,
+            pathStats->maxFlow());
+        debug() << "Path max flow is now " << pathStats->maxFlow();
+    }
+    sendNextPipelinedReservationRequest(pathID);
+    return true;
+}
+
+void CoordinatorPaymentTransaction::dropPipelinedPath(
+    const PathID pathID,
+    bool sendToLastProcessedNode)
+{
+    dropReservationsOnPath(
+        mPathsStats[pathID].get(),
+        pathID,
+        sendToLastProcessedNode);
+    mPipelinedPathIDs.erase(pathID);
+    mPipelinedPathsDeadlines.erase(pathID);
+    mPipelinedPathsParticipants.erase(pathID);
+
+    // sending message to receiver that transaction continues
+    sendMessage<TTLProlongationResponseMessage>(
+        mContractor->mainAddress(),
+        mEquivalent,
+        mContractorsManager->ownAddresses(),
+        currentTransactionUUID(),
+        TTLProlongationResponseMessage::Continue);
+}
+
+TransactionResult::SharedConst CoordinatorPaymentTransaction::finishPipelinedAmountsReservation()
+{
+    vector<PathID> pipelinedPathIDs, otherPathIDs;
+    for (const auto pathID : mPathIDs) {
+        if (!mPathsStats[pathID]->isValid()) {
+            mPathsStats.erase(pathID);
+        } else if (mPipelinedPathIDs.count(pathID) != 0) {
+            pipelinedPathIDs.push_back(pathID);
+        } else {
+            otherPathIDs.push_back(pathID);
+        }
+    }
+    info() << "Pipelined reservation finished on " << pipelinedPathIDs.size() << " paths. "
+           << "Reserved amount " << totalReservedAmount(AmountReservation::Outgoing);
+
+    // paths, reserved in pipelined way, are processed first for reservation of the hop to Receiver
+    mPathIDs = pipelinedPathIDs;
+    mPathIDs.insert(
+        mPathIDs.end(),
+        otherPathIDs.begin(),
+        otherPathIDs.end());
+
+    mStep = Stages::Coordinator_AmountReservation;
+    if (mPathIDs.empty()) {
+        mReservationsStage = 1;
+        return tryBuildPathsAgainAndContinueReservation();
+    }
+    mReservationsStage = 0;
+    return runAmountReservationStage();
+}
+
+bool CoordinatorPaymentTransaction::isPipelinedPathsPending() const
+{
+    return !mPipelinedPathIDs.empty();
+}
+
+bool CoordinatorPaymentTransaction::isPipelinedPathNode(
+    BaseAddress::Shared nodeAddress) const
+{
+    for (const auto pathID : mPipelinedPathIDs) {
+        const auto pathStats = mPathsStats.find(pathID);
+        if (pathStats != mPathsStats.end() and
+                pathStats->second->path()->positionOfNode(nodeAddress) >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CoordinatorPaymentTransaction::restorePipelinedPathParticipants()
+{
+    // path, reserved in pipelined way, becomes current one and is not pending anymore
+    mIsCurrentPathPipelined = mPipelinedPathIDs.erase(mCurrentAmountReservingPathIdentifier) != 0;
+    if (!mIsCurrentPathPipelined) {
+        return;
+    }
+    const auto kPathParticipants = mPipelinedPathsParticipants.find(mCurrentAmountReservingPathIdentifier);
+    if (kPathParticipants != mPipelinedPathsParticipants.end()) {
+        mCurrentPathParticipants = kPathParticipants->second;
+        mPipelinedPathsParticipants.erase(kPathParticipants);
+    }
+}
+
+uint32_t CoordinatorPaymentTransaction::pipelinedResponsesWaitingTime() const
+{
+    auto nearestDeadline = mPipelinedPathsDeadlines.cbegin()->second;
+    for (const auto &pathIDAndDeadline : mPipelinedPathsDeadlines) {
+        nearestDeadline = min(nearestDeadline, pathIDAndDeadline.second);
+    }
+    const auto kNow = utc_now();
+    if (nearestDeadline <= kNow) {
+        return 0;
+    }
+    return (uint32_t)(nearestDeadline - kNow).total_milliseconds();
+}
+
 TransactionResult::SharedConst CoordinatorPaymentTransaction::tryProcessNextPath()
 {
     debug() << "tryProcessNextPath";
     mCurrentPathParticipants.clear();
     try {
         switchToNextPath();
+        restorePipelinedPathParticipants();
         return runAmountReservationStage();
 
     } catch (NotFoundError &e) {
-        debug() << "No another paths are available. Try build new paths.";
-        mRebuildingAttemptsCount++;
-        if (mRebuildingAttemptsCount > kMaxRebuildingAttemptsCount) {
-            reject("Count rebuilding attempts reaches maximal number. Canceling.");
-            return resultInsufficientFundsError();
-        }
-
-        if (mInaccessibleNodes.size() != mPreviousInaccessibleNodesCount ||
-                mRejectedTrustLines.size() != mPreviousRejectedTrustLinesCount) {
-            auto countPathsBeforeBuilding = mPathsStats.size();
-            buildPathsAgain();
-
-            if (mPathsStats.size() > countPathsBeforeBuilding) {
-                debug() << "New paths was built " << to_string(mPathsStats.size() - countPathsBeforeBuilding);
-                mPreviousInaccessibleNodesCount = mInaccessibleNodes.size();
-                mPreviousRejectedTrustLinesCount = mRejectedTrustLines.size();
-                // in case if amount on direct paths changed, we can process it again
-                mDirectPathIsAlreadyProcessed = false;
-                initAmountsReservationOnNextPath();
-                return runAmountReservationStage();
-            }
-            debug() << "New paths was not built";
-        }
+        return tryBuildPathsAgainAndContinueReservation();
+    }
+}
 
-        reject("No another paths are available. Canceling.");
+TransactionResult::SharedConst CoordinatorPaymentTransaction::tryBuildPathsAgainAndContinueReservation()
+{
+    debug() << "No another paths are available. Try build new paths.";
+    mRebuildingAttemptsCount++;
+    if (mRebuildingAttemptsCount > kMaxRebuildingAttemptsCount) {
+        reject("Count rebuilding attempts reaches maximal number. Canceling.");
         return resultInsufficientFundsError();
     }
+
+    if (mInaccessibleNodes.size() != mPreviousInaccessibleNodesCount ||
+            mRejectedTrustLines.size() != mPreviousRejectedTrustLinesCount ||
+            mIsPipelinedReservationRejected) {
+        auto countPathsBeforeBuilding = mPathsStats.size();
+        buildPathsAgain();
+
+        if (mPathsStats.size() > countPathsBeforeBuilding) {
+            debug() << "New paths was built " << to_string(mPathsStats.size() - countPathsBeforeBuilding);
+            mPreviousInaccessibleNodesCount = mInaccessibleNodes.size();
+            mPreviousRejectedTrustLinesCount = mRejectedTrustLines.size();
+            mIsPipelinedReservationRejected = false;
+            // in case if amount on direct paths changed, we can process it again
+            mDirectPathIsAlreadyProcessed = false;
+            initAmountsReservationOnNextPath();
+            return runAmountReservationStage();
+        }
+        debug() << "New paths was not built";
+    }
+
+    reject("No another paths are available. Canceling.");
+    return resultInsufficientFundsError();
 }
 
 TransactionResult::SharedConst CoordinatorPaymentTransaction::sendFinalAmountsConfigurationToAllParticipants()
@@ -1342,6 +1867,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::sendFinalAmountsCo
     }
 
     debug() << "Total count of all participants with coordinator is " << mPaymentParticipants.size();
+    info() << "Amounts reservation duration " << utc_now() - mAmountsReservationStarted;
 
     mStep = Coordinator_FinalAmountsConfigurationConfirmation;
     return resultWaitForMessageTypes(
@@ -1657,7 +2183,7 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runDirectAmountRes
         mCurrentAmountReservingPathIdentifier,
         pathStats);
 
-    if (kTotalAmount == mCommand->amount()) {
+    if (kTotalAmount == mCommand->amount() && !isPipelinedPathsPending()) {
         debug() << "Total requested amount: " << mCommand->amount() << ". Collected.";
         debug() << "Begin processing participants votes.";
 
@@ -1828,7 +2354,9 @@ TransactionResult::SharedConst CoordinatorPaymentTransaction::runTTLTransactionR
         }
     } else {
         // voting stage
-        if (mPaymentNodesIds.find(senderAddress->fullAddress()) != mPaymentNodesIds.end()) {
+        // or node is waiting for reservation of the hop to Receiver on pipelined path
+        if (mPaymentNodesIds.find(senderAddress->fullAddress()) != mPaymentNodesIds.end() or
+                isPipelinedPathNode(senderAddress)) {
             sendMessage<TTLProlongationResponseMessage>(
                 senderAddress,
                 mEquivalent,
@@ -2085,7 +2613,9 @@ void CoordinatorPaymentTransaction::buildPathsAgain()
     while (mPathsManager->pathCollection()->hasNextPath()) {
         auto path = mPathsManager->pathCollection()->nextPath();
         if (isPathValid(path)) {
-            addPathForFurtherProcessing(path);
+            addPathForFurtherProcessing(
+                path,
+                mPathsManager->pathCollection()->currentPathCapacity());
         }
     }
     mPathsManager->clearPathsCollection();
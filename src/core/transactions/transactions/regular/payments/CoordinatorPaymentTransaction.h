@@ -37,6 +37,7 @@ public:
         PathsManager *pathsManager,
         Keystore *keystore,
         bool isPaymentTransactionsAllowedDueToObserving,
+        uint16_t maxPipelinedPathsCount,
         EventsInterfaceManager *eventsInterfaceManager,
         Logger &log,
         SubsystemsController *subsystemsController);
@@ -72,6 +73,11 @@ protected:
      */
     TransactionResult::SharedConst runAmountReservationStage();
 
+    /**
+     * process responses on pipelined reservation requests on several paths simultaneously
+     */
+    TransactionResult::SharedConst runPipelinedAmountReservationStage();
+
     /**
      * reaction on request of reserve amount on direct way to Receiver
      */
@@ -123,7 +129,8 @@ protected:
      * @param path built path from resources which will be added to mPathsStats
      */
     void addPathForFurtherProcessing(
-        Path::Shared path);
+        Path::Shared path,
+        const TrustLineAmount &estimatedCapacity);
 
     /**
      * init field mCurrentAmountReservingPathIdentifier for starting work with mPathStats
@@ -147,6 +154,12 @@ protected:
      */
     TransactionResult::SharedConst tryProcessNextPath();
 
+    /**
+     * rebuild paths in case if there are no paths for processing
+     * and begin reservation on newly built paths
+     */
+    TransactionResult::SharedConst tryBuildPathsAgainAndContinueReservation();
+
     /**
      * try reserve available amount on direct path to Receiver
      * and send reservation request to it
@@ -210,6 +223,70 @@ protected:
      */
     TransactionResult::SharedConst processRemoteNodeResponse();
 
+    /*
+     * Pipelined amounts reservation.
+     * Paths reservations are processed sequentially, because each node drops its reservations on paths,
+     * which are absent in final amounts configuration received from coordinator.
+     * So several paths can be processed at once only if they have no common nodes.
+     * Receiver is present in all paths, that's why pipelined reservation is processed on paths without common
+     * intermediate nodes up to the last intermediate node of each path (all hops except the hop to Receiver).
+     * After that, paths are processed in common sequential way and only hops to Receiver are left on them.
+     */
+
+    /**
+     * select paths without common intermediate nodes, split remaining amount between them
+     * and send reservation requests to the first intermediate node of each selected path
+     * in case if there are less than two such paths, sequential reservation is started
+     */
+    TransactionResult::SharedConst tryBeginPipelinedAmountsReservation();
+
+    /**
+     * send next reservation request on pipelined path or finish pipelined processing of this path
+     * in case if all hops except the hop to Receiver are reserved
+     */
+    void sendNextPipelinedReservationRequest(
+        const PathID pathID);
+
+    /**
+     * @return false in case if response contains protocol violation and transaction should be rejected
+     */
+    bool processPipelinedNeighborReservationResponse(
+        IntermediateNodeReservationResponseMessage::Shared message);
+
+    /**
+     * @return false in case if response contains protocol violation and transaction should be rejected
+     */
+    bool processPipelinedFurtherReservationResponse(
+        CoordinatorReservationResponseMessage::Shared message);
+
+    /**
+     * @return time in milliseconds up to the nearest deadline of pipelined paths responses
+     */
+    uint32_t pipelinedResponsesWaitingTime() const;
+
+    /**
+     * drop reservations on pipelined path, which is not processed anymore
+     */
+    void dropPipelinedPath(
+        const PathID pathID,
+        bool sendToLastProcessedNode);
+
+    /**
+     * move paths, processed in pipelined way, to the beginning of the paths queue
+     * and switch to sequential reservation
+     */
+    TransactionResult::SharedConst finishPipelinedAmountsReservation();
+
+    /**
+     * @return true if there are paths, processed in pipelined way, which are waiting for the hop to Receiver
+     */
+    bool isPipelinedPathsPending() const;
+
+    bool isPipelinedPathNode(
+        BaseAddress::Shared nodeAddress) const;
+
+    void restorePipelinedPathParticipants();
+
     /**
      * send messages to all transaction participants with their final amount configuration
      */
@@ -362,5 +439,30 @@ protected:
     uint16_t mCountParticipantKeysResending;
 
     bool mIsPaymentTransactionsAllowedDueToObserving;
+
+    // max count of paths, which are reserved simultaneously on pipelined reservation,
+    // value less than 2 disables pipelined reservation
+    uint16_t mMaxPipelinedPathsCount;
+
+    // capacities of paths, estimated by topology during paths building
+    unordered_map<PathID, TrustLineAmount> mPathsEstimatedCapacities;
+
+    // paths, which are reserved in pipelined way and are waiting for the hop to Receiver
+    set<PathID> mPipelinedPathIDs;
+
+    // paths, which are processed in pipelined way at the moment, with deadlines of responses on them
+    map<PathID, DateTime> mPipelinedPathsDeadlines;
+
+    // participants of paths, which were processed in pipelined way, but not finished yet
+    map<PathID, vector<Contractor::Shared>> mPipelinedPathsParticipants;
+
+    // current path was reserved in pipelined way and its hop to Receiver was postponed
+    bool mIsCurrentPathPipelined;
+
+    // node, which doesn't support postponed reservation request, was met,
+    // so dropped path should be built and reserved again one by one
+    bool mIsPipelinedReservationRejected;
+
+    DateTime mAmountsReservationStarted;
 };
 #endif //GEO_NETWORK_CLIENT_COORDINATORPAYMENTTRANSCATION_H
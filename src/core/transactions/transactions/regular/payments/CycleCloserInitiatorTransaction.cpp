@@ -1307,6 +1307,11 @@ const SerializedPathLengthSize CycleCloserInitiatorTransaction::cycleLength() co
     return (SerializedPathLengthSize)mPathStats->path()->length();
 }
 
+Path::Shared CycleCloserInitiatorTransaction::closedCycle() const
+{
+    return mPathStats->path();
+}
+
 const string CycleCloserInitiatorTransaction::logHeader() const
 {
     stringstream s;
@@ -33,6 +33,12 @@ public:
      */
     const SerializedPathLengthSize cycleLength() const override;
 
+    /**
+     * @return cycle which is closing by current transaction,
+     * used in CyclesManager for releasing trust lines of this cycle after transaction finishing
+     */
+    Path::Shared closedCycle() const;
+
 protected:
     // Stages handlers
     // TODO: Add throws specifications
@@ -526,12 +526,18 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runReservatio
             }
             // we don't wait for Payments_FinalPathConfiguration message,
             // because it isn't critical for us
+            vector<Message::MessageType> messageTypes = {
+                Message::Payments_TTLProlongationResponse,
+                Message::Payments_FinalPathConfiguration,
+                Message::Payments_FinalAmountsConfiguration,
+                Message::Payments_TransactionPublicKeyHash,
+                Message::Payments_IntermediateNodeReservationRequest};
+            if (mStep == Stages::IntermediateNode_CoordinatorRequestProcessing) {
+                // coordinator can postpone request to this node (in case of pipelined reservation)
+                messageTypes.push_back(Message::Payments_CoordinatorReservationRequest);
+            }
             return resultWaitForMessageTypes(
-                {Message::Payments_TTLProlongationResponse,
-                 Message::Payments_FinalPathConfiguration,
-                 Message::Payments_FinalAmountsConfiguration,
-                 Message::Payments_TransactionPublicKeyHash,
-                 Message::Payments_IntermediateNodeReservationRequest},
+                move(messageTypes),
                 maxNetworkDelay((kMaxPathLength - 2) * 4));
         }
         return reject("Coordinator send response with transaction finish state. Rolling Back");
@@ -553,12 +559,18 @@ TransactionResult::SharedConst IntermediateNodePaymentTransaction::runReservatio
     mTTLRequestWasSend = true;
     // we don't wait for Payments_FinalPathConfiguration message,
     // because it isn't critical for us
+    vector<Message::MessageType> messageTypes = {
+        Message::Payments_IntermediateNodeReservationRequest,
+        Message::Payments_FinalPathConfiguration,
+        Message::Payments_FinalAmountsConfiguration,
+        Message::Payments_TransactionPublicKeyHash,
+        Message::Payments_TTLProlongationResponse};
+    if (mStep == Stages::IntermediateNode_CoordinatorRequestProcessing) {
+        // coordinator can postpone request to this node (in case of pipelined reservation)
+        messageTypes.push_back(Message::Payments_CoordinatorReservationRequest);
+    }
     return resultWaitForMessageTypes(
-        {Message::Payments_IntermediateNodeReservationRequest,
-         Message::Payments_FinalPathConfiguration,
-         Message::Payments_FinalAmountsConfiguration,
-         Message::Payments_TransactionPublicKeyHash,
-         Message::Payments_TTLProlongationResponse},
+        move(messageTypes),
         maxNetworkDelay(2));
 }
 
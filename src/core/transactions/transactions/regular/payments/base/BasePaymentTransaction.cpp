@@ -143,10 +143,8 @@ BasePaymentTransaction::BasePaymentTransaction(
 
             // Amount
             TrustLineAmount stepAmount;
-            vector<byte> amountBytes(
-                buffer.get() + bytesBufferOffset,
-                buffer.get() + bytesBufferOffset + kTrustLineAmountBytesCount);
-            stepAmount = bytesToTrustLineAmount(amountBytes);
+            stepAmount = bytesToTrustLineAmount(
+                buffer.get() + bytesBufferOffset);
             bytesBufferOffset += kTrustLineAmountBytesCount;
 
             // Direction
@@ -1178,11 +1176,9 @@ pair<BytesShared, size_t> BasePaymentTransaction::getSerializedReceipt(
         TransactionUUID::kBytesSize);
     bytesBufferOffset += TransactionUUID::kBytesSize;
 
-    auto serializedAmount = trustLineAmountToBytes(amount);
-    memcpy(
-        serializedData.get() + bytesBufferOffset,
-        serializedAmount.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        amount,
+        serializedData.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
     AuditNumber currentAuditNumber;
@@ -1398,13 +1394,10 @@ pair<BytesShared, size_t> BasePaymentTransaction::serializeToBytes() const
             dataBytesOffset += sizeof(PathID);
 
             // AmountReservation - TrustLineAmount
-            vector<byte> buffer = trustLineAmountToBytes(
-                kReservationValues.second->amount());
-            memcpy(
-                dataBytesShared.get() + dataBytesOffset,
-                buffer.data(),
-                buffer.size());
-            dataBytesOffset += buffer.size();
+            trustLineAmountToBytes(
+                kReservationValues.second->amount(),
+                dataBytesShared.get() + dataBytesOffset);
+            dataBytesOffset += kTrustLineAmountBytesCount;
 
             // Direction
             const auto kDirection = kReservationValues.second->direction();
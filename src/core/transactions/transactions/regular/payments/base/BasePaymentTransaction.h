@@ -155,7 +155,10 @@ public:
         Common_ObservingReject,
 
         Common_RollbackByOtherTransaction,
-        Common_Uncertain
+        Common_Uncertain,
+
+        // added to the end for keeping values of serialized stages
+        Coordinator_PipelinedAmountReservation
     };
 
     enum VotesRecoveryStages {
@@ -21,18 +21,16 @@ TransactionResult::SharedConst TotalBalancesTransaction::run()
     TrustLineAmount totalTrustUsedBySelf = 0;
 
     // if contractor is gateway, than outgoing trust amount is equal balance on this TL
-    for (auto &nodeIDAndTrustLine : mTrustLinesManager->trustLines()) {
+    for (const auto &nodeIDAndTrustLine : mTrustLinesManager->trustLines()) {
+        const auto kTrustUsedByContractor = nodeIDAndTrustLine.second->usedAmountByContractor();
         if (!nodeIDAndTrustLine.second->isContractorGateway()) {
             totalOutgoingTrust += nodeIDAndTrustLine.second->outgoingTrustAmount();
         } else {
-            auto totalOutgoingTrustUsedShared = nodeIDAndTrustLine.second->usedAmountByContractor();
-            totalOutgoingTrust += *totalOutgoingTrustUsedShared.get();
+            totalOutgoingTrust += kTrustUsedByContractor;
         }
         totalIncomingTrust += nodeIDAndTrustLine.second->incomingTrustAmount();
-        auto totalOutgoingTrustUsedShared = nodeIDAndTrustLine.second->usedAmountByContractor();
-        totalTrustUsedByContractor += *totalOutgoingTrustUsedShared.get();
-        auto totalIncomingTrustUsedShared = nodeIDAndTrustLine.second->usedAmountBySelf();
-        totalTrustUsedBySelf += *totalIncomingTrustUsedShared.get();
+        totalTrustUsedByContractor += kTrustUsedByContractor;
+        totalTrustUsedBySelf += nodeIDAndTrustLine.second->usedAmountBySelf();
     }
 
     return resultOk(
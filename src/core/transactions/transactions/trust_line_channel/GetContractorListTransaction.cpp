@@ -14,18 +14,22 @@ GetContractorListTransaction::GetContractorListTransaction(
 
 TransactionResult::SharedConst GetContractorListTransaction::run()
 {
-    const auto &contractors = mContractorsManager->allContractors();
-    stringstream ss;
-    ss << to_string(contractors.size());
-    for (const auto &contractor: contractors) {
-        ss << kTokensSeparator << contractor.get()->getID()
-           << kTokensSeparator << contractor.get()->outputString();
+    // Contractors ids and addresses are copied here, so result doesn't depend on later contractors changes.
+    // Records are serialized lazily by chunks, while result is written into the results FIFO.
+    vector<pair<ContractorID, string>> contractors;
+    for (const auto &contractor : mContractorsManager->allContractors()) {
+        contractors.emplace_back(
+            contractor->getID(),
+            contractor->outputString());
     }
-    ss << kCommandsSeparator;
-    string kResultInfo = ss.str();
     return transactionResultFromCommand(
         mCommand->resultOk(
-            kResultInfo));
+            CommandResult::recordsChunks<pair<ContractorID, string>>(
+                move(contractors),
+                [] (stringstream &stream, const pair<ContractorID, string> &kContractor) {
+                    stream << kContractor.first
+                           << kTokensSeparator << kContractor.second;
+                })));
 }
 
 const string GetContractorListTransaction::logHeader() const
@@ -417,11 +417,9 @@ pair<BytesShared, size_t> ConflictResolverContractorTransaction::getSerializedRe
         TransactionUUID::kBytesSize);
     bytesBufferOffset += TransactionUUID::kBytesSize;
 
-    auto serializedAmount = trustLineAmountToBytes(receiptRecord->amount());
-    memcpy(
-        serializedData.get() + bytesBufferOffset,
-        serializedAmount.data(),
-        kTrustLineAmountBytesCount);
+    trustLineAmountToBytes(
+        receiptRecord->amount(),
+        serializedData.get() + bytesBufferOffset);
     bytesBufferOffset += kTrustLineAmountBytesCount;
 
     auto auditNumber = receiptRecord->auditNumber();
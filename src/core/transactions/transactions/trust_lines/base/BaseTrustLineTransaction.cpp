@@ -86,32 +86,23 @@ pair<BytesShared, size_t> BaseTrustLineTransaction::getOwnSerializedAuditData(
     dataBytesOffset += sizeof(AuditNumber);
     info() << "own audit " << mAuditNumber;
 
-    vector<byte> incomingAmountBufferBytes = trustLineAmountToBytes(
+    trustLineAmountToBytes(
         mTrustLines->incomingTrustAmount(
-            mContractorID));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        incomingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+        mContractorID),
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
     info() << "own incoming amount " << mTrustLines->incomingTrustAmount(mContractorID);
 
-    vector<byte> outgoingAmountBufferBytes = trustLineAmountToBytes(
+    trustLineAmountToBytes(
         mTrustLines->outgoingTrustAmount(
-            mContractorID));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        outgoingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+        mContractorID),
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
     info() << "own outgoing amount " << mTrustLines->outgoingTrustAmount(mContractorID);
 
-    vector<byte> balanceBufferBytes = trustLineBalanceToBytes(
-        const_cast<TrustLineBalance&>(mTrustLines->balance(mContractorID)));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        balanceBufferBytes.data(),
-        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToBytes(
+        const_cast<TrustLineBalance&>(mTrustLines->balance(mContractorID)),
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineBalanceSerializeBytesCount;
     info() << "own balance " << mTrustLines->balance(mContractorID);
 
@@ -169,33 +160,24 @@ pair<BytesShared, size_t> BaseTrustLineTransaction::getContractorSerializedAudit
     dataBytesOffset += sizeof(AuditNumber);
     info() << "contractor audit " << mAuditNumber;
 
-    vector<byte> outgoingAmountBufferBytes = trustLineAmountToBytes(
+    trustLineAmountToBytes(
         mTrustLines->outgoingTrustAmount(
-            mContractorID));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        outgoingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+        mContractorID),
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
     info() << "contractor outgoing amount " << mTrustLines->outgoingTrustAmount(mContractorID);
 
-    vector<byte> incomingAmountBufferBytes = trustLineAmountToBytes(
+    trustLineAmountToBytes(
         mTrustLines->incomingTrustAmount(
-            mContractorID));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        incomingAmountBufferBytes.data(),
-        kTrustLineAmountBytesCount);
+        mContractorID),
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineAmountBytesCount;
     info() << "contractor incoming amount " << mTrustLines->incomingTrustAmount(mContractorID);
 
     auto contractorBalance = -1 * mTrustLines->balance(mContractorID);
-    vector<byte> balanceBufferBytes = trustLineBalanceToBytes(
-        const_cast<TrustLineBalance&>(contractorBalance));
-    memcpy(
-        dataBytesShared.get() + dataBytesOffset,
-        balanceBufferBytes.data(),
-        kTrustLineBalanceSerializeBytesCount);
+    trustLineBalanceToBytes(
+        const_cast<TrustLineBalance&>(contractorBalance),
+        dataBytesShared.get() + dataBytesOffset);
     dataBytesOffset += kTrustLineBalanceSerializeBytesCount;
     info() << "contractor balance " << contractorBalance;
 
@@ -18,40 +18,50 @@ GetTrustLinesListTransaction::GetTrustLinesListTransaction(
 TransactionResult::SharedConst GetTrustLinesListTransaction::run()
 {
     const auto kNeighborsCount = mTrustLinesManager->trustLines().size();
-    stringstream ss;
-    if (mCommand->from() > kNeighborsCount - 1) {
-        ss << "0";
-    } else {
+    // Requested trust lines are copied here, so result doesn't depend on later trust lines changes.
+    // Records are serialized lazily by chunks, while result is written into the results FIFO.
+    vector<TrustLineSnapshot> trustLines;
+    if (mCommand->from() <= kNeighborsCount - 1) {
         // todo discuss if exclude non active TLs
-        auto resultRecordsCount = min(mCommand->count(), kNeighborsCount - mCommand->from());
-        ss << to_string(resultRecordsCount);
+        trustLines.reserve(
+            min(mCommand->count(), kNeighborsCount - mCommand->from()));
         size_t recordIdx = 0;
-        size_t currentRecordsCount = 0;
         for (const auto &kNodeIDAndTrustLine: mTrustLinesManager->trustLines()) {
             if (recordIdx < mCommand->from()) {
                 recordIdx++;
                 continue;
             }
             recordIdx++;
-            ss << kTokensSeparator << kNodeIDAndTrustLine.first
-               << kTokensSeparator << mContractorsManager->contractor(kNodeIDAndTrustLine.first)->outputString()
-               << kTokensSeparator << kNodeIDAndTrustLine.second->state()
-               << kTokensSeparator << kNodeIDAndTrustLine.second->isOwnKeysPresent()
-               << kTokensSeparator << kNodeIDAndTrustLine.second->isContractorKeysPresent()
-               << kTokensSeparator << kNodeIDAndTrustLine.second->incomingTrustAmount()
-               << kTokensSeparator << kNodeIDAndTrustLine.second->outgoingTrustAmount()
-               << kTokensSeparator << kNodeIDAndTrustLine.second->balance();
-            currentRecordsCount++;
-            if (currentRecordsCount == mCommand->count()) {
+            const auto &trustLine = kNodeIDAndTrustLine.second;
+            trustLines.push_back({
+                trustLine->contractorID(),
+                mContractorsManager->contractor(kNodeIDAndTrustLine.first)->outputString(),
+                trustLine->state(),
+                trustLine->isOwnKeysPresent(),
+                trustLine->isContractorKeysPresent(),
+                trustLine->incomingTrustAmount(),
+                trustLine->outgoingTrustAmount(),
+                trustLine->balance()});
+            if (trustLines.size() == mCommand->count()) {
                 break;
             }
         }
     }
-    ss << kCommandsSeparator;
-    string kResultInfo = ss.str();
+
     return transactionResultFromCommand(
         mCommand->resultOk(
-            kResultInfo));
+            CommandResult::recordsChunks<TrustLineSnapshot>(
+                move(trustLines),
+                [] (stringstream &stream, const TrustLineSnapshot &kTrustLine) {
+                    stream << kTrustLine.contractorID
+                           << kTokensSeparator << kTrustLine.contractorAddresses
+                           << kTokensSeparator << kTrustLine.state
+                           << kTokensSeparator << kTrustLine.isOwnKeysPresent
+                           << kTokensSeparator << kTrustLine.isContractorKeysPresent
+                           << kTokensSeparator << kTrustLine.incomingTrustAmount
+                           << kTokensSeparator << kTrustLine.outgoingTrustAmount
+                           << kTokensSeparator << kTrustLine.balance;
+                })));
 }
 
 const string GetTrustLinesListTransaction::logHeader() const
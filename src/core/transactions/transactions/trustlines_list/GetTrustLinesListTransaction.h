@@ -25,6 +25,20 @@ public:
 protected:
     const string logHeader() const override;
 
+private:
+    // Copy of the trust line state at the moment of the request,
+    // trust line itself could be changed while the result is written to the client.
+    struct TrustLineSnapshot {
+        ContractorID contractorID;
+        string contractorAddresses;
+        TrustLine::TrustLineState state;
+        bool isOwnKeysPresent;
+        bool isContractorKeysPresent;
+        TrustLineAmount incomingTrustAmount;
+        TrustLineAmount outgoingTrustAmount;
+        TrustLineBalance balance;
+    };
+
 private:
     GetTrustLinesCommand::Shared mCommand;
     TrustLinesManager *mTrustLinesManager;
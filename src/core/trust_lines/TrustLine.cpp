@@ -137,43 +137,45 @@ void TrustLine::setAuditNumber(
 
 /*!
  * Returns amount that is available to use on the trust line.
+ * Amounts are computed on each call, so they are returned by value
+ * (without separate heap allocation for each returned amount).
  */
-ConstSharedTrustLineAmount TrustLine::availableOutgoingAmount() const
+TrustLineAmount TrustLine::availableOutgoingAmount() const
 {
     if (mBalance < kZeroBalance() && absoluteBalanceAmount(mBalance) > mIncomingTrustAmount) {
-        return make_shared<const TrustLineAmount>(0);
+        return kZeroAmount();
     }
-    return make_shared<const TrustLineAmount>(
+    return TrustLineAmount(
         mIncomingTrustAmount + mBalance);
 }
 
 /*!
  * Returns amount that is available to use on the trust line from contractor node.
  */
-ConstSharedTrustLineAmount TrustLine::availableIncomingAmount() const
+TrustLineAmount TrustLine::availableIncomingAmount() const
 {
     if (mBalance > kZeroBalance() && absoluteBalanceAmount(mBalance) > mOutgoingTrustAmount) {
-        return make_shared<const TrustLineAmount>(0);
+        return kZeroAmount();
     }
-    return make_shared<const TrustLineAmount>(
+    return TrustLineAmount(
         mOutgoingTrustAmount - mBalance);
 }
 
-ConstSharedTrustLineAmount TrustLine::usedAmountByContractor() const
+TrustLineAmount TrustLine::usedAmountByContractor() const
 {
     if (mBalance >= kZeroBalance()) {
-        return make_shared<const TrustLineAmount>(mBalance);
+        return TrustLineAmount(mBalance);
     } else {
-        return make_shared<const TrustLineAmount>(0);
+        return kZeroAmount();
     }
 }
 
-ConstSharedTrustLineAmount TrustLine::usedAmountBySelf() const
+TrustLineAmount TrustLine::usedAmountBySelf() const
 {
     if (mBalance <= kZeroBalance()) {
-        return make_shared<const TrustLineAmount>(-mBalance);
+        return TrustLineAmount(-mBalance);
     } else {
-        return make_shared<const TrustLineAmount>(0);
+        return kZeroAmount();
     }
 }
 
@@ -265,6 +267,12 @@ const TrustLineAmount &TrustLine::kZeroAmount()
     return zero;
 }
 
+const ConstSharedTrustLineAmount &TrustLine::kZeroAmountShared()
+{
+    static const ConstSharedTrustLineAmount zero = make_shared<const TrustLineAmount>(0);
+    return zero;
+}
+
 bool operator==(
     const TrustLine::Shared contractor1,
     const TrustLine::Shared contractor2)
@@ -79,13 +79,13 @@ public:
     void setAuditNumber(
         AuditNumber newAuditNumber);
 
-    ConstSharedTrustLineAmount availableOutgoingAmount() const;
+    TrustLineAmount availableOutgoingAmount() const;
 
-    ConstSharedTrustLineAmount availableIncomingAmount() const;
+    TrustLineAmount availableIncomingAmount() const;
 
-    ConstSharedTrustLineAmount usedAmountByContractor() const;
+    TrustLineAmount usedAmountByContractor() const;
 
-    ConstSharedTrustLineAmount usedAmountBySelf() const;
+    TrustLineAmount usedAmountBySelf() const;
 
     void setTotalOutgoingReceiptsAmount(
         const TrustLineAmount &amount);
@@ -116,6 +116,9 @@ public:
 
     static const TrustLineAmount& kZeroAmount();
 
+    // immutable zero amount, shared by all results, which are passed as ConstSharedTrustLineAmount
+    static const ConstSharedTrustLineAmount& kZeroAmountShared();
+
     friend bool operator== (
         const TrustLine::Shared contractor1,
         const TrustLine::Shared contractor2);
@@ -27,7 +27,14 @@ void TrustLinesManager::loadTrustLinesFromStorage()
     auto ioTransaction = mStorageHandler->beginTransaction();
     const auto kTrustLines = ioTransaction->trustLinesHandler()->allTrustLinesByEquivalent(mEquivalent);
 
-    mTrustLines.reserve(kTrustLines.size());
+    ContractorID maxContractorID = 0;
+    for (auto const &kTrustLine : kTrustLines) {
+        maxContractorID = max(
+            maxContractorID,
+            kTrustLine->contractorID());
+    }
+    mTrustLines.reserve(maxContractorID);
+    mAuditRules.reserve(maxContractorID);
 
     for (auto const &kTrustLine : kTrustLines) {
         auto keyChain = mKeysStore->keychain(kTrustLine->trustLineID());
@@ -95,16 +102,14 @@ void TrustLinesManager::loadTrustLinesFromStorage()
                 kTrustLine->contractorID());
         }
 
-        mTrustLines.insert(
-            make_pair(
-                kTrustLine->contractorID(),
-                kTrustLine));
+        mTrustLines.set(
+            kTrustLine->contractorID(),
+            kTrustLine);
         // todo : choose audit rule from settings
-        mAuditRules.insert(
-            make_pair(
-                kTrustLine->contractorID(),
-                make_shared<AuditRuleCountPayments>(
-                    kCountPaymentsForAudit)));
+        mAuditRules.set(
+            kTrustLine->contractorID(),
+            make_shared<AuditRuleCountPayments>(
+                kCountPaymentsForAudit));
     }
 }
 
@@ -123,13 +128,14 @@ void TrustLinesManager::open(
     auto trustLine = make_shared<TrustLine>(
         contractorID,
         trustLineID);
-    mTrustLines[contractorID] = trustLine;
+    mTrustLines.set(
+        contractorID,
+        trustLine);
     // todo : choose audit rule from settings
-    mAuditRules.insert(
-        make_pair(
-            contractorID,
-            make_shared<AuditRuleCountPayments>(
-                kCountPaymentsForAudit)));
+    mAuditRules.set(
+        contractorID,
+        make_shared<AuditRuleCountPayments>(
+            kCountPaymentsForAudit));
 
     if (ioTransaction != nullptr) {
         ioTransaction->trustLinesHandler()->saveTrustLine(
@@ -154,13 +160,14 @@ void TrustLinesManager::accept(
     auto trustLine = make_shared<TrustLine>(
         contractorID,
         trustLineID);
-    mTrustLines[contractorID] = trustLine;
+    mTrustLines.set(
+        contractorID,
+        trustLine);
     // todo : choose audit rule from settings
-    mAuditRules.insert(
-        make_pair(
-            contractorID,
-            make_shared<AuditRuleCountPayments>(
-                kCountPaymentsForAudit)));
+    mAuditRules.set(
+        contractorID,
+        make_shared<AuditRuleCountPayments>(
+            kCountPaymentsForAudit));
 
     if (ioTransaction != nullptr) {
         ioTransaction->trustLinesHandler()->saveTrustLine(
@@ -183,8 +190,9 @@ TrustLinesManager::TrustLineOperationResult TrustLinesManager::setOutgoing(
 
         } else {
             // In case if "amount" is greater than 0 - outgoing trust line should be created.
-            auto trustLine = mTrustLines[contractorID];
+            auto trustLine = mTrustLines.at(contractorID);
             trustLine->setOutgoingTrustAmount(amount);
+            notifyTrustLineChanged(contractorID);
             return TrustLineOperationResult::Updated;
         }
     }
@@ -198,13 +206,14 @@ TrustLinesManager::TrustLineOperationResult TrustLinesManager::setOutgoing(
         return TrustLineOperationResult::Closed;
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     if (trustLine->outgoingTrustAmount() == amount) {
         // There is no reason to write the same data to the disk.
         return TrustLineOperationResult::NoChanges;
     }
 
     trustLine->setOutgoingTrustAmount(amount);
+    notifyTrustLineChanged(contractorID);
     return TrustLineOperationResult::Updated;
 }
 
@@ -222,7 +231,7 @@ TrustLinesManager::TrustLineOperationResult TrustLinesManager::setIncoming(
 
         } else {
             // In case if "amount" is greater than 0 - incoming trust line should be created.
-            auto trustLine = mTrustLines[contractorID];
+            auto trustLine = mTrustLines.at(contractorID);
             trustLine->setIncomingTrustAmount(amount);
             return TrustLineOperationResult::Updated;
         }
@@ -237,7 +246,7 @@ TrustLinesManager::TrustLineOperationResult TrustLinesManager::setIncoming(
         return TrustLineOperationResult::Closed;
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     if (trustLine->incomingTrustAmount() == amount) {
         // There is no reason to write the same data to the disk.
         return TrustLineOperationResult::NoChanges;
@@ -255,8 +264,9 @@ void TrustLinesManager::closeOutgoing(
             "can't close outgoing trust line with zero amount.");
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setOutgoingTrustAmount(0);
+    notifyTrustLineChanged(contractorID);
 }
 
 void TrustLinesManager::closeIncoming(
@@ -267,7 +277,7 @@ void TrustLinesManager::closeIncoming(
             "can't close incoming trust line with zero amount.");
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setIncomingTrustAmount(0);
 }
 
@@ -282,7 +292,7 @@ void TrustLinesManager::setContractorAsGateway(
                 "There is no trust line to contractor " + to_string(contractorID));
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setContractorAsGateway(contractorIsGateway);
     ioTransaction->trustLinesHandler()->updateTrustLineIsContractorGateway(
         trustLine,
@@ -299,7 +309,7 @@ void TrustLinesManager::setIsOwnKeysPresent(
                 "There is no trust line to contractor " + to_string(contractorID));
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setIsOwnKeysPresent(isOwnKeysPresent);
 }
 
@@ -313,7 +323,7 @@ void TrustLinesManager::setIsContractorKeysPresent(
                 "There is no trust line to contractor " + to_string(contractorID));
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setIsContractorKeysPresent(isContractorKeysPresent);
 }
 
@@ -328,8 +338,9 @@ void TrustLinesManager::setTrustLineState(
                 "There is no trust line to contractor " + to_string(contractorID));
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setState(state);
+    notifyTrustLineChanged(contractorID);
 
     if (ioTransaction != nullptr) {
         ioTransaction->trustLinesHandler()->updateTrustLineState(
@@ -348,7 +359,7 @@ void TrustLinesManager::setTrustLineAuditNumber(
                 "There is no trust line to contractor " + to_string(contractorID));
     }
 
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setAuditNumber(newAuditNumber);
 }
 
@@ -363,11 +374,12 @@ void TrustLinesManager::resetTrustLine(
                 logHeader() + "::isContractorGateway: "
                               "There is no trust line to this contractor.");
     }
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->setIncomingTrustAmount(incomingTrustAmount);
     trustLine->setOutgoingTrustAmount(outgoingTrustAmount);
     trustLine->setBalance(balance);
     trustLine->setState(TrustLine::ResetPending);
+    notifyTrustLineChanged(contractorID);
 }
 
 const bool TrustLinesManager::isContractorGateway(
@@ -566,17 +578,17 @@ ConstSharedTrustLineAmount TrustLinesManager::outgoingTrustAmountConsideringRese
 {
     const auto kTL = trustLineReadOnly(contractorID);
     if (kTL->state() != TrustLine::Active) {
-        return make_shared<const TrustLineAmount>(0);
+        return TrustLine::kZeroAmountShared();
     }
     const auto kAvailableAmount = kTL->availableOutgoingAmount();
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractorID, AmountReservation::Outgoing);
 
-    if (*kAlreadyReservedAmount >= *kAvailableAmount) {
-        return make_shared<const TrustLineAmount>(0);
+    if (kAlreadyReservedAmount >= kAvailableAmount) {
+        return TrustLine::kZeroAmountShared();
     }
     return make_shared<const TrustLineAmount>(
-        *kAvailableAmount - *kAlreadyReservedAmount);
+        kAvailableAmount - kAlreadyReservedAmount);
 }
 
 ConstSharedTrustLineAmount TrustLinesManager::incomingTrustAmountConsideringReservations(
@@ -584,17 +596,17 @@ ConstSharedTrustLineAmount TrustLinesManager::incomingTrustAmountConsideringRese
 {
     const auto kTL = trustLineReadOnly(contractorID);
     if (kTL->state() != TrustLine::Active) {
-        return make_shared<const TrustLineAmount>(0);
+        return TrustLine::kZeroAmountShared();
     }
     const auto kAvailableAmount = kTL->availableIncomingAmount();
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractorID, AmountReservation::Incoming);
 
-    if (*kAlreadyReservedAmount >= *kAvailableAmount) {
-        return make_shared<const TrustLineAmount>(0);
+    if (kAlreadyReservedAmount >= kAvailableAmount) {
+        return TrustLine::kZeroAmountShared();
     }
     return make_shared<const TrustLineAmount>(
-        *kAvailableAmount - *kAlreadyReservedAmount);
+        kAvailableAmount - kAlreadyReservedAmount);
 }
 
 pair<ConstSharedTrustLineAmount, ConstSharedTrustLineAmount> TrustLinesManager::availableOutgoingCycleAmounts(
@@ -603,34 +615,34 @@ pair<ConstSharedTrustLineAmount, ConstSharedTrustLineAmount> TrustLinesManager::
     const auto kTL = trustLineReadOnly(contractorID);
     if (kTL->state() != TrustLine::Active) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(0));
+            TrustLine::kZeroAmountShared(),
+            TrustLine::kZeroAmountShared());
     }
     const auto kBalance = kTL->balance();
     if (kBalance <= TrustLine::kZeroBalance()) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(0));
+            TrustLine::kZeroAmountShared(),
+            TrustLine::kZeroAmountShared());
     }
 
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractorID, AmountReservation::Outgoing);
 
-    if (*kAlreadyReservedAmount.get() == TrustLine::kZeroAmount()) {
+    if (kAlreadyReservedAmount == TrustLine::kZeroAmount()) {
         return make_pair(
             make_shared<const TrustLineAmount>(kBalance),
             make_shared<const TrustLineAmount>(kBalance));
     }
 
     auto kAbsoluteBalance = absoluteBalanceAmount(kBalance);
-    if (*kAlreadyReservedAmount.get() > kAbsoluteBalance) {
+    if (kAlreadyReservedAmount > kAbsoluteBalance) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
+            TrustLine::kZeroAmountShared(),
             make_shared<const TrustLineAmount>(kBalance));
     } else {
         return make_pair(
             make_shared<const TrustLineAmount>(
-                kAbsoluteBalance - *kAlreadyReservedAmount.get()),
+                kAbsoluteBalance - kAlreadyReservedAmount),
             make_shared<const TrustLineAmount>(kBalance));
     }
 }
@@ -641,34 +653,34 @@ pair<ConstSharedTrustLineAmount, ConstSharedTrustLineAmount> TrustLinesManager::
     const auto kTL = trustLineReadOnly(contractorID);
     if (kTL->state() != TrustLine::Active) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(0));
+            TrustLine::kZeroAmountShared(),
+            TrustLine::kZeroAmountShared());
     }
     const auto kBalance = kTL->balance();
     if (kBalance >= TrustLine::kZeroBalance()) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
-            make_shared<const TrustLineAmount>(0));
+            TrustLine::kZeroAmountShared(),
+            TrustLine::kZeroAmountShared());
     }
 
     const auto kAlreadyReservedAmount = mAmountReservationsHandler->totalReserved(
         contractorID, AmountReservation::Incoming);
 
     auto kAbsoluteBalance = absoluteBalanceAmount(kBalance);
-    if (*kAlreadyReservedAmount.get() == TrustLine::kZeroAmount()) {
+    if (kAlreadyReservedAmount == TrustLine::kZeroAmount()) {
         return make_pair(
             make_shared<const TrustLineAmount>(kAbsoluteBalance),
             make_shared<const TrustLineAmount>(kAbsoluteBalance));
     }
 
-    if (*kAlreadyReservedAmount.get() >= kAbsoluteBalance) {
+    if (kAlreadyReservedAmount >= kAbsoluteBalance) {
         return make_pair(
-            make_shared<const TrustLineAmount>(0),
+            TrustLine::kZeroAmountShared(),
             make_shared<const TrustLineAmount>(kAbsoluteBalance));
     }
     return make_pair(
         make_shared<const TrustLineAmount>(
-            kAbsoluteBalance - *kAlreadyReservedAmount.get()),
+            kAbsoluteBalance - kAlreadyReservedAmount),
         make_shared<const TrustLineAmount>(kAbsoluteBalance));
 }
 
@@ -716,6 +728,8 @@ void TrustLinesManager::removeTrustLine(
     }
 
     mTrustLines.erase(contractorID);
+    mAuditRules.erase(contractorID);
+    notifyTrustLineChanged(contractorID);
 
     if (ioTransaction != nullptr) {
         ioTransaction->trustLinesHandler()->deleteTrustLine(
@@ -736,7 +750,7 @@ void TrustLinesManager::updateTrustLineFromStorage(
                 "There is no trust line to the contractor.");
     }
 
-    auto kTrustLine = mTrustLines[contractorID];
+    auto kTrustLine = mTrustLines.at(contractorID);
     try {
         auto auditRecord = ioTransaction->auditHandler()->getActualAudit(
             kTrustLine->trustLineID());
@@ -780,7 +794,7 @@ void TrustLinesManager::updateTrustLineFromStorage(
         kTrustLine->setAuditNumber(TrustLine::kInitialAuditNumber);
     }
 
-    mTrustLines[kTrustLine->contractorID()] = kTrustLine;
+    notifyTrustLineChanged(contractorID);
 }
 
 /**
@@ -808,7 +822,7 @@ void TrustLinesManager::resetTrustLineTotalReceiptsAmounts(
             logHeader() + "::resetTrustLineTotalReceiptsAmounts: "
                 "There is no trust line to the contractor " + to_string(contractorID));
     }
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     trustLine->resetTotalReceiptsAmounts();
 }
 
@@ -1108,11 +1122,19 @@ const TrustLine::ConstShared TrustLinesManager::trustLineReadOnly(
     }
 }
 
-unordered_map<ContractorID, TrustLine::Shared> &TrustLinesManager::trustLines()
+ContractorIDMap<TrustLine::Shared> &TrustLinesManager::trustLines()
 {
     return mTrustLines;
 }
 
+size_t TrustLinesManager::allocatedBytesCount() const
+{
+    return mTrustLines.allocatedBytesCount()
+           + mTrustLines.size() * sizeof(TrustLine)
+           + mAuditRules.allocatedBytesCount()
+           + mAuditRules.size() * sizeof(AuditRuleCountPayments);
+}
+
 vector<ContractorID> TrustLinesManager::getFirstLevelNodesForCycles(
     bool isCreditorBranch)
 {
@@ -1190,12 +1212,14 @@ void TrustLinesManager::useReservation(
 
     switch (reservation->direction()) {
         case AmountReservation::Outgoing: {
-            mTrustLines[contractorID]->pay(reservation->amount());
+            mTrustLines.at(contractorID)->pay(reservation->amount());
+            notifyTrustLineChanged(contractorID);
             return;
         }
 
         case AmountReservation::Incoming: {
-            mTrustLines[contractorID]->acceptPayment(reservation->amount());
+            mTrustLines.at(contractorID)->acceptPayment(reservation->amount());
+            notifyTrustLineChanged(contractorID);
             return;
         }
 
@@ -1272,6 +1296,20 @@ const TrustLineID TrustLinesManager::nextFreeID(
     return prevElement + 1;
 }
 
+void TrustLinesManager::notifyTrustLineChanged(
+    ContractorID contractorID) const
+{
+    if (trustLineChangedSignal.empty()) {
+        return;
+    }
+    try {
+        trustLineChangedSignal(
+            mContractorsManager->contractorMainAddress(contractorID));
+    } catch (NotFoundError &e) {
+        warning() << "Can't notify about trust line changes. Details: " << e.what();
+    }
+}
+
 TrustLinesManager::TrustLineActionType TrustLinesManager::checkTrustLineAfterTransaction(
     ContractorID contractorID,
     bool isActionInitiator)
@@ -1282,7 +1320,7 @@ TrustLinesManager::TrustLineActionType TrustLinesManager::checkTrustLineAfterTra
             logHeader() + "::checkTrustLineAfterTransaction: "
                 "No trust line with the contractor is present " + to_string(contractorID));
     }
-    auto trustLine = mTrustLines[contractorID];
+    auto trustLine = mTrustLines.at(contractorID);
     auto ioTransaction = mStorageHandler->beginTransaction();
     if (isTrustLineEmpty(contractorID)) {
         info() << "TL become empty";
@@ -1294,8 +1332,8 @@ TrustLinesManager::TrustLineActionType TrustLinesManager::checkTrustLineAfterTra
         } else {
             return TrustLineActionType::NoActions;
         }
-    } else if (mAuditRules[contractorID]->check(trustLine, ioTransaction)) {
-        info() << "Audit rule " << mAuditRules[contractorID]->auditRuleType() << " triggered";
+    } else if (mAuditRules.at(contractorID)->check(trustLine, ioTransaction)) {
+        info() << "Audit rule " << mAuditRules.at(contractorID)->auditRuleType() << " triggered";
         // if TL become overflowed, it is necessary to run Audit TA.
         // AuditSource TA run on node which pay
         if (isActionInitiator) {
@@ -1354,7 +1392,7 @@ void TrustLinesManager::resetAuditRule(
         throw NotFoundError(
             logHeader() + "::resetAuditRule: No audit rule for contractorID " + to_string(contractorID));
     }
-    mAuditRules[contractorID]->reset();
+    mAuditRules.at(contractorID)->reset();
 }
 
 const string TrustLinesManager::logHeader() const
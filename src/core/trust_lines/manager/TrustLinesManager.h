@@ -6,6 +6,7 @@
 #include "../../common/exceptions/IOError.h"
 #include "../../common/exceptions/ConflictError.h"
 #include "../../common/exceptions/NotFoundError.h"
+#include "../../common/containers/ContractorIDMap.h"
 #include "../../logger/Logger.h"
 #include "../../payments/reservations/AmountReservationsHandler.h"
 #include "../audit_rules/AuditRuleCountPayments.h"
@@ -18,6 +19,8 @@
 #include "../audit_rules/AuditRuleBoundaryOverflowed.h"
 #include "../audit_rules/AuditRuleCountPayments.h"
 
+#include <boost/signals2.hpp>
+
 #include <unordered_map>
 #include <vector>
 #include <set>
@@ -32,7 +35,13 @@
 #endif
 
 
+namespace signals = boost::signals2;
+
 class TrustLinesManager {
+public:
+    // Emitted on changes of outgoing amount, balance, or state of the trust line with the contractor
+    typedef signals::signal<void(BaseAddress::Shared)> TrustLineChangedSignal;
+
 public:
     enum TrustLineOperationResult {
         Opened,
@@ -370,7 +379,13 @@ public:
     const TrustLine::ConstShared trustLineReadOnly(
         ContractorID contractorID) const;
 
-    unordered_map<ContractorID, TrustLine::Shared>& trustLines();
+    ContractorIDMap<TrustLine::Shared>& trustLines();
+
+    /**
+     * @returns approximate count of bytes, occupied by trust lines and their audit rules in memory
+     * (amounts reservations and control blocks of shared pointers are not taken into account).
+     */
+    size_t allocatedBytesCount() const;
 
     vector<ContractorID> getFirstLevelNodesForCycles(
         bool isCreditorBranch);
@@ -393,6 +408,9 @@ public:
     void printTLs();
     void printTLFlows();
 
+public:
+    mutable TrustLineChangedSignal trustLineChangedSignal;
+
 protected:
     /**
      * Reads trust lines info from the internal storage and initialises internal trust lines map.
@@ -405,6 +423,9 @@ protected:
     const TrustLineID nextFreeID(
         IOTransaction::Shared ioTransaction) const;
 
+    void notifyTrustLineChanged(
+        ContractorID contractorID) const;
+
 protected: // log shortcuts
     const string logHeader() const
         noexcept;
@@ -419,10 +440,10 @@ private:
     static const uint32_t kCountPaymentsForAudit = 10;
 
 private:
-    unordered_map<ContractorID, TrustLine::Shared> mTrustLines;
+    ContractorIDMap<TrustLine::Shared> mTrustLines;
     SerializedEquivalent mEquivalent;
 
-    unordered_map<ContractorID, BaseAuditRule::Shared> mAuditRules;
+    ContractorIDMap<BaseAuditRule::Shared> mAuditRules;
     vector<ContractorID> mContractorsShouldBePinged;
 
     unique_ptr<AmountReservationsHandler> mAmountReservationsHandler;
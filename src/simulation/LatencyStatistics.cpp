@@ -0,0 +1,89 @@
+#include "LatencyStatistics.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+LatencyStatistics::LatencyStatistics(
+    const string &commandName) :
+    mCommandName(commandName),
+    mDuration(0)
+{}
+
+void LatencyStatistics::addResult(
+    uint16_t code,
+    chrono::microseconds latency)
+{
+    lock_guard<mutex> lock(mMutex);
+    if (code == kResultOK or code == kResultCreated) {
+        mSuccessfulLatencies.push_back(latency);
+    } else {
+        mFailures[code]++;
+    }
+}
+
+void LatencyStatistics::setDuration(
+    chrono::microseconds duration)
+{
+    lock_guard<mutex> lock(mMutex);
+    mDuration = duration;
+}
+
+void LatencyStatistics::reportHeader(
+    ostream &stream)
+{
+    stream << left << setw(16) << "command"
+           << right << setw(8) << "total"
+           << setw(8) << "ok"
+           << setw(10) << "req/s"
+           << setw(10) << "p50 ms"
+           << setw(10) << "p90 ms"
+           << setw(10) << "p99 ms"
+           << setw(10) << "max ms"
+           << "  failures (code:count, 0 is timeout)" << endl;
+}
+
+void LatencyStatistics::report(
+    ostream &stream)
+{
+    lock_guard<mutex> lock(mMutex);
+    sort(
+        mSuccessfulLatencies.begin(),
+        mSuccessfulLatencies.end());
+
+    size_t failuresCount = 0;
+    stringstream failures;
+    for (const auto &failure : mFailures) {
+        failuresCount += failure.second;
+        failures << " " << failure.first << ":" << failure.second;
+    }
+
+    const auto kTotal = mSuccessfulLatencies.size() + failuresCount;
+    const auto kSeconds = (double)mDuration.count() / 1000000;
+    const auto kThroughput = kSeconds > 0 ? (double)kTotal / kSeconds : 0;
+
+    stream << left << setw(16) << mCommandName
+           << right << setw(8) << kTotal
+           << setw(8) << mSuccessfulLatencies.size()
+           << fixed << setprecision(1)
+           << setw(10) << kThroughput
+           << setprecision(2)
+           << setw(10) << percentile(0.5)
+           << setw(10) << percentile(0.9)
+           << setw(10) << percentile(0.99)
+           << setw(10) << percentile(1.0)
+           << " " << failures.str() << endl;
+}
+
+double LatencyStatistics::percentile(
+    double part) const
+{
+    if (mSuccessfulLatencies.empty()) {
+        return 0;
+    }
+    // nearest rank method
+    auto rank = (size_t)(part * mSuccessfulLatencies.size() + 0.999999);
+    rank = max(rank, (size_t)1);
+    rank = min(rank, mSuccessfulLatencies.size());
+    return (double)mSuccessfulLatencies[rank - 1].count() / 1000;
+}
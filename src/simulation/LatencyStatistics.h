@@ -0,0 +1,61 @@
+#ifndef GEO_NETWORK_CLIENT_SIMULATION_LATENCYSTATISTICS_H
+#define GEO_NETWORK_CLIENT_SIMULATION_LATENCYSTATISTICS_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Collects results of the commands of one workload and reports
+ * throughput and latency percentiles of the successful commands,
+ * and count of the failed ones per each result code.
+ * Methods are thread safe: results are reported by all client threads of the workload.
+ */
+class LatencyStatistics {
+
+public:
+    explicit LatencyStatistics(
+        const string &commandName);
+
+    void addResult(
+        uint16_t code,
+        chrono::microseconds latency);
+
+    void setDuration(
+        chrono::microseconds duration);
+
+    /**
+     * Writes one line of the report table.
+     */
+    void report(
+        ostream &stream);
+
+    static void reportHeader(
+        ostream &stream);
+
+protected:
+    // latency (in milliseconds) of the successful commands, which is not exceeded by the part of them
+    double percentile(
+        double part) const;
+
+protected:
+    static const uint16_t kResultOK = 200;
+    // payments are reported as created
+    static const uint16_t kResultCreated = 201;
+
+    mutex mMutex;
+    string mCommandName;
+    vector<chrono::microseconds> mSuccessfulLatencies;
+    // result code -> count of the commands, 0 means timeout
+    map<uint16_t, size_t> mFailures;
+    chrono::microseconds mDuration;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_SIMULATION_LATENCYSTATISTICS_H
@@ -0,0 +1,145 @@
+#include "NodeConnection.h"
+
+#include <boost/uuid/uuid_io.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+NodeConnection::NodeConnection(
+    const string &unixSocketPath,
+    const atomic<bool> &stopRequested) :
+    mStopRequested(stopRequested)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (unixSocketPath.size() >= sizeof(address.sun_path)) {
+        throw IOError(
+            "NodeConnection: socket path is too long: " + unixSocketPath);
+    }
+    strcpy(address.sun_path, unixSocketPath.c_str());
+
+    mSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (mSocket < 0) {
+        throw IOError(
+            string("NodeConnection: can't create socket: ") + strerror(errno));
+    }
+    if (connect(mSocket, (sockaddr*)&address, sizeof(address)) != 0) {
+        const auto kError = errno;
+        close(mSocket);
+        throw IOError(
+            "NodeConnection: can't connect to " + unixSocketPath + ": " + strerror(kError));
+    }
+}
+
+NodeConnection::~NodeConnection()
+{
+    close(mSocket);
+}
+
+NodeConnection::Result NodeConnection::execute(
+    const string &identifier,
+    const string &arguments,
+    chrono::seconds timeout)
+{
+    const auto kUUID = boost::uuids::to_string(mUUIDGenerator());
+    const auto kStarted = chrono::steady_clock::now();
+    const auto kDeadline = kStarted + timeout;
+
+    writeAll(
+        kUUID + "\t" + identifier + "\t" + arguments + "\n");
+
+    Result result{0, "", chrono::microseconds(0)};
+    string line;
+    while (readLine(line, kDeadline)) {
+        // result format: <uuid>\t<code>[\t<information>]
+        if (line.compare(0, kUUID.size(), kUUID) != 0 or line.size() <= kUUID.size() + 1) {
+            continue;
+        }
+        const auto kCodeStart = kUUID.size() + 1;
+        const auto kCodeEnd = line.find('\t', kCodeStart);
+        result.mCode = (uint16_t)atoi(
+            line.substr(kCodeStart, kCodeEnd - kCodeStart).c_str());
+        if (kCodeEnd != string::npos) {
+            result.mInformation = line.substr(kCodeEnd + 1);
+        }
+        break;
+    }
+
+    result.mLatency = chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now() - kStarted);
+    return result;
+}
+
+void NodeConnection::writeAll(
+    const string &data)
+{
+    size_t written = 0;
+    while (written < data.size()) {
+        const auto kCount = send(
+            mSocket,
+            data.data() + written,
+            data.size() - written,
+            MSG_NOSIGNAL);
+        if (kCount < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw IOError(
+                string("NodeConnection::writeAll: ") + strerror(errno));
+        }
+        written += (size_t)kCount;
+    }
+}
+
+bool NodeConnection::readLine(
+    string &line,
+    chrono::steady_clock::time_point deadline)
+{
+    char buffer[4096];
+    while (true) {
+        const auto kLineEnd = mReadBuffer.find('\n');
+        if (kLineEnd != string::npos) {
+            line = mReadBuffer.substr(0, kLineEnd);
+            mReadBuffer.erase(0, kLineEnd + 1);
+            return true;
+        }
+
+        const auto kLeft = chrono::duration_cast<chrono::milliseconds>(
+            deadline - chrono::steady_clock::now()).count();
+        if (kLeft <= 0 or mStopRequested) {
+            return false;
+        }
+        pollfd descriptor{mSocket, POLLIN, 0};
+        const auto kReady = poll(
+            &descriptor,
+            1,
+            (int)min(kLeft, (decltype(kLeft))kPollIntervalMilliseconds));
+        if (kReady < 0 and errno != EINTR) {
+            throw IOError(
+                string("NodeConnection::readLine: ") + strerror(errno));
+        }
+        if (kReady <= 0) {
+            continue;
+        }
+
+        const auto kCount = recv(mSocket, buffer, sizeof(buffer), 0);
+        if (kCount == 0) {
+            throw IOError(
+                "NodeConnection::readLine: connection is closed by the node");
+        }
+        if (kCount < 0) {
+            if (errno == EINTR or errno == EAGAIN) {
+                continue;
+            }
+            throw IOError(
+                string("NodeConnection::readLine: ") + strerror(errno));
+        }
+        mReadBuffer.append(buffer, (size_t)kCount);
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef GEO_NETWORK_CLIENT_SIMULATION_NODECONNECTION_H
+#define GEO_NETWORK_CLIENT_SIMULATION_NODECONNECTION_H
+
+#include "../core/common/exceptions/IOError.h"
+
+#include <boost/uuid/random_generator.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+/**
+ * Client side of the node control socket (see "control_interface" in conf.json).
+ * Sends text commands in the same format as commands FIFO does
+ * and waits for the result with the same command uuid.
+ * Connection is not thread safe: each client thread uses its own one.
+ */
+class NodeConnection {
+
+public:
+    struct Result {
+        // 0 in case if result was not received in time
+        uint16_t mCode;
+        string mInformation;
+        chrono::microseconds mLatency;
+    };
+
+public:
+    /**
+     * Waiting for the results is cancelled as soon as stopRequested is set.
+     *
+     * @throws IOError in case if the socket can't be connected.
+     */
+    NodeConnection(
+        const string &unixSocketPath,
+        const atomic<bool> &stopRequested);
+
+    ~NodeConnection();
+
+    NodeConnection(const NodeConnection&) = delete;
+    NodeConnection& operator=(const NodeConnection&) = delete;
+
+    /**
+     * Sends command "<uuid>\t<identifier>\t<arguments>" and waits for its result.
+     * Results of the commands, which were timed out earlier, are skipped.
+     *
+     * @throws IOError in case if the connection was broken.
+     */
+    Result execute(
+        const string &identifier,
+        const string &arguments,
+        chrono::seconds timeout);
+
+protected:
+    void writeAll(
+        const string &data);
+
+    // returns false in case of timeout or if stop was requested
+    bool readLine(
+        string &line,
+        chrono::steady_clock::time_point deadline);
+
+protected:
+    // waiting is split into short intervals, so stop request is noticed quickly
+    static const int kPollIntervalMilliseconds = 200;
+
+    int mSocket;
+    const atomic<bool> &mStopRequested;
+    string mReadBuffer;
+    boost::uuids::random_generator mUUIDGenerator;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_SIMULATION_NODECONNECTION_H
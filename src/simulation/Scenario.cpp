@@ -0,0 +1,81 @@
+#include "Scenario.h"
+
+#include <fstream>
+
+Scenario Scenario::fromFile(
+    const string &path)
+{
+    json conf;
+    try {
+        ifstream stream(path);
+        if (!stream.is_open()) {
+            throw ValueError("can't open file");
+        }
+        stream >> conf;
+
+    } catch (std::exception &e) {
+        throw ValueError(
+            "Scenario::fromFile: can't read scenario " + path + ": " + e.what());
+    }
+
+    Scenario scenario;
+    try {
+        scenario.mNodeBinary = conf.value("node_binary", string("bin/geo_network_client"));
+        scenario.mWorkDir = conf.value("work_dir", string("/tmp/geo_simulation"));
+        scenario.mNodesCount = conf.at("nodes_count").get<size_t>();
+        scenario.mFirstNodePort = conf.value("first_node_port", (uint16_t)12000);
+        scenario.mObserverPort = conf.value("observer_port", (uint16_t)11999);
+        scenario.mEquivalent = conf.value("equivalent", (uint32_t)1);
+        scenario.mNodeWorkersCount = conf.value("node_workers_count", (uint16_t)0);
+        scenario.mNodePipelinedPathsCount = conf.value("node_pipelined_paths_count", (uint16_t)0);
+        if (conf.count("cycles_clearing") != 0) {
+            scenario.mCyclesClearing = conf.at("cycles_clearing");
+        }
+        scenario.mSeed = conf.value("seed", (uint32_t)1);
+        scenario.mSetupTimeoutSeconds = conf.value("setup_timeout_sec", (uint32_t)120);
+        scenario.mSettleSeconds = conf.value("settle_sec", (uint32_t)10);
+        scenario.mCommandTimeoutSeconds = conf.value("command_timeout_sec", (uint32_t)60);
+
+        auto topology = conf.at("topology");
+        scenario.mTopology.mType = topology.at("type").get<string>();
+        scenario.mTopology.mLinksPerNode = topology.value("links_per_node", (size_t)2);
+        scenario.mTopology.mTrustAmount = topology.value("trust_amount", string("1000000"));
+
+        for (const auto &workload : conf.at("workloads")) {
+            scenario.mWorkloads.push_back({
+                workload.at("command").get<string>(),
+                workload.at("requests_count").get<size_t>(),
+                workload.value("concurrency", (size_t)1),
+                workload.value("amount", string("1"))});
+        }
+
+    } catch (std::exception &e) {
+        throw ValueError(
+            "Scenario::fromFile: invalid scenario " + path + ": " + e.what());
+    }
+
+    if (scenario.mNodesCount < 2) {
+        throw ValueError(
+            "Scenario::fromFile: at least 2 nodes are required");
+    }
+    if ((size_t)scenario.mFirstNodePort + scenario.mNodesCount > UINT16_MAX) {
+        throw ValueError(
+            "Scenario::fromFile: nodes ports are out of range");
+    }
+    for (const auto &workload : scenario.mWorkloads) {
+        if (workload.mCommand != "payment" and workload.mCommand != "max_flow"
+                and workload.mCommand != "total_balances" and workload.mCommand != "cycles") {
+            throw ValueError(
+                "Scenario::fromFile: unknown workload command " + workload.mCommand);
+        }
+        if (workload.mCommand == "cycles" and scenario.mCyclesClearing.is_null()) {
+            throw ValueError(
+                "Scenario::fromFile: cycles workload requires cycles_clearing configuration");
+        }
+        if (workload.mConcurrency == 0) {
+            throw ValueError(
+                "Scenario::fromFile: workload concurrency can't be zero");
+        }
+    }
+    return scenario;
+}
@@ -0,0 +1,81 @@
+#ifndef GEO_NETWORK_CLIENT_SIMULATION_SCENARIO_H
+#define GEO_NETWORK_CLIENT_SIMULATION_SCENARIO_H
+
+#include "../core/common/exceptions/ValueError.h"
+#include "../libs/json/json.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+using json = nlohmann::json;
+
+/**
+ * Description of the synthetic trust lines topology of the simulated network.
+ */
+struct TopologyDescription {
+    // "chain", "ring", "star" or "random"
+    string mType;
+    // average count of trust lines per node (only for "random" topology)
+    size_t mLinksPerNode;
+    // amount of the trust, which is set by each side of each trust line
+    string mTrustAmount;
+};
+
+/**
+ * One step of the load: mRequestsCount commands of one type are sent by mConcurrency clients,
+ * each client sends next command only after result of the previous one (closed loop).
+ * Initiator and contractor of each command are chosen randomly.
+ *
+ * "cycles" workload consists of rounds instead of commands: in each round the random cycle of three nodes
+ * of the topology gets debts by three payments between its neighbor nodes, and then the round waits
+ * until the nodes close this cycle.
+ */
+struct WorkloadDescription {
+    // "payment", "max_flow", "total_balances" or "cycles"
+    string mCommand;
+    size_t mRequestsCount;
+    size_t mConcurrency;
+    // amount of each payment (only for "payment" and "cycles" commands)
+    string mAmount;
+};
+
+/**
+ * Simulation scenario, read from the JSON file (see README.md for the format).
+ */
+class Scenario {
+
+public:
+    /**
+     * @throws ValueError in case if file can't be read or scenario is invalid.
+     */
+    static Scenario fromFile(
+        const string &path);
+
+public:
+    string mNodeBinary;
+    string mWorkDir;
+    size_t mNodesCount;
+    uint16_t mFirstNodePort;
+    uint16_t mObserverPort;
+    uint32_t mEquivalent;
+    uint16_t mNodeWorkersCount;
+    uint16_t mNodePipelinedPathsCount;
+    // is passed into configuration of each node as is (cycles closing is disabled if it is absent)
+    json mCyclesClearing;
+    uint32_t mSeed;
+
+    TopologyDescription mTopology;
+    // time, during which each command of the network building is retried until success
+    uint32_t mSetupTimeoutSeconds;
+    // pause after the network building, during which nodes finish keys sharing and audits
+    uint32_t mSettleSeconds;
+    // time of waiting for the result of each command of the workload
+    uint32_t mCommandTimeoutSeconds;
+
+    vector<WorkloadDescription> mWorkloads;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_SIMULATION_SCENARIO_H
@@ -0,0 +1,207 @@
+#include "SimulatedNode.h"
+
+#include <boost/filesystem.hpp>
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+namespace fs = boost::filesystem;
+
+SimulatedNode::SimulatedNode(
+    size_t index,
+    const Scenario &scenario) :
+    mIndex(index),
+    mScenario(scenario),
+    mPort((uint16_t)(scenario.mFirstNodePort + index)),
+    mPID(0),
+    mPeakMemoryKB(0)
+{
+    mAddress = "127.0.0.1:" + to_string(mPort);
+    mDirectory = fs::absolute(
+        fs::path(scenario.mWorkDir) / ("node_" + to_string(index))).string();
+    mControlSocketPath = mDirectory + "/control.sock";
+}
+
+SimulatedNode::~SimulatedNode()
+{
+    stop();
+}
+
+void SimulatedNode::start()
+{
+    try {
+        fs::remove_all(mDirectory);
+        fs::create_directories(mDirectory);
+        writeConfiguration(
+            mScenario);
+
+    } catch (std::exception &e) {
+        throw RuntimeError(
+            "SimulatedNode::start: can't prepare directory " + mDirectory + ": " + e.what());
+    }
+
+    // relative path to the binary is resolved before changing of the working directory
+    const auto kBinary = fs::absolute(mScenario.mNodeBinary).string();
+    const auto kOutput = mDirectory + "/node.out";
+
+    mPID = fork();
+    if (mPID < 0) {
+        mPID = 0;
+        throw RuntimeError(
+            string("SimulatedNode::start: can't fork: ") + strerror(errno));
+    }
+
+    if (mPID == 0) {
+        // child: only async-signal-safe calls until exec;
+        // node is terminated together with the simulation, even if the last one has crashed
+        prctl(PR_SET_PDEATHSIG, SIGTERM);
+        const auto kOutputFile = open(kOutput.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (kOutputFile >= 0) {
+            dup2(kOutputFile, STDOUT_FILENO);
+            dup2(kOutputFile, STDERR_FILENO);
+            close(kOutputFile);
+        }
+        if (chdir(mDirectory.c_str()) != 0) {
+            _exit(127);
+        }
+        execl(kBinary.c_str(), kBinary.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+}
+
+bool SimulatedNode::waitUntilReady(
+    chrono::seconds timeout)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, mControlSocketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    const auto kDeadline = chrono::steady_clock::now() + timeout;
+    while (chrono::steady_clock::now() < kDeadline) {
+        if (!isRunning()) {
+            return false;
+        }
+        const auto kSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (kSocket >= 0) {
+            const auto kConnected = connect(kSocket, (sockaddr*)&address, sizeof(address)) == 0;
+            close(kSocket);
+            if (kConnected) {
+                return true;
+            }
+        }
+        this_thread::sleep_for(
+            chrono::milliseconds(100));
+    }
+    return false;
+}
+
+void SimulatedNode::stop()
+{
+    if (mPID == 0) {
+        return;
+    }
+    peakMemoryKB();
+    kill(mPID, SIGTERM);
+
+    const auto kDeadline = chrono::steady_clock::now() + chrono::seconds(5);
+    while (chrono::steady_clock::now() < kDeadline) {
+        if (waitpid(mPID, nullptr, WNOHANG) != 0) {
+            mPID = 0;
+            return;
+        }
+        this_thread::sleep_for(
+            chrono::milliseconds(50));
+    }
+    kill(mPID, SIGKILL);
+    waitpid(mPID, nullptr, 0);
+    mPID = 0;
+}
+
+bool SimulatedNode::isRunning()
+{
+    if (mPID == 0) {
+        return false;
+    }
+    if (waitpid(mPID, nullptr, WNOHANG) != 0) {
+        mPID = 0;
+        return false;
+    }
+    return true;
+}
+
+size_t SimulatedNode::index() const
+{
+    return mIndex;
+}
+
+const string& SimulatedNode::address() const
+{
+    return mAddress;
+}
+
+const string& SimulatedNode::controlSocketPath() const
+{
+    return mControlSocketPath;
+}
+
+const string& SimulatedNode::directory() const
+{
+    return mDirectory;
+}
+
+size_t SimulatedNode::peakMemoryKB()
+{
+    if (mPID == 0) {
+        return mPeakMemoryKB;
+    }
+    ifstream status("/proc/" + to_string(mPID) + "/status");
+    string line;
+    while (getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            mPeakMemoryKB = (size_t)strtoull(line.c_str() + 6, nullptr, 10);
+            break;
+        }
+    }
+    return mPeakMemoryKB;
+}
+
+void SimulatedNode::writeConfiguration(
+    const Scenario &scenario) const
+{
+    json conf;
+    conf["interface"] = {
+        {"host", "127.0.0.1"},
+        {"port", mPort}};
+    conf["addresses"] = json::array({{
+        {"type", "ipv4"},
+        {"address", mAddress}}});
+    conf["observers"] = json::array({{
+        {"type", "ipv4"},
+        {"address", "127.0.0.1:" + to_string(scenario.mObserverPort)}}});
+    conf["control_interface"] = {
+        {"unix_socket", "control.sock"}};
+    // nodes check that their contractors use the same registry, registry itself is not requested
+    conf["equivalents_registry_address"] = "simulation";
+    conf["workers_count"] = scenario.mNodeWorkersCount;
+    conf["pipelined_paths_count"] = scenario.mNodePipelinedPathsCount;
+    if (!scenario.mCyclesClearing.is_null()) {
+        conf["cycles_clearing"] = scenario.mCyclesClearing;
+    }
+
+    ofstream file(mDirectory + "/conf.json");
+    file << conf.dump(4) << endl;
+    if (!file.good()) {
+        throw RuntimeError(
+            "SimulatedNode::writeConfiguration: can't write conf.json");
+    }
+}
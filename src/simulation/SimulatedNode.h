@@ -0,0 +1,84 @@
+#ifndef GEO_NETWORK_CLIENT_SIMULATION_SIMULATEDNODE_H
+#define GEO_NETWORK_CLIENT_SIMULATION_SIMULATEDNODE_H
+
+#include "Scenario.h"
+
+#include "../core/common/exceptions/RuntimeError.h"
+
+#include <chrono>
+#include <string>
+#include <sys/types.h>
+
+using namespace std;
+
+/**
+ * One node of the simulated network: separate process of the node binary,
+ * running in its own directory "<work_dir>/node_<index>" on the loopback UDP port.
+ * Node keeps configuration, storage, FIFOs and logs relatively to the working directory,
+ * so each node needs own process and own directory.
+ */
+class SimulatedNode {
+
+public:
+    SimulatedNode(
+        size_t index,
+        const Scenario &scenario);
+
+    ~SimulatedNode();
+
+    SimulatedNode(const SimulatedNode&) = delete;
+    SimulatedNode& operator=(const SimulatedNode&) = delete;
+
+    /**
+     * Recreates directory of the node (previous storage is removed), writes conf.json and starts the process.
+     *
+     * @throws RuntimeError in case if directory can't be prepared or process can't be started.
+     */
+    void start();
+
+    /**
+     * Waits until node accepts connections on the control socket.
+     * @returns false in case of timeout or if the node process has exited.
+     */
+    bool waitUntilReady(
+        chrono::seconds timeout);
+
+    /**
+     * Sends SIGTERM to the node and waits for it, node is killed if it doesn't exit in time.
+     */
+    void stop();
+
+    bool isRunning();
+
+    size_t index() const;
+
+    // "127.0.0.1:<port>", as it should be passed in commands to the other nodes
+    const string& address() const;
+
+    const string& controlSocketPath() const;
+
+    const string& directory() const;
+
+    /**
+     * @returns peak resident memory of the node process in kilobytes (VmHWM),
+     * the last known value is returned after the node was stopped.
+     */
+    size_t peakMemoryKB();
+
+protected:
+    void writeConfiguration(
+        const Scenario &scenario) const;
+
+protected:
+    size_t mIndex;
+    const Scenario &mScenario;
+    uint16_t mPort;
+    string mAddress;
+    string mDirectory;
+    string mControlSocketPath;
+    pid_t mPID;
+    size_t mPeakMemoryKB;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_SIMULATION_SIMULATEDNODE_H
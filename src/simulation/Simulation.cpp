@@ -0,0 +1,510 @@
+#include "Simulation.h"
+
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+const uint16_t kResultOK = 200;
+const uint16_t kPaymentResultCreated = 201;
+const char *const kAddressTypeIPv4IncludingPort = "12";
+// interval of checking if the cycle of the round is already closed
+const auto kCyclePollingInterval = chrono::milliseconds(10);
+
+}
+
+atomic<bool> Simulation::mStopRequested(false);
+
+Simulation::Simulation(
+    const Scenario &scenario) :
+    mScenario(scenario)
+{}
+
+Simulation::~Simulation()
+{
+    mSetupConnections.clear();
+    for (auto &node : mNodes) {
+        node->stop();
+    }
+    if (mObserver != nullptr) {
+        mObserver->stop();
+    }
+}
+
+void Simulation::requestStop()
+{
+    mStopRequested = true;
+}
+
+int Simulation::run()
+{
+    mSetupDeadline = chrono::steady_clock::now() + chrono::seconds(mScenario.mSetupTimeoutSeconds);
+    try {
+        mObserver = make_unique<StubObserver>(
+            mScenario.mObserverPort);
+        mObserver->start();
+
+    } catch (std::exception &e) {
+        cerr << "Can't start observer on port " << mScenario.mObserverPort << ": " << e.what() << endl;
+        return 1;
+    }
+
+    if (!startNodes() or !buildNetwork()) {
+        return 1;
+    }
+
+    cout << "Network is built, waiting " << mScenario.mSettleSeconds << " seconds for it to settle" << endl;
+    for (uint32_t second = 0; second < mScenario.mSettleSeconds and !mStopRequested; ++second) {
+        this_thread::sleep_for(
+            chrono::seconds(1));
+    }
+
+    vector<unique_ptr<LatencyStatistics>> statistics;
+    for (const auto &workload : mScenario.mWorkloads) {
+        if (mStopRequested) {
+            break;
+        }
+        cout << "Running workload " << workload.mCommand << ": " << workload.mRequestsCount
+             << " requests, " << workload.mConcurrency << " clients" << endl;
+        statistics.push_back(
+            make_unique<LatencyStatistics>(
+                workload.mCommand));
+        if (workload.mCommand == "cycles") {
+            runCyclesWorkload(
+                workload,
+                *statistics.back());
+        } else {
+            runWorkload(
+                workload,
+                *statistics.back());
+        }
+    }
+
+    cout << endl;
+    LatencyStatistics::reportHeader(cout);
+    for (const auto &workloadStatistics : statistics) {
+        workloadStatistics->report(cout);
+    }
+    cout << endl;
+    reportMemoryUsage();
+    cout << "Observer processed " << mObserver->processedRequestsCount() << " requests" << endl;
+    return mStopRequested ? 1 : 0;
+}
+
+bool Simulation::startNodes()
+{
+    cout << "Starting " << mScenario.mNodesCount << " nodes in " << mScenario.mWorkDir << endl;
+    try {
+        for (size_t index = 0; index < mScenario.mNodesCount; ++index) {
+            mNodes.push_back(
+                make_unique<SimulatedNode>(
+                    index,
+                    mScenario));
+            mNodes.back()->start();
+        }
+
+        for (auto &node : mNodes) {
+            const auto kLeft = chrono::duration_cast<chrono::seconds>(
+                mSetupDeadline - chrono::steady_clock::now());
+            if (!node->waitUntilReady(max(kLeft, chrono::seconds(1)))) {
+                cerr << "Node " << node->index() << " is not ready, see " << node->directory() << endl;
+                return false;
+            }
+            mSetupConnections.push_back(
+                make_unique<NodeConnection>(
+                    node->controlSocketPath(),
+                    mStopRequested));
+        }
+
+    } catch (std::exception &e) {
+        cerr << "Can't start nodes: " << e.what() << endl;
+        return false;
+    }
+    return true;
+}
+
+bool Simulation::buildNetwork()
+{
+    mLinks = TopologyGenerator::generate(
+        mScenario.mTopology,
+        mScenario.mNodesCount,
+        mScenario.mSeed);
+    cout << "Building " << mScenario.mTopology.mType << " topology of " << mLinks.size() << " trust lines" << endl;
+
+    // channel id of the contractor on the first and on the second node of each link
+    vector<pair<string, string>> channels;
+    const auto kEquivalent = to_string(mScenario.mEquivalent);
+    NodeConnection::Result result;
+
+    // each step is done for all links before the next one,
+    // so the nodes confirm channels and share keys in background meanwhile
+    for (const auto &link : mLinks) {
+        // second node creates channel and passes its key to the first one
+        if (!executeUntilSuccess(
+                link.second,
+                "INIT:contractors/channel",
+                addressArguments(link.first),
+                result)) {
+            return false;
+        }
+        const auto kSeparator = result.mInformation.find('\t');
+        const auto kIDOnSecond = result.mInformation.substr(0, kSeparator);
+        const auto kKeyOfSecond = result.mInformation.substr(kSeparator + 1);
+
+        if (!executeUntilSuccess(
+                link.first,
+                "INIT:contractors/channel",
+                addressArguments(link.second) + "\t" + kKeyOfSecond + "\t" + kIDOnSecond,
+                result)) {
+            return false;
+        }
+        channels.emplace_back(
+            result.mInformation.substr(0, result.mInformation.find('\t')),
+            kIDOnSecond);
+    }
+
+    for (size_t i = 0; i < mLinks.size(); ++i) {
+        if (!executeUntilSuccess(
+                mLinks[i].first,
+                "INIT:contractors/trust-line",
+                channels[i].first + "\t" + kEquivalent,
+                result)) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < mLinks.size(); ++i) {
+        const auto kAmountArguments = "\t" + mScenario.mTopology.mTrustAmount + "\t" + kEquivalent;
+        if (!executeUntilSuccess(
+                mLinks[i].first,
+                "SET:contractors/trust-lines",
+                channels[i].first + kAmountArguments,
+                result)) {
+            return false;
+        }
+        if (!executeUntilSuccess(
+                mLinks[i].second,
+                "SET:contractors/trust-lines",
+                channels[i].second + kAmountArguments,
+                result)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Simulation::runWorkload(
+    const WorkloadDescription &workload,
+    LatencyStatistics &statistics)
+{
+    const auto kIdentifier = workloadCommandIdentifier(
+        workload);
+    const auto kCommandTimeout = chrono::seconds(mScenario.mCommandTimeoutSeconds);
+    atomic<size_t> nextRequest(0);
+
+    auto client = [&] (size_t clientIndex) {
+        mt19937 generator(mScenario.mSeed + (uint32_t)clientIndex);
+        uniform_int_distribution<size_t> anyNode(0, mNodes.size() - 1);
+        // connections are opened lazily, each client has own connection to each node it uses
+        vector<unique_ptr<NodeConnection>> connections(mNodes.size());
+
+        while (!mStopRequested and nextRequest++ < workload.mRequestsCount) {
+            const auto kInitiator = anyNode(generator);
+            auto contractor = anyNode(generator);
+            while (contractor == kInitiator) {
+                contractor = anyNode(generator);
+            }
+
+            try {
+                if (connections[kInitiator] == nullptr) {
+                    connections[kInitiator] = make_unique<NodeConnection>(
+                        mNodes[kInitiator]->controlSocketPath(),
+                        mStopRequested);
+                }
+                const auto kResult = connections[kInitiator]->execute(
+                    kIdentifier,
+                    workloadCommandArguments(
+                        workload,
+                        contractor),
+                    kCommandTimeout);
+                if (kResult.mCode == 0 and mStopRequested) {
+                    // waiting was interrupted, command is not timed out
+                    break;
+                }
+                statistics.addResult(
+                    kResult.mCode,
+                    kResult.mLatency);
+
+            } catch (IOError &e) {
+                // node has closed the connection, it would be reopened by the next command
+                connections[kInitiator] = nullptr;
+                statistics.addResult(
+                    0,
+                    kCommandTimeout);
+            }
+        }
+    };
+
+    runClients(
+        workload.mConcurrency,
+        client,
+        statistics);
+}
+
+void Simulation::runCyclesWorkload(
+    const WorkloadDescription &workload,
+    LatencyStatistics &statistics)
+{
+    const auto kTriangles = TopologyGenerator::triangles(
+        mLinks,
+        mNodes.size());
+    if (kTriangles.empty()) {
+        cerr << "Topology has no cycles of three nodes, cycles workload is skipped" << endl;
+        return;
+    }
+    cout << "Topology has " << kTriangles.size() << " cycles of three nodes" << endl;
+
+    const auto kCommandTimeout = chrono::seconds(mScenario.mCommandTimeoutSeconds);
+    const auto kEquivalent = to_string(mScenario.mEquivalent);
+    atomic<size_t> nextRound(0);
+    // trust lines of the cycles of the rounds in progress
+    mutex busyLinksMutex;
+    set<TopologyGenerator::Link> busyLinks;
+    auto cycleLinks = [] (const TopologyGenerator::Triangle &triangle) {
+        return vector<TopologyGenerator::Link>{
+            {triangle[0], triangle[1]},
+            {triangle[1], triangle[2]},
+            {triangle[0], triangle[2]}};
+    };
+
+    auto client = [&] (size_t clientIndex) {
+        mt19937 generator(mScenario.mSeed + (uint32_t)clientIndex);
+        uniform_int_distribution<size_t> anyTriangle(0, kTriangles.size() - 1);
+        vector<unique_ptr<NodeConnection>> connections(mNodes.size());
+        auto connection = [&] (size_t nodeIndex) -> NodeConnection& {
+            if (connections[nodeIndex] == nullptr) {
+                connections[nodeIndex] = make_unique<NodeConnection>(
+                    mNodes[nodeIndex]->controlSocketPath(),
+                    mStopRequested);
+            }
+            return *connections[nodeIndex];
+        };
+
+        while (!mStopRequested and nextRound++ < workload.mRequestsCount) {
+            TopologyGenerator::Triangle triangle;
+            bool isTaken = false;
+            while (!isTaken and !mStopRequested) {
+                {
+                    lock_guard<mutex> lock(busyLinksMutex);
+                    triangle = kTriangles[anyTriangle(generator)];
+                    const auto kLinks = cycleLinks(triangle);
+                    isTaken = true;
+                    for (const auto &link : kLinks) {
+                        isTaken = isTaken and busyLinks.count(link) == 0;
+                    }
+                    if (isTaken) {
+                        busyLinks.insert(
+                            kLinks.begin(),
+                            kLinks.end());
+                    }
+                }
+                if (!isTaken) {
+                    this_thread::sleep_for(
+                        kCyclePollingInterval);
+                }
+            }
+            if (!isTaken) {
+                break;
+            }
+
+            NodeConnection::Result result;
+            try {
+                string initialBalance;
+                result = requestTrustLineBalance(
+                    connection(triangle[0]),
+                    triangle[1],
+                    initialBalance);
+
+                // each node of the cycle pays to the next one, so the cycle gets debts on all its trust lines
+                auto isPaid = result.mCode == kResultOK;
+                for (size_t i = 0; i < triangle.size() and isPaid; ++i) {
+                    result = connection(triangle[i]).execute(
+                        "CREATE:contractors/transactions",
+                        addressArguments(triangle[(i + 1) % triangle.size()]) + "\t" + workload.mAmount
+                            + "\t" + kEquivalent,
+                        kCommandTimeout);
+                    isPaid = result.mCode == kPaymentResultCreated;
+                }
+
+                if (isPaid) {
+                    const auto kPaid = chrono::steady_clock::now();
+                    string balance;
+                    do {
+                        this_thread::sleep_for(
+                            kCyclePollingInterval);
+                        result = requestTrustLineBalance(
+                            connection(triangle[0]),
+                            triangle[1],
+                            balance);
+                    } while (result.mCode == kResultOK and balance != initialBalance and !mStopRequested
+                             and chrono::steady_clock::now() - kPaid < kCommandTimeout);
+                    if (result.mCode == kResultOK and balance != initialBalance) {
+                        // cycle was not closed in time
+                        result.mCode = 0;
+                    }
+                    result.mLatency = chrono::duration_cast<chrono::microseconds>(
+                        chrono::steady_clock::now() - kPaid);
+                }
+
+            } catch (IOError &e) {
+                // node has closed the connection, it would be reopened by the next round
+                for (const auto nodeIndex : triangle) {
+                    connections[nodeIndex] = nullptr;
+                }
+                result.mCode = 0;
+                result.mLatency = kCommandTimeout;
+            }
+
+            {
+                lock_guard<mutex> lock(busyLinksMutex);
+                for (const auto &link : cycleLinks(triangle)) {
+                    busyLinks.erase(link);
+                }
+            }
+            if (result.mCode == 0 and mStopRequested) {
+                // waiting was interrupted, round is not timed out
+                break;
+            }
+            statistics.addResult(
+                result.mCode,
+                result.mLatency);
+        }
+    };
+
+    runClients(
+        workload.mConcurrency,
+        client,
+        statistics);
+}
+
+void Simulation::runClients(
+    size_t concurrency,
+    const function<void(size_t)> &client,
+    LatencyStatistics &statistics)
+{
+    const auto kStarted = chrono::steady_clock::now();
+    vector<thread> clients;
+    for (size_t i = 0; i < concurrency; ++i) {
+        clients.emplace_back(
+            client,
+            i);
+    }
+    for (auto &clientThread : clients) {
+        clientThread.join();
+    }
+    statistics.setDuration(
+        chrono::duration_cast<chrono::microseconds>(
+            chrono::steady_clock::now() - kStarted));
+}
+
+NodeConnection::Result Simulation::requestTrustLineBalance(
+    NodeConnection &connection,
+    size_t contractorIndex,
+    string &balance) const
+{
+    const auto kResult = connection.execute(
+        "GET:contractors/trust-lines/one/address",
+        addressArguments(contractorIndex) + "\t" + to_string(mScenario.mEquivalent),
+        chrono::seconds(mScenario.mCommandTimeoutSeconds));
+    if (kResult.mCode == kResultOK) {
+        // balance is the last token of the trust line description
+        balance = kResult.mInformation.substr(
+            kResult.mInformation.rfind('\t') + 1);
+    }
+    return kResult;
+}
+
+void Simulation::reportMemoryUsage()
+{
+    size_t totalKB = 0;
+    size_t maxKB = 0;
+    size_t runningNodesCount = 0;
+    for (auto &node : mNodes) {
+        if (node->isRunning()) {
+            runningNodesCount++;
+        }
+        const auto kPeakKB = node->peakMemoryKB();
+        totalKB += kPeakKB;
+        maxKB = max(maxKB, kPeakKB);
+    }
+    cout << "Nodes running: " << runningNodesCount << "/" << mNodes.size()
+         << ", peak RSS per node: avg " << (mNodes.empty() ? 0 : totalKB / mNodes.size())
+         << " KB, max " << maxKB << " KB" << endl;
+}
+
+bool Simulation::executeUntilSuccess(
+    size_t nodeIndex,
+    const string &identifier,
+    const string &arguments,
+    NodeConnection::Result &result)
+{
+    while (!mStopRequested) {
+        const auto kLeft = chrono::duration_cast<chrono::seconds>(
+            mSetupDeadline - chrono::steady_clock::now());
+        if (kLeft.count() <= 0) {
+            break;
+        }
+        try {
+            result = mSetupConnections[nodeIndex]->execute(
+                identifier,
+                arguments,
+                kLeft);
+
+        } catch (IOError &e) {
+            cerr << "Node " << nodeIndex << ": " << e.what() << endl;
+            return false;
+        }
+        if (result.mCode == kResultOK) {
+            return true;
+        }
+        this_thread::sleep_for(
+            chrono::milliseconds(500));
+    }
+    cerr << "Node " << nodeIndex << " has not executed " << identifier << " during setup, last code "
+         << result.mCode << ", see " << mNodes[nodeIndex]->directory() << endl;
+    return false;
+}
+
+string Simulation::addressArguments(
+    size_t nodeIndex) const
+{
+    return string("1\t") + kAddressTypeIPv4IncludingPort + "\t" + mNodes[nodeIndex]->address();
+}
+
+string Simulation::workloadCommandIdentifier(
+    const WorkloadDescription &workload) const
+{
+    if (workload.mCommand == "payment") {
+        return "CREATE:contractors/transactions";
+    }
+    if (workload.mCommand == "max_flow") {
+        return "GET:contractors/transactions/max";
+    }
+    return "GET:stats/balance/total";
+}
+
+string Simulation::workloadCommandArguments(
+    const WorkloadDescription &workload,
+    size_t contractorIndex) const
+{
+    const auto kEquivalent = to_string(mScenario.mEquivalent);
+    if (workload.mCommand == "payment") {
+        return addressArguments(contractorIndex) + "\t" + workload.mAmount + "\t" + kEquivalent;
+    }
+    if (workload.mCommand == "max_flow") {
+        return addressArguments(contractorIndex) + "\t" + kEquivalent;
+    }
+    return kEquivalent;
+}
@@ -0,0 +1,114 @@
+#ifndef GEO_NETWORK_CLIENT_SIMULATION_SIMULATION_H
+#define GEO_NETWORK_CLIENT_SIMULATION_SIMULATION_H
+
+#include "Scenario.h"
+#include "SimulatedNode.h"
+#include "NodeConnection.h"
+#include "StubObserver.h"
+#include "LatencyStatistics.h"
+#include "TopologyGenerator.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Runs the scenario: starts stub observer and nodes, builds trust lines topology
+ * through the control sockets of the nodes, runs workloads one by one
+ * and reports throughput and latency per each of them.
+ * Nodes are stopped when simulation is destroyed.
+ */
+class Simulation {
+
+public:
+    explicit Simulation(
+        const Scenario &scenario);
+
+    ~Simulation();
+
+    /**
+     * @returns process exit code: 0 if all workloads were run, 1 otherwise.
+     */
+    int run();
+
+    /**
+     * Interrupts the simulation (is safe to be called from the signal handler).
+     */
+    static void requestStop();
+
+protected:
+    bool startNodes();
+
+    bool buildNetwork();
+
+    void runWorkload(
+        const WorkloadDescription &workload,
+        LatencyStatistics &statistics);
+
+    /**
+     * Runs rounds of cycles closing: latency of the round is measured from the result of its last payment
+     * until the balance of the first trust line of the cycle returns to its value before the round.
+     * Cycles of the concurrent rounds have no common trust lines, but may have common nodes,
+     * so one node can close several cycles at once.
+     */
+    void runCyclesWorkload(
+        const WorkloadDescription &workload,
+        LatencyStatistics &statistics);
+
+    // runs client(clientIndex) in each of concurrency threads and measures the duration of the workload
+    void runClients(
+        size_t concurrency,
+        const function<void(size_t)> &client,
+        LatencyStatistics &statistics);
+
+    /**
+     * @returns result of the request of the trust line, balance is set only if the code is OK.
+     */
+    NodeConnection::Result requestTrustLineBalance(
+        NodeConnection &connection,
+        size_t contractorIndex,
+        string &balance) const;
+
+    void reportMemoryUsage();
+
+    /**
+     * Repeats command until it is successfully executed by the node:
+     * during network building nodes may still process previous steps (channel confirmation, keys sharing).
+     * @returns false in case if setup timeout has expired or simulation was interrupted.
+     */
+    bool executeUntilSuccess(
+        size_t nodeIndex,
+        const string &identifier,
+        const string &arguments,
+        NodeConnection::Result &result);
+
+    // "1\t12\t<ip:port>" - addresses part of the commands
+    string addressArguments(
+        size_t nodeIndex) const;
+
+    string workloadCommandIdentifier(
+        const WorkloadDescription &workload) const;
+
+    string workloadCommandArguments(
+        const WorkloadDescription &workload,
+        size_t contractorIndex) const;
+
+protected:
+    static atomic<bool> mStopRequested;
+
+    const Scenario &mScenario;
+    unique_ptr<StubObserver> mObserver;
+    vector<unique_ptr<SimulatedNode>> mNodes;
+    // connections, used during network building (one per node)
+    vector<unique_ptr<NodeConnection>> mSetupConnections;
+    vector<TopologyGenerator::Link> mLinks;
+    chrono::steady_clock::time_point mSetupDeadline;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_SIMULATION_SIMULATION_H
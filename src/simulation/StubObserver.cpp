@@ -0,0 +1,223 @@
+#include "StubObserver.h"
+
+#include <cstring>
+
+namespace {
+
+// observer responses (see ObservingTransaction::ObservingResponseType)
+const byte kResponseNoInfo = 0;
+const byte kResponseClaimInPool = 1;
+const byte kResponseParticipantsVotesPresent = 3;
+const byte kResponseUnknownRequest = 200;
+
+// request: [MessageSize][protocol version][message type][payload]
+const size_t kRequestHeaderSize = sizeof(SerializedProtocolVersion) + sizeof(ObservingMessage::SerializedType);
+const ObservingMessage::MessageSize kMaxRequestSize = 16 * 1024 * 1024;
+
+const size_t kTransactionUUIDSize = 16;
+
+template <typename Value>
+void append(
+    vector<char> &buffer,
+    const Value &value)
+{
+    const auto *kBytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(
+        buffer.end(),
+        kBytes,
+        kBytes + sizeof(Value));
+}
+
+}
+
+/**
+ * One connection of the node: requests are read one by one and answered in the same order,
+ * as ObserverConnection pipelines them and expects responses in order of the requests.
+ */
+class StubObserver::Session :
+    public enable_shared_from_this<StubObserver::Session> {
+
+public:
+    Session(
+        StubObserver &observer,
+        as::ip::tcp::socket socket) :
+        mObserver(observer),
+        mSocket(move(socket)),
+        mRequestSize(0)
+    {}
+
+    void readNextRequest()
+    {
+        auto self = shared_from_this();
+        as::async_read(
+            mSocket,
+            as::buffer(
+                &mRequestSize,
+                sizeof(mRequestSize)),
+            [this, self] (const boost::system::error_code &error, size_t) {
+                if (error or mRequestSize < kRequestHeaderSize or mRequestSize > kMaxRequestSize) {
+                    return;
+                }
+                mRequest.resize(mRequestSize);
+                as::async_read(
+                    mSocket,
+                    as::buffer(mRequest),
+                    [this, self] (const boost::system::error_code &error, size_t) {
+                        if (error) {
+                            return;
+                        }
+                        writeResponse();
+                    });
+            });
+    }
+
+protected:
+    void writeResponse()
+    {
+        const auto kType = (ObservingMessage::SerializedType)mRequest[sizeof(SerializedProtocolVersion)];
+        const auto kPayload = mObserver.response(
+            kType,
+            mRequest);
+        mObserver.mProcessedRequestsCount++;
+
+        mResponse.clear();
+        append(
+            mResponse,
+            (ObservingMessage::MessageSize)kPayload.size());
+        mResponse.insert(
+            mResponse.end(),
+            kPayload.begin(),
+            kPayload.end());
+
+        auto self = shared_from_this();
+        as::async_write(
+            mSocket,
+            as::buffer(mResponse),
+            [this, self] (const boost::system::error_code &error, size_t) {
+                if (error) {
+                    return;
+                }
+                readNextRequest();
+            });
+    }
+
+protected:
+    StubObserver &mObserver;
+    as::ip::tcp::socket mSocket;
+    ObservingMessage::MessageSize mRequestSize;
+    vector<char> mRequest;
+    vector<char> mResponse;
+};
+
+StubObserver::StubObserver(
+    uint16_t port) :
+    mAcceptor(
+        mIOService,
+        as::ip::tcp::endpoint(
+            as::ip::address::from_string("127.0.0.1"),
+            port)),
+    mNextSocket(mIOService),
+    mStarted(chrono::steady_clock::now()),
+    mProcessedRequestsCount(0)
+{}
+
+StubObserver::~StubObserver()
+{
+    stop();
+}
+
+void StubObserver::start()
+{
+    acceptNextConnection();
+    mThread = thread([this] () {
+        mIOService.run();
+    });
+}
+
+void StubObserver::stop()
+{
+    if (!mThread.joinable()) {
+        return;
+    }
+    mIOService.stop();
+    mThread.join();
+}
+
+size_t StubObserver::processedRequestsCount() const
+{
+    return mProcessedRequestsCount;
+}
+
+void StubObserver::acceptNextConnection()
+{
+    mAcceptor.async_accept(
+        mNextSocket,
+        [this] (const boost::system::error_code &error) {
+            if (error) {
+                return;
+            }
+            make_shared<Session>(
+                *this,
+                move(mNextSocket))->readNextRequest();
+            mNextSocket = as::ip::tcp::socket(mIOService);
+            acceptNextConnection();
+        });
+}
+
+BlockNumber StubObserver::currentBlockNumber() const
+{
+    const auto kElapsed = chrono::duration_cast<chrono::seconds>(
+        chrono::steady_clock::now() - mStarted).count();
+    return 1 + (BlockNumber)kElapsed / kBlockPeriodSeconds;
+}
+
+vector<char> StubObserver::response(
+    ObservingMessage::SerializedType requestType,
+    const vector<char> &request) const
+{
+    vector<char> payload;
+    switch (requestType) {
+        case ObservingMessage::Observing_BlockNumberRequest: {
+            append(payload, kResponseNoInfo);
+            append(payload, currentBlockNumber());
+            break;
+        }
+        case ObservingMessage::Observing_ClaimAppendRequest: {
+            append(payload, kResponseClaimInPool);
+            break;
+        }
+        case ObservingMessage::Observing_ParticipantsVotesAppendRequest: {
+            append(payload, kResponseParticipantsVotesPresent);
+            break;
+        }
+        case ObservingMessage::Observing_ParticipantsVotesRequest: {
+            // [response][is votes present][block number][transaction uuid][signatures count]
+            // votes are always reported as absent, so uuid of the transaction is not read by the node
+            append(payload, kResponseNoInfo);
+            append(payload, (byte)0);
+            append(payload, currentBlockNumber());
+            payload.insert(payload.end(), kTransactionUUIDSize, 0);
+            append(payload, (SerializedRecordsCount)0);
+            break;
+        }
+        case ObservingMessage::Observing_TransactionsRequest: {
+            // [response][block number][transactions count][response per each transaction]
+            SerializedRecordsCount transactionsCount = 0;
+            if (request.size() >= kRequestHeaderSize + sizeof(SerializedRecordsCount)) {
+                memcpy(
+                    &transactionsCount,
+                    request.data() + kRequestHeaderSize,
+                    sizeof(SerializedRecordsCount));
+            }
+            append(payload, kResponseNoInfo);
+            append(payload, currentBlockNumber());
+            append(payload, transactionsCount);
+            payload.insert(payload.end(), transactionsCount, (char)kResponseNoInfo);
+            break;
+        }
+        default: {
+            append(payload, kResponseUnknownRequest);
+        }
+    }
+    return payload;
+}
@@ -0,0 +1,64 @@
+#ifndef GEO_NETWORK_CLIENT_SIMULATION_STUBOBSERVER_H
+#define GEO_NETWORK_CLIENT_SIMULATION_STUBOBSERVER_H
+
+#include "../core/observing/messages/base/ObservingMessage.hpp"
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace as = boost::asio;
+using namespace std;
+
+/**
+ * Minimal observer, which is required by the nodes to run payments:
+ * it reports block number, growing with time, accepts all claims and votes,
+ * and knows nothing about transactions (so nodes never get conflicting verdicts from it).
+ * Serves all nodes of the simulation on one TCP port in its own thread.
+ */
+class StubObserver {
+
+public:
+    /**
+     * @throws boost::system::system_error in case if the port can't be bound.
+     */
+    explicit StubObserver(
+        uint16_t port);
+
+    ~StubObserver();
+
+    void start();
+
+    void stop();
+
+    size_t processedRequestsCount() const;
+
+protected:
+    class Session;
+
+    void acceptNextConnection();
+
+    BlockNumber currentBlockNumber() const;
+
+    vector<char> response(
+        ObservingMessage::SerializedType requestType,
+        const vector<char> &request) const;
+
+protected:
+    // block number grows once per this period, like it does on the real observers
+    static constexpr uint32_t kBlockPeriodSeconds = 5;
+
+    as::io_service mIOService;
+    as::ip::tcp::acceptor mAcceptor;
+    as::ip::tcp::socket mNextSocket;
+    thread mThread;
+    chrono::steady_clock::time_point mStarted;
+    atomic<size_t> mProcessedRequestsCount;
+};
+
+
+#endif //GEO_NETWORK_CLIENT_SIMULATION_STUBOBSERVER_H
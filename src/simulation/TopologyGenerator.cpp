@@ -0,0 +1,121 @@
+#include "TopologyGenerator.h"
+
+#include <set>
+
+vector<TopologyGenerator::Link> TopologyGenerator::generate(
+    const TopologyDescription &description,
+    size_t nodesCount,
+    uint32_t seed)
+{
+    if (description.mType == "chain") {
+        return chain(
+            nodesCount);
+    }
+    if (description.mType == "ring") {
+        auto links = chain(
+            nodesCount);
+        if (nodesCount > 2) {
+            links.emplace_back(
+                nodesCount - 1,
+                0);
+        }
+        return links;
+    }
+    if (description.mType == "star") {
+        return star(
+            nodesCount);
+    }
+    if (description.mType == "random") {
+        mt19937 generator(seed);
+        return random(
+            nodesCount,
+            description.mLinksPerNode,
+            generator);
+    }
+    throw ValueError(
+        "TopologyGenerator::generate: unknown topology type " + description.mType);
+}
+
+vector<TopologyGenerator::Triangle> TopologyGenerator::triangles(
+    const vector<Link> &links,
+    size_t nodesCount)
+{
+    vector<set<size_t>> neighbors(nodesCount);
+    for (const auto &link : links) {
+        neighbors[link.first].insert(link.second);
+        neighbors[link.second].insert(link.first);
+    }
+
+    // each triangle is found only from the link between its two lowest nodes
+    vector<Triangle> result;
+    for (const auto &link : links) {
+        const auto kFirst = min(link.first, link.second);
+        const auto kSecond = max(link.first, link.second);
+        for (auto third = neighbors[kSecond].upper_bound(kSecond); third != neighbors[kSecond].end(); ++third) {
+            if (neighbors[kFirst].count(*third) != 0) {
+                result.push_back({kFirst, kSecond, *third});
+            }
+        }
+    }
+    return result;
+}
+
+vector<TopologyGenerator::Link> TopologyGenerator::chain(
+    size_t nodesCount)
+{
+    vector<Link> links;
+    for (size_t i = 1; i < nodesCount; ++i) {
+        links.emplace_back(
+            i - 1,
+            i);
+    }
+    return links;
+}
+
+vector<TopologyGenerator::Link> TopologyGenerator::star(
+    size_t nodesCount)
+{
+    vector<Link> links;
+    for (size_t i = 1; i < nodesCount; ++i) {
+        links.emplace_back(
+            0,
+            i);
+    }
+    return links;
+}
+
+vector<TopologyGenerator::Link> TopologyGenerator::random(
+    size_t nodesCount,
+    size_t linksPerNode,
+    mt19937 &generator)
+{
+    vector<Link> links;
+    set<Link> presentLinks;
+    auto addLink = [&links, &presentLinks] (size_t first, size_t second) {
+        const Link kLink(min(first, second), max(first, second));
+        if (first == second or presentLinks.count(kLink) != 0) {
+            return;
+        }
+        presentLinks.insert(kLink);
+        links.push_back(kLink);
+    };
+
+    for (size_t i = 1; i < nodesCount; ++i) {
+        uniform_int_distribution<size_t> previousNode(0, i - 1);
+        addLink(
+            previousNode(generator),
+            i);
+    }
+
+    const auto kMaxLinksCount = nodesCount * (nodesCount - 1) / 2;
+    const auto kLinksCount = min(
+        kMaxLinksCount,
+        max(nodesCount - 1, nodesCount * linksPerNode / 2));
+    uniform_int_distribution<size_t> anyNode(0, nodesCount - 1);
+    while (links.size() < kLinksCount) {
+        addLink(
+            anyNode(generator),
+            anyNode(generator));
+    }
+    return links;
+}
@@ -0,0 +1,56 @@
+#ifndef GEO_NETWORK_CLIENT_SIMULATION_TOPOLOGYGENERATOR_H
+#define GEO_NETWORK_CLIENT_SIMULATION_TOPOLOGYGENERATOR_H
+
+#include "Scenario.h"
+
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Generates synthetic trust lines topology: list of pairs of nodes indexes, which are connected by trust line.
+ * Generated topology is always connected, so each node can pay to any other one.
+ * Topology depends only on the description and the seed, so runs of the same scenario are comparable.
+ */
+class TopologyGenerator {
+
+public:
+    typedef pair<size_t, size_t> Link;
+    // indexes of the nodes of the cycle of three nodes, in ascending order
+    typedef array<size_t, 3> Triangle;
+
+public:
+    /**
+     * @throws ValueError in case of unknown topology type.
+     */
+    static vector<Link> generate(
+        const TopologyDescription &description,
+        size_t nodesCount,
+        uint32_t seed);
+
+    /**
+     * @returns all cycles of three nodes of the topology, each one once.
+     */
+    static vector<Triangle> triangles(
+        const vector<Link> &links,
+        size_t nodesCount);
+
+protected:
+    static vector<Link> chain(
+        size_t nodesCount);
+
+    static vector<Link> star(
+        size_t nodesCount);
+
+    // random spanning tree, extended by random links up to the required average count of links per node
+    static vector<Link> random(
+        size_t nodesCount,
+        size_t linksPerNode,
+        mt19937 &generator);
+};
+
+
+#endif //GEO_NETWORK_CLIENT_SIMULATION_TOPOLOGYGENERATOR_H
@@ -0,0 +1,31 @@
+#include "Simulation.h"
+
+#include <csignal>
+#include <iostream>
+
+void onInterrupt(int)
+{
+    Simulation::requestStop();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        cerr << "Usage: " << argv[0] << " <scenario.json>" << endl;
+        return 2;
+    }
+
+    try {
+        const auto kScenario = Scenario::fromFile(argv[1]);
+        signal(SIGINT, onInterrupt);
+        signal(SIGTERM, onInterrupt);
+        signal(SIGPIPE, SIG_IGN);
+
+        Simulation simulation(kScenario);
+        return simulation.run();
+
+    } catch (std::exception &e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+}
@@ -1,6 +1,17 @@
 #ifndef GEO_NETWORK_CLIENT_TESTINCLUDES_H
 #define GEO_NETWORK_CLIENT_TESTINCLUDES_H
 
+#include "common/containers/ContractorIDMapTest.cpp"
+#include "common/multiprecision/MultiprecisionUtilsTest.cpp"
+#include "common/time/TimerServiceTest.cpp"
+#include "common/workers/WorkersPoolTest.cpp"
+
+#include "contractors/ContractorsManagerTest.cpp"
+
+#include "crypto/SecureArenaTest.cpp"
+
+#include "interface/сommands_interface/interface/CommandsParserTest.cpp"
+
 #include "interface/сommands_interface/commands/history/HistoryAdditionalPaymentsCommandTest.cpp"
 #include "interface/сommands_interface/commands/history/HistoryPaymentsCommandTest.cpp"
 #include "interface/сommands_interface/commands/history/HistoryTrustLinesCommandTest.cpp"
@@ -27,4 +38,16 @@
 #include "interface/сommands_interface/commands/trust_lines/SetOutgoingTrustLineCommandTest.cpp"
 #include "interface/сommands_interface/commands/trust_lines/ShareKeysCommandTest.cpp"
 
+#include "interface/results_interface/CommandResultTest.cpp"
+
+#include "interface/socket_interface/SocketInterfaceTest.cpp"
+
+#include "io/storage/HistoryStorageMigrationTest.cpp"
+#include "io/storage/HistoryStoragePaginationTest.cpp"
+
+#include "network/communicator/IncomingRemoteNodeTest.cpp"
+#include "network/communicator/MessagesParsingTest.cpp"
+
+#include "transactions/history/HistoryPaymentsTransactionTest.cpp"
+
 #endif //GEO_NETWORK_CLIENT_TESTINCLUDES_H
\ No newline at end of file
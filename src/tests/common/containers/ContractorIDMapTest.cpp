@@ -0,0 +1,131 @@
+#include "../../catch.hpp"
+#include "../../../core/common/containers/ContractorIDMap.h"
+
+#include <memory>
+
+namespace contractor_id_map_test {
+
+typedef ContractorIDMap<shared_ptr<int>> IntsMap;
+
+static_assert(
+    is_const<IntsMap::value_type::first_type>::value,
+    "contractor id of the element must not be changed via iterator");
+
+vector<ContractorID> ids(
+    const IntsMap &map)
+{
+    vector<ContractorID> result;
+    for (const auto &idAndValue : map) {
+        result.push_back(idAndValue.first);
+    }
+    return result;
+}
+
+}
+
+TEST_CASE("Testing ContractorIDMap")
+{
+    using namespace contractor_id_map_test;
+    IntsMap map;
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+
+    map.set(5, make_shared<int>(50));
+    map.set(1, make_shared<int>(10));
+    map.set(3, make_shared<int>(30));
+
+    SECTION("Values are set and replaced")
+    {
+        REQUIRE(map.size() == 3);
+        REQUIRE(map.count(3) == 1);
+        REQUIRE(map.count(2) == 0);
+        REQUIRE(map.count(100) == 0);
+        REQUIRE(*map.at(5) == 50);
+        REQUIRE_THROWS_AS(map.at(2), NotFoundError);
+
+        map.set(3, make_shared<int>(33));
+        REQUIRE(map.size() == 3);
+        REQUIRE(*map.at(3) == 33);
+
+        // null value is not stored
+        map.set(3, nullptr);
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.count(3) == 0);
+    }
+
+    SECTION("Elements are iterated in order of ids, absent ones are skipped")
+    {
+        REQUIRE(ids(map) == vector<ContractorID>({1, 3, 5}));
+
+        auto found = map.find(3);
+        REQUIRE(found != map.end());
+        REQUIRE(found->first == 3);
+        REQUIRE(*found->second == 30);
+        REQUIRE(++found == map.find(5));
+        REQUIRE(++found == map.end());
+        REQUIRE(map.find(4) == map.end());
+
+        const auto &constMap = map;
+        REQUIRE(constMap.find(1)->first == 1);
+        REQUIRE(constMap.find(2) == constMap.end());
+    }
+
+    SECTION("Erased elements are not present")
+    {
+        REQUIRE(map.erase(2) == 0);
+        REQUIRE(map.erase(5) == 1);
+        REQUIRE(map.erase(5) == 0);
+        REQUIRE(map.size() == 2);
+        REQUIRE(ids(map) == vector<ContractorID>({1, 3}));
+
+        REQUIRE(map.erase(1) == 1);
+        REQUIRE(map.erase(3) == 1);
+        REQUIRE(map.empty());
+        REQUIRE(map.begin() == map.end());
+
+        map.set(4, make_shared<int>(40));
+        REQUIRE(ids(map) == vector<ContractorID>({4}));
+    }
+
+    SECTION("Erase keeps iterators to other elements valid")
+    {
+        // erasing of the last element doesn't release its slot
+        auto current = map.find(3);
+        REQUIRE(map.erase(5) == 1);
+        REQUIRE(current->first == 3);
+        REQUIRE(*current->second == 30);
+        REQUIRE(++current == map.end());
+
+        // elements can be erased while iterating
+        for (auto it = map.begin(); it != map.end();) {
+            const auto kErasedID = it->first;
+            ++it;
+            map.erase(kErasedID);
+        }
+        REQUIRE(map.empty());
+    }
+
+    SECTION("Trailing empty slots are released on shrinking")
+    {
+        map.set(1000, make_shared<int>(1));
+        const auto kAllocatedBytesCount = map.allocatedBytesCount();
+        map.erase(1000);
+        REQUIRE(map.allocatedBytesCount() == kAllocatedBytesCount);
+
+        map.shrinkToFit();
+        REQUIRE(map.allocatedBytesCount() < kAllocatedBytesCount);
+        REQUIRE(ids(map) == vector<ContractorID>({1, 3, 5}));
+        REQUIRE(map.count(1000) == 0);
+
+        map.set(7, make_shared<int>(70));
+        REQUIRE(ids(map) == vector<ContractorID>({1, 3, 5, 7}));
+    }
+
+    SECTION("Map is cleared")
+    {
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(map.count(1) == 0);
+        REQUIRE(map.begin() == map.end());
+    }
+}
@@ -0,0 +1,153 @@
+#include "../../catch.hpp"
+#include "../../../core/common/multiprecision/MultiprecisionUtils.h"
+
+#include <random>
+
+namespace multiprecision_utils_test {
+
+/*
+ * Serialization, used before limb by limb writing was introduced
+ * (export_bits into the temporary buffer, padded by leading zeroes).
+ * Is used as a reference of the wire format.
+ */
+vector<byte> previousTrustLineAmountToBytes(
+    const TrustLineAmount &amount)
+{
+    vector<byte> exportedBytes;
+    export_bits(amount, back_inserter(exportedBytes), 8);
+    vector<byte> result(kTrustLineAmountBytesCount - exportedBytes.size(), 0);
+    result.insert(result.end(), exportedBytes.begin(), exportedBytes.end());
+    return result;
+}
+
+vector<byte> previousTrustLineBalanceToBytes(
+    const TrustLineBalance &balance)
+{
+    vector<byte> exportedBytes;
+    export_bits(balance, back_inserter(exportedBytes), 8);
+    vector<byte> result(kTrustLineBalanceSerializeBytesCount - exportedBytes.size(), 0);
+    result[0] = byte(balance < 0);
+    result.insert(result.end(), exportedBytes.begin(), exportedBytes.end());
+    return result;
+}
+
+TrustLineAmount previousBytesToTrustLineAmount(
+    const vector<byte> &amountBytes)
+{
+    TrustLineAmount amount;
+    import_bits(amount, amountBytes.begin(), amountBytes.begin() + kTrustLineAmountBytesCount);
+    return amount;
+}
+
+TrustLineBalance previousBytesToTrustLineBalance(
+    const vector<byte> &balanceBytes)
+{
+    TrustLineBalance balance;
+    import_bits(balance, balanceBytes.begin() + 1, balanceBytes.begin() + kTrustLineBalanceSerializeBytesCount);
+    if (balance > 0 and balanceBytes[0] != 0) {
+        balance = -balance;
+    }
+    return balance;
+}
+
+// amounts of all magnitudes: edge values and random ones of random bits count
+vector<TrustLineAmount> testAmounts()
+{
+    vector<TrustLineAmount> result = {
+        TrustLineAmount(0),
+        TrustLineAmount(1),
+        TrustLineAmount(255),
+        TrustLineAmount(256),
+        TrustLineAmount(numeric_limits<uint64_t>::max()),
+        TrustLineAmount(numeric_limits<uint64_t>::max()) + 1,
+        numeric_limits<TrustLineAmount>::max()};
+
+    mt19937_64 generator(42);
+    for (size_t idx = 0; idx < 1000; idx++) {
+        TrustLineAmount amount = 0;
+        for (size_t limbIdx = 0; limbIdx < kTrustLineAmountBytesCount / sizeof(uint64_t); limbIdx++) {
+            amount = (amount << 64) | TrustLineAmount(generator());
+        }
+        result.push_back(
+            amount >> (generator() % 256));
+    }
+    return result;
+}
+
+vector<TrustLineBalance> testBalances()
+{
+    vector<TrustLineBalance> result;
+    for (const auto &amount : testAmounts()) {
+        result.push_back(TrustLineBalance(amount));
+        result.push_back(-TrustLineBalance(amount));
+    }
+    return result;
+}
+
+}
+
+TEST_CASE("Testing multiprecision serialization")
+{
+    using namespace multiprecision_utils_test;
+
+    SECTION("Amounts are serialized into the same bytes as before")
+    {
+        for (const auto &amount : testAmounts()) {
+            const auto kPreviousBytes = previousTrustLineAmountToBytes(amount);
+            REQUIRE(trustLineAmountToBytes(amount) == kPreviousBytes);
+
+            byte buffer[kTrustLineAmountBytesCount];
+            trustLineAmountToBytes(amount, buffer);
+            REQUIRE(memcmp(buffer, kPreviousBytes.data(), kTrustLineAmountBytesCount) == 0);
+
+            REQUIRE(bytesToTrustLineAmount(kPreviousBytes) == amount);
+            REQUIRE(previousBytesToTrustLineAmount(trustLineAmountToBytes(amount)) == amount);
+        }
+    }
+
+    SECTION("Balances are serialized into the same bytes as before")
+    {
+        for (const auto &balance : testBalances()) {
+            const auto kPreviousBytes = previousTrustLineBalanceToBytes(balance);
+            REQUIRE(trustLineBalanceToBytes(balance) == kPreviousBytes);
+
+            byte buffer[kTrustLineBalanceSerializeBytesCount];
+            trustLineBalanceToBytes(balance, buffer);
+            REQUIRE(memcmp(buffer, kPreviousBytes.data(), kTrustLineBalanceSerializeBytesCount) == 0);
+
+            REQUIRE(bytesToTrustLineBalance(kPreviousBytes) == balance);
+            REQUIRE(previousBytesToTrustLineBalance(trustLineBalanceToBytes(balance)) == balance);
+        }
+    }
+
+    SECTION("Round trip keeps the values")
+    {
+        byte buffer[kTrustLineBalanceSerializeBytesCount];
+        for (const auto &amount : testAmounts()) {
+            trustLineAmountToBytes(amount, buffer);
+            REQUIRE(bytesToTrustLineAmount(buffer) == amount);
+        }
+        for (const auto &balance : testBalances()) {
+            trustLineBalanceToBytes(balance, buffer);
+            REQUIRE(bytesToTrustLineBalance(buffer) == balance);
+        }
+    }
+
+    SECTION("Negative zero is read as zero")
+    {
+        byte buffer[kTrustLineBalanceSerializeBytesCount] = {};
+        buffer[0] = 1;
+        REQUIRE(bytesToTrustLineBalance(buffer) == 0);
+        REQUIRE_FALSE(bytesToTrustLineBalance(buffer) < 0);
+    }
+
+    SECTION("Deserialized value is normalized")
+    {
+        // arithmetic and comparison rely on the absence of leading zero limbs
+        byte buffer[kTrustLineAmountBytesCount] = {};
+        buffer[kTrustLineAmountBytesCount - 1] = 7;
+        const auto kAmount = bytesToTrustLineAmount(buffer);
+        REQUIRE(kAmount.backend().size() == 1);
+        REQUIRE(kAmount + 1 == TrustLineAmount(8));
+    }
+}
@@ -0,0 +1,107 @@
+#include "../../catch.hpp"
+#include "../../../core/common/time/TimerService.h"
+
+TEST_CASE("Testing TimerService")
+{
+    as::io_service ioService;
+    TimerService timerService(ioService);
+    vector<int> calls;
+
+    SECTION("Callbacks are called in order of their expiries")
+    {
+        const auto kNow = TimerService::Clock::now();
+        timerService.schedule(kNow + chrono::milliseconds(30), [&] () { calls.push_back(3); });
+        timerService.schedule(kNow + chrono::milliseconds(10), [&] () { calls.push_back(1); });
+        timerService.schedule(kNow + chrono::milliseconds(20), [&] () { calls.push_back(2); });
+        // callbacks with the same expiry are called in order of scheduling
+        timerService.schedule(kNow + chrono::milliseconds(20), [&] () { calls.push_back(4); });
+        ioService.run();
+        REQUIRE(calls == vector<int>({1, 2, 4, 3}));
+    }
+
+    SECTION("Cancelled callback is not called")
+    {
+        const auto kTimerID = timerService.schedule(
+            TimerService::Clock::now() + chrono::milliseconds(5),
+            [&] () { calls.push_back(1); });
+        timerService.schedule(
+            TimerService::Clock::now() + chrono::milliseconds(10),
+            [&] () { calls.push_back(2); });
+        REQUIRE(timerService.isScheduled(kTimerID));
+        REQUIRE(timerService.cancel(kTimerID));
+        REQUIRE_FALSE(timerService.isScheduled(kTimerID));
+        REQUIRE_FALSE(timerService.cancel(kTimerID));
+        ioService.run();
+        REQUIRE(calls == vector<int>({2}));
+    }
+
+    SECTION("Earlier callback, scheduled after later one, is not delayed")
+    {
+        const auto kStarted = TimerService::Clock::now();
+        TimerService::Clock::time_point earlierCalled;
+        timerService.schedule(kStarted + chrono::seconds(1), [&] () { calls.push_back(2); });
+        timerService.schedule(kStarted + chrono::milliseconds(5), [&] () {
+            calls.push_back(1);
+            earlierCalled = TimerService::Clock::now();
+            // the later callback is not waited for
+            ioService.stop();
+        });
+        ioService.run();
+        REQUIRE(calls == vector<int>({1}));
+        REQUIRE(earlierCalled - kStarted < chrono::milliseconds(500));
+    }
+
+    SECTION("Callback can schedule and cancel other callbacks")
+    {
+        TimerService::TimerID cancelledID = 0;
+        timerService.schedule(TimerService::Clock::now(), [&] () {
+            calls.push_back(1);
+            timerService.cancel(cancelledID);
+            timerService.schedule(TimerService::Clock::now(), [&] () { calls.push_back(3); });
+        });
+        cancelledID = timerService.schedule(
+            TimerService::Clock::now() + chrono::milliseconds(10),
+            [&] () { calls.push_back(2); });
+        ioService.run();
+        REQUIRE(calls == vector<int>({1, 3}));
+    }
+
+    SECTION("Timer rescheduling replaces pending callback")
+    {
+        TimerService::Timer timer(&timerService);
+        REQUIRE_FALSE(timer.isPending());
+        timer.expiresFromNow(chrono::milliseconds(5), [&] () { calls.push_back(1); });
+        timer.expiresFromNow(chrono::milliseconds(10), [&] () { calls.push_back(2); });
+        REQUIRE(timer.isPending());
+        ioService.run();
+        REQUIRE(calls == vector<int>({2}));
+        REQUIRE_FALSE(timer.isPending());
+    }
+
+    SECTION("Timer can be rescheduled from its own callback")
+    {
+        TimerService::Timer timer(&timerService);
+        function<void()> callback = [&] () {
+            calls.push_back((int)calls.size());
+            if (calls.size() < 3) {
+                timer.expiresFromNow(chrono::milliseconds(1), callback);
+            }
+        };
+        timer.expiresFromNow(chrono::milliseconds(1), callback);
+        ioService.run();
+        REQUIRE(calls == vector<int>({0, 1, 2}));
+    }
+
+    SECTION("Destroyed timer cancels its callback")
+    {
+        {
+            TimerService::Timer timer(&timerService);
+            timer.expiresFromNow(chrono::milliseconds(5), [&] () { calls.push_back(1); });
+        }
+        timerService.schedule(
+            TimerService::Clock::now() + chrono::milliseconds(10),
+            [&] () { calls.push_back(2); });
+        ioService.run();
+        REQUIRE(calls == vector<int>({2}));
+    }
+}
@@ -0,0 +1,118 @@
+#include "../../catch.hpp"
+#include "../../../core/common/workers/WorkersPool.h"
+#include "../../../core/common/exceptions/ValueError.h"
+
+#include <atomic>
+
+TEST_CASE("Testing WorkersPool")
+{
+    as::io_service mainIOService;
+    // main io_service is run only when all handlers are posted
+    as::io_service::work mainWork(mainIOService);
+    vector<int> completed;
+    vector<string> errors;
+
+    auto runMainUntil = [&](size_t handlersCount) {
+        while (completed.size() + errors.size() < handlersCount) {
+            mainIOService.run_one();
+        }
+    };
+
+    SECTION("Error of the task is passed to the failure handler on the main thread")
+    {
+        WorkersPool pool(mainIOService, 2);
+        const auto kMainThreadID = this_thread::get_id();
+        thread::id failureThreadID;
+        pool.post<int>(
+            []() -> int {
+                throw ValueError("wrong value");
+            },
+            [&](int result) {
+                completed.push_back(result);
+            },
+            [&](const string &error) {
+                failureThreadID = this_thread::get_id();
+                errors.push_back(error);
+            });
+        pool.post<int>(
+            []() {
+                return 1;
+            },
+            [&](int result) {
+                completed.push_back(result);
+            },
+            [&](const string &error) {
+                errors.push_back(error);
+            });
+
+        REQUIRE_NOTHROW(runMainUntil(2));
+        REQUIRE(completed == vector<int>({1}));
+        REQUIRE(errors.size() == 1);
+        REQUIRE(errors[0].find("wrong value") != string::npos);
+        REQUIRE(failureThreadID == kMainThreadID);
+    }
+
+    SECTION("Tasks of one equivalent are executed in order of posting, one by one")
+    {
+        WorkersPool pool(mainIOService, 4);
+        const size_t kTasksCount = 100;
+        atomic<size_t> runningTasksCount(0);
+        atomic<bool> isOverlapped(false);
+        for (size_t idx = 0; idx < kTasksCount; idx++) {
+            pool.post<int>(
+                SerializedEquivalent(1),
+                [idx, &runningTasksCount, &isOverlapped]() {
+                    if (runningTasksCount++ != 0) {
+                        isOverlapped = true;
+                    }
+                    this_thread::sleep_for(chrono::microseconds(100));
+                    runningTasksCount--;
+                    return (int)idx;
+                },
+                [&](int result) {
+                    completed.push_back(result);
+                },
+                [&](const string &error) {
+                    errors.push_back(error);
+                });
+        }
+        runMainUntil(kTasksCount);
+        REQUIRE_FALSE(isOverlapped);
+        REQUIRE(errors.empty());
+        for (size_t idx = 0; idx < kTasksCount; idx++) {
+            REQUIRE(completed[idx] == (int)idx);
+        }
+    }
+
+    SECTION("Pool without workers calls handlers in place")
+    {
+        WorkersPool pool(mainIOService, 0);
+        REQUIRE(pool.workersCount() == 0);
+        pool.post<int>(
+            SerializedEquivalent(1),
+            []() {
+                return 7;
+            },
+            [&](int result) {
+                completed.push_back(result);
+            },
+            [&](const string &error) {
+                errors.push_back(error);
+            });
+        REQUIRE(completed == vector<int>({7}));
+
+        REQUIRE_NOTHROW(
+            pool.post<int>(
+                []() -> int {
+                    throw runtime_error("failed in place");
+                },
+                [&](int result) {
+                    completed.push_back(result);
+                },
+                [&](const string &error) {
+                    errors.push_back(error);
+                }));
+        REQUIRE(errors == vector<string>({"failed in place"}));
+        REQUIRE(completed.size() == 1);
+    }
+}
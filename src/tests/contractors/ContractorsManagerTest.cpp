@@ -0,0 +1,141 @@
+#include "../catch.hpp"
+#include "../../core/contractors/ContractorsManager.h"
+
+namespace contractors_manager_test {
+
+// storage directory, removed together with its data base when the test is over
+class TemporaryDirectory {
+
+public:
+    TemporaryDirectory() :
+        mPath(fs::temp_directory_path() / fs::unique_path("contractors-manager-test-%%%%-%%%%"))
+    {}
+
+    ~TemporaryDirectory()
+    {
+        fs::remove_all(mPath);
+    }
+
+    const string path() const
+    {
+        return mPath.string();
+    }
+
+private:
+    fs::path mPath;
+};
+
+BaseAddress::Shared address(
+    const string &fullAddress)
+{
+    return make_shared<IPv4WithPortAddress>(fullAddress);
+}
+
+}
+
+TEST_CASE("Testing ContractorsManager addresses index")
+{
+    using namespace contractors_manager_test;
+    Logger logger;
+    TemporaryDirectory directory;
+    StorageHandler storageHandler(directory.path(), "storageDB", logger);
+    const vector<pair<string, string>> kOwnAddresses = {{"ipv4", "127.0.0.1:2000"}};
+    ContractorsManager manager(kOwnAddresses, &storageHandler, logger);
+
+    const auto kFirstAddress = address("127.0.0.1:2001");
+    const auto kSecondAddress = address("127.0.0.1:2002");
+    const auto kThirdAddress = address("127.0.0.1:2003");
+    auto ioTransaction = storageHandler.beginTransaction();
+
+    SECTION("Contractor is found by equal address, not only by the same object")
+    {
+        const auto kContractor = manager.createContractor(ioTransaction, {kFirstAddress});
+        REQUIRE(manager.contractorIDByAddress(address("127.0.0.1:2001")) == kContractor->getID());
+        REQUIRE(manager.contractorIDByAddress(kSecondAddress) == ContractorsManager::kNotFoundContractorID);
+    }
+
+    SECTION("Contractor is found by addresses only if all its addresses are checked")
+    {
+        const auto kContractor = manager.createContractor(ioTransaction, {kFirstAddress, kSecondAddress});
+
+        vector<BaseAddress::Shared> checkedAddresses = {kFirstAddress};
+        REQUIRE(manager.contractorIDByAddresses(checkedAddresses) == ContractorsManager::kNotFoundContractorID);
+
+        checkedAddresses = {kThirdAddress, address("127.0.0.1:2002"), address("127.0.0.1:2001")};
+        REQUIRE(manager.contractorIDByAddresses(checkedAddresses) == kContractor->getID());
+
+        REQUIRE_THROWS_AS(
+            manager.createContractor(ioTransaction, {kSecondAddress, kFirstAddress}),
+            ValueError);
+    }
+
+    SECTION("Contractor with the lowest id is returned for the shared address")
+    {
+        const auto kFirstContractor = manager.createContractor(ioTransaction, {kFirstAddress, kSecondAddress});
+        const auto kSecondContractor = manager.createContractor(ioTransaction, {kFirstAddress});
+        REQUIRE(kFirstContractor->getID() < kSecondContractor->getID());
+        REQUIRE(manager.contractorIDByAddress(kFirstAddress) == kFirstContractor->getID());
+
+        vector<BaseAddress::Shared> checkedAddresses = {kFirstAddress, kSecondAddress};
+        REQUIRE(manager.contractorIDByAddresses(checkedAddresses) == kFirstContractor->getID());
+
+        manager.removeContractor(ioTransaction, kFirstContractor->getID());
+        REQUIRE(manager.contractorIDByAddress(kFirstAddress) == kSecondContractor->getID());
+        REQUIRE(manager.contractorIDByAddress(kSecondAddress) == ContractorsManager::kNotFoundContractorID);
+    }
+
+    SECTION("Index follows changed addresses")
+    {
+        const auto kContractor = manager.createContractor(ioTransaction, {kFirstAddress});
+        manager.updateContractorAddresses(ioTransaction, kContractor->getID(), {kSecondAddress, kThirdAddress});
+
+        REQUIRE(manager.contractorIDByAddress(kFirstAddress) == ContractorsManager::kNotFoundContractorID);
+        REQUIRE(manager.contractorIDByAddress(kSecondAddress) == kContractor->getID());
+        REQUIRE(manager.contractorIDByAddress(kThirdAddress) == kContractor->getID());
+
+        vector<BaseAddress::Shared> checkedAddresses = {kFirstAddress};
+        REQUIRE(manager.contractorIDByAddresses(checkedAddresses) == ContractorsManager::kNotFoundContractorID);
+    }
+
+    SECTION("Id of the removed contractor is reused")
+    {
+        const auto kFirstContractor = manager.createContractor(ioTransaction, {kFirstAddress});
+        const auto kSecondContractor = manager.createContractor(ioTransaction, {kSecondAddress});
+        const auto kFreedID = kFirstContractor->getID();
+        manager.removeContractor(ioTransaction, kFreedID);
+        REQUIRE_FALSE(manager.contractorPresent(kFreedID));
+        REQUIRE(manager.allContractors().size() == 1);
+
+        const auto kThirdContractor = manager.createContractor(ioTransaction, {kThirdAddress});
+        REQUIRE(kThirdContractor->getID() == kFreedID);
+        REQUIRE(manager.contractorIDByAddress(kFirstAddress) == ContractorsManager::kNotFoundContractorID);
+        REQUIRE(manager.contractorIDByAddress(kThirdAddress) == kFreedID);
+        REQUIRE(manager.contractor(kFreedID) == kThirdContractor);
+        REQUIRE(manager.contractor(kSecondContractor->getID()) == kSecondContractor);
+    }
+
+    SECTION("Trailing removed contractors are not present anymore")
+    {
+        const auto kFirstContractor = manager.createContractor(ioTransaction, {kFirstAddress});
+        const auto kSecondContractor = manager.createContractor(ioTransaction, {kSecondAddress});
+        manager.removeContractor(ioTransaction, kSecondContractor->getID());
+        REQUIRE_FALSE(manager.contractorPresent(kSecondContractor->getID()));
+        REQUIRE_THROWS_AS(manager.contractorAddresses(kSecondContractor->getID()), NotFoundError);
+        REQUIRE(manager.allContractors() == vector<Contractor::Shared>({kFirstContractor}));
+    }
+
+    SECTION("Index is rebuilt on loading from the storage")
+    {
+        const auto kFirstContractor = manager.createContractor(ioTransaction, {kFirstAddress, kSecondAddress});
+        const auto kSecondContractor = manager.createContractor(ioTransaction, {kThirdAddress});
+        ioTransaction = nullptr;
+
+        ContractorsManager loadedManager(kOwnAddresses, &storageHandler, logger);
+        REQUIRE(loadedManager.allContractors().size() == 2);
+        REQUIRE(loadedManager.contractorIDByAddress(kSecondAddress) == kFirstContractor->getID());
+        REQUIRE(loadedManager.contractorIDByAddress(kThirdAddress) == kSecondContractor->getID());
+
+        vector<BaseAddress::Shared> checkedAddresses = {kFirstAddress, kSecondAddress};
+        REQUIRE(loadedManager.contractorIDByAddresses(checkedAddresses) == kFirstContractor->getID());
+    }
+}
@@ -0,0 +1,163 @@
+#include "../catch.hpp"
+#include "../../core/crypto/memory.h"
+
+namespace secure_arena_test {
+
+using namespace crypto::memory;
+
+const size_t kSlotSize = 64;
+const size_t kChunkSlotsCount = 4;
+
+// exposes unlocks counters of the chunks
+class InspectedSecureArena : public SecureArena {
+
+public:
+    InspectedSecureArena() :
+        SecureArena(kSlotSize, kChunkSlotsCount)
+    {}
+
+    size_t chunksCount()
+    {
+        return mChunks.size();
+    }
+
+    size_t unlocksCount(
+        byte *slot)
+    {
+        return chunkOfSlot(slot).mUnlocksCount;
+    }
+
+    bool areAllChunksLocked()
+    {
+        for (const auto &chunk : mChunks) {
+            if (chunk.mUnlocksCount != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+void fillSegment(
+    SecureSegment &segment,
+    byte value)
+{
+    auto guard = segment.unlockAndInitGuard();
+    memset(guard.address(), value, segment.size());
+}
+
+bool isSegmentFilledWith(
+    SecureSegment &segment,
+    byte value)
+{
+    auto guard = segment.unlockAndInitGuard();
+    for (size_t idx = 0; idx < segment.size(); idx++) {
+        if (guard.address()[idx] != value) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+TEST_CASE("Testing SecureArena")
+{
+    using namespace secure_arena_test;
+    REQUIRE(sodium_init() != -1);
+    InspectedSecureArena arena;
+
+    SECTION("Freed slot is zeroed and reused")
+    {
+        byte *slotAddress;
+        {
+            SecureSegment segment(arena);
+            slotAddress = segment.address();
+            REQUIRE(segment.size() == kSlotSize);
+            fillSegment(segment, 0xAB);
+            REQUIRE(isSegmentFilledWith(segment, 0xAB));
+            REQUIRE(arena.usedSlotsCount() == 1);
+        }
+        REQUIRE(arena.usedSlotsCount() == 0);
+
+        SecureSegment segment(arena);
+        REQUIRE(segment.address() == slotAddress);
+        REQUIRE(isSegmentFilledWith(segment, 0));
+        REQUIRE(arena.chunksCount() == 1);
+    }
+
+    SECTION("Slots are taken from the next chunk only when current one is full")
+    {
+        vector<unique_ptr<SecureSegment>> segments;
+        for (size_t idx = 0; idx < kChunkSlotsCount; idx++) {
+            segments.push_back(make_unique<SecureSegment>(arena));
+        }
+        REQUIRE(arena.chunksCount() == 1);
+        segments.push_back(make_unique<SecureSegment>(arena));
+        REQUIRE(arena.chunksCount() == 2);
+        REQUIRE(arena.allocatedBytesCount() == 2 * kChunkSlotsCount * kSlotSize);
+
+        // slots of the same chunk do not overlap
+        for (size_t idx = 0; idx < segments.size(); idx++) {
+            fillSegment(*segments[idx], (byte)idx);
+        }
+        for (size_t idx = 0; idx < segments.size(); idx++) {
+            REQUIRE(isSegmentFilledWith(*segments[idx], (byte)idx));
+        }
+    }
+
+    SECTION("Guards of the slots of one chunk are reference counted")
+    {
+        SecureSegment first(arena);
+        SecureSegment second(arena);
+        REQUIRE(arena.unlocksCount(first.address()) == 0);
+        {
+            auto firstGuard = first.unlockAndInitGuard();
+            REQUIRE(arena.unlocksCount(first.address()) == 1);
+            {
+                auto secondGuard = second.unlockAndInitGuard();
+                REQUIRE(arena.unlocksCount(first.address()) == 2);
+            }
+            // chunk stays unlocked while the first guard is alive
+            REQUIRE(arena.unlocksCount(first.address()) == 1);
+            firstGuard.address()[0] = 1;
+        }
+        REQUIRE(arena.areAllChunksLocked());
+    }
+
+    SECTION("Unlock scope keeps chunks unlocked and locks them back")
+    {
+        SecureSegment first(arena);
+        {
+            SecureArena::UnlockScope outerScope(arena);
+            REQUIRE(arena.unlocksCount(first.address()) == 1);
+            {
+                SecureArena::UnlockScope innerScope(arena);
+                REQUIRE(arena.unlocksCount(first.address()) == 2);
+
+                // chunk, allocated inside the scopes, is unlocked as the other ones
+                vector<unique_ptr<SecureSegment>> segments;
+                for (size_t idx = 0; idx < kChunkSlotsCount; idx++) {
+                    segments.push_back(make_unique<SecureSegment>(arena));
+                }
+                REQUIRE(arena.chunksCount() == 2);
+                REQUIRE(arena.unlocksCount(segments.back()->address()) == 2);
+
+                fillSegment(*segments.back(), 0xCD);
+                REQUIRE(arena.unlocksCount(segments.back()->address()) == 2);
+            }
+            REQUIRE(arena.unlocksCount(first.address()) == 1);
+        }
+        REQUIRE(arena.areAllChunksLocked());
+
+        // slots, freed inside the scopes, are zeroed too
+        vector<unique_ptr<SecureSegment>> segments;
+        for (size_t idx = 0; idx < kChunkSlotsCount; idx++) {
+            segments.push_back(make_unique<SecureSegment>(arena));
+        }
+        for (const auto &segment : segments) {
+            REQUIRE(isSegmentFilledWith(*segment, 0));
+        }
+        REQUIRE(arena.areAllChunksLocked());
+    }
+}
@@ -0,0 +1,98 @@
+#include "../../catch.hpp"
+#include "../../../core/interface/results_interface/result/CommandResult.h"
+
+TEST_CASE("Testing streamed CommandResult serialization")
+{
+    const CommandUUID kCommandUUID;
+    const string kHeader = kCommandUUID.stringUUID() + kTokensSeparator + "200" + kTokensSeparator;
+
+    SECTION("Streamed result is serialized the same way several times")
+    {
+        vector<int> records;
+        records.push_back(1);
+        records.push_back(2);
+        records.push_back(3);
+        CommandResult result(
+            "TEST",
+            kCommandUUID,
+            200,
+            CommandResult::recordsChunks<int>(
+                records,
+                [] (stringstream &stream, const int &kRecord) {
+                    stream << kRecord;
+                },
+                "end"));
+
+        const auto kExpected = kHeader + "3\t1\t2\t3\tend" + kCommandsSeparator;
+        REQUIRE(result.isStreamed());
+        REQUIRE(result.serialize() == kExpected);
+        REQUIRE(result.serialize() == kExpected);
+
+        // source records are copied into the result, so their changes don't affect it
+        records.clear();
+        CommandResult::ChunksStream stream(result);
+        string chunk;
+        while (stream.serializeNextChunk(chunk)) {}
+        REQUIRE(chunk == kExpected);
+        REQUIRE_FALSE(stream.serializeNextChunk(chunk));
+        REQUIRE(chunk == kExpected);
+    }
+
+    SECTION("Huge result is split into several chunks")
+    {
+        const size_t kRecordsCount = 3 * CommandResult::kStreamChunkSize / 8;
+        vector<string> records(kRecordsCount, string("record"));
+        CommandResult result(
+            "TEST",
+            kCommandUUID,
+            200,
+            CommandResult::recordsChunks<string>(
+                records,
+                [] (stringstream &stream, const string &kRecord) {
+                    stream << kRecord;
+                }));
+
+        CommandResult::ChunksStream stream(result);
+        size_t chunksCount = 0;
+        string serializedResult;
+        bool isNotFinished;
+        do {
+            string chunk;
+            isNotFinished = stream.serializeNextChunk(chunk);
+            REQUIRE(chunk.size() <= kHeader.size() + CommandResult::kStreamChunkSize + 8);
+            serializedResult += chunk;
+            chunksCount++;
+        } while (isNotFinished);
+
+        REQUIRE(chunksCount > 1);
+        REQUIRE(serializedResult == result.serialize());
+        REQUIRE(serializedResult.size() == kHeader.size() + to_string(kRecordsCount).size() + kRecordsCount * 7 + 1);
+    }
+
+    SECTION("Empty streamed result contains only records count")
+    {
+        CommandResult result(
+            "TEST",
+            kCommandUUID,
+            200,
+            CommandResult::recordsChunks<int>(
+                vector<int>(),
+                [] (stringstream &stream, const int &kRecord) {
+                    stream << kRecord;
+                }));
+        REQUIRE(result.serialize() == kHeader + "0" + kCommandsSeparator);
+    }
+
+    SECTION("Not streamed result is written by one chunk")
+    {
+        CommandResult result(
+            "TEST",
+            kCommandUUID,
+            200,
+            string("1\t2"));
+        CommandResult::ChunksStream stream(result);
+        string chunk;
+        REQUIRE_FALSE(stream.serializeNextChunk(chunk));
+        REQUIRE(chunk == kHeader + "1\t2" + kCommandsSeparator);
+    }
+}
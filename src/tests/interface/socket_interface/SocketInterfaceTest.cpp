@@ -0,0 +1,108 @@
+#include "../../catch.hpp"
+#include "../../../core/interface/socket_interface/interface/SocketInterface.h"
+
+#include <thread>
+
+namespace socket_interface_test {
+
+const string kSocketPath = "/tmp/geo_socket_interface_test.sock";
+const string kCommandUUID = "47183823-2574-4bfd-b411-99ed177d3e43";
+
+class TestSocketInterface:
+    public SocketInterface {
+
+public:
+    using SocketInterface::SocketInterface;
+
+    size_t routedCommandsCount() const
+    {
+        return mSessionsByCommandUUID.size();
+    }
+
+    size_t sessionsCount() const
+    {
+        return mSessions.size();
+    }
+};
+
+// processes ready handlers until the condition is met (or about one second passed)
+bool pollUntil(
+    as::io_service &ioService,
+    function<bool()> condition)
+{
+    for (size_t attempt = 0; attempt < 1000; attempt++) {
+        ioService.poll();
+        ioService.reset();
+        if (condition()) {
+            return true;
+        }
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    return false;
+}
+
+}
+
+TEST_CASE("Testing SocketInterface results routing")
+{
+    using namespace socket_interface_test;
+
+    as::io_service ioService;
+    Logger logger;
+    TestSocketInterface socketInterface(
+        ioService,
+        kSocketPath,
+        "",
+        0,
+        logger);
+    socketInterface.beginAcceptConnections();
+
+    vector<BaseUserCommand::Shared> receivedCommands;
+    socketInterface.commandReceivedSignal.connect(
+        [&receivedCommands] (bool, BaseUserCommand::Shared command) {
+            receivedCommands.push_back(command);
+        });
+
+    as::local::stream_protocol::socket client(ioService);
+    client.connect(as::local::stream_protocol::endpoint(kSocketPath));
+    REQUIRE(pollUntil(ioService, [&] { return socketInterface.sessionsCount() == 1; }));
+
+    const string kCommand = kCommandUUID + "\tGET:equivalents\n";
+
+    SECTION("Command with UUID of pending command is rejected")
+    {
+        as::write(client, as::buffer(kCommand + kCommand));
+        REQUIRE(pollUntil(ioService, [&] { return client.available() > 0; }));
+        REQUIRE(receivedCommands.size() == 1);
+        REQUIRE(socketInterface.routedCommandsCount() == 1);
+
+        string response(client.available(), '\0');
+        client.read_some(as::buffer(&response[0], response.size()));
+        REQUIRE(response == kCommandUUID + "\t401\n");
+
+        // result of the first command is still routed to the client
+        REQUIRE(socketInterface.writeResult(receivedCommands.front()->responseOK()));
+        REQUIRE(socketInterface.routedCommandsCount() == 0);
+        REQUIRE(pollUntil(ioService, [&] { return client.available() > 0; }));
+        response.resize(client.available());
+        client.read_some(as::buffer(&response[0], response.size()));
+        REQUIRE(response == kCommandUUID + "\t200\n");
+
+        // UUID may be used again after the result was written
+        as::write(client, as::buffer(kCommand));
+        REQUIRE(pollUntil(ioService, [&] { return receivedCommands.size() == 2; }));
+        REQUIRE(socketInterface.routedCommandsCount() == 1);
+    }
+
+    SECTION("Commands of closed session are forgotten")
+    {
+        as::write(client, as::buffer(kCommand));
+        REQUIRE(pollUntil(ioService, [&] { return receivedCommands.size() == 1; }));
+        REQUIRE(socketInterface.routedCommandsCount() == 1);
+
+        client.close();
+        REQUIRE(pollUntil(ioService, [&] { return socketInterface.sessionsCount() == 0; }));
+        REQUIRE(socketInterface.routedCommandsCount() == 0);
+        REQUIRE_FALSE(socketInterface.writeResult(receivedCommands.front()->responseOK()));
+    }
+}
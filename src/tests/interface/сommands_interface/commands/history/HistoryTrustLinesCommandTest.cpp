@@ -92,4 +92,31 @@ TEST_CASE("Testing HistoryTrustLinesCommand")
 
         REQUIRE_THROWS(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "1\t2\t3\t4\t5"));
     }
+
+    SECTION("Cursor")
+    {
+        REQUIRE_FALSE(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "1\t2\t3\t4\t5\n").isCursorPresent());
+
+        REQUIRE(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\tnull\n").isCursorPresent());
+
+        REQUIRE_FALSE(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\tnull\n").cursor().isPositioned());
+
+        REQUIRE(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\t123:45\n").cursor().toString() == "123:45");
+
+        REQUIRE(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\tend\n").cursor().isExhausted());
+
+        REQUIRE(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\tend\n").cursor().toString() == "end");
+
+        REQUIRE(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\tnull\n").cursor().toString() == "null");
+
+        REQUIRE_THROWS(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "1\t2\t3\t4\t5\tnull\n"));
+
+        REQUIRE_THROWS(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "1\t2\t3\t4\t5\t123:45\n"));
+
+        REQUIRE_THROWS(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\t123\n"));
+
+        REQUIRE_THROWS(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\t:45\n"));
+
+        REQUIRE_THROWS(HistoryTrustLinesCommand("47183823-2574-4bfd-b411-99ed177d3e43"s, "0\t2\t3\t4\t5\t\n"));
+    }
 }
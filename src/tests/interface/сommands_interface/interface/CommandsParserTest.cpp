@@ -0,0 +1,141 @@
+#include "../../../catch.hpp"
+#include "../../../../core/interface/commands_interface/interface/CommandsInterface.h"
+
+namespace commands_parser_test {
+
+const string kCommandUUID = "47183823-2574-4bfd-b411-99ed177d3e43";
+
+string textTrustLinesCommand()
+{
+    return kCommandUUID + "\tGET:contractors/trust-lines\t1\t2\t3\n";
+}
+
+string binaryTrustLinesCommand()
+{
+    const string kBody = "1\t2\t3\n";
+    const uint32_t kFrameLength = (uint32_t)(sizeof(uint16_t) + NodeUUID::kBytesSize + kBody.size());
+    const auto kUUID = boost::lexical_cast<uuid>(kCommandUUID);
+
+    string frame;
+    frame.push_back(CommandsParser::kBinaryFrameMarker);
+    frame.push_back((char)(kFrameLength >> 24));
+    frame.push_back((char)(kFrameLength >> 16));
+    frame.push_back((char)(kFrameLength >> 8));
+    frame.push_back((char)kFrameLength);
+    frame.push_back((char)(CommandsParser::GetTrustLines >> 8));
+    frame.push_back((char)CommandsParser::GetTrustLines);
+    frame.append(kUUID.begin(), kUUID.end());
+    frame.append(kBody);
+    return frame;
+}
+
+void requireTrustLinesCommand(
+    const pair<bool, BaseUserCommand::Shared> &flagAndCommand)
+{
+    REQUIRE(flagAndCommand.first);
+    auto command = dynamic_pointer_cast<GetTrustLinesCommand>(flagAndCommand.second);
+    REQUIRE(command != nullptr);
+    REQUIRE(command->UUID().stringUUID() == kCommandUUID);
+    REQUIRE(command->from() == 1);
+    REQUIRE(command->count() == 2);
+    REQUIRE(command->equivalent() == 3);
+}
+
+void requireNoCommand(
+    const pair<bool, BaseUserCommand::Shared> &flagAndCommand)
+{
+    REQUIRE_FALSE(flagAndCommand.first);
+    REQUIRE(flagAndCommand.second == nullptr);
+}
+
+void requireErrorCommand(
+    const pair<bool, BaseUserCommand::Shared> &flagAndCommand)
+{
+    REQUIRE_FALSE(flagAndCommand.first);
+    REQUIRE(dynamic_pointer_cast<ErrorUserCommand>(flagAndCommand.second) != nullptr);
+}
+
+}
+
+TEST_CASE("Testing CommandsParser")
+{
+    using namespace commands_parser_test;
+
+    Logger logger;
+    CommandsParser parser(logger);
+
+    SECTION("Text command split into several reads waits for the separator")
+    {
+        const auto kCommand = textTrustLinesCommand();
+        // split inside the UUID, inside the identifier and right before the separator
+        const vector<size_t> kSplitPoints = {10, 45, kCommand.size() - 1};
+        size_t offset = 0;
+        for (const auto kSplitPoint : kSplitPoints) {
+            parser.appendReadData(kCommand.data() + offset, kSplitPoint - offset);
+            requireNoCommand(parser.processReceivedCommands());
+            offset = kSplitPoint;
+        }
+        parser.appendReadData(kCommand.data() + offset, kCommand.size() - offset);
+        requireTrustLinesCommand(parser.processReceivedCommands());
+        requireNoCommand(parser.processReceivedCommands());
+    }
+
+    SECTION("Binary frame received byte by byte")
+    {
+        const auto kFrame = binaryTrustLinesCommand();
+        for (size_t idx = 0; idx < kFrame.size() - 1; idx++) {
+            parser.appendReadData(kFrame.data() + idx, 1);
+            requireNoCommand(parser.processReceivedCommands());
+        }
+        parser.appendReadData(kFrame.data() + kFrame.size() - 1, 1);
+        requireTrustLinesCommand(parser.processReceivedCommands());
+        requireNoCommand(parser.processReceivedCommands());
+    }
+
+    SECTION("Several mixed commands received by one read, the last one partially")
+    {
+        const auto kText = textTrustLinesCommand();
+        const auto kFrame = binaryTrustLinesCommand();
+        const auto kData = kText + kFrame + kText + kFrame + kText;
+        const size_t kFirstReadSize = kData.size() - 5;
+
+        parser.appendReadData(kData.data(), kFirstReadSize);
+        for (size_t idx = 0; idx < 4; idx++) {
+            requireTrustLinesCommand(parser.processReceivedCommands());
+        }
+        requireNoCommand(parser.processReceivedCommands());
+
+        parser.appendReadData(kData.data() + kFirstReadSize, kData.size() - kFirstReadSize);
+        requireTrustLinesCommand(parser.processReceivedCommands());
+        requireNoCommand(parser.processReceivedCommands());
+    }
+
+    SECTION("Invalid commands are skipped up to the next command")
+    {
+        const auto kData =
+            string("short\n") +
+            "not-a-uuid-not-a-uuid-not-a-uuid-not\tGET:contractors/trust-lines\t1\t2\t3\n" +
+            kCommandUUID + "\tUNKNOWN:command\t1\n" +
+            kCommandUUID + "\tGET:contractors/trust-lines\ta\t2\t3\n" +
+            textTrustLinesCommand();
+
+        parser.appendReadData(kData.data(), kData.size());
+        for (size_t idx = 0; idx < 4; idx++) {
+            requireErrorCommand(parser.processReceivedCommands());
+        }
+        requireTrustLinesCommand(parser.processReceivedCommands());
+        requireNoCommand(parser.processReceivedCommands());
+    }
+
+    SECTION("Binary frame with invalid length is skipped")
+    {
+        auto frame = binaryTrustLinesCommand();
+        frame[4] = 1;
+        const auto kData = frame + textTrustLinesCommand();
+
+        parser.appendReadData(kData.data(), kData.size());
+        requireErrorCommand(parser.processReceivedCommands());
+        requireTrustLinesCommand(parser.processReceivedCommands());
+        requireNoCommand(parser.processReceivedCommands());
+    }
+}
@@ -0,0 +1,165 @@
+#include "../../catch.hpp"
+#include "../../../core/io/storage/HistoryStorage.h"
+#include "../../../core/contractors/addresses/IPv4WithPortAddress.h"
+
+namespace history_storage_migration_test {
+
+const string kMainTableName = "history";
+const string kAdditionalTableName = "history_additional";
+
+void executeQuery(
+    sqlite3 *dataBase,
+    const string &query)
+{
+    REQUIRE(sqlite3_exec(dataBase, query.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK);
+}
+
+// creates tables in the layout used before amount and contractors columns were introduced
+void createPreviousVersionTables(
+    sqlite3 *dataBase)
+{
+    executeQuery(
+        dataBase,
+        "CREATE TABLE " + kMainTableName +
+            "(operation_uuid BLOB NOT NULL, "
+                "operation_timestamp INTEGER NOT NULL, "
+                "record_type INTEGER NOT NULL, "
+                "record_body BLOB NOT NULL, "
+                "record_body_bytes_count INT NOT NULL, "
+                "equivalent INTEGER NOT NULL, "
+                "command_uuid BLOB);");
+    executeQuery(
+        dataBase,
+        "CREATE TABLE " + kAdditionalTableName +
+            "(operation_uuid BLOB NOT NULL, "
+                "operation_timestamp INTEGER NOT NULL, "
+                "record_type INTEGER NOT NULL, "
+                "record_body BLOB NOT NULL, "
+                "record_body_bytes_count INT NOT NULL, "
+                "equivalent INTEGER NOT NULL);");
+}
+
+void insertPreviousVersionRecord(
+    sqlite3 *dataBase,
+    const TransactionUUID &operationUUID,
+    int recordType,
+    const pair<BytesShared, size_t> &recordBody)
+{
+    string query = "INSERT INTO " + kMainTableName +
+                   "(operation_uuid, operation_timestamp, record_type, record_body, "
+                   "record_body_bytes_count, equivalent) VALUES(?, 1, ?, ?, ?, 0);";
+    sqlite3_stmt *stmt;
+    REQUIRE(sqlite3_prepare_v2(dataBase, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK);
+    sqlite3_bind_blob(stmt, 1, operationUUID.data, TransactionUUID::kBytesSize, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, recordType);
+    sqlite3_bind_blob(stmt, 3, recordBody.first.get(), (int)recordBody.second, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 4, (int)recordBody.second);
+    REQUIRE(sqlite3_step(stmt) == SQLITE_DONE);
+    sqlite3_finalize(stmt);
+}
+
+bool isColumnPresent(
+    sqlite3 *dataBase,
+    const string &tableName,
+    const string &columnName)
+{
+    string query = "PRAGMA table_info(" + tableName + ");";
+    sqlite3_stmt *stmt;
+    REQUIRE(sqlite3_prepare_v2(dataBase, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK);
+    bool result = false;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        if (columnName == (const char *)sqlite3_column_text(stmt, 1)) {
+            result = true;
+        }
+    }
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+size_t rowsCount(
+    sqlite3 *dataBase,
+    const string &query)
+{
+    sqlite3_stmt *stmt;
+    REQUIRE(sqlite3_prepare_v2(dataBase, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK);
+    size_t result = 0;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        result++;
+    }
+    sqlite3_finalize(stmt);
+    return result;
+}
+
+}
+
+TEST_CASE("Testing HistoryStorage migration to columnar fields")
+{
+    using namespace history_storage_migration_test;
+
+    Logger logger;
+    sqlite3 *dataBase;
+    REQUIRE(sqlite3_open_v2(":memory:", &dataBase, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) == SQLITE_OK);
+    createPreviousVersionTables(dataBase);
+
+    vector<BaseAddress::Shared> addresses;
+    addresses.push_back(make_shared<IPv4WithPortAddress>("127.0.0.1:2000"));
+    auto contractor = make_shared<Contractor>(addresses);
+    TrustLineRecord record(
+        TransactionUUID(),
+        TrustLineRecord::Setting,
+        contractor,
+        TrustLineAmount(1500));
+
+    SECTION("Amount and contractors are restored from records bodies")
+    {
+        insertPreviousVersionRecord(
+            dataBase,
+            record.operationUUID(),
+            Record::TrustLineRecordType,
+            record.serializedHistoryRecordBody());
+
+        REQUIRE_NOTHROW(HistoryStorage(dataBase, kMainTableName, kAdditionalTableName, logger));
+        REQUIRE(isColumnPresent(dataBase, kMainTableName, "amount"));
+        REQUIRE(isColumnPresent(dataBase, kAdditionalTableName, "amount"));
+
+        auto serializedAmount = trustLineAmountToBytes(TrustLineAmount(1500));
+        sqlite3_stmt *stmt;
+        string query = "SELECT amount FROM " + kMainTableName + ";";
+        REQUIRE(sqlite3_prepare_v2(dataBase, query.c_str(), -1, &stmt, nullptr) == SQLITE_OK);
+        REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+        REQUIRE(sqlite3_column_bytes(stmt, 0) == (int)kTrustLineAmountBytesCount);
+        REQUIRE(memcmp(sqlite3_column_blob(stmt, 0), serializedAmount.data(), kTrustLineAmountBytesCount) == 0);
+        sqlite3_finalize(stmt);
+
+        REQUIRE(rowsCount(
+            dataBase,
+            "SELECT * FROM " + kMainTableName + "_contractors WHERE address = '127.0.0.1:2000';") == 1);
+
+        // second launch should not migrate again
+        REQUIRE_NOTHROW(HistoryStorage(dataBase, kMainTableName, kAdditionalTableName, logger));
+        REQUIRE(rowsCount(dataBase, "SELECT * FROM " + kMainTableName + "_contractors;") == 1);
+    }
+
+    SECTION("Failed migration leaves previous schema untouched")
+    {
+        insertPreviousVersionRecord(
+            dataBase,
+            record.operationUUID(),
+            Record::TrustLineRecordType,
+            record.serializedHistoryRecordBody());
+        // record of unknown type interrupts migration after amount column was already added
+        insertPreviousVersionRecord(
+            dataBase,
+            TransactionUUID(),
+            255,
+            record.serializedHistoryRecordBody());
+
+        REQUIRE_THROWS(HistoryStorage(dataBase, kMainTableName, kAdditionalTableName, logger));
+        REQUIRE_FALSE(isColumnPresent(dataBase, kMainTableName, "amount"));
+        REQUIRE_FALSE(isColumnPresent(dataBase, kAdditionalTableName, "amount"));
+        REQUIRE(rowsCount(dataBase, "SELECT * FROM " + kMainTableName + "_contractors;") == 0);
+        REQUIRE(rowsCount(dataBase, "SELECT * FROM " + kMainTableName + ";") == 2);
+    }
+
+    sqlite3_close_v2(dataBase);
+}
@@ -0,0 +1,93 @@
+#include "../../catch.hpp"
+#include "../../../core/io/storage/HistoryStorage.h"
+#include "../../../core/contractors/addresses/IPv4WithPortAddress.h"
+
+TEST_CASE("Testing HistoryStorage pages reading by cursor")
+{
+    Logger logger;
+    sqlite3 *dataBase;
+    REQUIRE(sqlite3_open_v2(":memory:", &dataBase, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) == SQLITE_OK);
+    HistoryStorage historyStorage(dataBase, "history", "history_additional", logger);
+
+    const SerializedEquivalent kEquivalent = 0;
+    const size_t kRecordsCount = 5;
+    vector<BaseAddress::Shared> addresses;
+    addresses.push_back(make_shared<IPv4WithPortAddress>("127.0.0.1:2000"));
+    auto contractor = make_shared<Contractor>(addresses);
+    // records are saved in the same moment, so their order is defined only by record id
+    for (size_t idx = 1; idx <= kRecordsCount; idx++) {
+        historyStorage.saveTrustLineRecord(
+            make_shared<TrustLineRecord>(
+                TransactionUUID(),
+                TrustLineRecord::Setting,
+                contractor,
+                TrustLineAmount(idx)),
+            kEquivalent);
+    }
+
+    auto readPage = [&](HistoryCursor::Shared cursor, size_t pageSize, size_t offset) {
+        return historyStorage.allTrustLineRecords(
+            kEquivalent,
+            pageSize,
+            offset,
+            DateTime(),
+            false,
+            DateTime(),
+            false,
+            cursor);
+    };
+
+    SECTION("Pages are read until the cursor is exhausted")
+    {
+        auto cursor = make_shared<HistoryCursor>();
+        REQUIRE(cursor->toString() == HistoryCursor::kFirstPageToken);
+
+        auto page = readPage(cursor, 2, 0);
+        REQUIRE(page.size() == 2);
+        REQUIRE(page[0]->amount() == TrustLineAmount(5));
+        REQUIRE(page[1]->amount() == TrustLineAmount(4));
+        REQUIRE(cursor->isPositioned());
+
+        page = readPage(cursor, 2, 0);
+        REQUIRE(page.size() == 2);
+        REQUIRE(page[0]->amount() == TrustLineAmount(3));
+        REQUIRE(page[1]->amount() == TrustLineAmount(2));
+        REQUIRE(cursor->isPositioned());
+
+        // page shorter than the limit is the last one
+        page = readPage(cursor, 2, 0);
+        REQUIRE(page.size() == 1);
+        REQUIRE(page[0]->amount() == TrustLineAmount(1));
+        REQUIRE(cursor->isExhausted());
+        REQUIRE(cursor->toString() == HistoryCursor::kExhaustedToken);
+
+        page = readPage(cursor, 2, 0);
+        REQUIRE(page.empty());
+        REQUIRE(cursor->isExhausted());
+    }
+
+    SECTION("Full last page is followed by empty exhausted one")
+    {
+        auto cursor = make_shared<HistoryCursor>();
+        REQUIRE(readPage(cursor, kRecordsCount, 0).size() == kRecordsCount);
+        REQUIRE(cursor->isPositioned());
+
+        REQUIRE(readPage(cursor, kRecordsCount, 0).empty());
+        REQUIRE(cursor->isExhausted());
+    }
+
+    SECTION("Offset is not applied to the cursor")
+    {
+        auto cursor = make_shared<HistoryCursor>();
+        auto page = readPage(cursor, 2, 3);
+        REQUIRE(page.size() == 2);
+        REQUIRE(page[0]->amount() == TrustLineAmount(5));
+
+        // without cursor offset still works
+        page = readPage(nullptr, 2, 3);
+        REQUIRE(page.size() == 2);
+        REQUIRE(page[0]->amount() == TrustLineAmount(2));
+    }
+
+    sqlite3_close_v2(dataBase);
+}
@@ -0,0 +1,160 @@
+#include "../../catch.hpp"
+#include "../../../core/network/communicator/internal/incoming/IncomingNodesHandler.h"
+
+namespace incoming_remote_node_test {
+
+// exposes budgets of the remote node
+class InspectedIncomingRemoteNode : public IncomingRemoteNode {
+
+public:
+    using IncomingRemoteNode::IncomingRemoteNode;
+    using IncomingRemoteNode::kMaxMalformedPacketsCount;
+    using IncomingRemoteNode::kMaxPacketsBurst;
+
+    size_t channelsCount() const
+    {
+        return mChannels.size();
+    }
+};
+
+class InspectedIncomingNodesHandler : public IncomingNodesHandler {
+
+public:
+    using IncomingNodesHandler::IncomingNodesHandler;
+    using IncomingNodesHandler::kMaxNodesCount;
+};
+
+const UDPEndpoint kEndpoint(boost::asio::ip::address_v4::from_string("127.0.0.1"), 2000);
+
+// first packet of the message of two packets, so it is buffered by the channel and is never collected
+vector<byte> bufferedPacket(
+    PacketHeader::ChannelIndex channelIndex)
+{
+    const size_t kBodySize = 8;
+    vector<byte> packet(PacketHeader::kSize + kBodySize, 0);
+    *reinterpret_cast<PacketHeader::PacketSize*>(packet.data() + PacketHeader::kPacketSizeOffset) =
+        (PacketHeader::PacketSize)packet.size();
+    *reinterpret_cast<PacketHeader::ChannelIndex*>(packet.data() + PacketHeader::kChannelIndexOffset) =
+        channelIndex;
+    *reinterpret_cast<PacketHeader::TotalPacketsCount*>(packet.data() + PacketHeader::kPacketsCountOffset) = 2;
+    *reinterpret_cast<PacketHeader::PacketIndex*>(packet.data() + PacketHeader::kPacketIndexOffset) = 0;
+    return packet;
+}
+
+vector<byte> malformedPacket()
+{
+    auto packet = bufferedPacket(0);
+    // packet size can't be less than header size
+    *reinterpret_cast<PacketHeader::PacketSize*>(packet.data() + PacketHeader::kPacketSizeOffset) = 1;
+    return packet;
+}
+
+void send(
+    IncomingRemoteNode &node,
+    const vector<byte> &datagram)
+{
+    node.processIncomingBytesSequence(
+        datagram.data(),
+        datagram.size());
+}
+
+}
+
+TEST_CASE("Testing IncomingRemoteNode budgets")
+{
+    using namespace incoming_remote_node_test;
+    Logger logger;
+    InspectedIncomingRemoteNode node(kEndpoint, logger);
+
+    SECTION("Malformed packets are tolerated until their budget is exceeded")
+    {
+        for (size_t idx = 0; idx < InspectedIncomingRemoteNode::kMaxMalformedPacketsCount; idx++) {
+            send(node, malformedPacket());
+            REQUIRE_FALSE(node.isBanned());
+        }
+        REQUIRE(node.droppedPacketsCount() == InspectedIncomingRemoteNode::kMaxMalformedPacketsCount);
+
+        // valid packets are still processed
+        send(node, bufferedPacket(1));
+        REQUIRE(node.channelsCount() == 1);
+
+        send(node, malformedPacket());
+        REQUIRE(node.isBanned());
+        REQUIRE(node.channelsCount() == 0);
+    }
+
+    SECTION("Packets of banned node are dropped")
+    {
+        for (size_t idx = 0; idx <= InspectedIncomingRemoteNode::kMaxMalformedPacketsCount; idx++) {
+            send(node, malformedPacket());
+        }
+        REQUIRE(node.isBanned());
+        const auto kDroppedPacketsCount = node.droppedPacketsCount();
+
+        send(node, bufferedPacket(1));
+        REQUIRE(node.channelsCount() == 0);
+        REQUIRE(node.droppedPacketsCount() == kDroppedPacketsCount + 1);
+    }
+
+    SECTION("Tokens are charged per packet, not per datagram")
+    {
+        // each datagram contains several packets of different channels
+        const size_t kPacketsPerDatagram = 8;
+        vector<byte> datagram;
+        for (size_t idx = 0; idx < kPacketsPerDatagram; idx++) {
+            const auto kPacket = bufferedPacket((PacketHeader::ChannelIndex)idx);
+            datagram.insert(datagram.end(), kPacket.begin(), kPacket.end());
+        }
+        send(node, datagram);
+        REQUIRE(node.channelsCount() == kPacketsPerDatagram);
+
+        // datagrams count is less than the burst, but their packets count is greater
+        const size_t kDatagramsCount = InspectedIncomingRemoteNode::kMaxPacketsBurst / kPacketsPerDatagram * 2;
+        for (size_t idx = 0; idx < kDatagramsCount and not node.isBanned(); idx++) {
+            send(node, datagram);
+        }
+        REQUIRE(node.isBanned());
+    }
+}
+
+TEST_CASE("Testing IncomingNodesHandler limit of remote nodes")
+{
+    using namespace incoming_remote_node_test;
+    Logger logger;
+    InspectedIncomingNodesHandler nodesHandler(logger);
+
+    const auto kAddress = boost::asio::ip::address_v4::from_string("10.0.0.1");
+    for (size_t idx = 0; idx < InspectedIncomingNodesHandler::kMaxNodesCount; idx++) {
+        // endpoints of the same address differ only by port
+        REQUIRE(nodesHandler.handler(UDPEndpoint(kAddress, (unsigned short)(1000 + idx))) != nullptr);
+    }
+    const UDPEndpoint kFirstEndpoint(kAddress, 1000);
+    const auto kFirstNode = nodesHandler.handler(kFirstEndpoint);
+    REQUIRE(kFirstNode != nullptr);
+    REQUIRE(kFirstNode->endpoint() == kFirstEndpoint);
+
+    const UDPEndpoint kNewEndpoint(
+        boost::asio::ip::address_v4::from_string("10.0.0.2"),
+        2000);
+    REQUIRE(nodesHandler.handler(kNewEndpoint) == nullptr);
+    REQUIRE(nodesHandler.droppedPacketsCount() == 1);
+
+    // endpoints of the known nodes are still served
+    REQUIRE(nodesHandler.handler(UDPEndpoint(kAddress, 1001)) != nullptr);
+}
+
+TEST_CASE("Testing IncomingNodesHandler endpoints distinguishing")
+{
+    using namespace incoming_remote_node_test;
+    Logger logger;
+    IncomingNodesHandler nodesHandler(logger);
+
+    // address of the second endpoint is greater by one, and its port is less by one
+    const UDPEndpoint kFirstEndpoint(boost::asio::ip::address_v4::from_string("10.0.0.1"), 1001);
+    const UDPEndpoint kSecondEndpoint(boost::asio::ip::address_v4::from_string("10.0.0.2"), 1000);
+    const auto kFirstNode = nodesHandler.handler(kFirstEndpoint);
+    const auto kSecondNode = nodesHandler.handler(kSecondEndpoint);
+    REQUIRE(kFirstNode != kSecondNode);
+    REQUIRE(kFirstNode->endpoint() == kFirstEndpoint);
+    REQUIRE(kSecondNode->endpoint() == kSecondEndpoint);
+}
@@ -0,0 +1,139 @@
+#include "../../catch.hpp"
+#include "../../../core/network/communicator/internal/incoming/MessageParser.h"
+#include "../../../core/network/communicator/internal/incoming/ParsingQueue.h"
+#include "../../../core/network/messages/general/PingMessage.h"
+#include "../../../core/common/workers/WorkersPool.h"
+
+namespace messages_parsing_test {
+
+pair<BytesShared, size_t> serializedPing(
+    ContractorID idOnReceiverSide)
+{
+    return PingMessage(idOnReceiverSide).serializeToBytes();
+}
+
+}
+
+TEST_CASE("Testing parsing queue")
+{
+    ParsingQueue queue;
+    REQUIRE(queue.isEmpty());
+    const auto kFirst = make_shared<PingMessage>(1);
+    const auto kSecond = make_shared<PingMessage>(2);
+    const auto kThird = make_shared<PingMessage>(3);
+
+    SECTION("Messages are delivered in order of collecting")
+    {
+        const auto kFirstNumber = queue.enqueue();
+        const auto kSecondNumber = queue.enqueue();
+        const auto kThirdNumber = queue.enqueue();
+        REQUIRE_FALSE(queue.isEmpty());
+
+        REQUIRE(queue.onParsed(kThirdNumber, kThird).empty());
+        REQUIRE(queue.onParsed(kSecondNumber, kSecond).empty());
+        REQUIRE(queue.onParsed(kFirstNumber, kFirst) == vector<Message::Shared>({kFirst, kSecond, kThird}));
+        REQUIRE(queue.isEmpty());
+    }
+
+    SECTION("Dropped message releases next ones")
+    {
+        const auto kFirstNumber = queue.enqueue();
+        const auto kSecondNumber = queue.enqueue();
+        REQUIRE(queue.onParsed(kSecondNumber, kSecond).empty());
+        REQUIRE(queue.onParsed(kFirstNumber, nullptr) == vector<Message::Shared>({kSecond}));
+        REQUIRE(queue.isEmpty());
+    }
+
+    SECTION("Queue waits for messages, collected after delivering")
+    {
+        REQUIRE(queue.onParsed(queue.enqueue(), kFirst) == vector<Message::Shared>({kFirst}));
+        REQUIRE(queue.isEmpty());
+        const auto kSecondNumber = queue.enqueue();
+        REQUIRE_FALSE(queue.isEmpty());
+        REQUIRE(queue.onParsed(kSecondNumber, kSecond) == vector<Message::Shared>({kSecond}));
+        REQUIRE(queue.isEmpty());
+    }
+}
+
+TEST_CASE("Testing messages parsing in workers pool")
+{
+    using namespace messages_parsing_test;
+
+    SECTION("Not encrypted message is parsed")
+    {
+        const auto kBytesAndCount = serializedPing(42);
+        const auto kParsed = MessagesParser::parse(
+            kBytesAndCount.first,
+            kBytesAndCount.second,
+            nullptr);
+        REQUIRE(kParsed.mError.empty());
+        REQUIRE(kParsed.mMessage != nullptr);
+        REQUIRE(kParsed.mMessage->typeID() == Message::General_Ping);
+        REQUIRE(static_pointer_cast<PingMessage>(kParsed.mMessage)->idOnReceiverSide == 42);
+    }
+
+    SECTION("Message of unknown type is dropped with reason")
+    {
+        auto bytesAndCount = serializedPing(42);
+        auto messageType = reinterpret_cast<Message::SerializedType*>(
+            bytesAndCount.first.get() + sizeof(ContractorID) + sizeof(SerializedProtocolVersion));
+        *messageType = numeric_limits<Message::SerializedType>::max();
+        const auto kParsed = MessagesParser::parse(
+            bytesAndCount.first,
+            bytesAndCount.second,
+            nullptr);
+        REQUIRE(kParsed.mMessage == nullptr);
+        REQUIRE(kParsed.mError.find("Unexpected message identifier") != string::npos);
+    }
+
+    SECTION("Messages, parsed in parallel, are delivered in order of collecting")
+    {
+        as::io_service mainIOService;
+        WorkersPool pool(mainIOService, 4);
+        ParsingQueue queue;
+        const size_t kMessagesCount = 1000;
+        vector<ContractorID> delivered;
+        size_t droppedCount = 0;
+
+        for (size_t idx = 0; idx < kMessagesCount; idx++) {
+            auto bytesAndCount = serializedPing((ContractorID)idx);
+            if (idx % 10 == 0) {
+                // every tenth message is malformed
+                bytesAndCount.first.get()[sizeof(ContractorID) + sizeof(SerializedProtocolVersion)] = 0xFF;
+                bytesAndCount.first.get()[sizeof(ContractorID) + sizeof(SerializedProtocolVersion) + 1] = 0xFF;
+            }
+            const auto kSequenceNumber = queue.enqueue();
+            auto onParsed = [&queue, &delivered, kSequenceNumber](Message::Shared message) {
+                for (const auto &deliveredMessage : queue.onParsed(kSequenceNumber, message)) {
+                    delivered.push_back(
+                        static_pointer_cast<PingMessage>(deliveredMessage)->idOnReceiverSide);
+                }
+            };
+            pool.post<MessagesParser::ParsedMessage>(
+                [bytesAndCount]() {
+                    return MessagesParser::parse(
+                        bytesAndCount.first,
+                        bytesAndCount.second,
+                        nullptr);
+                },
+                [onParsed, &droppedCount](MessagesParser::ParsedMessage parsedMessage) {
+                    if (parsedMessage.mMessage == nullptr) {
+                        droppedCount++;
+                    }
+                    onParsed(parsedMessage.mMessage);
+                },
+                [onParsed](const string &) {
+                    onParsed(nullptr);
+                });
+        }
+
+        while (!queue.isEmpty()) {
+            mainIOService.run_one();
+        }
+        REQUIRE(droppedCount == kMessagesCount / 10);
+        REQUIRE(delivered.size() == kMessagesCount - kMessagesCount / 10);
+        for (size_t idx = 1; idx < delivered.size(); idx++) {
+            REQUIRE(delivered[idx - 1] < delivered[idx]);
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#include "../../catch.hpp"
+#include "../../../core/transactions/transactions/history/HistoryPaymentsTransaction.h"
+
+#include <boost/filesystem.hpp>
+
+TEST_CASE("Testing HistoryPaymentsTransaction cursor")
+{
+    Logger logger;
+    auto directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        StorageHandler storageHandler(directory.string(), "storageDB", logger);
+
+        auto resultOf = [&](const string &commandBuffer) {
+            auto command = make_shared<HistoryPaymentsCommand>(
+                CommandUUID(),
+                commandBuffer);
+            HistoryPaymentsTransaction transaction(
+                command,
+                &storageHandler,
+                logger);
+            return transaction.run()->commandResult()->serialize();
+        };
+        auto endsWith = [](const string &value, const string &suffix) {
+            return value.size() >= suffix.size() and
+                value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+        };
+
+        SECTION("Lookup by uuid returns exhausted cursor")
+        {
+            REQUIRE(endsWith(resultOf(
+                "0\t10\tnull\tnull\tnull\tnull\t47183823-2574-4bfd-b411-99ed177d3e43\tnull\t0\tnull\n"),
+                "\tend\n"));
+
+            REQUIRE(endsWith(resultOf(
+                "0\t10\tnull\tnull\tnull\tnull\tnull\t47183823-2574-4bfd-b411-99ed177d3e43\t0\t123:45\n"),
+                "\tend\n"));
+        }
+
+        SECTION("Short page returns exhausted cursor")
+        {
+            REQUIRE(endsWith(resultOf(
+                "0\t10\tnull\tnull\tnull\tnull\tnull\tnull\t0\tnull\n"),
+                "\t0\tend\n"));
+        }
+
+        SECTION("Result without cursor has no cursor token")
+        {
+            REQUIRE(endsWith(resultOf(
+                "0\t10\tnull\tnull\tnull\tnull\tnull\tnull\t0\n"),
+                "\t200\t0\n"));
+        }
+    }
+    boost::filesystem::remove_all(directory);
+}